@@ -550,7 +550,7 @@ std::string CommsBundleField::commsDefAccessCodeInternal() const
 std::string CommsBundleField::commsDefAliasesCodeInternal() const
 {
     auto obj = bundleDslObj();
-    auto aliases = obj.aliases();
+    auto& aliases = obj.aliasesView();
     if (aliases.empty()) {
         return strings::emptyString();
     }
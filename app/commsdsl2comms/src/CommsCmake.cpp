@@ -16,11 +16,11 @@
 #include "CommsCmake.h"
 
 #include "CommsGenerator.h"
+#include "CommsPrecompiled.h"
 
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
-#include <fstream>
 #include <cassert>
 
 namespace strings = commsdsl::gen::strings;
@@ -51,11 +51,6 @@ bool CommsCmake::commsWriteInternal() const
             m_generator.getOutputDir(), strings::cmakeListsFileStr());    
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     const std::string Templ = 
         "cmake_minimum_required (VERSION 3.1)\n"
@@ -103,13 +98,14 @@ bool CommsCmake::commsWriteInternal() const
         "    find_package(LibComms REQUIRED)\n"
         "    target_link_libraries(#^#NAME#$# INTERFACE cc::comms)\n"
         "endif ()\n\n"
+        "#^#PRECOMPILED#$#\n"
         "if (\"${OPT_CMAKE_EXPORT_NAMESPACE}\" STREQUAL \"\")\n"
         "    set (OPT_CMAKE_EXPORT_NAMESPACE \"cc\")\n"
         "endif ()\n\n"
         "if (\"${OPT_CMAKE_EXPORT_CONFIG_NAME}\" STREQUAL \"\")\n"
         "    set (OPT_CMAKE_EXPORT_CONFIG_NAME \"#^#NAME#$#\")\n"
         "endif ()\n\n"
-        "install(TARGETS #^#NAME#$# EXPORT ${OPT_CMAKE_EXPORT_CONFIG_NAME}Config)\n"
+        "install(TARGETS #^#NAME#$##^#PRECOMPILED_TARGET#$# EXPORT ${OPT_CMAKE_EXPORT_CONFIG_NAME}Config#^#PRECOMPILED_INSTALL#$#)\n"
         "install(EXPORT ${OPT_CMAKE_EXPORT_CONFIG_NAME}Config\n"
         "    DESTINATION ${CMAKE_INSTALL_LIBDIR}/${OPT_CMAKE_EXPORT_CONFIG_NAME}/cmake\n"
         "    NAMESPACE ${OPT_CMAKE_EXPORT_NAMESPACE}::\n"
@@ -146,10 +142,26 @@ bool CommsCmake::commsWriteInternal() const
         {"CAP_NAME", util::strToUpper(m_generator.protocolSchema().mainNamespace())},
     };
 
-    stream << util::processTemplate(Templ, repl);
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    auto precompiledSources = CommsPrecompiled::commsRelSourcePaths(m_generator);
+    if (!precompiledSources.empty()) {
+        const std::string PrecompiledTempl = 
+            "# Define library with explicit instantiations of the protocol definition\n"
+            "add_library(#^#NAME#$#_precompiled STATIC\n"
+            "    #^#SOURCES#$#\n"
+            ")\n\n"
+            "target_link_libraries(#^#NAME#$#_precompiled PUBLIC #^#NAME#$#)\n";
+
+        util::ReplacementMap precompiledRepl = {
+            {"NAME", m_generator.protocolSchema().mainNamespace()},
+            {"SOURCES", util::strListToString(precompiledSources, "\n", "")},
+        };
+
+        repl["PRECOMPILED"] = util::processTemplate(PrecompiledTempl, precompiledRepl);
+        repl["PRECOMPILED_TARGET"] = ' ' + m_generator.protocolSchema().mainNamespace() + "_precompiled";
+        repl["PRECOMPILED_INSTALL"] = " ARCHIVE DESTINATION ${CMAKE_INSTALL_LIBDIR}";
+    }
+
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl))) {
         return false;
     }
     
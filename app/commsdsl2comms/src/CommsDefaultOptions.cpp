@@ -26,7 +26,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -95,15 +94,7 @@ bool writeFileInternal(
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
-    stream << data;
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, data);
 }
 
 const std::string& extOptionsTempl()
@@ -238,8 +229,8 @@ bool CommsDefaultOptions::commsWriteDefaultOptionsInternal() const
         {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
         {"CLASS_NAME", name},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsDefaultOptions, false)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     };
 
     if (!repl["EXTEND"].empty()) {
@@ -258,8 +249,8 @@ bool CommsDefaultOptions::commsWriteClientDefaultOptionsInternal() const
         {"DESC", "client"},
         {"NAME", "Client"},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsClientDefaultOptions, true)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     });
 
     if (!repl["EXTEND"].empty()) {
@@ -278,8 +269,8 @@ bool CommsDefaultOptions::commsWriteServerDefaultOptionsInternal() const
         {"DESC", "server"},
         {"NAME", "Server"},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsServerDefaultOptions, true)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     });
 
     if (!repl["EXTEND"].empty()) {
@@ -298,8 +289,8 @@ bool CommsDefaultOptions::commsWriteDataViewDefaultOptionsInternal() const
         {"DESC", "data view"},
         {"NAME", strings::dataViewStr()},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsDataViewDefaultOptions, true)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     });
 
     if (!repl["EXTEND"].empty()) {
@@ -326,8 +317,8 @@ bool CommsDefaultOptions::commsWriteBareMetalDefaultOptionsInternal() const
         {"NAME", strings::bareMetalStr()},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsBareMetalDefaultOptions, true)},
         {"EXTRA", std::move(extra)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     });
 
     if (!repl["EXTEND"].empty()) {
@@ -475,8 +466,8 @@ bool CommsDefaultOptions::commsWriteSingleMsgFactoryDefaultOptionsInternal(
         {"DESC", messagesDesc + " messages " + allocDesc + " allocation"},
         {"NAME", prefix},
         {"BODY", optionsBodyInternal(m_generator, &CommsNamespace::commsMsgFactoryDefaultOptions, true)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForOptions(name, m_generator) + strings::appendFileSuffixStr())},
     });
 
     if (!repl["EXTEND"].empty()) {
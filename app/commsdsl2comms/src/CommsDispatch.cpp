@@ -26,7 +26,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -38,6 +37,8 @@ namespace commsdsl2comms
 namespace 
 {
 
+const std::string NoInstrumentationStr("NoInstrumentation");
+const std::string StatsInstrumentationStr("StatsInstrumentation");
 
 auto getFileName(const std::string& desc = std::string())
 {
@@ -58,15 +59,7 @@ bool writeFileInternal(
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
-    stream << data;
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, data);
 }
 
 const std::string& dispatchTempl()
@@ -100,6 +93,60 @@ util::ReplacementMap initialRepl(CommsGenerator& generator)
 const std::string& singleMessagePerIdTempl()
 {
     static const std::string Templ =
+        "/// @brief Dispatch message object to its appropriate handling function\n"
+        "///     while invoking instrumentation policy around the handling.\n"
+        "/// @details Same as dispatch#^#NAME#$#Message(), but with extra\n"
+        "///     @b TInstrumentation template parameter.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @tparam TInstrumentation Dispatch instrumentation policy, invoked around\n"
+        "///     handling of every message, like @ref #^#NO_INSTRUMENTATION#$#.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] msg Message object held by reference to its interface class.\n"
+        "/// @param[in] handler Reference to handling object.\n"
+        "/// @see dispatch#^#NAME#$#Message()\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template<typename TProtOptions, typename TInstrumentation, typename TMsg, typename THandler>\n"
+        "auto dispatch#^#NAME#$#MessageInstrumented(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    TMsg& msg,\n"
+        "    THandler& handler) -> decltype(handler.handle(msg))\n"
+        "{\n"
+        "    using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
+        "    switch(id) {\n"
+        "    #^#CASES#$#\n"
+        "    default:\n"
+        "        break;\n"
+        "    };\n\n"
+        "    return handler.handle(msg);\n"
+        "}\n\n"
+        "/// @brief Dispatch message object to its appropriate handling function\n"
+        "///     while invoking instrumentation policy around the handling.\n"
+        "/// @details Same as dispatch#^#NAME#$#Message(), but with extra\n"
+        "///     @b TInstrumentation template parameter.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @tparam TInstrumentation Dispatch instrumentation policy, invoked around\n"
+        "///     handling of every message, like @ref #^#NO_INSTRUMENTATION#$#.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] idx Index of the message among messages with the same ID.\n"
+        "///     Expected to be @b 0.\n"
+        "/// @param[in] msg Message object held by reference to its interface class.\n"
+        "/// @param[in] handler Reference to handling object.\n"
+        "/// @see dispatch#^#NAME#$#Message()\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template<typename TProtOptions, typename TInstrumentation, typename TMsg, typename THandler>\n"
+        "auto dispatch#^#NAME#$#MessageInstrumented(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    std::size_t idx,\n"
+        "    TMsg& msg,\n"
+        "    THandler& handler) -> decltype(handler.handle(msg))\n"
+        "{\n"
+        "    if (idx != 0U) {\n"
+        "        return handler.handle(msg);\n"
+        "    }\n"
+        "    return dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, msg, handler);\n"
+        "}\n\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
         "/// @details @b switch statement based (on message ID) cast and dispatch functionality.\n"
         "/// @tparam TProtOptions Protocol options struct used for the application,\n"
@@ -130,13 +177,7 @@ const std::string& singleMessagePerIdTempl()
         "    TMsg& msg,\n"
         "    THandler& handler) -> decltype(handler.handle(msg))\n"
         "{\n"
-        "    using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
-        "    switch(id) {\n"
-        "    #^#CASES#$#\n"
-        "    default:\n"
-        "        break;\n"
-        "    };\n\n"
-        "    return handler.handle(msg);\n"
+        "    return dispatch#^#NAME#$#MessageInstrumented<TProtOptions, #^#NO_INSTRUMENTATION#$#>(id, msg, handler);\n"
         "}\n\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
         "/// @details Same as other dispatch#^#NAME#$#Message(), but receives extra @b idx parameter.\n"
@@ -202,6 +243,56 @@ const std::string& singleMessagePerIdTempl()
 const std::string& multipleMessagesPerIdTempl()
 {
     static const std::string Templ =
+        "/// @brief Dispatch message object to its appropriate handling function\n"
+        "///     while invoking instrumentation policy around the handling.\n"
+        "/// @details Same as dispatch#^#NAME#$#Message(), but with extra\n"
+        "///     @b TInstrumentation template parameter.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @tparam TInstrumentation Dispatch instrumentation policy, invoked around\n"
+        "///     handling of every message, like @ref #^#NO_INSTRUMENTATION#$#.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] idx Index of the message among messages with the same ID.\n"
+        "/// @param[in] msg Message object held by reference to its interface class.\n"
+        "/// @param[in] handler Reference to handling object.\n"
+        "/// @see dispatch#^#NAME#$#Message()\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template<typename TProtOptions, typename TInstrumentation, typename TMsg, typename THandler>\n"
+        "auto dispatch#^#NAME#$#MessageInstrumented(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    std::size_t idx,\n"
+        "    TMsg& msg,\n"
+        "    THandler& handler) -> decltype(handler.handle(msg))\n"
+        "{\n"
+        "    using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
+        "    switch(id) {\n"
+        "    #^#CASES#$#\n"
+        "    default:\n"
+        "        break;\n"
+        "    };\n\n"
+        "    return handler.handle(msg);\n"
+        "}\n\n"
+        "/// @brief Dispatch message object to its appropriate handling function\n"
+        "///     while invoking instrumentation policy around the handling.\n"
+        "/// @details Same as dispatch#^#NAME#$#Message(), but with extra\n"
+        "///     @b TInstrumentation template parameter.\n"
+        "/// @tparam TProtOptions Protocol options struct used for the application,\n"
+        "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @tparam TInstrumentation Dispatch instrumentation policy, invoked around\n"
+        "///     handling of every message, like @ref #^#NO_INSTRUMENTATION#$#.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] msg Message object held by reference to its interface class.\n"
+        "/// @param[in] handler Reference to handling object.\n"
+        "/// @see dispatch#^#NAME#$#Message()\n"
+        "/// @note Defined in #^#HEADERFILE#$#\n"
+        "template<typename TProtOptions, typename TInstrumentation, typename TMsg, typename THandler>\n"
+        "auto dispatch#^#NAME#$#MessageInstrumented(\n"
+        "    #^#MSG_ID_TYPE#$# id,\n"
+        "    TMsg& msg,\n"
+        "    THandler& handler) -> decltype(handler.handle(msg))\n"
+        "{\n"
+        "    return dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, 0U, msg, handler);\n"
+        "}\n\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
         "/// @details @b switch statement based (on message ID) cast and dispatch functionality.\n"
         "/// @tparam TProtOptions Protocol options struct used for the application,\n"
@@ -234,13 +325,7 @@ const std::string& multipleMessagesPerIdTempl()
         "    TMsg& msg,\n"
         "    THandler& handler) -> decltype(handler.handle(msg))\n"
         "{\n"
-        "    using InterfaceType = typename std::decay<decltype(msg)>::type;\n"
-        "    switch(id) {\n"
-        "    #^#CASES#$#\n"
-        "    default:\n"
-        "        break;\n"
-        "    };\n\n"
-        "    return handler.handle(msg);\n"
+        "    return dispatch#^#NAME#$#MessageInstrumented<TProtOptions, #^#NO_INSTRUMENTATION#$#>(id, idx, msg, handler);\n"
         "}\n\n"
         "/// @brief Dispatch message object to its appropriate handling function.\n"
         "/// @details Same as other dispatch#^#NAME#$#Message(), but without @b idx parameter.\n"
@@ -318,7 +403,9 @@ bool CommsDispatch::commsWriteInternal() const
         commsWriteClientDispatchInternal() &&
         commsWriteServerDispatchInternal() &&
         commsWritePlatformDispatchInternal() &&
-        commsWriteExtraDispatchInternal();
+        commsWriteExtraDispatchInternal() &&
+        commsWriteNoInstrumentationInternal() &&
+        commsWriteStatsInstrumentationInternal();
 }
 
 bool CommsDispatch::commsWriteDispatchInternal() const
@@ -579,12 +666,235 @@ bool CommsDispatch::commsWriteExtraDispatchInternal() const
     return true;
 }
 
+bool CommsDispatch::commsWriteNoInstrumentationInternal() const
+{
+    static const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the default dispatch instrumentation policy.\n\n"
+        "#pragma once\n\n"
+        "#include <cstddef>\n"
+        "#include \"#^#MSG_ID_HEADER#$#\"\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace dispatch\n"
+        "{\n\n"
+        "/// @brief Default dispatch instrumentation policy, which does nothing.\n"
+        "/// @details Every instrumentation policy is expected to define @b Scope\n"
+        "///     inner class. Its object is constructed right before handling of\n"
+        "///     the message and destructed right after the handling is complete.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "struct #^#NAME#$#\n"
+        "{\n"
+        "    /// @brief Scope of the single message handling.\n"
+        "    struct Scope\n"
+        "    {\n"
+        "        /// @brief Constructor invoked before the message handling.\n"
+        "        /// @param[in] id Numeric message ID.\n"
+        "        /// @param[in] metaIdx Index of the message in the messages metadata table\n"
+        "        ///     (see @b msgMetaAt() defined in @b MsgMeta.h).\n"
+        "        /// @param[in] msg Reference to the message object being handled.\n"
+        "        template <typename TMsg>\n"
+        "        Scope(#^#MSG_ID_TYPE#$# id, std::size_t metaIdx, const TMsg& msg)\n"
+        "        {\n"
+        "            static_cast<void>(id);\n"
+        "            static_cast<void>(metaIdx);\n"
+        "            static_cast<void>(msg);\n"
+        "        }\n"
+        "    };\n"
+        "};\n\n"
+        "} // namespace dispatch\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    util::ReplacementMap repl = initialRepl(m_generator);
+    repl.insert({
+        {"NAME", NoInstrumentationStr},
+        {"MSG_ID_HEADER", comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"MSG_ID_TYPE", comms::scopeForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"HEADERFILE", comms::relHeaderForDispatch(NoInstrumentationStr, m_generator)},
+    });
+
+    return writeFileInternal(NoInstrumentationStr, m_generator, util::processTemplate(Templ, repl, true));
+}
+
+bool CommsDispatch::commsWriteStatsInstrumentationInternal() const
+{
+    auto allMessages = m_generator.getAllMessages();
+    bool hasReferencedMessage = 
+        std::any_of(
+            allMessages.begin(), allMessages.end(),
+            [](auto* m)
+            {
+                return m->isReferenced();
+            });
+
+    if (!hasReferencedMessage) {
+        // No messages metadata table to rely on
+        return true;
+    }
+
+    static const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the dispatch instrumentation policy collecting statistics.\n\n"
+        "#pragma once\n\n"
+        "#include <atomic>\n"
+        "#include <chrono>\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <type_traits>\n"
+        "#include \"#^#MSG_ID_HEADER#$#\"\n"
+        "#include \"#^#MSG_META_HEADER#$#\"\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace dispatch\n"
+        "{\n\n"
+        "/// @brief Dispatch instrumentation policy collecting per message type statistics.\n"
+        "/// @details The statistics are kept per entry of the messages metadata table\n"
+        "///     (see @ref #^#PROT_NAMESPACE#$#::msgMetaAt()) and updated using relaxed atomic\n"
+        "///     operations. As the result they can be read from any other thread without locking.\n"
+        "/// @tparam TClock Clock used to measure handling latency.\n"
+        "/// @tparam TTag Extra tag type allowing definition of multiple independent statistics sets.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <typename TClock = std::chrono::steady_clock, typename TTag = void>\n"
+        "class #^#NAME#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Number of buckets in the latency histogram.\n"
+        "    /// @details Bucket @b 0 counts latencies below 1 nanosecond, bucket @b N counts\n"
+        "    ///     latencies in [2^(N-1), 2^N) nanoseconds range. The last bucket also\n"
+        "    ///     counts all the longer latencies.\n"
+        "    static const std::size_t LatencyBucketsCount = 40U;\n\n"
+        "    /// @brief Statistics of a single message type.\n"
+        "    struct Counters\n"
+        "    {\n"
+        "        std::atomic<std::uint64_t> count; ///< Number of handled messages.\n"
+        "        std::atomic<std::uint64_t> bytes; ///< Total serialisation length of handled messages.\n"
+        "        std::atomic<std::uint64_t> decodeErrors; ///< Number of reported decode errors.\n"
+        "        std::atomic<std::uint64_t> latency[LatencyBucketsCount]; ///< Histogram of handling latency.\n"
+        "    };\n\n"
+        "    /// @brief Scope of the single message handling.\n"
+        "    class Scope\n"
+        "    {\n"
+        "    public:\n"
+        "        /// @brief Constructor invoked before the message handling.\n"
+        "        /// @param[in] id Numeric message ID.\n"
+        "        /// @param[in] metaIdx Index of the message in the metadata table.\n"
+        "        /// @param[in] msg Reference to the message object being handled.\n"
+        "        template <typename TMsg>\n"
+        "        Scope(#^#MSG_ID_TYPE#$# id, std::size_t metaIdx, const TMsg& msg) :\n"
+        "            m_counters(countersAt(metaIdx))\n"
+        "        {\n"
+        "            static_cast<void>(id);\n"
+        "            if (m_counters == nullptr) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            m_counters->count.fetch_add(1U, std::memory_order_relaxed);\n"
+        "            m_counters->bytes.fetch_add(lengthOf(msg), std::memory_order_relaxed);\n"
+        "            m_start = TClock::now();\n"
+        "        }\n\n"
+        "        /// @brief Destructor invoked after the message handling.\n"
+        "        ~Scope()\n"
+        "        {\n"
+        "            if (m_counters == nullptr) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(TClock::now() - m_start);\n"
+        "            auto bucket = latencyBucketFor(static_cast<std::uint64_t>(duration.count()));\n"
+        "            m_counters->latency[bucket].fetch_add(1U, std::memory_order_relaxed);\n"
+        "        }\n\n"
+        "        Scope(const Scope&) = delete;\n"
+        "        Scope& operator=(const Scope&) = delete;\n\n"
+        "    private:\n"
+        "        Counters* m_counters = nullptr;\n"
+        "        typename TClock::time_point m_start;\n"
+        "    };\n\n"
+        "    /// @brief Access statistics of the message type.\n"
+        "    /// @param[in] metaIdx Index of the message in the metadata table,\n"
+        "    ///     must be less than @ref #^#PROT_NAMESPACE#$#::msgMetaCount().\n"
+        "    static const Counters& counters(std::size_t metaIdx)\n"
+        "    {\n"
+        "        return storage()[metaIdx];\n"
+        "    }\n\n"
+        "    /// @brief Report failure to decode message.\n"
+        "    /// @details The decoding happens before the dispatch, as the result it is\n"
+        "    ///     responsibility of the application to report it.\n"
+        "    /// @param[in] id Numeric message ID.\n"
+        "    /// @param[in] idx Index of the message among all the protocol messages with the same ID.\n"
+        "    static void recordDecodeError(#^#MSG_ID_TYPE#$# id, std::size_t idx = 0U)\n"
+        "    {\n"
+        "        auto metaIdx = #^#PROT_NAMESPACE#$#::msgMetaIndexOf(id) + idx;\n"
+        "        if ((#^#PROT_NAMESPACE#$#::msgMetaCount() <= metaIdx) ||\n"
+        "            (#^#PROT_NAMESPACE#$#::msgMetaAt(metaIdx).id != id)) {\n"
+        "            return;\n"
+        "        }\n\n"
+        "        storage()[metaIdx].decodeErrors.fetch_add(1U, std::memory_order_relaxed);\n"
+        "    }\n\n"
+        "    /// @brief Get index of the latency histogram bucket.\n"
+        "    static std::size_t latencyBucketFor(std::uint64_t nanoseconds)\n"
+        "    {\n"
+        "        std::size_t bucket = 0U;\n"
+        "        while ((nanoseconds != 0U) && (bucket < (LatencyBucketsCount - 1U))) {\n"
+        "            nanoseconds >>= 1U;\n"
+        "            ++bucket;\n"
+        "        }\n"
+        "        return bucket;\n"
+        "    }\n\n"
+        "private:\n"
+        "    using HasLengthTag = std::true_type;\n"
+        "    using NoLengthTag = std::false_type;\n\n"
+        "    static Counters* storage()\n"
+        "    {\n"
+        "        static Counters Values[#^#PROT_NAMESPACE#$#::MsgMetaTables<>::Count];\n"
+        "        return &Values[0];\n"
+        "    }\n\n"
+        "    static Counters* countersAt(std::size_t metaIdx)\n"
+        "    {\n"
+        "        if (#^#PROT_NAMESPACE#$#::msgMetaCount() <= metaIdx) {\n"
+        "            return nullptr;\n"
+        "        }\n\n"
+        "        return &storage()[metaIdx];\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    static std::uint64_t lengthOf(const TMsg& msg)\n"
+        "    {\n"
+        "        using Tag = typename std::conditional<TMsg::hasLength(), HasLengthTag, NoLengthTag>::type;\n"
+        "        return lengthOf(msg, Tag());\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    static std::uint64_t lengthOf(const TMsg& msg, HasLengthTag)\n"
+        "    {\n"
+        "        return static_cast<std::uint64_t>(msg.length());\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    static std::uint64_t lengthOf(const TMsg& msg, NoLengthTag)\n"
+        "    {\n"
+        "        static_cast<void>(msg);\n"
+        "        return 0U;\n"
+        "    }\n"
+        "};\n\n"
+        "} // namespace dispatch\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    util::ReplacementMap repl = initialRepl(m_generator);
+    repl.insert({
+        {"NAME", StatsInstrumentationStr},
+        {"MSG_ID_HEADER", comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"MSG_META_HEADER", comms::relHeaderForRoot("MsgMeta", m_generator)},
+        {"MSG_ID_TYPE", comms::scopeForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"HEADERFILE", comms::relHeaderForDispatch(StatsInstrumentationStr, m_generator)},
+    });
+
+    return writeFileInternal(StatsInstrumentationStr, m_generator, util::processTemplate(Templ, repl, true));
+}
+
 std::string CommsDispatch::commsIncludesInternal(const std::string& inputPrefix) const
 {
     util::StringsList incs = {
         comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator),
         comms::relHeaderForInput(inputPrefix + "Messages", m_generator),
         comms::relHeaderForOptions(strings::defaultOptionsClassStr(), m_generator),
+        comms::relHeaderForDispatch(NoInstrumentationStr, m_generator),
     };
 
     comms::prepareIncludeStatement(incs);
@@ -600,7 +910,7 @@ std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, Ch
     const commsdsl::gen::Message* secondMsg = nullptr;
     for (auto* m : allMessages) {
         assert(m != nullptr);
-        if (!func(*m)) {
+        if ((!m->isReferenced()) || (!func(*m))) {
             continue;
         }
         auto& mList = map[m->dslObj().id()];
@@ -631,6 +941,7 @@ std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, Ch
         {"MSG1_NAME", firstMsg != nullptr ? comms::className(firstMsg->dslObj().name()) : std::string("SomeMessage")},
         {"MSG2_NAME", secondMsg != nullptr ? comms::className(secondMsg->dslObj().name()) : std::string("SomeOtherMessage")},
         {"MSG_ID_TYPE", comms::scopeForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"NO_INSTRUMENTATION", comms::scopeForDispatch(NoInstrumentationStr, m_generator)},
         {"CASES", commsCasesCodeInternal(map)},
         {"DISPATCHER", commsMsgDispatcherCodeInternal(name)},
     };
@@ -641,6 +952,26 @@ std::string CommsDispatch::commsDispatchCodeInternal(const std::string& name, Ch
 
 std::string CommsDispatch::commsCasesCodeInternal(const MessagesMap& map) const
 {
+    // Index of the message in the metadata table (see CommsMsgId)
+    std::map<const commsdsl::gen::Message*, std::size_t> metaIndices;
+    auto allMessages = m_generator.getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        auto nextIdx = metaIndices.size();
+        metaIndices[m] = nextIdx;
+    }
+
+    auto metaIdxStrFunc = 
+        [&metaIndices](const commsdsl::gen::Message* m)
+        {
+            auto iter = metaIndices.find(m);
+            assert(iter != metaIndices.end());
+            return util::numToString(static_cast<std::uintmax_t>(iter->second));
+        };
+
     util::StringsList cases;
     for (auto& elem : map) {
         auto& msgList = elem.second;
@@ -651,6 +982,7 @@ std::string CommsDispatch::commsCasesCodeInternal(const MessagesMap& map) const
             "case #^#MSG_ID#$#:\n"
             "{\n"
             "    using MsgType = #^#MSG_TYPE#$#<InterfaceType, TProtOptions>;\n"
+            "    typename TInstrumentation::Scope instrumentationScope(id, #^#META_IDX#$#, static_cast<const MsgType&>(msg));\n"
             "    return handler.handle(static_cast<MsgType&>(msg));\n"
             "}";
 
@@ -658,6 +990,7 @@ std::string CommsDispatch::commsCasesCodeInternal(const MessagesMap& map) const
             util::ReplacementMap repl = {
                 {"MSG_ID", idStr},
                 {"MSG_TYPE", comms::scopeFor(*msgList.front(), m_generator)},
+                {"META_IDX", metaIdxStrFunc(msgList.front())},
             };
             cases.push_back(util::processTemplate(MsgCaseTempl, repl));
             continue;
@@ -668,6 +1001,7 @@ std::string CommsDispatch::commsCasesCodeInternal(const MessagesMap& map) const
             util::ReplacementMap repl = {
                 {"MSG_ID", util::numToString(idx)},
                 {"MSG_TYPE", comms::scopeFor(*msgList[idx], m_generator)},
+                {"META_IDX", metaIdxStrFunc(msgList[idx])},
             };
             offsetCases.push_back(util::processTemplate(MsgCaseTempl, repl));
         }
@@ -733,24 +1067,26 @@ std::string CommsDispatch::commsMsgDispatcherCodeInternal(const std::string& inp
         "///     @b comms::processAllWithDispatchViaDispatcher() function (or similar).\n"
         "/// @tparam TProtOptions Protocol options struct used for the application,\n"
         "///     like @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @tparam TInstrumentation Dispatch instrumentation policy, invoked around\n"
+        "///     handling of every message, like @ref #^#NO_INSTRUMENTATION#$#.\n"
         "/// @headerfile #^#HEADERFILE#$#\n"
-        "template <typename TProtOptions = #^#DEFAULT_OPTIONS#$#>\n"
+        "template <typename TProtOptions = #^#DEFAULT_OPTIONS#$#, typename TInstrumentation = #^#NO_INSTRUMENTATION#$#>\n"
         "struct #^#NAME#$#MsgDispatcher\n"
         "{\n"
         "    /// @brief Class detection tag\n"
         "    using MsgDispatcherTag = void;\n\n"
         "    /// @brief Dispatch message to its handler.\n"
-        "    /// @details Uses appropriate @ref dispatch#^#NAME#$#Message() function.\n"
+        "    /// @details Uses appropriate @ref dispatch#^#NAME#$#MessageInstrumented() function.\n"
         "    /// @param[in] id ID of the message.\n"
         "    /// @param[in] idx Index (or offset) of the message among those having the same numeric ID.\n"
         "    /// @param[in] msg Reference to message object.\n"
         "    /// @param[in] handler Reference to handler object.\n"
-        "    /// @return What the @ref dispatch#^#NAME#$#Message() function returns.\n"
+        "    /// @return What the @ref dispatch#^#NAME#$#MessageInstrumented() function returns.\n"
         "    template <typename TMsg, typename THandler>\n"
         "    static auto dispatch(#^#MAIN_NS#$#::MsgId id, std::size_t idx, TMsg& msg, THandler& handler) ->\n"
-        "        decltype(#^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#Message<TProtOptions>(id, idx, msg, handler))\n"
+        "        decltype(#^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, idx, msg, handler))\n"
         "    {\n"
-        "        return #^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#Message<TProtOptions>(id, idx, msg, handler);\n"
+        "        return #^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, idx, msg, handler);\n"
         "    }\n\n"
         "    /// @brief Complementary dispatch function.\n"
         "    /// @details Same as other dispatch without @b TAllMessages template parameter,\n"
@@ -762,16 +1098,16 @@ std::string CommsDispatch::commsMsgDispatcherCodeInternal(const std::string& inp
         "        return dispatch(id, idx, msg, handler);\n"
         "    }\n\n"
         "    /// @brief Dispatch message to its handler.\n"
-        "    /// @details Uses appropriate @ref dispatch#^#NAME#$#Message() function.\n"
+        "    /// @details Uses appropriate @ref dispatch#^#NAME#$#MessageInstrumented() function.\n"
         "    /// @param[in] id ID of the message.\n"
         "    /// @param[in] msg Reference to message object.\n"
         "    /// @param[in] handler Reference to handler object.\n"
-        "    /// @return What the @ref dispatch#^#NAME#$#Message() function returns.\n"
+        "    /// @return What the @ref dispatch#^#NAME#$#MessageInstrumented() function returns.\n"
         "    template <typename TMsg, typename THandler>\n"
         "    static auto dispatch(#^#MAIN_NS#$#::MsgId id, TMsg& msg, THandler& handler) ->\n"
-        "        decltype(#^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#Message<TProtOptions>(id, msg, handler))\n"
+        "        decltype(#^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, msg, handler))\n"
         "    {\n"
-        "        return #^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#Message<TProtOptions>(id, msg, handler);\n"
+        "        return #^#MAIN_NS#$#::dispatch::dispatch#^#NAME#$#MessageInstrumented<TProtOptions, TInstrumentation>(id, msg, handler);\n"
         "    }\n\n"
         "    /// @brief Complementary dispatch function.\n"
         "    /// @details Same as other dispatch without @b TAllMessages template parameter,\n"
@@ -796,6 +1132,7 @@ std::string CommsDispatch::commsMsgDispatcherCodeInternal(const std::string& inp
         {"MAIN_NS", m_generator.currentSchema().mainNamespace()},
         {"DEFAULT_OPTIONS", comms::scopeForOptions(strings::defaultOptionsStr(), m_generator)},
         {"HEADERFILE", comms::relHeaderForDispatch(getFileName(inputPrefix), m_generator)},
+        {"NO_INSTRUMENTATION", comms::scopeForDispatch(NoInstrumentationStr, m_generator)},
     };
     return util::processTemplate(Templ, repl);
 }
@@ -46,6 +46,8 @@ private:
     bool commsWriteServerDispatchInternal() const;
     bool commsWritePlatformDispatchInternal() const;
     bool commsWriteExtraDispatchInternal() const;
+    bool commsWriteNoInstrumentationInternal() const;
+    bool commsWriteStatsInstrumentationInternal() const;
 
     std::string commsIncludesInternal(const std::string& inputPrefix) const;
     std::string commsDispatchCodeInternal(const std::string& name, CheckMsgFunc&& func) const;
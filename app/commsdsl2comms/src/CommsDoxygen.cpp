@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -54,20 +53,7 @@ bool writeFileInternal(const std::string& name, const std::string& str, CommsGen
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
-    stream << str;
-    stream.flush();
-
-    if (!stream.good()) {
-        generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-    return true;    
+    return generator.writeFile(filePath, str);
 }
 
 } // namespace 
@@ -239,7 +225,7 @@ bool CommsDoxygen::commsWriteConfInternal() const
 
     util::ReplacementMap repl = {
         {"PROJ_NAME", m_generator.currentSchema().schemaName()},
-        {"APPEND", util::readFileContents(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
     };
 
     return writeFileInternal(FileName, util::processTemplate(Templ, repl), m_generator);
@@ -512,7 +498,7 @@ bool CommsDoxygen::commsWriteNamespacesInternal() const
 
     util::ReplacementMap repl = {
         {"SCHEMAS", util::strListToString(elems, "", "")},
-        {"APPEND", util::readFileContents(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
     };
 
     return writeFileInternal(FileName, util::processTemplate(Templ, repl), m_generator);
@@ -556,7 +542,7 @@ bool CommsDoxygen::commsWriteMainpageInternal() const
         {"DISPATCH_DOC", commsDispatchDocInternal()},
         {"CUSTOMIZE_DOC", commsCustomizeDocInternal()},
         {"VERSION_DOC", commsVersionDocInternal()},
-        {"APPEND", util::readFileContents(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForDoc(FileName, m_generator) + strings::appendFileSuffixStr())}
     };
 
     return writeFileInternal(FileName, util::processTemplate(Templ, repl), m_generator);
@@ -675,6 +661,10 @@ std::string CommsDoxygen::commsFrameDocInternal() const
 
     util::StringsList list;
     for (auto* f : frames) {
+        if (!f->isReferenced()) {
+            continue;
+        }
+
         list.push_back(
             "/// @li @ref " + comms::scopeFor(*f, m_generator) +
             " (from @b " + comms::relHeaderPathFor(*f, m_generator) + " header file).");
@@ -17,6 +17,7 @@
 
 #include "CommsGenerator.h"
 
+#include "commsdsl/gen/IntField.h"
 #include "commsdsl/gen/comms.h"
 #include "commsdsl/gen/util.h"
 #include "commsdsl/gen/strings.h"
@@ -150,6 +151,46 @@ commsdsl::gen::util::StringsList CommsEnumField::commsEnumValues() const
     return valuesStrings;    
 }
 
+std::string CommsEnumField::commsVariantPropKeyType() const
+{
+    return commsDefBaseClassInternal(true);
+}
+
+bool CommsEnumField::commsVariantIsPropKeyEquivalent(const CommsEnumField& other) const
+{
+    return commsVariantPropKeyType() == other.commsVariantPropKeyType();
+}
+
+bool CommsEnumField::commsVariantIsUnsignedPropKey() const
+{
+    return commsdsl::gen::IntField::isUnsignedType(enumDslObj().type());
+}
+
+CommsEnumField::ValueRangesList CommsEnumField::commsVariantPropKeyValidRanges() const
+{
+    ValueRangesList result;
+    auto obj = enumDslObj();
+    if ((!obj.isFailOnInvalid()) || obj.isPseudo() || commsHasGeneratedReadCode()) {
+        return result;
+    }
+
+    bool validCheckVersion =
+        generator().schemaOf(*this).versionDependentCode() &&
+        obj.validCheckVersion();
+
+    if (validCheckVersion) {
+        // Version dependent validity, don't bother
+        return result;
+    }
+
+    result.reserve(m_validRanges.size());
+    for (auto& r : m_validRanges) {
+        result.emplace_back(r.m_min, r.m_max);
+    }
+
+    return result;
+}
+
 bool CommsEnumField::prepareImpl()
 {
     return 
@@ -243,27 +284,7 @@ std::string CommsEnumField::commsDefExtraDoxigenImpl() const
 
 std::string CommsEnumField::commsDefBaseClassImpl() const
 {
-    static const std::string Templ = 
-        "comms::field::EnumValue<\n"
-        "    #^#PROT_NAMESPACE#$#::field::FieldBase<#^#FIELD_BASE_PARAMS#$#>,\n"
-        "    #^#COMMON_SCOPE#$#::ValueType#^#COMMA#$#\n"
-        "    #^#FIELD_OPTS#$#\n"
-        ">";
-
-    auto& gen = generator();
-    auto dslObj = enumDslObj();
-    util::ReplacementMap repl = {
-        {"PROT_NAMESPACE", gen.schemaOf(*this).mainNamespace()},
-        {"FIELD_BASE_PARAMS", commsFieldBaseParams(dslObj.endian())},
-        {"COMMON_SCOPE", comms::commonScopeFor(*this, gen)},
-        {"FIELD_OPTS", commsDefFieldOptsInternal()}
-    };         
-
-    if (!repl["FIELD_OPTS"].empty()) {
-        repl["COMMA"] = ",";
-    }
-
-    return util::processTemplate(Templ, repl);
+    return commsDefBaseClassInternal();
 }
 
 std::string CommsEnumField::commsDefPublicCodeImpl() const
@@ -1094,15 +1115,45 @@ std::string CommsEnumField::commsCommonValueNameBinSearchPairsInternal() const
     return util::strListToString(names, ",\n", "");
 }
 
-std::string CommsEnumField::commsDefFieldOptsInternal() const
+std::string CommsEnumField::commsDefBaseClassInternal(bool variantPropKey) const
+{
+    static const std::string Templ = 
+        "comms::field::EnumValue<\n"
+        "    #^#PROT_NAMESPACE#$#::field::FieldBase<#^#FIELD_BASE_PARAMS#$#>,\n"
+        "    #^#COMMON_SCOPE#$#::ValueType#^#COMMA#$#\n"
+        "    #^#FIELD_OPTS#$#\n"
+        ">";
+
+    auto& gen = generator();
+    auto dslObj = enumDslObj();
+    util::ReplacementMap repl = {
+        {"PROT_NAMESPACE", gen.schemaOf(*this).mainNamespace()},
+        {"FIELD_BASE_PARAMS", commsFieldBaseParams(dslObj.endian())},
+        {"COMMON_SCOPE", comms::commonScopeFor(*this, gen)},
+        {"FIELD_OPTS", commsDefFieldOptsInternal(variantPropKey)}
+    };         
+
+    if (!repl["FIELD_OPTS"].empty()) {
+        repl["COMMA"] = ",";
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string CommsEnumField::commsDefFieldOptsInternal(bool variantPropKey) const
 {
     util::StringsList opts;
 
     commsAddFieldDefOptions(opts);
-    commsAddDefaultValueOptInternal(opts);
+    if (!variantPropKey) {
+        commsAddDefaultValueOptInternal(opts);
+    }
+
     commsAddLengthOptInternal(opts);
-    commsAddValidRangesOptInternal(opts);
-    commsAddAvailableLengthLimitOptInternal(opts);
+    if (!variantPropKey) {
+        commsAddValidRangesOptInternal(opts);
+        commsAddAvailableLengthLimitOptInternal(opts);
+    }
 
     return util::strListToString(opts, ",\n", "");
 }
@@ -20,6 +20,8 @@
 #include "commsdsl/gen/EnumField.h"
 #include "commsdsl/gen/util.h"
 
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace commsdsl2comms
@@ -33,7 +35,14 @@ class CommsEnumField final : public commsdsl::gen::EnumField, public CommsField
 public:
     CommsEnumField(CommsGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent);
 
+    using ValueRange = std::pair<std::intmax_t, std::intmax_t>;
+    using ValueRangesList = std::vector<ValueRange>;
+
     commsdsl::gen::util::StringsList commsEnumValues() const;
+    std::string commsVariantPropKeyType() const;
+    bool commsVariantIsPropKeyEquivalent(const CommsEnumField& other) const;
+    bool commsVariantIsUnsignedPropKey() const;
+    ValueRangesList commsVariantPropKeyValidRanges() const;
 
 protected:
     // Base overrides
@@ -77,7 +86,8 @@ private:
     std::string commsCommonValueNamesMapBinSearchBodyInternal() const;
     std::string commsCommonBigUnsignedValueNameBinSearchPairsInternal() const;
     std::string commsCommonValueNameBinSearchPairsInternal() const;
-    std::string commsDefFieldOptsInternal() const;
+    std::string commsDefBaseClassInternal(bool variantPropKey = false) const;
+    std::string commsDefFieldOptsInternal(bool variantPropKey = false) const;
     std::string commsDefValueNameMapInternal() const;
     std::string commsDefValueNameFuncCodeInternal() const;
     std::string commsDefValueNamesMapFuncCodeInternal() const;
@@ -27,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -56,13 +55,13 @@ bool isOverrideCodeRequired(commsdsl::parse::OverrideType value)
         (value == commsdsl::parse::OverrideType_Extend);
 }
 
-void readCustomCodeInternal(const std::string& codePath, std::string& code)
+void readCustomCodeInternal(const commsdsl::gen::Generator& generator, const std::string& codePath, std::string& code)
 {
-    if (!util::isFileReadable(codePath)) {
+    if (!generator.isCodeFileReadable(codePath)) {
         return;
     }
 
-    code = util::readFileContents(codePath);
+    code = generator.readCodeFile(codePath);
 }
 
 } // namespace 
@@ -114,13 +113,13 @@ bool CommsField::commsPrepare()
         return false;
     }
 
-    readCustomCodeInternal(codePathPrefix + strings::incFileSuffixStr(), m_customCode.m_inc);
-    readCustomCodeInternal(codePathPrefix + strings::publicFileSuffixStr(), m_customCode.m_public);
-    readCustomCodeInternal(codePathPrefix + strings::protectedFileSuffixStr(), m_customCode.m_protected);
-    readCustomCodeInternal(codePathPrefix + strings::privateFileSuffixStr(), m_customCode.m_private);
-    readCustomCodeInternal(codePathPrefix + strings::extendFileSuffixStr(), m_customCode.m_extend);
-    readCustomCodeInternal(codePathPrefix + strings::appendFileSuffixStr(), m_customCode.m_append);
-    readCustomCodeInternal(codePathPrefix + strings::constructFileSuffixStr(), m_customConstruct);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::incFileSuffixStr(), m_customCode.m_inc);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::publicFileSuffixStr(), m_customCode.m_public);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::protectedFileSuffixStr(), m_customCode.m_protected);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::privateFileSuffixStr(), m_customCode.m_private);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::extendFileSuffixStr(), m_customCode.m_extend);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::appendFileSuffixStr(), m_customCode.m_append);
+    readCustomCodeInternal(m_field.generator(), codePathPrefix + strings::constructFileSuffixStr(), m_customConstruct);
     return true;
 }
 
@@ -414,6 +413,37 @@ bool CommsField::commsHasCustomLength(bool deepCheck) const
     return commsHasCustomLengthDeepImpl();
 }
 
+bool CommsField::commsHasCustomValueAccess() const
+{
+    return 
+        (!m_customCode.m_value.empty()) ||
+        (!m_customCode.m_read.empty()) ||
+        (!m_customCode.m_refresh.empty()) ||
+        (!commsDefReadFuncBodyImpl().empty()) ||
+        (!commsDefRefreshFuncBodyImpl().empty()) ||
+        commsHasCustomLength(false);
+}
+
+bool CommsField::commsHasCustomCode() const
+{
+    auto& c = m_customCode;
+    return
+        (!c.m_value.empty()) ||
+        (!c.m_read.empty()) ||
+        (!c.m_write.empty()) ||
+        (!c.m_refresh.empty()) ||
+        (!c.m_length.empty()) ||
+        (!c.m_valid.empty()) ||
+        (!c.m_name.empty()) ||
+        (!c.m_inc.empty()) ||
+        (!c.m_public.empty()) ||
+        (!c.m_protected.empty()) ||
+        (!c.m_private.empty()) ||
+        (!c.m_extend.empty()) ||
+        (!c.m_append.empty()) ||
+        (!m_customConstruct.empty());
+}
+
 const CommsField* CommsField::commsFindSibling(const std::string& name) const
 {
     auto* parent = m_field.getParent();
@@ -859,7 +889,7 @@ bool CommsField::commsPrepareOverrideInternal(
             break;
         }
 
-        auto contents = util::readFileContents(codePathPrefix + suffix);
+        auto contents = m_field.generator().readCodeFile(codePathPrefix + suffix);
         if (contents.empty()) {
             break;
         }
@@ -894,12 +924,6 @@ bool CommsField::commsWriteCommonInternal() const
     auto includes = commsCommonIncludes();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -921,9 +945,7 @@ bool CommsField::commsWriteCommonInternal() const
         {"DEF", commsCommonCode()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool CommsField::commsWriteDefInternal() const
@@ -937,12 +959,6 @@ bool CommsField::commsWriteDefInternal() const
     auto includes = commsDefIncludes();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -966,9 +982,7 @@ bool CommsField::commsWriteDefInternal() const
         {"DEF", commsDefCode()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string CommsField::commsFieldDefCodeInternal() const
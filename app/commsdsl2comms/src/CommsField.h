@@ -88,6 +88,9 @@ public:
     bool commsHasCustomValue() const;
     bool commsHasCustomValid() const;
     bool commsHasCustomLength(bool deepCheck = true) const;
+    bool commsHasCustomValueAccess() const;
+    bool commsHasCustomCode() const;
+    bool commsIsFieldCustomizable() const;
     const CommsField* commsFindSibling(const std::string& name) const;
 
 protected:
@@ -135,7 +138,6 @@ protected:
     std::string commsFieldBaseParams(commsdsl::parse::Endian endian) const;
     void commsAddFieldDefOptions(commsdsl::gen::util::StringsList& opts) const;
     void commsAddFieldTypeOption(commsdsl::gen::util::StringsList& opts) const;
-    bool commsIsFieldCustomizable() const;
     bool commsIsExtended() const;
 
 private:
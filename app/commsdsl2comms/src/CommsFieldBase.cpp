@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 #include "commsdsl/gen/comms.h"
 
-#include <fstream>
 #include <cassert>
 
 namespace comms = commsdsl::gen::comms;
@@ -55,12 +54,6 @@ bool CommsFieldBase::commsWriteInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ = 
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -94,11 +87,7 @@ bool CommsFieldBase::commsWriteInternal() const
         {"OPTIONS", util::strListToString(options, ",\n", "")},
     };        
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
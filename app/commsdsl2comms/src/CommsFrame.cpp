@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -38,6 +37,8 @@ namespace commsdsl2comms
 namespace 
 {
 
+const std::string PipelineSuffixStr("Pipeline");
+
 bool hasIdLayerInternal(const CommsFrame::CommsLayersList& commsLayers)
 {
     return
@@ -134,7 +135,8 @@ bool CommsFrame::writeImpl() const
 {
     return 
         commsWriteCommonInternal() &&
-        commsWriteDefInternal();
+        commsWriteDefInternal() &&
+        commsWritePipelineInternal();
 }
 
 bool CommsFrame::commsWriteCommonInternal() const
@@ -154,12 +156,6 @@ bool CommsFrame::commsWriteCommonInternal() const
         return false;
     }    
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -191,9 +187,7 @@ bool CommsFrame::commsWriteCommonInternal() const
         {"BODY", commsCommonBodyInternal()},
     };      
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();      
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool CommsFrame::commsWriteDefInternal() const
@@ -209,18 +203,10 @@ bool CommsFrame::commsWriteDefInternal() const
         return false;
     }    
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     auto inputCodePrefix = comms::inputCodePathFor(*this, gen);
-    auto replaceCode = util::readFileContents(inputCodePrefix + strings::replaceFileSuffixStr());
+    auto replaceCode = gen.readCodeFile(inputCodePrefix + strings::replaceFileSuffixStr());
     if (!replaceCode.empty()) {
-        stream << replaceCode;
-        stream.flush();
-        return stream.good();
+        return gen.writeFile(filePath, replaceCode);
     }
 
     static const std::string Templ =
@@ -275,7 +261,7 @@ bool CommsFrame::commsWriteDefInternal() const
         "#^#NS_END#$#\n"
         "#^#APPEND#$#\n";
 
-    auto extendCode = util::readFileContents(inputCodePrefix + strings::extendFileSuffixStr());
+    auto extendCode = gen.readCodeFile(inputCodePrefix + strings::extendFileSuffixStr());
     util::ReplacementMap repl =  {
         {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
         {"INCLUDES", commsDefIncludesInternal()},
@@ -290,20 +276,18 @@ bool CommsFrame::commsWriteDefInternal() const
         {"INPUT_MESSAGES", commsDefInputMessagesParamInternal()},
         {"ACCESS_FUNCS_DOC", commsDefAccessDocInternal()},
         {"LAYERS_ACCESS_LIST", commsDefAccessListInternal()},
-        {"PUBLIC", util::readFileContents(inputCodePrefix + strings::publicFileSuffixStr())},
+        {"PUBLIC", gen.readCodeFile(inputCodePrefix + strings::publicFileSuffixStr())},
         {"PROTECTED", commsDefProtectedInternal()},
         {"PRIVATE", commsDefPrivateInternal()},
         {"EXTEND", extendCode},
-        {"APPEND", util::readFileContents(comms::inputCodePathFor(*this, gen) + strings::appendFileSuffixStr())}
+        {"APPEND", gen.readCodeFile(comms::inputCodePathFor(*this, gen) + strings::appendFileSuffixStr())}
     };
 
     if (!extendCode.empty()) {
         repl["ORIG"] = strings::origSuffixStr();
     }
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string CommsFrame::commsCommonIncludesInternal() const
@@ -460,7 +444,7 @@ std::string CommsFrame::commsDefAccessListInternal() const
 
 std::string CommsFrame::commsDefProtectedInternal() const
 {
-    auto code = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::protectedFileSuffixStr());
+    auto code = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::protectedFileSuffixStr());
     if (code.empty()) {
         return strings::emptyString();
     }
@@ -477,7 +461,7 @@ std::string CommsFrame::commsDefProtectedInternal() const
 
 std::string CommsFrame::commsDefPrivateInternal() const
 {
-    auto code = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::privateFileSuffixStr());
+    auto code = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::privateFileSuffixStr());
     if (code.empty()) {
         return strings::emptyString();
     }
@@ -533,4 +517,448 @@ std::string CommsFrame::commsCustomizationOptionsInternal(
     return util::processTemplate(Templ, repl);    
 }
 
+bool CommsFrame::commsWritePipelineInternal() const
+{
+    auto& gen = static_cast<const CommsGenerator&>(generator());
+    if (!gen.commsGetFramePipelineEnabled()) {
+        return true;
+    }
+
+    auto inputCodePrefix = comms::inputCodePathFor(*this, gen);
+    if (!gen.readCodeFile(inputCodePrefix + strings::replaceFileSuffixStr()).empty()) {
+        gen.logger().info("Definition of the \"" + dslObj().name() + "\" frame is replaced, its pipeline is not generated.");
+        return true;
+    }
+
+    auto framing = commsPipelineFramingInternal();
+    if (framing.empty()) {
+        gen.logger().info(
+            "The \"" + dslObj().name() + "\" frame doesn't have a size layer preceded only by "
+            "sync, checksum, id or value layers, its pipeline is not generated.");
+        return true;
+    }
+
+    auto filePath = comms::headerPathFor(*this, gen);
+    assert(strings::cppHeaderSuffixStr().size() < filePath.size());
+    filePath.insert(filePath.size() - strings::cppHeaderSuffixStr().size(), PipelineSuffixStr);
+
+    gen.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!gen.createDirectory(dirPath)) {
+        return false;
+    }
+
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the parallel decoding pipeline of\n"
+        "///     <b>\"#^#CLASS_NAME#$#\"</b> frame.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#include <algorithm>\n"
+        "#include <condition_variable>\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <iterator>\n"
+        "#include <mutex>\n"
+        "#include <thread>\n"
+        "#include <vector>\n\n"
+        "#include \"comms/ErrorStatus.h\"\n"
+        "#include \"comms/iterator.h\"\n"
+        "#include \"#^#FRAME_HEADER#$#\"\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Parallel in-order decoding pipeline of the @ref #^#SCOPE#$# frame.\n"
+        "/// @details The input buffer is split into frames by reading only the fields\n"
+        "///     of the layers preceding the size one (sync, checksum, etc...). The\n"
+        "///     split frames are fully decoded and validated by the worker threads\n"
+        "///     while the calling thread keeps splitting. The decoded messages are\n"
+        "///     dispatched to the handler from the calling thread in their original order.\n"
+        "///     The number of split but not yet dispatched frames is bounded, the\n"
+        "///     splitting is paused until the earliest pending message is dispatched.\n"
+        "///\n"
+        "///     The worker threads are started by the constructor and joined by the\n"
+        "///     destructor, the processing calls only hand them the split frames.\n"
+        "///     Every worker thread uses its own frame object, which is expected to\n"
+        "///     use dynamic memory allocation of the messages. The application must\n"
+        "///     link with the platform threads library (@b Threads::Threads in CMake).\n"
+        "/// @tparam TMessage Common interface class of all the messages, expected to\n"
+        "///     support polymorphic dispatch.\n"
+        "#^#INPUT_MESSAGES_DOC#$#\n"
+        "/// @tparam TOpt Frame definition options\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <\n"
+        "   typename TMessage,\n"
+        "   #^#INPUT_MESSAGES#$#\n"
+        "   typename TOpt = #^#OPTIONS#$#\n"
+        ">\n"
+        "class #^#CLASS_NAME#$##^#SUFFIX#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Type of the frame used to decode the messages.\n"
+        "    using Frame = #^#FRAME_TYPE#$#;\n\n"
+        "    /// @brief Smart pointer to the decoded message.\n"
+        "    using MsgPtr = typename Frame::MsgPtr;\n\n"
+        "    /// @brief Constructor\n"
+        "    /// @param[in] threadsCount Number of the decoding worker threads, @b 0 means\n"
+        "    ///     number of concurrent threads supported by the hardware.\n"
+        "    /// @param[in] maxPendingFrames Maximal number of the split frames waiting to be\n"
+        "    ///     dispatched, bounds the memory used by the pipeline.\n"
+        "    explicit #^#CLASS_NAME#$##^#SUFFIX#$#(unsigned threadsCount = 0U, std::size_t maxPendingFrames = 1024U) :\n"
+        "        m_threadsCount(threadsCount),\n"
+        "        m_slots(std::max(maxPendingFrames, static_cast<std::size_t>(1U)))\n"
+        "    {\n"
+        "        if (m_threadsCount == 0U) {\n"
+        "            m_threadsCount = std::max(std::thread::hardware_concurrency(), 1U);\n"
+        "        }\n\n"
+        "        m_workers.reserve(m_threadsCount);\n"
+        "        for (auto idx = 0U; idx < m_threadsCount; ++idx) {\n"
+        "            m_workers.emplace_back([this]() { decodeLoop(); });\n"
+        "        }\n"
+        "    }\n\n"
+        "    /// @brief Copy constructor is deleted\n"
+        "    #^#CLASS_NAME#$##^#SUFFIX#$#(const #^#CLASS_NAME#$##^#SUFFIX#$#&) = delete;\n\n"
+        "    /// @brief Destructor, stops and joins the worker threads.\n"
+        "    ~#^#CLASS_NAME#$##^#SUFFIX#$#()\n"
+        "    {\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> guard(m_mutex);\n"
+        "            m_stopped = true;\n"
+        "        }\n\n"
+        "        m_decodeCond.notify_all();\n"
+        "        for (auto& t : m_workers) {\n"
+        "            t.join();\n"
+        "        }\n"
+        "    }\n\n"
+        "    /// @brief Copy assignment is deleted\n"
+        "    #^#CLASS_NAME#$##^#SUFFIX#$#& operator=(const #^#CLASS_NAME#$##^#SUFFIX#$#&) = delete;\n\n"
+        "    /// @brief Retrieve length of the frame at the beginning of the buffer.\n"
+        "    /// @details Reads only the fields of the layers preceding the size one,\n"
+        "    ///     no message object is created and the payload is not decoded.\n"
+        "    /// @param[in] buf Input buffer.\n"
+        "    /// @param[in] len Number of bytes in the input buffer.\n"
+        "    /// @param[out] frameLen Length of the frame.\n"
+        "    /// @return @b comms::ErrorStatus::Success when the whole frame is in the buffer,\n"
+        "    ///     @b comms::ErrorStatus::NotEnoughData when more data is required,\n"
+        "    ///     other error status when the buffer doesn't start with a valid frame.\n"
+        "    static comms::ErrorStatus readFrameLength(const std::uint8_t* buf, std::size_t len, std::size_t& frameLen)\n"
+        "    {\n"
+        "        auto iter = buf;\n"
+        "        std::size_t suffixLen = 0U;\n"
+        "        auto es = comms::ErrorStatus::Success;\n"
+        "        #^#FRAMING#$#\n"
+        "    }\n\n"
+        "    /// @brief Process all the complete frames in the input buffer.\n"
+        "    /// @details Produces the same result as @b comms::processAllWithDispatch().\n"
+        "    ///     The bytes that don't start a valid frame are skipped one by one and the\n"
+        "    ///     frames failing the full decoding are dropped. When the full decoding\n"
+        "    ///     doesn't end where the frame was split (for example the checksum\n"
+        "    ///     doesn't match due to a corrupted size), the rest of the buffer is\n"
+        "    ///     split again starting from the position where @b comms::processAllWithDispatch()\n"
+        "    ///     continues (one byte after the beginning of the frame for the protocol errors).\n"
+        "    /// @param[in] buf Input buffer, must stay valid until the function returns.\n"
+        "    /// @param[in] len Number of bytes in the input buffer.\n"
+        "    /// @param[in] handler Handler the decoded messages are dispatched to.\n"
+        "    /// @return Number of consumed bytes, the rest are expected to be provided\n"
+        "    ///     again when more data is received.\n"
+        "    template <typename THandler>\n"
+        "    std::size_t processAll(const std::uint8_t* buf, std::size_t len, THandler& handler)\n"
+        "    {\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> guard(m_mutex);\n"
+        "            m_buf = buf;\n"
+        "            m_len = len;\n"
+        "            m_produced = 0U;\n"
+        "            m_taken = 0U;\n"
+        "            for (auto& s : m_slots) {\n"
+        "                s.m_ready = false;\n"
+        "            }\n"
+        "        }\n\n"
+        "        ProcessGuard processGuard(*this);\n"
+        "        std::size_t consumed = 0U;\n"
+        "        std::size_t scanStart = 0U;\n"
+        "        std::size_t produced = 0U;\n"
+        "        std::size_t delivered = 0U;\n"
+        "        bool splitComplete = false;\n"
+        "        while (true) {\n"
+        "            static const std::size_t PublishBatch = 64U;\n"
+        "            while ((!splitComplete) && ((produced - delivered) < m_slots.size())) {\n"
+        "                std::size_t frameLen = 0U;\n"
+        "                auto es = readFrameLength(buf + consumed, len - consumed, frameLen);\n"
+        "                if (es == comms::ErrorStatus::NotEnoughData) {\n"
+        "                    splitComplete = true;\n"
+        "                    break;\n"
+        "                }\n\n"
+        "                if (es != comms::ErrorStatus::Success) {\n"
+        "                    ++consumed;\n"
+        "                    continue;\n"
+        "                }\n\n"
+        "                auto& slot = m_slots[produced % m_slots.size()];\n"
+        "                slot.m_scanStart = scanStart;\n"
+        "                slot.m_offset = consumed;\n"
+        "                consumed += frameLen;\n"
+        "                scanStart = consumed;\n"
+        "                ++produced;\n\n"
+        "                if ((produced % PublishBatch) == 0U) {\n"
+        "                    publish(produced);\n"
+        "                }\n"
+        "            }\n\n"
+        "            publish(produced);\n\n"
+        "            std::size_t readyCount = 0U;\n"
+        "            do {\n"
+        "                std::unique_lock<std::mutex> lock(m_mutex);\n"
+        "                if (delivered == produced) {\n"
+        "                    break;\n"
+        "                }\n\n"
+        "                auto& first = m_slots[delivered % m_slots.size()];\n"
+        "                m_readyCond.wait(lock, [&first]() { return first.m_ready; });\n"
+        "                while ((delivered + readyCount) < produced) {\n"
+        "                    auto& slot = m_slots[(delivered + readyCount) % m_slots.size()];\n"
+        "                    if (!slot.m_ready) {\n"
+        "                        break;\n"
+        "                    }\n\n"
+        "                    slot.m_ready = false;\n"
+        "                    ++readyCount;\n"
+        "                }\n"
+        "            } while (false);\n\n"
+        "            if (readyCount == 0U) {\n"
+        "                break;\n"
+        "            }\n\n"
+        "            for (auto idx = 0U; idx < readyCount; ++idx) {\n"
+        "                auto& slot = m_slots[delivered % m_slots.size()];\n"
+        "                auto msg = std::move(slot.m_msg);\n"
+        "                ++delivered;\n"
+        "                if (slot.m_status == comms::ErrorStatus::NotEnoughData) {\n"
+        "                    discard(delivered);\n"
+        "                    produced = delivered;\n"
+        "                    consumed = slot.m_offset;\n"
+        "                    splitComplete = true;\n"
+        "                    break;\n"
+        "                }\n\n"
+        "                if ((slot.m_status == comms::ErrorStatus::Success) && msg) {\n"
+        "                    msg->dispatch(handler);\n"
+        "                }\n\n"
+        "                auto next = slot.m_offset + slot.m_consumed;\n"
+        "                auto nextScanStart = scanStart;\n"
+        "                if (delivered < produced) {\n"
+        "                    nextScanStart = m_slots[delivered % m_slots.size()].m_scanStart;\n"
+        "                }\n\n"
+        "                if (next == nextScanStart) {\n"
+        "                    continue;\n"
+        "                }\n\n"
+        "                // The rest of the split frames are not the ones decoded by the serial processing\n"
+        "                discard(delivered);\n"
+        "                produced = delivered;\n"
+        "                consumed = next;\n"
+        "                scanStart = next;\n"
+        "                splitComplete = false;\n"
+        "                break;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return consumed;\n"
+        "    }\n\n"
+        "private:\n"
+        "    struct Slot\n"
+        "    {\n"
+        "        std::size_t m_scanStart = 0U;\n"
+        "        std::size_t m_offset = 0U;\n"
+        "        std::size_t m_consumed = 0U;\n"
+        "        MsgPtr m_msg;\n"
+        "        comms::ErrorStatus m_status = comms::ErrorStatus::Success;\n"
+        "        bool m_ready = false;\n"
+        "    };\n\n"
+        "    // Makes sure the workers don't access the input buffer after\n"
+        "    // the processing is over, even when the handler throws.\n"
+        "    class ProcessGuard\n"
+        "    {\n"
+        "    public:\n"
+        "        explicit ProcessGuard(#^#CLASS_NAME#$##^#SUFFIX#$#& pipeline) : m_pipeline(pipeline) {}\n\n"
+        "        ~ProcessGuard()\n"
+        "        {\n"
+        "            std::unique_lock<std::mutex> lock(m_pipeline.m_mutex);\n"
+        "            m_pipeline.m_produced = m_pipeline.m_taken;\n"
+        "            m_pipeline.m_readyCond.wait(lock, [this]() { return m_pipeline.m_busyCount == 0U; });\n"
+        "            m_pipeline.m_buf = nullptr;\n"
+        "        }\n\n"
+        "    private:\n"
+        "        #^#CLASS_NAME#$##^#SUFFIX#$#& m_pipeline;\n"
+        "    };\n\n"
+        "    template <typename TField>\n"
+        "    static comms::ErrorStatus readField(TField& field, const std::uint8_t*& iter, const std::uint8_t* buf, std::size_t len)\n"
+        "    {\n"
+        "        return field.read(iter, len - static_cast<std::size_t>(std::distance(buf, iter)));\n"
+        "    }\n\n"
+        "    void publish(std::size_t produced)\n"
+        "    {\n"
+        "        {\n"
+        "            std::lock_guard<std::mutex> guard(m_mutex);\n"
+        "            if (m_produced == produced) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            m_produced = produced;\n"
+        "        }\n\n"
+        "        m_decodeCond.notify_all();\n"
+        "    }\n\n"
+        "    // Drops the split frames which haven't been dispatched yet.\n"
+        "    void discard(std::size_t delivered)\n"
+        "    {\n"
+        "        std::unique_lock<std::mutex> lock(m_mutex);\n"
+        "        m_produced = m_taken;\n"
+        "        m_readyCond.wait(lock, [this]() { return m_busyCount == 0U; });\n"
+        "        m_produced = delivered;\n"
+        "        m_taken = delivered;\n"
+        "        for (auto& s : m_slots) {\n"
+        "            s.m_ready = false;\n"
+        "            s.m_msg.reset();\n"
+        "        }\n"
+        "    }\n\n"
+        "    void decodeLoop()\n"
+        "    {\n"
+        "        static const std::size_t MaxBatch = 64U;\n"
+        "        static const std::size_t MinBatch = 1U;\n"
+        "        Frame frame;\n"
+        "        std::unique_lock<std::mutex> lock(m_mutex);\n"
+        "        while (true) {\n"
+        "            m_decodeCond.wait(lock, [this]() { return m_stopped || (m_taken < m_produced); });\n"
+        "            if (m_stopped) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            auto first = m_taken;\n"
+        "            auto count = std::min(std::max((m_produced - m_taken) / m_threadsCount, MinBatch), MaxBatch);\n"
+        "            m_taken += count;\n"
+        "            ++m_busyCount;\n"
+        "            lock.unlock();\n\n"
+        "            for (auto idx = first; idx < (first + count); ++idx) {\n"
+        "                auto& slot = m_slots[idx % m_slots.size()];\n"
+        "                auto begIter = comms::readIteratorFor<TMessage>(m_buf + slot.m_offset);\n"
+        "                auto iter = begIter;\n"
+        "                slot.m_status = frame.read(slot.m_msg, iter, m_len - slot.m_offset);\n"
+        "                slot.m_consumed = static_cast<std::size_t>(std::distance(begIter, iter));\n"
+        "                if (slot.m_status == comms::ErrorStatus::ProtocolError) {\n"
+        "                    slot.m_consumed = 1U;\n"
+        "                }\n"
+        "            }\n\n"
+        "            lock.lock();\n"
+        "            for (auto idx = first; idx < (first + count); ++idx) {\n"
+        "                m_slots[idx % m_slots.size()].m_ready = true;\n"
+        "            }\n\n"
+        "            --m_busyCount;\n"
+        "            m_readyCond.notify_one();\n"
+        "        }\n"
+        "    }\n\n"
+        "    unsigned m_threadsCount = 0U;\n"
+        "    std::vector<Slot> m_slots;\n"
+        "    const std::uint8_t* m_buf = nullptr;\n"
+        "    std::size_t m_len = 0U;\n"
+        "    std::size_t m_produced = 0U;\n"
+        "    std::size_t m_taken = 0U;\n"
+        "    unsigned m_busyCount = 0U;\n"
+        "    bool m_stopped = false;\n"
+        "    std::mutex m_mutex;\n"
+        "    std::condition_variable m_decodeCond;\n"
+        "    std::condition_variable m_readyCond;\n"
+        "    std::vector<std::thread> m_workers;\n"
+        "};\n\n"
+        "#^#NS_END#$#\n";
+
+    util::ReplacementMap repl =  {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"NS_BEGIN", comms::namespaceBeginFor(*this, gen)},
+        {"NS_END", comms::namespaceEndFor(*this, gen)},
+        {"SCOPE", comms::scopeFor(*this, gen)},
+        {"CLASS_NAME", comms::className(dslObj().name())},
+        {"SUFFIX", PipelineSuffixStr},
+        {"OPTIONS", comms::scopeForOptions(strings::defaultOptionsStr(), gen)},
+        {"FRAME_HEADER", comms::relHeaderPathFor(*this, gen)},
+        {"HEADERFILE", util::strReplace(comms::relHeaderPathFor(*this, gen), strings::cppHeaderSuffixStr(), PipelineSuffixStr + strings::cppHeaderSuffixStr())},
+        {"INPUT_MESSAGES_DOC", commsDefInputMessagesDocInternal()},
+        {"INPUT_MESSAGES", commsDefInputMessagesParamInternal()},
+        {"FRAME_TYPE", commsPipelineFrameTypeInternal()},
+        {"FRAMING", std::move(framing)},
+    };
+
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+std::string CommsFrame::commsPipelineFramingInternal() const
+{
+    static const std::string FieldTempl =
+        "typename Frame::Layer_#^#NAME#$#::Field #^#NAME#$#Field;\n"
+        "es = readField(#^#NAME#$#Field, iter, buf, len);\n"
+        "if (es != comms::ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    static const std::string SyncTempl =
+        "if (#^#NAME#$#Field != typename Frame::Layer_#^#NAME#$#::Field()) {\n"
+        "    return comms::ErrorStatus::ProtocolError;\n"
+        "}\n";
+
+    static const std::string ChecksumSuffixTempl =
+        "suffixLen += typename Frame::Layer_#^#NAME#$#::Field().length();\n";
+
+    static const std::string SizeTempl =
+        "frameLen =\n"
+        "    static_cast<std::size_t>(std::distance(buf, iter)) +\n"
+        "    static_cast<std::size_t>(#^#NAME#$#Field.value()) +\n"
+        "    suffixLen;\n\n"
+        "if (len < frameLen) {\n"
+        "    return comms::ErrorStatus::NotEnoughData;\n"
+        "}\n\n"
+        "return comms::ErrorStatus::Success;";
+
+    using LayerKind = commsdsl::parse::Layer::Kind;
+    util::StringsList reads;
+    for (auto* l : m_commsLayers) {
+        auto layerDslObj = l->layer().dslObj();
+        auto kind = layerDslObj.kind();
+        util::ReplacementMap repl = {
+            {"NAME", comms::accessName(layerDslObj.name())},
+        };
+
+        if ((kind == LayerKind::Checksum) && 
+            (!commsdsl::parse::ChecksumLayer(layerDslObj).fromLayer().empty())) {
+            reads.push_back(util::processTemplate(ChecksumSuffixTempl, repl));
+            continue;
+        }
+
+        if ((kind != LayerKind::Sync) && 
+            (kind != LayerKind::Size) && 
+            (kind != LayerKind::Id) && 
+            (kind != LayerKind::Value) && 
+            (kind != LayerKind::Checksum)) {
+            break;
+        }
+
+        auto code = util::processTemplate(FieldTempl, repl);
+        if (kind == LayerKind::Sync) {
+            code += '\n' + util::processTemplate(SyncTempl, repl);
+        }
+
+        if (kind == LayerKind::Size) {
+            code += '\n' + util::processTemplate(SizeTempl, repl);
+            reads.push_back(std::move(code));
+            return util::strListToString(reads, "\n", "");
+        }
+
+        reads.push_back(std::move(code));
+    }
+
+    return strings::emptyString();
+}
+
+std::string CommsFrame::commsPipelineFrameTypeInternal() const
+{
+    auto str = comms::scopeFor(*this, generator()) + "<TMessage, ";
+    if (m_hasIdLayer) {
+        str += "TAllMessages, ";
+    }
+
+    str += "TOpt>";
+    return str;
+}
+
 } // namespace commsdsl2comms
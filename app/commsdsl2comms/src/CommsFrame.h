@@ -64,6 +64,9 @@ private:
     std::string commsCustomizationOptionsInternal(
         LayerOptsFunc layerOptsFunc,
         bool hasBase) const;    
+    bool commsWritePipelineInternal() const;
+    std::string commsPipelineFramingInternal() const;
+    std::string commsPipelineFrameTypeInternal() const;
     
     CommsLayersList m_commsLayers;  
     bool m_hasIdLayer = false;
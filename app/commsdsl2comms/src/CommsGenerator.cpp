@@ -30,6 +30,7 @@
 #include "CommsFrame.h"
 #include "CommsInputMessages.h"
 #include "CommsIntField.h"
+#include "CommsJson.h"
 #include "CommsListField.h"
 #include "CommsIdLayer.h"
 #include "CommsInterface.h"
@@ -38,10 +39,13 @@
 #include "CommsMsgId.h"
 #include "CommsNamespace.h"
 #include "CommsOptionalField.h"
+#include "CommsPrecompiled.h"
 #include "CommsPayloadLayer.h"
 #include "CommsRefField.h"
 #include "CommsSchema.h"
 #include "CommsSetField.h"
+#include "CommsShardKey.h"
+#include "CommsSharedFields.h"
 #include "CommsSizeLayer.h"
 #include "CommsSyncLayer.h"
 #include "CommsStringField.h"
@@ -70,6 +74,19 @@ namespace commsdsl2comms
 
 const std::string MinCommsVersion("5.2.0");    
 
+namespace
+{
+
+// Prefix of the extra schema attributes providing hints to this generator.
+const std::string CommsExtraAttrPrefix("comms.");
+
+} // namespace
+
+CommsGenerator::CommsGenerator()
+{
+    addExpectedExtraPrefix(CommsExtraAttrPrefix);
+}
+
 const std::string& CommsGenerator::commsFileGeneratedComment()
 {
     static const std::string Str =
@@ -147,6 +164,57 @@ const CommsGenerator::ExtraMessageBundlesList& CommsGenerator::commsExtraMessage
     return m_commsExtraMessageBundles;
 }
 
+CommsGenerator::PrecompiledLib CommsGenerator::commsGetPrecompiledLib() const
+{
+    return m_precompiledLib;
+}
+
+void CommsGenerator::commsSetPrecompiledLib(const std::string& value)
+{
+    if (value.empty()) {
+        return;
+    }
+
+    static const std::string Map[] = {
+        /* None */ "none",
+        /* Default */ "default",
+        /* Client */ "client",
+        /* Server */ "server",
+        /* DataView */ "data-view",
+        /* BareMetal */ "bare-metal",
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<unsigned>(PrecompiledLib::NumOfValues), "Invalid map");
+
+    auto iter = std::find(std::begin(Map), std::end(Map), value);
+    if (iter == std::end(Map)) {
+        logger().warning("Unknown precompiled library options \"" + value + "\", precompiled library won't be generated.");
+        return;
+    }
+
+    m_precompiledLib = static_cast<PrecompiledLib>(std::distance(std::begin(Map), iter));
+}
+
+bool CommsGenerator::commsGetFieldsDedupEnabled() const
+{
+    return m_fieldsDedupEnabled;
+}
+
+void CommsGenerator::commsSetFieldsDedupEnabled(bool value)
+{
+    m_fieldsDedupEnabled = value;
+}
+
+bool CommsGenerator::commsGetFramePipelineEnabled() const
+{
+    return m_framePipelineEnabled;
+}
+
+void CommsGenerator::commsSetFramePipelineEnabled(bool value)
+{
+    m_framePipelineEnabled = value;
+}
+
 const std::string& CommsGenerator::commsMinCommsVersion()
 {
     return MinCommsVersion;
@@ -160,7 +228,8 @@ bool CommsGenerator::prepareImpl()
 
     return 
         commsPrepareDefaultInterfaceInternal() &&
-        commsPrepareExtraMessageBundlesInternal();
+        commsPrepareExtraMessageBundlesInternal() &&
+        commsPrepareSharedFieldsInternal();
 }
 
 CommsGenerator::SchemaPtr CommsGenerator::createSchemaImpl(commsdsl::parse::Schema dslObj, Elem* parent)
@@ -294,7 +363,10 @@ bool CommsGenerator::writeImpl()
             CommsInputMessages::write(*this) &&
             CommsDefaultOptions::write(*this) &&
             CommsDispatch::write(*this) &&
-            CommsMsgFactory::write(*this);
+            CommsJson::write(*this) &&
+            CommsSharedFields::write(*this) &&
+            CommsMsgFactory::write(*this) &&
+            CommsShardKey::write(*this);
 
         if (!result) {
             return false;
@@ -303,6 +375,7 @@ bool CommsGenerator::writeImpl()
 
     assert(&currentSchema() == &protocolSchema());
     return 
+        CommsPrecompiled::write(*this) &&
         CommsCmake::write(*this) &&
         CommsDoxygen::write(*this) &&
         commsWriteExtraFilesInternal();
@@ -375,6 +448,23 @@ bool CommsGenerator::commsPrepareExtraMessageBundlesInternal()
     return true;
 }
 
+bool CommsGenerator::commsPrepareSharedFieldsInternal()
+{
+    if (!m_fieldsDedupEnabled) {
+        return true;
+    }
+
+    for (auto idx = 0U; idx < schemas().size(); ++idx) {
+        chooseCurrentSchema(idx);
+        if (!CommsSharedFields::prepare(*this)) {
+            return false;
+        }
+    }
+
+    assert(&currentSchema() == &protocolSchema());
+    return true;
+}
+
 bool CommsGenerator::commsWriteExtraFilesInternal() const
 {
     auto& inputDir = getCodeDir();
@@ -454,36 +544,23 @@ bool CommsGenerator::commsWriteExtraFilesInternal() const
             return false;
         }
 
-        std::error_code ec;
-        fs::copy_file(srcPath, destPath, fs::copy_options::overwrite_existing, ec);
-        if (ec) {
-            logger().error("Failed to copy with reason: " + ec.message());
-            return false;
-        }
-
-        if (protSchema.mainNamespace() != schemaNs) {
-            // The namespace has changed
-
-            auto destStr = destPath.string();
-            std::ifstream stream(destStr);
-            if (!stream) {
-                logger().error("Failed to open " + destStr + " for modification.");
+        if (protSchema.mainNamespace() == schemaNs) {
+            if (!copyFile(srcPath.string(), destPath.string())) {
                 return false;
             }
 
-            std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
-            stream.close();
-
-            util::strReplace(content, "namespace " + schemaNs, "namespace " + protSchema.mainNamespace());
-            std::ofstream outStream(destStr, std::ios_base::trunc);
-            if (!outStream) {
-                logger().error("Failed to modify " + destStr + ".");
-                return false;
-            }
+            continue;
+        }
 
-            outStream << content;
-            logger().info("Updated " + destStr + " to have proper main namespace.");
+        // The namespace has changed
+        auto destStr = destPath.string();
+        auto content = readCodeFile(srcPath.string());
+        util::strReplace(content, "namespace " + schemaNs, "namespace " + protSchema.mainNamespace());
+        if (!writeFile(destStr, content)) {
+            return false;
         }
+
+        logger().info("Updated " + destStr + " to have proper main namespace.");
     }
     return true;
 }
@@ -43,6 +43,19 @@ public:
         NumOfValues
     };    
 
+    enum class PrecompiledLib
+    {
+        None,
+        Default,
+        Client,
+        Server,
+        DataView,
+        BareMetal,
+        NumOfValues
+    };
+
+    CommsGenerator();
+
     static const CommsGenerator& cast(const commsdsl::gen::Generator& ref)
     {
         return static_cast<const CommsGenerator&>(ref);
@@ -63,6 +76,15 @@ public:
     void commsSetExtraInputBundles(const std::vector<std::string>& inputBundles);
     const ExtraMessageBundlesList& commsExtraMessageBundles() const;
 
+    PrecompiledLib commsGetPrecompiledLib() const;
+    void commsSetPrecompiledLib(const std::string& value);
+
+    bool commsGetFieldsDedupEnabled() const;
+    void commsSetFieldsDedupEnabled(bool value);
+
+    bool commsGetFramePipelineEnabled() const;
+    void commsSetFramePipelineEnabled(bool value);
+
     static const std::string& commsMinCommsVersion();
 
 protected:
@@ -100,6 +122,7 @@ protected:
 private:
     bool commsPrepareDefaultInterfaceInternal();
     bool commsPrepareExtraMessageBundlesInternal();
+    bool commsPrepareSharedFieldsInternal();
     bool commsWriteExtraFilesInternal() const;
     
     static const CustomizationLevel DefaultCustomizationLevel = CustomizationLevel::Limited;
@@ -108,6 +131,9 @@ private:
     std::vector<std::string> m_extraInputBundles;
     ExtraMessageBundlesList m_commsExtraMessageBundles;
     bool m_mainNamespaceInOptionsForced = false;
+    PrecompiledLib m_precompiledLib = PrecompiledLib::None;
+    bool m_fieldsDedupEnabled = false;
+    bool m_framePipelineEnabled = false;
 };
 
 } // namespace commsdsl2comms
@@ -25,7 +25,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -56,12 +55,6 @@ bool writeFileInternal(
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     auto allMessages = generator.getAllMessagesIdSorted();
     util::StringsList includes = {
         "<tuple>",
@@ -73,7 +66,7 @@ bool writeFileInternal(
 
     for (auto* m : allMessages) {
         assert(m != nullptr);
-        if (!func(*m)) {
+        if ((!m->isReferenced()) || (!func(*m))) {
             continue;
         }
 
@@ -130,8 +123,8 @@ bool writeFileInternal(
         {"OPTIONS", comms::scopeForOptions(strings::defaultOptionsClassStr(), generator)},
         {"INCLUDES", util::strListToString(includes, "\n", "\n")},
         {"MESSAGES", util::strListToString(scopes, ",\n", "")},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForInput(name, generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForInput(name, generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", generator.readCodeFile(comms::inputCodePathForInput(name, generator) + strings::extendFileSuffixStr())},
+        {"APPEND", generator.readCodeFile(comms::inputCodePathForInput(name, generator) + strings::appendFileSuffixStr())},
         {"PROT_PREFIX", util::strToUpper(generator.currentSchema().mainNamespace())},
         {"MACRO_NAME", util::strToMacroName(name)},
         {"ALIASES", util::strListToString(aliases, " \\\n", "\n")},
@@ -143,9 +136,7 @@ bool writeFileInternal(
         repl["ORIG"] = strings::origSuffixStr();
     }
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 } // namespace 
@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -152,10 +151,10 @@ bool CommsInterface::prepareImpl()
         m_name = strings::messageClassStr();
     }
 
-    m_constructCode = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::constructFileSuffixStr());
-    m_publicCode = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::publicFileSuffixStr());
-    m_protectedCode = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::protectedFileSuffixStr());
-    m_privateCode = util::readFileContents(comms::inputCodePathFor(*this, generator()) + strings::privateFileSuffixStr());
+    m_constructCode = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::constructFileSuffixStr());
+    m_publicCode = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::publicFileSuffixStr());
+    m_protectedCode = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::protectedFileSuffixStr());
+    m_privateCode = generator().readCodeFile(comms::inputCodePathFor(*this, generator()) + strings::privateFileSuffixStr());
     m_commsFields = CommsField::commsTransformFieldsList(fields());
 
     return true;
@@ -185,12 +184,6 @@ bool CommsInterface::commsWriteCommonInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        gen.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -220,9 +213,7 @@ bool CommsInterface::commsWriteCommonInternal() const
         {"CODE", commsCommonFieldsCodeInternal()}
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool CommsInterface::commsWriteDefInternal() const
@@ -231,8 +222,7 @@ bool CommsInterface::commsWriteDefInternal() const
     auto writeFunc = 
         [&gen](const std::string& filePath, const std::string& content)
         {
-            auto& logger = gen.logger();
-            logger.info("Generating " + filePath);
+            gen.logger().info("Generating " + filePath);
 
             auto dirPath = util::pathUp(filePath);
             assert(!dirPath.empty());
@@ -240,20 +230,12 @@ bool CommsInterface::commsWriteDefInternal() const
                 return false;
             }
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                logger.error("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
-            
-            stream << content;
-            stream.flush();
-            return stream.good();
+            return gen.writeFile(filePath, content);
         };
     
     auto genFilePath = comms::headerPathRoot(m_name, gen);
     auto codePathPrefix = comms::inputCodePathForRoot(m_name, gen);
-    auto replaceContent = util::readFileContents(codePathPrefix + strings::replaceFileSuffixStr());
+    auto replaceContent = gen.readCodeFile(codePathPrefix + strings::replaceFileSuffixStr());
     if (!replaceContent.empty()) {
         return writeFunc(genFilePath, replaceContent);
     }
@@ -268,8 +250,8 @@ bool CommsInterface::commsWriteDefInternal() const
         {"DOC_DETAILS", commsDefDocDetailsInternal()},
         {"BASE", commsDefBaseClassInternal()},
         {"HEADERFILE", comms::relHeaderPathFor(*this, gen)},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForRoot(m_name, gen) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForRoot(m_name, gen) + strings::appendFileSuffixStr())}
+        {"EXTEND", gen.readCodeFile(comms::inputCodePathForRoot(m_name, gen) + strings::extendFileSuffixStr())},
+        {"APPEND", gen.readCodeFile(comms::inputCodePathForRoot(m_name, gen) + strings::appendFileSuffixStr())}
     };
 
     if (!repl["EXTEND"].empty()) {
@@ -580,7 +562,7 @@ std::string CommsInterface::commsDefFieldsAliasesInternal() const
         return strings::emptyString();
     }
 
-    auto aliases = obj.aliases();
+    auto& aliases = obj.aliasesView();
     if (aliases.empty()) {
         return strings::emptyString();    
     }
@@ -0,0 +1,1482 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsJson.h"
+
+#include "CommsGenerator.h"
+#include "CommsSchema.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace 
+{
+
+const std::string JsonStr("Json");
+
+const std::string& mainTempl()
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains JSON transcoder of the messages defined in @b #^#PROT_NAMESPACE#$# namespace.\n\n"
+        "#pragma once\n\n"
+        "#include <algorithm>\n"
+        "#include <cctype>\n"
+        "#include <cmath>\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <cstdio>\n"
+        "#include <cstdlib>\n"
+        "#include <cstring>\n"
+        "#include <limits>\n"
+        "#include <tuple>\n"
+        "#include <type_traits>\n"
+        "#include <utility>\n\n"
+        "#if __cplusplus >= 201703L\n"
+        "#include <charconv>\n"
+        "#endif\n\n"
+        "#include \"comms/MessageBase.h\"\n"
+        "#include \"comms/field/ArrayList.h\"\n"
+        "#include \"comms/field/Bitfield.h\"\n"
+        "#include \"comms/field/BitmaskValue.h\"\n"
+        "#include \"comms/field/Bundle.h\"\n"
+        "#include \"comms/field/EnumValue.h\"\n"
+        "#include \"comms/field/FloatValue.h\"\n"
+        "#include \"comms/field/IntValue.h\"\n"
+        "#include \"comms/field/Optional.h\"\n"
+        "#include \"comms/field/String.h\"\n"
+        "#include \"comms/field/Variant.h\"\n"
+        "#include \"comms/util/Tuple.h\"\n"
+        "#^#INCLUDES#$#\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace json\n"
+        "{\n\n"
+        "/// @brief Status of reading a message from its JSON representation.\n"
+        "enum class ReadStatus\n"
+        "{\n"
+        "    Success, ///< The message has been read and passed to the handler.\n"
+        "    SyntaxError, ///< The input is not a valid JSON.\n"
+        "    InvalidValue, ///< The value doesn't match its field.\n"
+        "    UnknownMessage, ///< The message ID and name don't match any known message.\n"
+        "    ValuesLimit ///< Limit to the available values, must be last\n"
+        "};\n\n"
+        "#^#WRITER#$#\n\n"
+        "#^#READER#$#\n\n"
+        "namespace details\n"
+        "{\n\n"
+        "struct EnumFieldTag {};\n"
+        "struct BitmaskFieldTag {};\n"
+        "struct GenericFieldTag {};\n"
+        "struct IntElementTag {};\n"
+        "struct FieldElementTag {};\n"
+        "struct MessageTag {};\n"
+        "struct InterfaceTag {};\n\n"
+        "template <typename TField>\n"
+        "using FieldTag =\n"
+        "    typename std::conditional<\n"
+        "        comms::field::isEnumValue<TField>(),\n"
+        "        EnumFieldTag,\n"
+        "        typename std::conditional<\n"
+        "            comms::field::isBitmaskValue<TField>(),\n"
+        "            BitmaskFieldTag,\n"
+        "            GenericFieldTag\n"
+        "        >::type\n"
+        "    >::type;\n\n"
+        "template <typename TList>\n"
+        "using ElementTag =\n"
+        "    typename std::conditional<\n"
+        "        std::is_integral<typename TList::ElementType>::value,\n"
+        "        IntElementTag,\n"
+        "        FieldElementTag\n"
+        "    >::type;\n\n"
+        "#^#FIELD_WRITER#$#\n\n"
+        "#^#FIELD_READER#$#\n\n"
+        "#^#MSG_INFO#$#\n\n"
+        "} // namespace details\n\n"
+        "/// @brief Write JSON representation of the message into the caller provided buffer.\n"
+        "/// @details The message is written as a single line object, for example\n"
+        "///     @code\n"
+        "///     {\"id\":1,\"name\":\"Msg1\",\"fields\":{\"F1\":5,\"F2\":\"Value1\"}}\n"
+        "///     @endcode\n"
+        "///     The enum values and set bits are written using their names. The values\n"
+        "///     without a name are written as numbers. The raw data is written as a\n"
+        "///     hexadecimal string, the missing optional fields as @b null, and the\n"
+        "///     variant fields as an object with the single member.\n"
+        "/// @tparam TMsg Type of the actual message object (not the interface).\n"
+        "/// @tparam TBuf Type of the buffer, see @ref Writer.\n"
+        "/// @param[in] msg Message object.\n"
+        "/// @param[in, out] buf Buffer, the JSON text is appended to its existing contents.\n"
+        "template <typename TMsg, typename TBuf>\n"
+        "void writeMessage(const TMsg& msg, TBuf& buf)\n"
+        "{\n"
+        "    static_assert(comms::isMessageBase<TMsg>(), \"Must be actual message\");\n"
+        "    using IdType = typename std::underlying_type<#^#MSG_ID_TYPE#$#>::type;\n\n"
+        "    static const char IdPrefix[] = \"{\\\"id\\\":\";\n"
+        "    static const char NamePrefix[] = \",\\\"name\\\":\";\n"
+        "    static const char FieldsPrefix[] = \",\\\"fields\\\":\";\n\n"
+        "    Writer<TBuf> out(buf);\n"
+        "    out.putRaw(IdPrefix, sizeof(IdPrefix) - 1U);\n"
+        "    out.putInt(static_cast<IdType>(msg.doGetId()));\n"
+        "    out.putRaw(NamePrefix, sizeof(NamePrefix) - 1U);\n"
+        "    out.putQuoted(msg.doName());\n"
+        "    out.putRaw(FieldsPrefix, sizeof(FieldsPrefix) - 1U);\n"
+        "    details::FieldWriter<TBuf>::writeMembers(out, msg.fields());\n"
+        "    out.putChar('}');\n"
+        "}\n\n"
+        "/// @brief Write JSON representation of the message followed by the new line character.\n"
+        "/// @see @ref writeMessage()\n"
+        "template <typename TMsg, typename TBuf>\n"
+        "void writeMessageLine(const TMsg& msg, TBuf& buf)\n"
+        "{\n"
+        "    writeMessage(msg, buf);\n"
+        "    Writer<TBuf>(buf).putChar('\\n');\n"
+        "}\n\n"
+        "/// @brief Handler of the messages writing their JSON lines into the provided buffer.\n"
+        "/// @details Can be used with the dispatch functions defined in\n"
+        "///     @b #^#PROT_NAMESPACE#$#::dispatch namespace. The messages handled\n"
+        "///     via their interface are ignored.\n"
+        "/// @tparam TBuf Type of the buffer, see @ref Writer.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <typename TBuf>\n"
+        "class WriteHandler\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Constructor\n"
+        "    explicit WriteHandler(TBuf& buf) : m_buf(buf) {}\n\n"
+        "    /// @brief Handle message.\n"
+        "    template <typename TMsg>\n"
+        "    void handle(const TMsg& msg)\n"
+        "    {\n"
+        "        using Tag =\n"
+        "            typename std::conditional<\n"
+        "                comms::isMessageBase<TMsg>(),\n"
+        "                details::MessageTag,\n"
+        "                details::InterfaceTag\n"
+        "            >::type;\n\n"
+        "        handleInternal(msg, Tag());\n"
+        "    }\n\n"
+        "private:\n"
+        "    template <typename TMsg>\n"
+        "    void handleInternal(const TMsg& msg, details::MessageTag)\n"
+        "    {\n"
+        "        writeMessageLine(msg, m_buf);\n"
+        "    }\n\n"
+        "    template <typename TMsg>\n"
+        "    static void handleInternal(const TMsg& msg, details::InterfaceTag)\n"
+        "    {\n"
+        "        static_cast<void>(msg);\n"
+        "    }\n\n"
+        "    TBuf& m_buf;\n"
+        "};\n\n"
+        "/// @brief Read message from its JSON representation and pass it to the handler.\n"
+        "/// @details The input is expected to be in the format produced by @ref writeMessage().\n"
+        "///     The @b \"id\" member is required, while @b \"name\" is used to select the message\n"
+        "///     when it is present. The fields not listed in the input retain their default\n"
+        "///     values. The message object is constructed on the stack, the memory allocation\n"
+        "///     depends only on the storage types selected by the @b TOpt options.\n"
+        "/// @tparam TInterface Interface class of the messages.\n"
+        "/// @tparam THandler Type of the handler, must define @b handle() member function\n"
+        "///     accepting reference to every message type.\n"
+        "/// @tparam TOpt Protocol definition options, see @ref #^#DEFAULT_OPTIONS#$#.\n"
+        "/// @param[in] str JSON input.\n"
+        "/// @param[in] len Length of the JSON input.\n"
+        "/// @param[in] handler Handler object.\n"
+        "/// @return Status of the operation, the handler is invoked only on success.\n"
+        "template <typename TInterface, typename THandler, typename TOpt = #^#DEFAULT_OPTIONS#$#>\n"
+        "ReadStatus readMessage(const char* str, std::size_t len, THandler& handler)\n"
+        "{\n"
+        "    details::MessageInfo info;\n"
+        "    auto status = details::parseMessageInfo(str, len, info);\n"
+        "    if (status != ReadStatus::Success) {\n"
+        "        return status;\n"
+        "    }\n\n"
+        "    if (!info.m_hasId) {\n"
+        "        return ReadStatus::UnknownMessage;\n"
+        "    }\n\n"
+        "    #^#NO_MESSAGES#$#\n"
+        "    switch (info.m_id) {\n"
+        "        #^#CASES#$#\n"
+        "        default: break;\n"
+        "    }\n\n"
+        "    return ReadStatus::UnknownMessage;\n"
+        "}\n\n"
+        "} // namespace json\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    return Templ;
+}
+
+const std::string& writerTempl()
+{
+    static const std::string Templ =
+        "/// @brief Appender of the JSON text to the caller provided growable buffer.\n"
+        "/// @details The text is appended after the existing contents of the buffer.\n"
+        "///     The buffer is grown geometrically when needed and trimmed to the\n"
+        "///     written length on destruction. Reusing the same buffer for multiple\n"
+        "///     messages results in no memory allocation once it has grown enough.\n"
+        "/// @tparam TBuf Type of the buffer, such as @b std::string or @b std::vector<char>.\n"
+        "///     It must provide @b size(), @b resize() and @b operator[]() member functions.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <typename TBuf>\n"
+        "class Writer\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Constructor\n"
+        "    explicit Writer(TBuf& buf) : m_buf(buf), m_len(buf.size()) {}\n\n"
+        "    /// @brief Destructor, trims the buffer to the written length.\n"
+        "    ~Writer()\n"
+        "    {\n"
+        "        m_buf.resize(m_len);\n"
+        "    }\n\n"
+        "    /// @brief Copy constructor is deleted\n"
+        "    Writer(const Writer&) = delete;\n\n"
+        "    /// @brief Copy assignment is deleted\n"
+        "    Writer& operator=(const Writer&) = delete;\n\n"
+        "    /// @brief Append single character.\n"
+        "    void putChar(char ch)\n"
+        "    {\n"
+        "        *reserve(1U) = ch;\n"
+        "        ++m_len;\n"
+        "    }\n\n"
+        "    /// @brief Append raw characters.\n"
+        "    void putRaw(const char* str, std::size_t len)\n"
+        "    {\n"
+        "        if (len == 0U) {\n"
+        "            return;\n"
+        "        }\n\n"
+        "        std::memcpy(reserve(len), str, len);\n"
+        "        m_len += len;\n"
+        "    }\n\n"
+        "    /// @brief Append quoted and escaped string.\n"
+        "    template <typename TIter>\n"
+        "    void putQuoted(TIter begin, TIter end)\n"
+        "    {\n"
+        "        putChar('\"');\n"
+        "        for (auto iter = begin; iter != end; ++iter) {\n"
+        "            putEscaped(static_cast<char>(*iter));\n"
+        "        }\n"
+        "        putChar('\"');\n"
+        "    }\n\n"
+        "    /// @brief Append quoted and escaped zero terminated string.\n"
+        "    void putQuoted(const char* str)\n"
+        "    {\n"
+        "        putQuoted(str, str + std::strlen(str));\n"
+        "    }\n\n"
+        "    /// @brief Append integral value.\n"
+        "    template <typename T>\n"
+        "    void putInt(T value)\n"
+        "    {\n"
+        "        using ValueType =\n"
+        "            typename std::conditional<\n"
+        "                std::is_signed<T>::value,\n"
+        "                std::intmax_t,\n"
+        "                std::uintmax_t\n"
+        "            >::type;\n"
+        "        putIntInternal(static_cast<ValueType>(value));\n"
+        "    }\n\n"
+        "    /// @brief Append floating point value.\n"
+        "    /// @details The non-finite values are written as @b \"nan\", @b \"inf\"\n"
+        "    ///     and @b \"-inf\" strings.\n"
+        "    template <typename T>\n"
+        "    void putFloat(T value)\n"
+        "    {\n"
+        "        if (std::isnan(value)) {\n"
+        "            putRaw(\"\\\"nan\\\"\", 5U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (std::isinf(value)) {\n"
+        "            if (value < 0) {\n"
+        "                putRaw(\"\\\"-inf\\\"\", 6U);\n"
+        "                return;\n"
+        "            }\n\n"
+        "            putRaw(\"\\\"inf\\\"\", 5U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        static const std::size_t MaxLen = 32U;\n"
+        "        auto* out = reserve(MaxLen);\n"
+        "#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)\n"
+        "        auto result = std::to_chars(out, out + MaxLen, value);\n"
+        "        m_len += static_cast<std::size_t>(result.ptr - out);\n"
+        "#else\n"
+        "        using CastType = typename std::conditional<sizeof(T) <= sizeof(float), float, double>::type;\n"
+        "        const char* fmt = (sizeof(CastType) == sizeof(float)) ? \"%.9g\" : \"%.17g\";\n"
+        "        auto len = std::snprintf(out, MaxLen, fmt, static_cast<double>(static_cast<CastType>(value)));\n"
+        "        m_len += static_cast<std::size_t>(len);\n"
+        "#endif\n"
+        "    }\n\n"
+        "    /// @brief Append byte as two hexadecimal digits.\n"
+        "    void putHex(std::uint8_t byte)\n"
+        "    {\n"
+        "        static const char Digits[] = \"0123456789abcdef\";\n"
+        "        auto* out = reserve(2U);\n"
+        "        out[0] = Digits[byte >> 4U];\n"
+        "        out[1] = Digits[byte & 0xfU];\n"
+        "        m_len += 2U;\n"
+        "    }\n\n"
+        "private:\n"
+        "    char* reserve(std::size_t len)\n"
+        "    {\n"
+        "        auto required = m_len + len;\n"
+        "        if (m_buf.size() < required) {\n"
+        "            m_buf.resize(std::max(required, m_buf.size() * 2U));\n"
+        "        }\n\n"
+        "        return &m_buf[m_len];\n"
+        "    }\n\n"
+        "    void putIntInternal(std::intmax_t value)\n"
+        "    {\n"
+        "#if __cplusplus >= 201703L\n"
+        "        static const std::size_t MaxLen = std::numeric_limits<std::intmax_t>::digits10 + 3U;\n"
+        "        auto* out = reserve(MaxLen);\n"
+        "        auto result = std::to_chars(out, out + MaxLen, value);\n"
+        "        m_len += static_cast<std::size_t>(result.ptr - out);\n"
+        "#else\n"
+        "        if (value < 0) {\n"
+        "            putChar('-');\n"
+        "            putIntInternal(static_cast<std::uintmax_t>(0U) - static_cast<std::uintmax_t>(value));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        putIntInternal(static_cast<std::uintmax_t>(value));\n"
+        "#endif\n"
+        "    }\n\n"
+        "    void putIntInternal(std::uintmax_t value)\n"
+        "    {\n"
+        "        static const std::size_t MaxLen = std::numeric_limits<std::uintmax_t>::digits10 + 2U;\n"
+        "#if __cplusplus >= 201703L\n"
+        "        auto* out = reserve(MaxLen);\n"
+        "        auto result = std::to_chars(out, out + MaxLen, value);\n"
+        "        m_len += static_cast<std::size_t>(result.ptr - out);\n"
+        "#else\n"
+        "        char digits[MaxLen];\n"
+        "        auto* end = &digits[0] + MaxLen;\n"
+        "        auto* begin = end;\n"
+        "        do {\n"
+        "            --begin;\n"
+        "            *begin = static_cast<char>('0' + (value % 10U));\n"
+        "            value /= 10U;\n"
+        "        } while (value != 0U);\n\n"
+        "        putRaw(begin, static_cast<std::size_t>(end - begin));\n"
+        "#endif\n"
+        "    }\n\n"
+        "    void putEscaped(char ch)\n"
+        "    {\n"
+        "        if (ch == '\"') {\n"
+        "            putRaw(\"\\\\\\\"\", 2U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (ch == '\\\\') {\n"
+        "            putRaw(\"\\\\\\\\\", 2U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (ch == '\\n') {\n"
+        "            putRaw(\"\\\\n\", 2U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (ch == '\\r') {\n"
+        "            putRaw(\"\\\\r\", 2U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (ch == '\\t') {\n"
+        "            putRaw(\"\\\\t\", 2U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (static_cast<unsigned char>(ch) < 0x20) {\n"
+        "            putRaw(\"\\\\u00\", 4U);\n"
+        "            putHex(static_cast<std::uint8_t>(ch));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        putChar(ch);\n"
+        "    }\n\n"
+        "    TBuf& m_buf;\n"
+        "    std::size_t m_len = 0U;\n"
+        "};\n";
+
+    return Templ;
+}
+
+const std::string& readerTempl()
+{
+    static const std::string Templ =
+        "/// @brief Reader of the JSON tokens out of the input buffer.\n"
+        "/// @details Doesn't allocate any memory.\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "class Reader\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Constructor\n"
+        "    Reader(const char* str, std::size_t len) : m_iter(str), m_end(str + len) {}\n\n"
+        "    /// @brief Current position.\n"
+        "    const char* pos() const\n"
+        "    {\n"
+        "        return m_iter;\n"
+        "    }\n\n"
+        "    /// @brief Check whether whole input has been consumed.\n"
+        "    bool atEnd()\n"
+        "    {\n"
+        "        skipWs();\n"
+        "        return m_iter == m_end;\n"
+        "    }\n\n"
+        "    /// @brief Check the next character without consuming it.\n"
+        "    bool peek(char ch)\n"
+        "    {\n"
+        "        skipWs();\n"
+        "        return (m_iter != m_end) && (*m_iter == ch);\n"
+        "    }\n\n"
+        "    /// @brief Consume the next character if it has the expected value.\n"
+        "    bool consume(char ch)\n"
+        "    {\n"
+        "        if (!peek(ch)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        ++m_iter;\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    /// @brief Consume the expected literal, such as @b null.\n"
+        "    bool consumeLiteral(const char* str)\n"
+        "    {\n"
+        "        skipWs();\n"
+        "        auto len = std::strlen(str);\n"
+        "        if ((static_cast<std::size_t>(m_end - m_iter) < len) ||\n"
+        "            (std::memcmp(m_iter, str, len) != 0)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        m_iter += len;\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    /// @brief Read the raw contents of the string without unescaping it.\n"
+        "    bool readRawString(const char*& str, std::size_t& len)\n"
+        "    {\n"
+        "        if (!consume('\"')) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        str = m_iter;\n"
+        "        while (m_iter != m_end) {\n"
+        "            if (*m_iter == '\"') {\n"
+        "                len = static_cast<std::size_t>(m_iter - str);\n"
+        "                ++m_iter;\n"
+        "                return true;\n"
+        "            }\n\n"
+        "            if (*m_iter == '\\\\') {\n"
+        "                ++m_iter;\n"
+        "                if (m_iter == m_end) {\n"
+        "                    break;\n"
+        "                }\n"
+        "            }\n\n"
+        "            ++m_iter;\n"
+        "        }\n\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    /// @brief Read the string and pass its unescaped characters to the provided function.\n"
+        "    template <typename TFunc>\n"
+        "    bool readString(TFunc&& func)\n"
+        "    {\n"
+        "        const char* str = nullptr;\n"
+        "        std::size_t len = 0U;\n"
+        "        if (!readRawString(str, len)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        auto* end = str + len;\n"
+        "        while (str != end) {\n"
+        "            auto ch = *str;\n"
+        "            ++str;\n"
+        "            if (ch != '\\\\') {\n"
+        "                func(ch);\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            ch = *str;\n"
+        "            ++str;\n"
+        "            switch (ch) {\n"
+        "                case 'b': func('\\b'); break;\n"
+        "                case 'f': func('\\f'); break;\n"
+        "                case 'n': func('\\n'); break;\n"
+        "                case 'r': func('\\r'); break;\n"
+        "                case 't': func('\\t'); break;\n"
+        "                case 'u': {\n"
+        "                    unsigned code = 0U;\n"
+        "                    if (!readHex(str, end, 4U, code)) {\n"
+        "                        return false;\n"
+        "                    }\n\n"
+        "                    putUtf8(code, func);\n"
+        "                    break;\n"
+        "                }\n"
+        "                default: func(ch); break;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    /// @brief Read integral value.\n"
+        "    template <typename T>\n"
+        "    bool readInt(T& value)\n"
+        "    {\n"
+        "        char token[MaxNumLen + 1U];\n"
+        "        if (!readNumToken(token)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        if (token[0] == '-') {\n"
+        "            std::intmax_t signedValue = 0;\n"
+        "            if (!parseInt(token, signedValue)) {\n"
+        "                return false;\n"
+        "            }\n\n"
+        "            value = static_cast<T>(signedValue);\n"
+        "            return true;\n"
+        "        }\n\n"
+        "        std::uintmax_t unsignedValue = 0U;\n"
+        "        if (!parseInt(token, unsignedValue)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        value = static_cast<T>(unsignedValue);\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    /// @brief Read floating point value, including @b \"nan\", @b \"inf\" and @b \"-inf\" strings.\n"
+        "    template <typename T>\n"
+        "    bool readFloat(T& value)\n"
+        "    {\n"
+        "        if (peek('\"')) {\n"
+        "            const char* str = nullptr;\n"
+        "            std::size_t len = 0U;\n"
+        "            if (!readRawString(str, len)) {\n"
+        "                return false;\n"
+        "            }\n\n"
+        "            if (equals(str, len, \"nan\")) {\n"
+        "                value = std::numeric_limits<T>::quiet_NaN();\n"
+        "                return true;\n"
+        "            }\n\n"
+        "            if (equals(str, len, \"inf\")) {\n"
+        "                value = std::numeric_limits<T>::infinity();\n"
+        "                return true;\n"
+        "            }\n\n"
+        "            if (equals(str, len, \"-inf\")) {\n"
+        "                value = -std::numeric_limits<T>::infinity();\n"
+        "                return true;\n"
+        "            }\n\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        char token[MaxNumLen + 1U];\n"
+        "        if (!readNumToken(token)) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        using ParseType = typename std::conditional<sizeof(T) <= sizeof(double), T, double>::type;\n"
+        "        ParseType parsed = 0;\n"
+        "#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)\n"
+        "        auto* end = token + std::strlen(token);\n"
+        "        auto result = std::from_chars(token, end, parsed);\n"
+        "        if ((result.ec != std::errc()) || (result.ptr != end)) {\n"
+        "            return false;\n"
+        "        }\n"
+        "#else\n"
+        "        char* end = nullptr;\n"
+        "        parsed = static_cast<ParseType>(std::strtod(token, &end));\n"
+        "        if (*end != '\\0') {\n"
+        "            return false;\n"
+        "        }\n"
+        "#endif\n"
+        "        value = static_cast<T>(parsed);\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    /// @brief Skip any value.\n"
+        "    bool skipValue()\n"
+        "    {\n"
+        "        skipWs();\n"
+        "        if (m_iter == m_end) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        if (*m_iter == '\"') {\n"
+        "            const char* str = nullptr;\n"
+        "            std::size_t len = 0U;\n"
+        "            return readRawString(str, len);\n"
+        "        }\n\n"
+        "        if ((*m_iter == '{') || (*m_iter == '[')) {\n"
+        "            return skipContainer();\n"
+        "        }\n\n"
+        "        auto* begin = m_iter;\n"
+        "        while ((m_iter != m_end) && (std::isalnum(static_cast<unsigned char>(*m_iter)) || (std::strchr(\"+-.\", *m_iter) != nullptr))) {\n"
+        "            ++m_iter;\n"
+        "        }\n\n"
+        "        return begin != m_iter;\n"
+        "    }\n\n"
+        "    /// @brief Compare the raw string with the zero terminated one.\n"
+        "    static bool equals(const char* str, std::size_t len, const char* other)\n"
+        "    {\n"
+        "        return (std::strncmp(str, other, len) == 0) && (other[len] == '\\0');\n"
+        "    }\n\n"
+        "    /// @brief Skip the whitespaces.\n"
+        "    void skipWs()\n"
+        "    {\n"
+        "        while ((m_iter != m_end) && ((*m_iter == ' ') || (*m_iter == '\\t') || (*m_iter == '\\n') || (*m_iter == '\\r'))) {\n"
+        "            ++m_iter;\n"
+        "        }\n"
+        "    }\n\n"
+        "private:\n"
+        "    static const std::size_t MaxNumLen = 64U;\n\n"
+        "    bool readNumToken(char (&token)[MaxNumLen + 1U])\n"
+        "    {\n"
+        "        skipWs();\n"
+        "        std::size_t len = 0U;\n"
+        "        while ((m_iter != m_end) && (len < MaxNumLen) &&\n"
+        "               (((*m_iter >= '0') && (*m_iter <= '9')) || (std::strchr(\"+-.eE\", *m_iter) != nullptr))) {\n"
+        "            token[len] = *m_iter;\n"
+        "            ++len;\n"
+        "            ++m_iter;\n"
+        "        }\n\n"
+        "        token[len] = '\\0';\n"
+        "        return len != 0U;\n"
+        "    }\n\n"
+        "    template <typename T>\n"
+        "    static bool parseInt(const char* token, T& value)\n"
+        "    {\n"
+        "#if __cplusplus >= 201703L\n"
+        "        auto* end = token + std::strlen(token);\n"
+        "        auto result = std::from_chars(token, end, value);\n"
+        "        return (result.ec == std::errc()) && (result.ptr == end);\n"
+        "#else\n"
+        "        char* end = nullptr;\n"
+        "        if (std::is_signed<T>::value) {\n"
+        "            value = static_cast<T>(std::strtoll(token, &end, 10));\n"
+        "        }\n"
+        "        else {\n"
+        "            value = static_cast<T>(std::strtoull(token, &end, 10));\n"
+        "        }\n"
+        "        return (end != token) && (*end == '\\0');\n"
+        "#endif\n"
+        "    }\n\n"
+        "    static bool readHex(const char*& str, const char* end, unsigned count, unsigned& value)\n"
+        "    {\n"
+        "        if (static_cast<std::size_t>(end - str) < count) {\n"
+        "            return false;\n"
+        "        }\n\n"
+        "        value = 0U;\n"
+        "        for (auto idx = 0U; idx < count; ++idx) {\n"
+        "            auto ch = str[idx];\n"
+        "            unsigned digit = 0U;\n"
+        "            if ((ch >= '0') && (ch <= '9')) {\n"
+        "                digit = static_cast<unsigned>(ch - '0');\n"
+        "            }\n"
+        "            else if ((ch >= 'a') && (ch <= 'f')) {\n"
+        "                digit = static_cast<unsigned>(ch - 'a') + 10U;\n"
+        "            }\n"
+        "            else if ((ch >= 'A') && (ch <= 'F')) {\n"
+        "                digit = static_cast<unsigned>(ch - 'A') + 10U;\n"
+        "            }\n"
+        "            else {\n"
+        "                return false;\n"
+        "            }\n\n"
+        "            value = (value << 4U) | digit;\n"
+        "        }\n\n"
+        "        str += count;\n"
+        "        return true;\n"
+        "    }\n\n"
+        "    template <typename TFunc>\n"
+        "    static void putUtf8(unsigned code, TFunc& func)\n"
+        "    {\n"
+        "        if (code < 0x80) {\n"
+        "            func(static_cast<char>(code));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (code < 0x800) {\n"
+        "            func(static_cast<char>(0xc0 | (code >> 6U)));\n"
+        "            func(static_cast<char>(0x80 | (code & 0x3f)));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        func(static_cast<char>(0xe0 | (code >> 12U)));\n"
+        "        func(static_cast<char>(0x80 | ((code >> 6U) & 0x3f)));\n"
+        "        func(static_cast<char>(0x80 | (code & 0x3f)));\n"
+        "    }\n\n"
+        "    bool skipContainer()\n"
+        "    {\n"
+        "        unsigned depth = 0U;\n"
+        "        while (m_iter != m_end) {\n"
+        "            auto ch = *m_iter;\n"
+        "            if (ch == '\"') {\n"
+        "                const char* str = nullptr;\n"
+        "                std::size_t len = 0U;\n"
+        "                if (!readRawString(str, len)) {\n"
+        "                    return false;\n"
+        "                }\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            ++m_iter;\n"
+        "            if ((ch == '{') || (ch == '[')) {\n"
+        "                ++depth;\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if ((ch == '}') || (ch == ']')) {\n"
+        "                --depth;\n"
+        "                if (depth == 0U) {\n"
+        "                    return true;\n"
+        "                }\n"
+        "            }\n"
+        "        }\n\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    const char* m_iter = nullptr;\n"
+        "    const char* m_end = nullptr;\n"
+        "};\n";
+
+    return Templ;
+}
+
+const std::string& fieldWriterTempl()
+{
+    static const std::string Templ =
+        "template <typename TBuf>\n"
+        "class FieldWriter\n"
+        "{\n"
+        "public:\n"
+        "    FieldWriter(Writer<TBuf>& out, bool& first) : m_out(out), m_first(first) {}\n\n"
+        "    template <typename TField>\n"
+        "    void operator()(const TField& field) const\n"
+        "    {\n"
+        "        if (!m_first) {\n"
+        "            m_out.putChar(',');\n"
+        "        }\n\n"
+        "        m_first = false;\n"
+        "        m_out.putQuoted(field.name());\n"
+        "        m_out.putChar(':');\n"
+        "        write(m_out, field);\n"
+        "    }\n\n"
+        "    template <std::size_t TIdx, typename TField>\n"
+        "    void operator()(const TField& field) const\n"
+        "    {\n"
+        "        operator()(field);\n"
+        "    }\n\n"
+        "    template <typename TField>\n"
+        "    static void write(Writer<TBuf>& out, const TField& field)\n"
+        "    {\n"
+        "        using FieldType = typename std::decay<decltype(field)>::type;\n"
+        "        writeValue<FieldType>(out, field, FieldTag<FieldType>());\n"
+        "    }\n\n"
+        "    template <typename TTuple>\n"
+        "    static void writeMembers(Writer<TBuf>& out, const TTuple& members)\n"
+        "    {\n"
+        "        bool first = true;\n"
+        "        out.putChar('{');\n"
+        "        comms::util::tupleForEach(members, FieldWriter(out, first));\n"
+        "        out.putChar('}');\n"
+        "    }\n\n"
+        "private:\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::IntValue<TFieldBase, T, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        out.putInt(actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField>\n"
+        "    static void writeValue(Writer<TBuf>& out, const TField& field, EnumFieldTag)\n"
+        "    {\n"
+        "        using ValueType = typename TField::ValueType;\n"
+        "        using UnderlyingType = typename std::underlying_type<ValueType>::type;\n\n"
+        "        auto* name = field.valueName(field.value());\n"
+        "        if (name == nullptr) {\n"
+        "            out.putInt(static_cast<UnderlyingType>(field.value()));\n"
+        "            return;\n"
+        "        }\n\n"
+        "        out.putQuoted(name);\n"
+        "    }\n\n"
+        "    template <typename TField>\n"
+        "    static void writeValue(Writer<TBuf>& out, const TField& field, BitmaskFieldTag)\n"
+        "    {\n"
+        "        bool hasUnknownBits = false;\n"
+        "        for (auto idx = 0U; idx < static_cast<unsigned>(TField::BitIdx_numOfValues); ++idx) {\n"
+        "            auto bitIdx = static_cast<typename TField::BitIdx>(idx);\n"
+        "            if ((field.getBitValue(bitIdx)) && (field.bitName(bitIdx) == nullptr)) {\n"
+        "                hasUnknownBits = true;\n"
+        "                break;\n"
+        "            }\n"
+        "        }\n\n"
+        "        auto mask = ~static_cast<std::uintmax_t>(0U);\n"
+        "        if (TField::BitIdx_numOfValues < std::numeric_limits<std::uintmax_t>::digits) {\n"
+        "            mask = (static_cast<std::uintmax_t>(1U) << static_cast<unsigned>(TField::BitIdx_numOfValues)) - 1U;\n"
+        "        }\n\n"
+        "        if (hasUnknownBits || ((static_cast<std::uintmax_t>(field.value()) & ~mask) != 0U)) {\n"
+        "            out.putInt(field.value());\n"
+        "            return;\n"
+        "        }\n\n"
+        "        bool first = true;\n"
+        "        out.putChar('[');\n"
+        "        for (auto idx = 0U; idx < static_cast<unsigned>(TField::BitIdx_numOfValues); ++idx) {\n"
+        "            auto bitIdx = static_cast<typename TField::BitIdx>(idx);\n"
+        "            if (!field.getBitValue(bitIdx)) {\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if (!first) {\n"
+        "                out.putChar(',');\n"
+        "            }\n\n"
+        "            first = false;\n"
+        "            out.putQuoted(field.bitName(bitIdx));\n"
+        "        }\n"
+        "        out.putChar(']');\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::Bitfield<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        writeMembers(out, actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::Bundle<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        writeMembers(out, actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::FloatValue<TFieldBase, T, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        out.putFloat(actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::String<TFieldBase, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        out.putQuoted(actField.value().begin(), actField.value().end());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TElement, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::ArrayList<TFieldBase, TElement, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        writeList(out, actField.value(), ElementTag<TField>());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TOptField, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::Optional<TOptField, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        if (!actField.doesExist()) {\n"
+        "            out.putRaw(\"null\", 4U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        write(out, actField.field());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static void writeValue(Writer<TBuf>& out, const comms::field::Variant<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<const TField&>(field);\n"
+        "        if (!actField.currentFieldValid()) {\n"
+        "            out.putRaw(\"null\", 4U);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        bool first = true;\n"
+        "        out.putChar('{');\n"
+        "        actField.currentFieldExec(FieldWriter(out, first));\n"
+        "        out.putChar('}');\n"
+        "    }\n\n"
+        "    template <typename TVec>\n"
+        "    static void writeList(Writer<TBuf>& out, const TVec& data, IntElementTag)\n"
+        "    {\n"
+        "        out.putChar('\"');\n"
+        "        for (auto byte : data) {\n"
+        "            out.putHex(static_cast<std::uint8_t>(byte));\n"
+        "        }\n"
+        "        out.putChar('\"');\n"
+        "    }\n\n"
+        "    template <typename TVec>\n"
+        "    static void writeList(Writer<TBuf>& out, const TVec& data, FieldElementTag)\n"
+        "    {\n"
+        "        out.putChar('[');\n"
+        "        bool first = true;\n"
+        "        for (auto& elem : data) {\n"
+        "            if (!first) {\n"
+        "                out.putChar(',');\n"
+        "            }\n\n"
+        "            first = false;\n"
+        "            write(out, elem);\n"
+        "        }\n"
+        "        out.putChar(']');\n"
+        "    }\n\n"
+        "    Writer<TBuf>& m_out;\n"
+        "    bool& m_first;\n"
+        "};\n";
+
+    return Templ;
+}
+
+const std::string& fieldReaderTempl()
+{
+    static const std::string Templ =
+        "class FieldReader\n"
+        "{\n"
+        "public:\n"
+        "    template <typename TField>\n"
+        "    static ReadStatus read(Reader& in, TField& field)\n"
+        "    {\n"
+        "        using FieldType = typename std::decay<decltype(field)>::type;\n"
+        "        return readValue<FieldType>(in, field, FieldTag<FieldType>());\n"
+        "    }\n\n"
+        "    template <typename TTuple>\n"
+        "    static ReadStatus readMembers(Reader& in, TTuple& members)\n"
+        "    {\n"
+        "        if (!in.consume('{')) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        if (in.consume('}')) {\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        while (true) {\n"
+        "            const char* key = nullptr;\n"
+        "            std::size_t keyLen = 0U;\n"
+        "            if ((!in.readRawString(key, keyLen)) || (!in.consume(':'))) {\n"
+        "                return ReadStatus::SyntaxError;\n"
+        "            }\n\n"
+        "            bool found = false;\n"
+        "            auto status = ReadStatus::Success;\n"
+        "            comms::util::tupleForEach(members, MemberReader(in, key, keyLen, found, status));\n"
+        "            if ((!found) && (!in.skipValue())) {\n"
+        "                return ReadStatus::SyntaxError;\n"
+        "            }\n\n"
+        "            if (status != ReadStatus::Success) {\n"
+        "                return status;\n"
+        "            }\n\n"
+        "            if (in.consume(',')) {\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if (in.consume('}')) {\n"
+        "                return ReadStatus::Success;\n"
+        "            }\n\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n"
+        "    }\n\n"
+        "private:\n"
+        "    class MemberReader\n"
+        "    {\n"
+        "    public:\n"
+        "        MemberReader(Reader& in, const char* key, std::size_t keyLen, bool& found, ReadStatus& status) :\n"
+        "            m_in(in),\n"
+        "            m_key(key),\n"
+        "            m_keyLen(keyLen),\n"
+        "            m_found(found),\n"
+        "            m_status(status)\n"
+        "        {\n"
+        "        }\n\n"
+        "        template <typename TField>\n"
+        "        void operator()(TField& field) const\n"
+        "        {\n"
+        "            if (m_found || (!Reader::equals(m_key, m_keyLen, field.name()))) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            m_found = true;\n"
+        "            m_status = FieldReader::read(m_in, field);\n"
+        "        }\n\n"
+        "    private:\n"
+        "        Reader& m_in;\n"
+        "        const char* m_key = nullptr;\n"
+        "        std::size_t m_keyLen = 0U;\n"
+        "        bool& m_found;\n"
+        "        ReadStatus& m_status;\n"
+        "    };\n\n"
+        "    class VariantMemberFinder\n"
+        "    {\n"
+        "    public:\n"
+        "        VariantMemberFinder(const char* key, std::size_t keyLen, std::size_t& idx, bool& found) :\n"
+        "            m_key(key),\n"
+        "            m_keyLen(keyLen),\n"
+        "            m_idx(idx),\n"
+        "            m_found(found)\n"
+        "        {\n"
+        "        }\n\n"
+        "        template <typename TField>\n"
+        "        void operator()() const\n"
+        "        {\n"
+        "            if (m_found) {\n"
+        "                return;\n"
+        "            }\n\n"
+        "            if (Reader::equals(m_key, m_keyLen, TField::name())) {\n"
+        "                m_found = true;\n"
+        "                return;\n"
+        "            }\n\n"
+        "            ++m_idx;\n"
+        "        }\n\n"
+        "    private:\n"
+        "        const char* m_key = nullptr;\n"
+        "        std::size_t m_keyLen = 0U;\n"
+        "        std::size_t& m_idx;\n"
+        "        bool& m_found;\n"
+        "    };\n\n"
+        "    class VariantMemberReader\n"
+        "    {\n"
+        "    public:\n"
+        "        VariantMemberReader(Reader& in, ReadStatus& status) : m_in(in), m_status(status) {}\n\n"
+        "        template <std::size_t TIdx, typename TField>\n"
+        "        void operator()(TField& field) const\n"
+        "        {\n"
+        "            m_status = FieldReader::read(m_in, field);\n"
+        "        }\n\n"
+        "    private:\n"
+        "        Reader& m_in;\n"
+        "        ReadStatus& m_status;\n"
+        "    };\n\n"
+        "    static ReadStatus numStatus(bool result)\n"
+        "    {\n"
+        "        return result ? ReadStatus::Success : ReadStatus::InvalidValue;\n"
+        "    }\n\n"
+        "    template <typename TValueType>\n"
+        "    static bool findEnumValue(const char* const* map, std::size_t count, const char* key, std::size_t keyLen, TValueType& value)\n"
+        "    {\n"
+        "        for (auto idx = 0U; idx < count; ++idx) {\n"
+        "            if ((map[idx] != nullptr) && (Reader::equals(key, keyLen, map[idx]))) {\n"
+        "                value = static_cast<TValueType>(idx);\n"
+        "                return true;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    template <typename TValueType>\n"
+        "    static bool findEnumValue(const std::pair<TValueType, const char*>* map, std::size_t count, const char* key, std::size_t keyLen, TValueType& value)\n"
+        "    {\n"
+        "        for (auto idx = 0U; idx < count; ++idx) {\n"
+        "            if (Reader::equals(key, keyLen, map[idx].second)) {\n"
+        "                value = map[idx].first;\n"
+        "                return true;\n"
+        "            }\n"
+        "        }\n\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::IntValue<TFieldBase, T, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        return numStatus(in.readInt(actField.value()));\n"
+        "    }\n\n"
+        "    template <typename TField>\n"
+        "    static ReadStatus readValue(Reader& in, TField& field, EnumFieldTag)\n"
+        "    {\n"
+        "        using ValueType = typename TField::ValueType;\n"
+        "        using UnderlyingType = typename std::underlying_type<ValueType>::type;\n\n"
+        "        if (!in.peek('\"')) {\n"
+        "            UnderlyingType value = 0;\n"
+        "            if (!in.readInt(value)) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            field.value() = static_cast<ValueType>(value);\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        const char* str = nullptr;\n"
+        "        std::size_t len = 0U;\n"
+        "        if (!in.readRawString(str, len)) {\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n\n"
+        "        auto namesMap = TField::valueNamesMap();\n"
+        "        if (!findEnumValue(namesMap.first, namesMap.second, str, len, field.value())) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        return ReadStatus::Success;\n"
+        "    }\n\n"
+        "    template <typename TField>\n"
+        "    static ReadStatus readValue(Reader& in, TField& field, BitmaskFieldTag)\n"
+        "    {\n"
+        "        if (!in.consume('[')) {\n"
+        "            return numStatus(in.readInt(field.value()));\n"
+        "        }\n\n"
+        "        field.value() = 0U;\n"
+        "        if (in.consume(']')) {\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        while (true) {\n"
+        "            const char* str = nullptr;\n"
+        "            std::size_t len = 0U;\n"
+        "            if (!in.readRawString(str, len)) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            bool found = false;\n"
+        "            for (auto idx = 0U; idx < static_cast<unsigned>(TField::BitIdx_numOfValues); ++idx) {\n"
+        "                auto bitIdx = static_cast<typename TField::BitIdx>(idx);\n"
+        "                auto* name = field.bitName(bitIdx);\n"
+        "                if ((name != nullptr) && (Reader::equals(str, len, name))) {\n"
+        "                    field.setBitValue(bitIdx, true);\n"
+        "                    found = true;\n"
+        "                    break;\n"
+        "                }\n"
+        "            }\n\n"
+        "            if (!found) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            if (in.consume(',')) {\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if (in.consume(']')) {\n"
+        "                return ReadStatus::Success;\n"
+        "            }\n\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::Bitfield<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        return readMembers(in, actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::Bundle<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        return readMembers(in, actField.value());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::FloatValue<TFieldBase, T, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        return numStatus(in.readFloat(actField.value()));\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::String<TFieldBase, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& value = static_cast<TField&>(field).value();\n"
+        "        value.clear();\n"
+        "        bool overflow = false;\n"
+        "        bool result =\n"
+        "            in.readString(\n"
+        "                [&value, &overflow](char ch)\n"
+        "                {\n"
+        "                    if (value.max_size() <= value.size()) {\n"
+        "                        overflow = true;\n"
+        "                        return;\n"
+        "                    }\n\n"
+        "                    value.push_back(ch);\n"
+        "                });\n\n"
+        "        if (!result) {\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n\n"
+        "        if (overflow) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        return ReadStatus::Success;\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TElement, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::ArrayList<TFieldBase, TElement, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        actField.value().clear();\n"
+        "        return readList(in, actField.value(), ElementTag<TField>());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TOptField, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::Optional<TOptField, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        if (in.consumeLiteral(\"null\")) {\n"
+        "            actField.setMissing();\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        actField.setExists();\n"
+        "        return read(in, actField.field());\n"
+        "    }\n\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    static ReadStatus readValue(Reader& in, comms::field::Variant<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag)\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        if (in.consumeLiteral(\"null\")) {\n"
+        "            actField.reset();\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        const char* key = nullptr;\n"
+        "        std::size_t keyLen = 0U;\n"
+        "        if ((!in.consume('{')) || (!in.readRawString(key, keyLen)) || (!in.consume(':'))) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        std::size_t idx = 0U;\n"
+        "        bool found = false;\n"
+        "        comms::util::tupleForEachType<TMembers>(VariantMemberFinder(key, keyLen, idx, found));\n"
+        "        if (!found) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        auto status = ReadStatus::Success;\n"
+        "        actField.selectField(idx);\n"
+        "        actField.currentFieldExec(VariantMemberReader(in, status));\n"
+        "        if (status != ReadStatus::Success) {\n"
+        "            return status;\n"
+        "        }\n\n"
+        "        if (!in.consume('}')) {\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n\n"
+        "        return ReadStatus::Success;\n"
+        "    }\n\n"
+        "    template <typename TVec>\n"
+        "    static ReadStatus readList(Reader& in, TVec& data, IntElementTag)\n"
+        "    {\n"
+        "        using ElementType = typename TVec::value_type;\n\n"
+        "        const char* str = nullptr;\n"
+        "        std::size_t len = 0U;\n"
+        "        if (!in.readRawString(str, len)) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        if ((len % 2U) != 0U) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        for (auto idx = 0U; idx < len; idx += 2U) {\n"
+        "            unsigned byte = 0U;\n"
+        "            for (auto digitIdx = 0U; digitIdx < 2U; ++digitIdx) {\n"
+        "                auto ch = str[idx + digitIdx];\n"
+        "                unsigned digit = 0U;\n"
+        "                if ((ch >= '0') && (ch <= '9')) {\n"
+        "                    digit = static_cast<unsigned>(ch - '0');\n"
+        "                }\n"
+        "                else if ((ch >= 'a') && (ch <= 'f')) {\n"
+        "                    digit = static_cast<unsigned>(ch - 'a') + 10U;\n"
+        "                }\n"
+        "                else if ((ch >= 'A') && (ch <= 'F')) {\n"
+        "                    digit = static_cast<unsigned>(ch - 'A') + 10U;\n"
+        "                }\n"
+        "                else {\n"
+        "                    return ReadStatus::InvalidValue;\n"
+        "                }\n\n"
+        "                byte = (byte << 4U) | digit;\n"
+        "            }\n\n"
+        "            if (data.max_size() <= data.size()) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            data.push_back(static_cast<ElementType>(byte));\n"
+        "        }\n\n"
+        "        return ReadStatus::Success;\n"
+        "    }\n\n"
+        "    template <typename TVec>\n"
+        "    static ReadStatus readList(Reader& in, TVec& data, FieldElementTag)\n"
+        "    {\n"
+        "        if (!in.consume('[')) {\n"
+        "            return ReadStatus::InvalidValue;\n"
+        "        }\n\n"
+        "        if (in.consume(']')) {\n"
+        "            return ReadStatus::Success;\n"
+        "        }\n\n"
+        "        while (true) {\n"
+        "            if (data.max_size() <= data.size()) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            data.emplace_back();\n"
+        "            auto status = read(in, data.back());\n"
+        "            if (status != ReadStatus::Success) {\n"
+        "                return status;\n"
+        "            }\n\n"
+        "            if (in.consume(',')) {\n"
+        "                continue;\n"
+        "            }\n\n"
+        "            if (in.consume(']')) {\n"
+        "                return ReadStatus::Success;\n"
+        "            }\n\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n"
+        "    }\n"
+        "};\n";
+
+    return Templ;
+}
+
+const std::string& messageInfoTempl()
+{
+    static const std::string Templ =
+        "struct MessageInfo\n"
+        "{\n"
+        "    std::uintmax_t m_id = 0U;\n"
+        "    const char* m_name = nullptr;\n"
+        "    std::size_t m_nameLen = 0U;\n"
+        "    const char* m_fields = nullptr;\n"
+        "    std::size_t m_fieldsLen = 0U;\n"
+        "    bool m_hasId = false;\n\n"
+        "    bool nameMatches(const char* name) const\n"
+        "    {\n"
+        "        return (m_name == nullptr) || Reader::equals(m_name, m_nameLen, name);\n"
+        "    }\n"
+        "};\n\n"
+        "inline ReadStatus parseMessageInfo(const char* str, std::size_t len, MessageInfo& info)\n"
+        "{\n"
+        "    Reader in(str, len);\n"
+        "    if (!in.consume('{')) {\n"
+        "        return ReadStatus::SyntaxError;\n"
+        "    }\n\n"
+        "    while (!in.consume('}')) {\n"
+        "        const char* key = nullptr;\n"
+        "        std::size_t keyLen = 0U;\n"
+        "        if ((!in.readRawString(key, keyLen)) || (!in.consume(':'))) {\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n\n"
+        "        if (Reader::equals(key, keyLen, \"id\")) {\n"
+        "            if (!in.readInt(info.m_id)) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n\n"
+        "            info.m_hasId = true;\n"
+        "        }\n"
+        "        else if (Reader::equals(key, keyLen, \"name\")) {\n"
+        "            if (!in.readRawString(info.m_name, info.m_nameLen)) {\n"
+        "                return ReadStatus::InvalidValue;\n"
+        "            }\n"
+        "        }\n"
+        "        else {\n"
+        "            in.skipWs();\n"
+        "            auto* begin = in.pos();\n"
+        "            if (!in.skipValue()) {\n"
+        "                return ReadStatus::SyntaxError;\n"
+        "            }\n\n"
+        "            if (Reader::equals(key, keyLen, \"fields\")) {\n"
+        "                info.m_fields = begin;\n"
+        "                info.m_fieldsLen = static_cast<std::size_t>(in.pos() - begin);\n"
+        "            }\n"
+        "        }\n\n"
+        "        if ((!in.consume(',')) && (!in.peek('}'))) {\n"
+        "            return ReadStatus::SyntaxError;\n"
+        "        }\n"
+        "    }\n\n"
+        "    if (!in.atEnd()) {\n"
+        "        return ReadStatus::SyntaxError;\n"
+        "    }\n\n"
+        "    return ReadStatus::Success;\n"
+        "}\n\n"
+        "template <typename TMsg, typename THandler>\n"
+        "ReadStatus readAndHandle(const MessageInfo& info, THandler& handler)\n"
+        "{\n"
+        "    TMsg msg;\n"
+        "    if (info.m_fields != nullptr) {\n"
+        "        Reader in(info.m_fields, info.m_fieldsLen);\n"
+        "        auto status = FieldReader::readMembers(in, msg.fields());\n"
+        "        if (status != ReadStatus::Success) {\n"
+        "            return status;\n"
+        "        }\n"
+        "    }\n\n"
+        "    msg.doRefresh();\n"
+        "    handler.handle(msg);\n"
+        "    return ReadStatus::Success;\n"
+        "}\n";
+
+    return Templ;
+}
+
+} // namespace 
+
+bool CommsJson::write(CommsGenerator& generator)
+{
+    auto& thisSchema = static_cast<CommsSchema&>(generator.currentSchema());
+    if ((!generator.isCurrentProtocolSchema()) && (!thisSchema.commsHasAnyMessage())) {
+        return true;
+    }
+
+    CommsJson obj(generator);
+    return obj.commsWriteInternal();
+}
+
+bool CommsJson::commsWriteInternal() const
+{
+    auto filePath = comms::headerPathRoot(JsonStr, m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    auto map = commsMessagesMapInternal();
+    auto headerfile = comms::relHeaderForRoot(JsonStr, m_generator);
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
+        {"HEADERFILE", headerfile},
+        {"MSG_ID_TYPE", comms::scopeForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"DEFAULT_OPTIONS", comms::scopeForOptions(strings::defaultOptionsClassStr(), m_generator)},
+        {"INCLUDES", commsIncludesInternal(map)},
+        {"CASES", commsCasesCodeInternal(map)},
+    };
+
+    if (map.empty()) {
+        repl["NO_MESSAGES"] = "static_cast<void>(handler);";
+    }
+
+    repl.insert({
+        {"WRITER", util::processTemplate(writerTempl(), repl)},
+        {"READER", util::processTemplate(readerTempl(), repl)},
+        {"FIELD_WRITER", fieldWriterTempl()},
+        {"FIELD_READER", fieldReaderTempl()},
+        {"MSG_INFO", messageInfoTempl()},
+    });
+
+    return m_generator.writeFile(filePath, util::processTemplate(mainTempl(), repl, true));
+}
+
+std::string CommsJson::commsIncludesInternal(const MessagesMap& map) const
+{
+    util::StringsList incs = {
+        comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator),
+        comms::relHeaderForOptions(strings::defaultOptionsClassStr(), m_generator),
+    };
+
+    for (auto& elem : map) {
+        for (auto* m : elem.second) {
+            incs.push_back(comms::relHeaderPathFor(*m, m_generator));
+        }
+    }
+
+    comms::prepareIncludeStatement(incs);
+    return util::strListToString(incs, "\n", "");
+}
+
+std::string CommsJson::commsCasesCodeInternal(const MessagesMap& map) const
+{
+    static const std::string CaseTempl = 
+        "case #^#ID#$#:\n"
+        "    #^#MESSAGES#$#\n"
+        "    break;";
+
+    static const std::string MsgTempl = 
+        "{\n"
+        "    using MsgType = #^#MESSAGE#$#<TInterface, TOpt>;\n"
+        "    if (info.nameMatches(MsgType::doName())) {\n"
+        "        return details::readAndHandle<MsgType>(info, handler);\n"
+        "    }\n"
+        "}";
+
+    util::StringsList cases;
+    for (auto& elem : map) {
+        util::StringsList messages;
+        for (auto* m : elem.second) {
+            util::ReplacementMap msgRepl = {
+                {"MESSAGE", comms::scopeFor(*m, m_generator)},
+            };
+
+            messages.push_back(util::processTemplate(MsgTempl, msgRepl));
+        }
+
+        util::ReplacementMap repl = {
+            {"ID", util::numToString(elem.first)},
+            {"MESSAGES", util::strListToString(messages, "\n", "")},
+        };
+
+        cases.push_back(util::processTemplate(CaseTempl, repl));
+    }
+
+    return util::strListToString(cases, "\n", "");
+}
+
+CommsJson::MessagesMap CommsJson::commsMessagesMapInternal() const
+{
+    MessagesMap map;
+    auto allMessages = m_generator.getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        assert(m != nullptr);
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        map[m->dslObj().id()].push_back(m);
+    }
+
+    return map;
+}
+
+} // namespace commsdsl2comms
@@ -32,6 +32,13 @@ namespace strings = commsdsl::gen::strings;
 namespace commsdsl2comms
 {
 
+namespace 
+{
+
+const std::string CachedLengthAttrStr("comms.cachedLength");
+
+} // namespace 
+
 CommsListField::CommsListField(
     CommsGenerator& generator, 
     commsdsl::parse::Field dslObj, 
@@ -75,6 +82,10 @@ bool CommsListField::prepareImpl()
             "please contact the developer and request this feature");
         return false;
     }
+
+    if (result && comms::isExtraAttributeEnabled(dslObj().extraAttributes(), CachedLengthAttrStr)) {
+        m_commsCachedLength = commsIsCachedLengthApplicableInternal();
+    }
     
     return result;
 }
@@ -187,6 +198,14 @@ CommsListField::IncludesList CommsListField::commsDefIncludesImpl() const
     if (!obj.detachedElemLengthPrefixFieldName().empty()) {
         result.push_back("comms/Assert.h");
     } 
+
+    if (m_commsCachedLength) {
+        result.insert(result.end(), {
+            "<cstddef>",
+            "<limits>",
+            "<utility>"
+        });
+    }
     return result;
 }
 
@@ -233,6 +252,90 @@ std::string CommsListField::commsDefBaseClassImpl() const
     return util::processTemplate(Templ, repl);
 }
 
+std::string CommsListField::commsDefPublicCodeImpl() const
+{
+    if (!m_commsCachedLength) {
+        return strings::emptyString();
+    }
+
+    static const std::string Templ = 
+        "/// @brief Access the stored list.\n"
+        "/// @details Invalidates the cached serialisation length, don't keep the\n"
+        "///     returned reference after the @ref length() invocation.\n"
+        "typename Base::ValueType& value()\n"
+        "{\n"
+        "    m_cachedLength = noCachedLength();\n"
+        "    return Base::value();\n"
+        "}\n\n"
+        "/// @brief Access the stored list (const version).\n"
+        "const typename Base::ValueType& value() const\n"
+        "{\n"
+        "    return Base::value();\n"
+        "}\n\n"
+        "/// @brief Replace the stored list.\n"
+        "template <typename U>\n"
+        "void setValue(U&& val)\n"
+        "{\n"
+        "    value() = std::forward<U>(val);\n"
+        "}\n\n"
+        "/// @brief Get the serialisation length.\n"
+        "/// @details Computed once and cached until the next modification.\n"
+        "std::size_t length() const\n"
+        "{\n"
+        "    if (m_cachedLength == noCachedLength()) {\n"
+        "        m_cachedLength = Base::length();\n"
+        "    }\n\n"
+        "    return m_cachedLength;\n"
+        "}\n\n"
+        "/// @brief Read the list, invalidates the cached serialisation length.\n"
+        "template <typename TIter>\n"
+        "comms::ErrorStatus read(TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    m_cachedLength = noCachedLength();\n"
+        "    return Base::read(iter, len);\n"
+        "}\n\n"
+        "/// @brief Read the list without error check, invalidates the cached serialisation length.\n"
+        "template <typename TIter>\n"
+        "void readNoStatus(TIter& iter)\n"
+        "{\n"
+        "    m_cachedLength = noCachedLength();\n"
+        "    Base::readNoStatus(iter);\n"
+        "}\n\n"
+        "/// @brief Refresh the list, invalidates the cached serialisation length when updated.\n"
+        "bool refresh()\n"
+        "{\n"
+        "    if (!Base::refresh()) {\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    m_cachedLength = noCachedLength();\n"
+        "    return true;\n"
+        "}\n\n"
+        "/// @brief Update the version, invalidates the cached serialisation length.\n"
+        "bool setVersion(typename Base::VersionType version)\n"
+        "{\n"
+        "    m_cachedLength = noCachedLength();\n"
+        "    return Base::setVersion(version);\n"
+        "}\n";
+
+    return Templ;
+}
+
+std::string CommsListField::commsDefPrivateCodeImpl() const
+{
+    if (!m_commsCachedLength) {
+        return strings::emptyString();
+    }
+
+    static const std::string Templ = 
+        "static constexpr std::size_t noCachedLength()\n"
+        "{\n"
+        "    return std::numeric_limits<std::size_t>::max();\n"
+        "}\n\n"
+        "mutable std::size_t m_cachedLength = noCachedLength();\n";
+
+    return Templ;
+}
+
 std::string CommsListField::commsDefBundledReadPrepareFuncBodyImpl(const CommsFieldsList& siblings) const
 {
     auto obj = listDslObj();
@@ -582,6 +685,43 @@ std::string CommsListField::commsDefElementInternal() const
     return comms::scopeFor(m_commsExternalElementField->field(), generator()) + "<TOpt>";
 }
 
+bool CommsListField::commsIsCachedLengthApplicableInternal() const
+{
+    auto fieldRef = dslObj().externalRef();
+    if (commsHasCustomValueAccess()) {
+        generator().logger().warning(
+            "The \"" + CachedLengthAttrStr + "\" attribute of \"" + fieldRef + 
+            "\" field is ignored due to custom value access code.");
+        return false;
+    }
+
+    auto* elemField = m_commsMemberElementField;
+    if (elemField == nullptr) {
+        elemField = m_commsExternalElementField;
+    }
+
+    assert(elemField != nullptr);
+    auto obj = listDslObj();
+    bool hasElemLengthPrefix = 
+        (m_commsExternalElemLengthPrefixField != nullptr) ||
+        (m_commsMemberElemLengthPrefixField != nullptr) ||
+        (!obj.detachedElemLengthPrefixFieldName().empty());
+
+    bool variableElemLength = 
+        (elemField->commsMinLength() != elemField->commsMaxLength()) ||
+        (elemField->commsHasCustomLength()) ||
+        (hasElemLengthPrefix && (!obj.elemFixedLength()));
+
+    if (!variableElemLength) {
+        generator().logger().warning(
+            "The \"" + CachedLengthAttrStr + "\" attribute of \"" + fieldRef + 
+            "\" field is ignored, the elements have fixed length.");
+        return false;
+    }
+
+    return true;
+}
+
 void CommsListField::commsAddFixedLengthOptInternal(StringsList& opts) const
 {
     auto obj = listDslObj();
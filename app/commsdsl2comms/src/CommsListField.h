@@ -42,6 +42,8 @@ protected:
     virtual IncludesList commsDefIncludesImpl() const override;
     virtual std::string commsDefMembersCodeImpl() const override;
     virtual std::string commsDefBaseClassImpl() const override;
+    virtual std::string commsDefPublicCodeImpl() const override;
+    virtual std::string commsDefPrivateCodeImpl() const override;
     virtual std::string commsDefBundledReadPrepareFuncBodyImpl(const CommsFieldsList& siblings) const override;
     virtual std::string commsDefBundledRefreshFuncBodyImpl(const CommsFieldsList& siblings) const override;
     virtual bool commsIsLimitedCustomizableImpl() const override;
@@ -60,6 +62,7 @@ private:
     void commsAddElemLengthPrefixOptInternal(StringsList& opts) const;
     void commsAddTermSuffixOptInternal(StringsList& opts) const;
     void commsAddLengthForcingOptInternal(StringsList& opts) const;
+    bool commsIsCachedLengthApplicableInternal() const;
 
     CommsField* m_commsExternalElementField = nullptr;
     CommsField* m_commsMemberElementField = nullptr;
@@ -71,7 +74,7 @@ private:
     CommsField* m_commsMemberElemLengthPrefixField = nullptr;
     CommsField* m_commsExternalTermSuffixField = nullptr;
     CommsField* m_commsMemberTermSuffixField = nullptr;
-
+    bool m_commsCachedLength = false;
 };
 
 } // namespace commsdsl2comms
@@ -19,6 +19,7 @@
 #include "CommsGenerator.h"
 #include "CommsOptionalField.h"
 #include "CommsSchema.h"
+#include "CommsSharedFields.h"
 
 #include "commsdsl/gen/comms.h"
 #include "commsdsl/gen/strings.h"
@@ -26,7 +27,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <numeric>
 #include <utility>
@@ -58,13 +58,13 @@ bool isOverrideCodeRequired(commsdsl::parse::OverrideType value)
         (value == commsdsl::parse::OverrideType_Extend);
 }
 
-void readCustomCodeInternal(const std::string& codePath, std::string& code)
+void readCustomCodeInternal(const commsdsl::gen::Generator& generator, const std::string& codePath, std::string& code)
 {
-    if (!util::isFileReadable(codePath)) {
+    if (!generator.isCodeFileReadable(codePath)) {
         return;
     }
 
-    code = util::readFileContents(codePath);
+    code = generator.readCodeFile(codePath);
 }
 
 std::pair<const CommsField*, std::string> findInterfaceFieldInternal(const CommsGenerator& generator, const std::string& refStr)
@@ -208,6 +208,33 @@ CommsMessage::CommsMessage(CommsGenerator& generator, commsdsl::parse::Message d
 
 CommsMessage::~CommsMessage() = default;
 
+std::size_t CommsMessage::commsMinLength() const
+{
+    return 
+        std::accumulate(
+            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
+            [](std::size_t soFar, auto* f)
+            {
+                return comms::addLength(soFar, f->commsMinLength());
+            });
+}
+
+std::size_t CommsMessage::commsMaxLength() const
+{
+    return 
+        std::accumulate(
+            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
+            [](std::size_t soFar, auto* f)
+            {
+                return comms::addLength(soFar, f->commsMaxLength());
+            });
+}
+
+bool CommsMessage::commsHasCustomRead() const
+{
+    return (!m_customCode.m_read.empty()) || (!commsDefReadFuncInternal().empty());
+}
+
 std::string CommsMessage::commsDefaultOptions() const
 {
     return commsCustomizationOptionsInternal(&CommsField::commsDefaultOptions, nullptr, false);
@@ -257,13 +284,13 @@ bool CommsMessage::prepareImpl()
         return false;
     }
 
-    readCustomCodeInternal(codePathPrefix + strings::constructFileSuffixStr(), m_customConstruct);
-    readCustomCodeInternal(codePathPrefix + strings::incFileSuffixStr(), m_customCode.m_inc);
-    readCustomCodeInternal(codePathPrefix + strings::publicFileSuffixStr(), m_customCode.m_public);
-    readCustomCodeInternal(codePathPrefix + strings::protectedFileSuffixStr(), m_customCode.m_protected);
-    readCustomCodeInternal(codePathPrefix + strings::privateFileSuffixStr(), m_customCode.m_private);
-    readCustomCodeInternal(codePathPrefix + strings::extendFileSuffixStr(), m_customCode.m_extend);
-    readCustomCodeInternal(codePathPrefix + strings::appendFileSuffixStr(), m_customCode.m_append);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::constructFileSuffixStr(), m_customConstruct);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::incFileSuffixStr(), m_customCode.m_inc);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::publicFileSuffixStr(), m_customCode.m_public);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::protectedFileSuffixStr(), m_customCode.m_protected);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::privateFileSuffixStr(), m_customCode.m_private);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::extendFileSuffixStr(), m_customCode.m_extend);
+    readCustomCodeInternal(generator(), codePathPrefix + strings::appendFileSuffixStr(), m_customCode.m_append);
 
     m_commsFields = CommsField::commsTransformFieldsList(fields());
     m_bundledReadPrepareCodes.reserve(m_commsFields.size());
@@ -320,7 +347,7 @@ bool CommsMessage::commsPrepareOverrideInternal(
             break;
         }
 
-        auto contents = util::readFileContents(codePathPrefix + suffix);
+        auto contents = generator().readCodeFile(codePathPrefix + suffix);
         if (contents.empty()) {
             break;
         }
@@ -352,12 +379,6 @@ bool CommsMessage::commsWriteCommonInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -387,9 +408,7 @@ bool CommsMessage::commsWriteCommonInternal() const
         {"BODY", commsCommonBodyInternal()},
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool CommsMessage::commsWriteDefInternal() const
@@ -398,23 +417,14 @@ bool CommsMessage::commsWriteDefInternal() const
     auto writeFunc = 
         [&gen](const std::string& filePath, const std::string& content)
         {
-            auto& logger = gen.logger();
-            logger.info("Generating " + filePath);
+            gen.logger().info("Generating " + filePath);
 
-            std::ofstream stream(filePath);
-            if (!stream) {
-                logger.error("Failed to open \"" + filePath + "\" for writing.");
-                return false;
-            }
-            
-            stream << content;
-            stream.flush();
-            return stream.good();
+            return gen.writeFile(filePath, content);
         };
     
     auto genFilePath = comms::headerPathFor(*this, gen);
     auto codePathPrefix = comms::inputCodePathFor(*this, gen);
-    auto replaceContent = util::readFileContents(codePathPrefix + strings::replaceFileSuffixStr());
+    auto replaceContent = gen.readCodeFile(codePathPrefix + strings::replaceFileSuffixStr());
     if (!replaceContent.empty()) {
         return writeFunc(genFilePath, replaceContent);
     }
@@ -583,6 +593,10 @@ std::string CommsMessage::commsDefIncludesInternal() const
     for (auto* commsField : m_commsFields) {
         assert(commsField != nullptr);
 
+        if (CommsSharedFields::commsIsShared(CommsGenerator::cast(gen), *commsField)) {
+            includes.push_back(CommsSharedFields::commsRelHeaderPath(CommsGenerator::cast(gen)));
+        }
+
         auto fIncludes = commsField->commsDefIncludes();
         includes.reserve(includes.size() + fIncludes.size());
         std::move(fIncludes.begin(), fIncludes.end(), std::back_inserter(includes));
@@ -621,9 +635,16 @@ std::string CommsMessage::commsDefConstructInternal() const
 
 std::string CommsMessage::commsDefFieldsCodeInternal() const
 {
+    auto& gen = CommsGenerator::cast(generator());
     util::StringsList fields;
     for (auto* commsField : m_commsFields) {
         assert(commsField != nullptr);
+        auto sharedCode = CommsSharedFields::commsDefCode(gen, *commsField);
+        if (!sharedCode.empty()) {
+            fields.push_back(std::move(sharedCode));
+            continue;
+        }
+
         fields.push_back(commsField->commsDefCode());
     }
     return util::strListToString(fields, "\n", "");
@@ -905,7 +926,7 @@ std::string CommsMessage::commsDefFieldsAccessInternal() const
 
 std::string CommsMessage::commsDefFieldsAliasesInternal() const
 {
-    auto aliases = dslObj().aliases();
+    auto& aliases = dslObj().aliasesView();
     if (aliases.empty()) {
         return strings::emptyString();    
     }
@@ -967,20 +988,8 @@ std::string CommsMessage::commsDefLengthCheckInternal() const
         "#^#MAX_LEN_ASSERT#$#\n"
     ;
 
-    auto minLength =
-        std::accumulate(
-            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
-            [](std::size_t soFar, auto* f)
-            {
-                return comms::addLength(soFar, f->commsMinLength());
-            });
-    auto maxLength =
-        std::accumulate(
-            m_commsFields.begin(), m_commsFields.end(), std::size_t(0),
-            [](std::size_t soFar, auto* f)
-            {
-                return comms::addLength(soFar, f->commsMaxLength());
-            });    
+    auto minLength = commsMinLength();
+    auto maxLength = commsMaxLength();
 
     util::ReplacementMap repl = {
         {"MIN_LEN_VAL", util::numToString(minLength)},
@@ -43,6 +43,10 @@ public:
         return m_commsFields;
     }
 
+    std::size_t commsMinLength() const;
+    std::size_t commsMaxLength() const;
+    bool commsHasCustomRead() const;
+
     std::string commsDefaultOptions() const;
     std::string commsClientDefaultOptions() const;
     std::string commsServerDefaultOptions() const;
@@ -25,7 +25,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 #include <map>
 
 namespace comms = commsdsl::gen::comms;
@@ -225,12 +224,6 @@ bool commsWriteFileInternal(
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -348,7 +341,7 @@ bool commsWriteFileInternal(
     MessagesMap mappedMessages;
 
     for (auto* m : allMessages) {
-        if (!checkFunc(*m)) {
+        if ((!m->isReferenced()) || (!checkFunc(*m))) {
             continue;
         }
 
@@ -371,8 +364,8 @@ bool commsWriteFileInternal(
         {"POLICY", *policyStr},
         {"DESC", desc},
         {"INCLUDES", util::strListToString(includes, "\n", "\n")},
-        {"EXTEND", util::readFileContents(comms::inputCodePathForFactory(name, generator) + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(comms::inputCodePathForFactory(name, generator) + strings::appendFileSuffixStr())},
+        {"EXTEND", generator.readCodeFile(comms::inputCodePathForFactory(name, generator) + strings::extendFileSuffixStr())},
+        {"APPEND", generator.readCodeFile(comms::inputCodePathForFactory(name, generator) + strings::appendFileSuffixStr())},
         {"HAS_UNIQUE_IDS", util::boolToString(hasUniqueIds)},
         {"IN_PLACE_ALLOC", util::boolToString(inPlaceAlloc)},
         {"CAN_ALLOCATE", "true"},
@@ -389,9 +382,7 @@ bool commsWriteFileInternal(
         assert(false); // Not implemented
     }
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 } // namespace 
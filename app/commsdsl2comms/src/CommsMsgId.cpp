@@ -17,6 +17,7 @@
 
 #include "CommsGenerator.h"
 #include "CommsEnumField.h"
+#include "CommsMessage.h"
 #include "CommsSchema.h"
 
 #include "commsdsl/gen/strings.h"
@@ -25,8 +26,11 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
+#include <cstdint>
 #include <limits>
+#include <map>
+#include <type_traits>
+#include <vector>
 
 namespace util = commsdsl::gen::util;
 namespace comms = commsdsl::gen::comms;
@@ -40,6 +44,47 @@ namespace
 
 using ReplacementMap = commsdsl::gen::util::ReplacementMap;
 
+const std::string MsgMetaStr("MsgMeta");
+const std::uint32_t NameHashBasis = 2166136261U;
+const std::uint32_t NameHashPrime = 16777619U;
+const std::uint32_t MaxNameHashSeed = 0xffff;
+
+// Must be the same as msgMetaNameHashInternal() in the generated code
+std::uint32_t nameHash(const std::string& name, std::uint32_t hash)
+{
+    for (auto ch : name) {
+        hash = static_cast<std::uint32_t>((hash ^ static_cast<std::uint8_t>(ch)) * NameHashPrime);
+    }
+    return hash;
+}
+
+// Finds initial hash value mapping every name into a separate slot
+bool findNameHashSeed(const util::StringsList& names, std::size_t slotsCount, std::uint32_t& seed)
+{
+    std::vector<bool> usedSlots;
+    for (std::uint32_t s = 0U; s <= MaxNameHashSeed; ++s) {
+        usedSlots.assign(slotsCount, false);
+        auto basis = NameHashBasis ^ s;
+        bool collision = false;
+        for (auto& n : names) {
+            auto slot = nameHash(n, basis) % slotsCount;
+            if (usedSlots[slot]) {
+                collision = true;
+                break;
+            }
+
+            usedSlots[slot] = true;
+        }
+
+        if (!collision) {
+            seed = basis;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 } // namespace 
     
 
@@ -55,6 +100,13 @@ bool CommsMsgId::write(CommsGenerator& generator)
 }
 
 bool CommsMsgId::commsWriteInternal() const
+{
+    return 
+        commsWriteMsgIdInternal() &&
+        commsWriteMetaInternal();
+}
+
+bool CommsMsgId::commsWriteMsgIdInternal() const
 {
     auto filePath = comms::headerPathRoot(strings::msgIdEnumNameStr(), m_generator);
 
@@ -66,12 +118,6 @@ bool CommsMsgId::commsWriteInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ = 
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -96,10 +142,7 @@ bool CommsMsgId::commsWriteInternal() const
         {"IDS", commsIdsInternal()}
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
@@ -173,4 +216,303 @@ std::string CommsMsgId::commsIdsInternal() const
     return util::strListToString(ids, ",\n", "");
 }
 
+bool CommsMsgId::commsWriteMetaInternal() const
+{
+    MessagesList messages;
+    auto allMessages = m_generator.getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        messages.push_back(m);
+    }
+
+    if (messages.empty()) {
+        return true;
+    }
+
+    auto filePath = comms::headerPathRoot(MsgMetaStr, m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    std::map<std::string, std::size_t> namesMap;
+    for (auto idx = 0U; idx < messages.size(); ++idx) {
+        auto dslObj = messages[idx]->dslObj();
+        // Only first message having the name is found by name lookup
+        namesMap.insert(std::make_pair(util::displayName(dslObj.displayName(), dslObj.name()), idx));
+    }
+
+    util::StringsList names;
+    for (auto& n : namesMap) {
+        names.push_back(n.first);
+    }
+
+    std::uint32_t seed = NameHashBasis;
+    auto slotsCount = names.size() * 2U;
+    while (!findNameHashSeed(names, slotsCount, seed)) {
+        slotsCount *= 2U;
+    }
+
+    std::vector<std::size_t> slots(slotsCount, messages.size());
+    for (auto& n : namesMap) {
+        slots[nameHash(n.first, seed) % slotsCount] = n.second;
+    }
+
+    util::StringsList slotsStrings;
+    for (auto s : slots) {
+        slotsStrings.push_back(util::numToString(static_cast<std::uintmax_t>(s)));
+    }
+
+    auto firstId = messages.front()->dslObj().id();
+    auto lastId = messages.back()->dslObj().id();
+    bool dense = ((lastId - firstId) + 1U) == messages.size();
+    for (auto idx = 1U; dense && (idx < messages.size()); ++idx) {
+        dense = (messages[idx - 1U]->dslObj().id() != messages[idx]->dslObj().id());
+    }
+
+    const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains compile time metadata of the protocol messages.\n\n"
+        "#pragma once\n\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        "#include <limits>\n"
+        "#include \"#^#MSG_ID_HEADER#$#\"\n\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Sender of the message.\n"
+        "enum MsgMetaSender : std::uint8_t\n"
+        "{\n"
+        "    MsgMetaSender_Both, ///< Sent by both client and server.\n"
+        "    MsgMetaSender_Client, ///< Sent by client only.\n"
+        "    MsgMetaSender_Server, ///< Sent by server only.\n"
+        "};\n\n"
+        "/// @brief Bits of the @ref MsgMeta::platforms mask.\n"
+        "enum MsgMetaPlatform : std::uint64_t\n"
+        "{\n"
+        "    #^#PLATFORMS#$#\n"
+        "    MsgMetaPlatform_All = 0xFFFFFFFFFFFFFFFFULL ///< All the platforms.\n"
+        "};\n\n"
+        "/// @brief Value of @ref MsgMeta::maxLength when serialisation length is not limited.\n"
+        "constexpr std::size_t MsgMetaUnlimitedLength = std::numeric_limits<std::size_t>::max();\n\n"
+        "/// @brief Value of @ref MsgMeta::deprecatedSince when the message is not deprecated.\n"
+        "constexpr unsigned MsgMetaNotDeprecated = std::numeric_limits<unsigned>::max();\n\n"
+        "/// @brief Metadata of a single message, available without message object construction.\n"
+        "struct MsgMeta\n"
+        "{\n"
+        "    MsgId id; ///< Numeric ID of the message.\n"
+        "    const char* name; ///< Name of the message, same as reported by @b name() member function.\n"
+        "    std::size_t minLength; ///< Minimal serialisation length of the payload.\n"
+        "    std::size_t maxLength; ///< Maximal serialisation length of the payload, see @ref MsgMetaUnlimitedLength.\n"
+        "    MsgMetaSender sender; ///< Sender of the message.\n"
+        "    unsigned sinceVersion; ///< Version of the protocol the message was introduced in.\n"
+        "    unsigned deprecatedSince; ///< Version of the protocol the message was deprecated in, see @ref MsgMetaNotDeprecated.\n"
+        "    std::uint64_t platforms; ///< Mask of @ref MsgMetaPlatform values the message is supported on.\n"
+        "};\n\n"
+        "/// @brief Tables of the messages metadata.\n"
+        "/// @details Defined as template to allow definition of the static data in the header.\n"
+        "template <typename TDummy = void>\n"
+        "struct MsgMetaTables\n"
+        "{\n"
+        "    /// @brief Metadata of all the messages sorted by their numeric ID.\n"
+        "    static constexpr MsgMeta Values[] = {\n"
+        "        #^#VALUES#$#\n"
+        "    };\n\n"
+        "    /// @brief Number of messages.\n"
+        "    static constexpr std::size_t Count = sizeof(Values) / sizeof(Values[0]);\n\n"
+        "    /// @brief Initial value of the name hash, selected to avoid collisions.\n"
+        "    static constexpr std::uint32_t NameHashSeed = #^#SEED#$#;\n\n"
+        "    /// @brief Indices in @ref Values for every hashed name slot, @ref Count for unused slot.\n"
+        "    static constexpr std::size_t NameSlots[] = {\n"
+        "        #^#SLOTS#$#\n"
+        "    };\n\n"
+        "    /// @brief Number of name slots.\n"
+        "    static constexpr std::size_t NameSlotsCount = sizeof(NameSlots) / sizeof(NameSlots[0]);\n"
+        "};\n\n"
+        "template <typename TDummy>\n"
+        "constexpr MsgMeta MsgMetaTables<TDummy>::Values[];\n\n"
+        "template <typename TDummy>\n"
+        "constexpr std::size_t MsgMetaTables<TDummy>::NameSlots[];\n\n"
+        "/// @brief Number of entries in the messages metadata table.\n"
+        "constexpr std::size_t msgMetaCount()\n"
+        "{\n"
+        "    return MsgMetaTables<>::Count;\n"
+        "}\n\n"
+        "/// @brief Access metadata entry by its index.\n"
+        "/// @details The entries are sorted by numeric message ID.\n"
+        "constexpr const MsgMeta& msgMetaAt(std::size_t idx)\n"
+        "{\n"
+        "    return MsgMetaTables<>::Values[idx];\n"
+        "}\n\n"
+        "#^#INDEX_OF#$#\n"
+        "/// @brief Find metadata of the message by its numeric ID.\n"
+        "/// @return Pointer to the first entry with the provided ID, @b nullptr if not found.\n"
+        "constexpr const MsgMeta* msgMetaFind(MsgId id)\n"
+        "{\n"
+        "    return (msgMetaIndexOf(id) < msgMetaCount()) ? &msgMetaAt(msgMetaIndexOf(id)) : nullptr;\n"
+        "}\n\n"
+        "/// @cond INTERNAL\n"
+        "constexpr std::uint32_t msgMetaNameHashInternal(const char* name, std::uint32_t hash)\n"
+        "{\n"
+        "    return (*name == '\\0') ? hash : \n"
+        "        msgMetaNameHashInternal(name + 1, static_cast<std::uint32_t>((hash ^ static_cast<std::uint8_t>(*name)) * #^#PRIME#$#));\n"
+        "}\n\n"
+        "constexpr bool msgMetaNamesEqualInternal(const char* first, const char* second)\n"
+        "{\n"
+        "    return (*first == *second) && ((*first == '\\0') || msgMetaNamesEqualInternal(first + 1, second + 1));\n"
+        "}\n\n"
+        "constexpr std::size_t msgMetaNameCheckInternal(const char* name, std::size_t idx)\n"
+        "{\n"
+        "    return ((idx < msgMetaCount()) && msgMetaNamesEqualInternal(msgMetaAt(idx).name, name)) ? idx : msgMetaCount();\n"
+        "}\n"
+        "/// @endcond\n\n"
+        "/// @brief Find index of the metadata entry by the message name.\n"
+        "/// @details Uses perfect hash of the message names computed at generation time.\n"
+        "/// @return Index of the entry, @ref msgMetaCount() if not found.\n"
+        "constexpr std::size_t msgMetaIndexOfName(const char* name)\n"
+        "{\n"
+        "    return\n"
+        "        msgMetaNameCheckInternal(\n"
+        "            name,\n"
+        "            MsgMetaTables<>::NameSlots[msgMetaNameHashInternal(name, MsgMetaTables<>::NameHashSeed) % MsgMetaTables<>::NameSlotsCount]);\n"
+        "}\n\n"
+        "/// @brief Find metadata of the message by its name.\n"
+        "/// @return Pointer to the entry, @b nullptr if not found.\n"
+        "constexpr const MsgMeta* msgMetaFindByName(const char* name)\n"
+        "{\n"
+        "    return (msgMetaIndexOfName(name) < msgMetaCount()) ? &msgMetaAt(msgMetaIndexOfName(name)) : nullptr;\n"
+        "}\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n"
+        ;
+
+    static const std::string DenseIndexTempl = 
+        "/// @brief Find index of the first metadata entry with the provided numeric ID.\n"
+        "/// @details The IDs are contiguous, direct indexing is used.\n"
+        "/// @return Index of the entry, @ref msgMetaCount() if not found.\n"
+        "constexpr std::size_t msgMetaIndexOf(MsgId id)\n"
+        "{\n"
+        "    return\n"
+        "        ((static_cast<std::uintmax_t>(id) - #^#FIRST_ID#$#) < msgMetaCount()) ?\n"
+        "            static_cast<std::size_t>(static_cast<std::uintmax_t>(id) - #^#FIRST_ID#$#) :\n"
+        "            msgMetaCount();\n"
+        "}\n";
+
+    static const std::string SparseIndexTempl = 
+        "/// @cond INTERNAL\n"
+        "constexpr std::size_t msgMetaLowerBoundInternal(MsgId id, std::size_t from, std::size_t to)\n"
+        "{\n"
+        "    return\n"
+        "        (to <= from) ? from :\n"
+        "        (msgMetaAt(from + ((to - from) / 2U)).id < id) ?\n"
+        "            msgMetaLowerBoundInternal(id, from + ((to - from) / 2U) + 1U, to) :\n"
+        "            msgMetaLowerBoundInternal(id, from, from + ((to - from) / 2U));\n"
+        "}\n\n"
+        "constexpr std::size_t msgMetaIdCheckInternal(MsgId id, std::size_t idx)\n"
+        "{\n"
+        "    return ((idx < msgMetaCount()) && (msgMetaAt(idx).id == id)) ? idx : msgMetaCount();\n"
+        "}\n"
+        "/// @endcond\n\n"
+        "/// @brief Find index of the first metadata entry with the provided numeric ID.\n"
+        "/// @details Uses binary search.\n"
+        "/// @return Index of the entry, @ref msgMetaCount() if not found.\n"
+        "constexpr std::size_t msgMetaIndexOf(MsgId id)\n"
+        "{\n"
+        "    return msgMetaIdCheckInternal(id, msgMetaLowerBoundInternal(id, 0U, msgMetaCount()));\n"
+        "}\n";
+
+    util::ReplacementMap indexRepl = {
+        {"FIRST_ID", util::numToString(firstId)},
+    };
+
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
+        {"MSG_ID_HEADER", comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"PLATFORMS", commsMetaPlatformsInternal()},
+        {"VALUES", commsMetaValuesInternal(messages)},
+        {"SEED", util::numToString(static_cast<std::uintmax_t>(seed))},
+        {"PRIME", util::numToString(static_cast<std::uintmax_t>(NameHashPrime))},
+        {"SLOTS", util::strListToString(slotsStrings, ", ", "")},
+        {"INDEX_OF", util::processTemplate(dense ? DenseIndexTempl : SparseIndexTempl, indexRepl)},
+    };
+
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+std::string CommsMsgId::commsMetaValuesInternal(const MessagesList& messages) const
+{
+    static const std::string SenderMap[] = {
+        /* Both */ "MsgMetaSender_Both",
+        /* Client */ "MsgMetaSender_Client",
+        /* Server */ "MsgMetaSender_Server",
+    };
+    static const std::size_t SenderMapSize = std::extent<decltype(SenderMap)>::value;
+    static_assert(SenderMapSize == static_cast<unsigned>(commsdsl::parse::Message::Sender::NumOfValues), "Invalid map");
+
+    static const std::string Templ = 
+        "{static_cast<MsgId>(#^#ID#$#), \"#^#NAME#$#\", #^#MIN_LEN#$#, #^#MAX_LEN#$#, #^#SENDER#$#, #^#SINCE#$#, #^#DEPRECATED#$#, #^#PLATFORMS#$#}";
+
+    auto& allPlatforms = m_generator.currentSchema().platformNames();
+    util::StringsList values;
+    for (auto* m : messages) {
+        auto* commsMsg = static_cast<const CommsMessage*>(m);
+        auto dslObj = m->dslObj();
+        auto senderIdx = static_cast<unsigned>(dslObj.sender());
+        assert(senderIdx < SenderMapSize);
+
+        util::StringsList platforms;
+        for (auto& p : dslObj.platforms()) {
+            auto iter = std::find(allPlatforms.begin(), allPlatforms.end(), p);
+            if ((iter == allPlatforms.end()) || (64 <= std::distance(allPlatforms.begin(), iter))) {
+                platforms.clear();
+                break;
+            }
+
+            platforms.push_back("MsgMetaPlatform_" + p);
+        }
+
+        util::ReplacementMap repl = {
+            {"ID", util::numToString(dslObj.id())},
+            {"NAME", util::displayName(dslObj.displayName(), dslObj.name())},
+            {"MIN_LEN", util::numToString(static_cast<std::uintmax_t>(commsMsg->commsMinLength()))},
+            {"MAX_LEN", "MsgMetaUnlimitedLength"},
+            {"SENDER", SenderMap[senderIdx]},
+            {"SINCE", util::numToString(dslObj.sinceVersion())},
+            {"DEPRECATED", "MsgMetaNotDeprecated"},
+            {"PLATFORMS", "MsgMetaPlatform_All"},
+        };
+
+        auto maxLength = commsMsg->commsMaxLength();
+        if (maxLength != comms::maxPossibleLength()) {
+            repl["MAX_LEN"] = util::numToString(static_cast<std::uintmax_t>(maxLength));
+        }
+
+        if (dslObj.deprecatedSince() != commsdsl::parse::Protocol::notYetDeprecated()) {
+            repl["DEPRECATED"] = util::numToString(dslObj.deprecatedSince());
+        }
+
+        if (!platforms.empty()) {
+            repl["PLATFORMS"] = util::strListToString(platforms, " | ", "");
+        }
+
+        values.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(values, ",\n", "");
+}
+
+std::string CommsMsgId::commsMetaPlatformsInternal() const
+{
+    auto& allPlatforms = m_generator.currentSchema().platformNames();
+    util::StringsList values;
+    for (auto idx = 0U; (idx < allPlatforms.size()) && (idx < 64U); ++idx) {
+        values.push_back(
+            "MsgMetaPlatform_" + allPlatforms[idx] + " = " + 
+            util::numToString(std::uintmax_t(1U) << idx, 16U) + ", ///< Platform @b " + allPlatforms[idx] + ".");
+    }
+
+    return util::strListToString(values, "\n", "");
+}
+
 } // namespace commsdsl2comms
\ No newline at end of file
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include "commsdsl/gen/Namespace.h"
+
 #include <string>
 
 namespace commsdsl2comms
@@ -27,11 +29,17 @@ public:
     static bool write(CommsGenerator& generator);
 
 private:
+    using MessagesList = commsdsl::gen::Namespace::MessagesAccessList;
+
     explicit CommsMsgId(CommsGenerator& generator) : m_generator(generator) {}
 
     bool commsWriteInternal() const;
+    bool commsWriteMsgIdInternal() const;
+    bool commsWriteMetaInternal() const;
     std::string commsTypeInternal() const;
     std::string commsIdsInternal() const;
+    std::string commsMetaValuesInternal(const MessagesList& messages) const;
+    std::string commsMetaPlatformsInternal() const;
     
     CommsGenerator& m_generator;
 };
@@ -441,6 +441,10 @@ std::string CommsNamespace::commsOptionsInternal(
         util::StringsList messageElems;
         for (auto& msgPtr : messages()) {
             assert(msgPtr);
+            if (!msgPtr->isReferenced()) {
+                continue;
+            }
+
             addSubElemFunc((static_cast<const CommsMessage*>(msgPtr.get())->*messageOptsFunc)(), messageElems);
         }
 
@@ -463,6 +467,10 @@ std::string CommsNamespace::commsOptionsInternal(
         util::StringsList frameElems;
         for (auto& framePtr : frames()) {
             assert(framePtr);
+            if (!framePtr->isReferenced()) {
+                continue;
+            }
+
             addSubElemFunc((static_cast<const CommsFrame*>(framePtr.get())->*frameOptsFunc)(), frameElems);
         } 
 
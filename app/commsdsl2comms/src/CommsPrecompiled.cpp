@@ -0,0 +1,390 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "CommsPrecompiled.h"
+
+#include "CommsGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace 
+{
+
+using PrecompiledLib = CommsGenerator::PrecompiledLib;
+using ElemsList = std::vector<const commsdsl::gen::Elem*>;
+
+const std::string PrecompiledStr("Precompiled");
+const std::string PrecompiledNamespaceStr("precompiled");
+
+const std::string& optionsNameFor(PrecompiledLib value)
+{
+    static const std::string Map[] = {
+        /* None */ strings::emptyString(),
+        /* Default */ strings::defaultOptionsClassStr(),
+        /* Client */ "Client" + strings::defaultOptionsClassStr(),
+        /* Server */ "Server" + strings::defaultOptionsClassStr(),
+        /* DataView */ strings::dataViewStr() + strings::defaultOptionsClassStr(),
+        /* BareMetal */ strings::bareMetalStr() + strings::defaultOptionsClassStr(),
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<unsigned>(PrecompiledLib::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<unsigned>(value);
+    assert(idx < MapSize);
+    return Map[idx];
+}
+
+const std::string& inputNameFor(PrecompiledLib value)
+{
+    static const std::string ClientInputStr("ClientInputMessages");
+    static const std::string ServerInputStr("ServerInputMessages");
+
+    if (value == PrecompiledLib::Client) {
+        return ClientInputStr;
+    }
+
+    if (value == PrecompiledLib::Server) {
+        return ServerInputStr;
+    }
+
+    return strings::allMessagesStr();
+}
+
+const commsdsl::gen::Interface* interfaceFor(const CommsGenerator& generator)
+{
+    auto allInterfaces = generator.getAllInterfaces();
+    for (auto* i : allInterfaces) {
+        assert(i != nullptr);
+        if (i->isReferenced()) {
+            return i;
+        }
+    }
+
+    return nullptr;
+}
+
+ElemsList elemsFor(const CommsGenerator& generator)
+{
+    ElemsList result;
+    auto allFields = generator.getAllFields();
+    for (auto* f : allFields) {
+        assert(f != nullptr);
+        if (!f->isReferenced()) {
+            continue;
+        }
+
+        result.push_back(f);
+    }
+
+    if (interfaceFor(generator) == nullptr) {
+        return result;
+    }
+
+    auto allMessages = generator.getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        assert(m != nullptr);
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        result.push_back(m);
+    }
+
+    auto allFrames = generator.getAllFrames();
+    for (auto* f : allFrames) {
+        assert(f != nullptr);
+        if (!f->isReferenced()) {
+            continue;
+        }
+
+        result.push_back(f);
+    }
+
+    return result;
+}
+
+std::string precompiledScope(const std::string& name, const CommsGenerator& generator)
+{
+    return comms::scopeForRoot(PrecompiledNamespaceStr, generator) + "::" + name;
+}
+
+std::string interfaceTypeFor(const commsdsl::gen::Interface& iFace, const CommsGenerator& generator)
+{
+    static const std::string Templ = 
+        "#^#INTERFACE#$#<\n"
+        "    comms::option::app::ReadIterator<const std::uint8_t*>,\n"
+        "    comms::option::app::WriteIterator<std::uint8_t*>,\n"
+        "    comms::option::app::IdInfoInterface,\n"
+        "    comms::option::app::LengthInfoInterface,\n"
+        "    comms::option::app::ValidCheckInterface,\n"
+        "    comms::option::app::NameInterface,\n"
+        "    comms::option::app::RefreshInterface\n"
+        ">";
+
+    util::ReplacementMap repl = {
+        {"INTERFACE", comms::scopeFor(iFace, generator)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+util::StringsList instantiationsFor(const commsdsl::gen::Elem& elem, const CommsGenerator& generator)
+{
+    auto optionsStr = precompiledScope("Options", generator);
+    auto scopeStr = comms::scopeFor(elem, generator);
+    auto elemType = elem.elemType();
+    if (elemType == commsdsl::gen::Elem::Type_Field) {
+        return util::StringsList{
+            "class " + scopeStr + '<' + optionsStr + '>'
+        };
+    }
+
+    auto messageStr = precompiledScope("Message", generator);
+    if (elemType == commsdsl::gen::Elem::Type_Message) {
+        return util::StringsList{
+            "struct " + scopeStr + strings::fieldsSuffixStr() + '<' + optionsStr + '>',
+            "class " + scopeStr + '<' + messageStr + ", " + optionsStr + '>'
+        };
+    }
+
+    assert(elemType == commsdsl::gen::Elem::Type_Frame);
+    return util::StringsList{
+        "class " + scopeStr + '<' + messageStr + ", " + precompiledScope("InputMessages", generator) + ", " + optionsStr + '>'
+    };
+}
+
+bool writeSourceInternal(
+    const std::string& filePath,
+    CommsGenerator& generator,
+    const std::string& desc,
+    const util::StringsList& instantiations)
+{
+    generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    static const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains explicit instantiation of the precompiled #^#DESC#$#.\n\n"
+        "#include \"#^#HEADER#$#\"\n\n"
+        "#^#INSTANTIATIONS#$#\n";
+
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"DESC", desc},
+        {"HEADER", comms::relHeaderForRoot(PrecompiledStr, generator)},
+        {"INSTANTIATIONS", util::strListToString(instantiations, ";\n", ";")},
+    };
+
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+} // namespace 
+    
+
+bool CommsPrecompiled::write(CommsGenerator& generator)
+{
+    if (generator.commsGetPrecompiledLib() == PrecompiledLib::None) {
+        return true;
+    }
+
+    assert(generator.isCurrentProtocolSchema());
+    CommsPrecompiled obj(generator);
+    return obj.commsWriteInternal();
+}
+
+util::StringsList CommsPrecompiled::commsRelSourcePaths(const CommsGenerator& generator)
+{
+    util::StringsList result;
+    if (generator.commsGetPrecompiledLib() == PrecompiledLib::None) {
+        return result;
+    }
+
+    auto srcPrefix = strings::srcDirStr() + '/';
+    if (interfaceFor(generator) != nullptr) {
+        result.push_back(srcPrefix + comms::relSourceForRoot(PrecompiledStr, generator));
+    }
+
+    auto elems = elemsFor(generator);
+    for (auto* e : elems) {
+        result.push_back(srcPrefix + comms::relSourcePathFor(*e, generator));
+    }
+
+    return result;
+}
+
+bool CommsPrecompiled::commsWriteInternal() const
+{
+    if (interfaceFor(m_generator) == nullptr) {
+        m_generator.logger().warning(
+            "No referenced interface is available, messages and frames won't be part of the precompiled library.");
+    }
+
+    return
+        commsWriteHeaderInternal() &&
+        commsWriteSourcesInternal();
+}
+
+bool CommsPrecompiled::commsWriteHeaderInternal() const
+{
+    auto filePath = comms::headerPathRoot(PrecompiledStr, m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    auto precompiledLib = m_generator.commsGetPrecompiledLib();
+    auto& optionsName = optionsNameFor(precompiledLib);
+    util::StringsList includes = {
+        "<cstdint>",
+        comms::relHeaderForOptions(optionsName, m_generator),
+    };
+
+    util::StringsList externs;
+    auto* iFace = interfaceFor(m_generator);
+    std::string interfaceStr;
+    if (iFace != nullptr) {
+        interfaceStr = interfaceTypeFor(*iFace, m_generator);
+        includes.push_back(comms::relHeaderPathFor(*iFace, m_generator));
+        includes.push_back(comms::relHeaderForInput(inputNameFor(precompiledLib), m_generator));
+        externs.push_back("extern template class " + interfaceStr);
+    }
+
+    auto elems = elemsFor(m_generator);
+    for (auto* e : elems) {
+        includes.push_back(comms::relHeaderPathFor(*e, m_generator));
+        auto instantiations = instantiationsFor(*e, m_generator);
+        for (auto& i : instantiations) {
+            externs.push_back("extern template " + i);
+        }
+    }
+
+    static const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the types used by the precompiled protocol library.\n"
+        "/// @details Also declares explicit instantiations of the protocol definition classes,\n"
+        "///     which reside in the precompiled library, to avoid their implicit instantiation.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "namespace #^#NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Protocol options used by the precompiled library.\n"
+        "using Options = #^#OPTIONS#$#;\n\n"
+        "#^#TYPES#$#\n"
+        "} // namespace #^#NAMESPACE#$#\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n\n"
+        "#^#EXTERNS#$#\n"
+        "#^#APPEND#$#\n";
+
+    static const std::string TypesTempl = 
+        "/// @brief Common interface class of the messages used by the precompiled library.\n"
+        "using Message =\n"
+        "    #^#INTERFACE#$#;\n\n"
+        "/// @brief Input messages of the frames used by the precompiled library.\n"
+        "using InputMessages = #^#INPUT#$#<Message, Options>;\n";
+
+    comms::prepareIncludeStatement(includes);
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
+        {"NAMESPACE", PrecompiledNamespaceStr},
+        {"INCLUDES", util::strListToString(includes, "\n", "\n")},
+        {"OPTIONS", comms::scopeForOptions(optionsName, m_generator)},
+        {"EXTERNS", util::strListToString(externs, ";\n", ";\n")},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForRoot(PrecompiledStr, m_generator) + strings::appendFileSuffixStr())},
+    };
+
+    if (iFace != nullptr) {
+        util::ReplacementMap typesRepl = {
+            {"INTERFACE", interfaceStr},
+            {"INPUT", comms::scopeForInput(inputNameFor(precompiledLib), m_generator)},
+        };
+
+        repl["TYPES"] = util::processTemplate(TypesTempl, typesRepl);
+    }
+
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+bool CommsPrecompiled::commsWriteSourcesInternal() const
+{
+    auto* iFace = interfaceFor(m_generator);
+    if (iFace != nullptr) {
+        auto filePath = comms::sourcePathRoot(PrecompiledStr, m_generator);
+        util::StringsList instantiations = {
+            "template class " + interfaceTypeFor(*iFace, m_generator)
+        };
+
+        if (!writeSourceInternal(filePath, m_generator, "interface class", instantiations)) {
+            return false;
+        }
+    }
+
+    auto elems = elemsFor(m_generator);
+    for (auto* e : elems) {
+        static const std::string Desc[] = {
+            /* Type_Invalid */ strings::emptyString(),
+            /* Type_Namespace */ strings::emptyString(),
+            /* Type_Message */ "message",
+            /* Type_Field */ "field",
+            /* Type_Interface */ strings::emptyString(),
+            /* Type_Frame */ "frame",
+            /* Type_Layer */ strings::emptyString(),
+            /* Type_Schema */ strings::emptyString(),
+        };
+
+        static const std::size_t DescSize = std::extent<decltype(Desc)>::value;
+        static_assert(DescSize == commsdsl::gen::Elem::Type_NumOfValues, "Invalid map");
+
+        auto idx = static_cast<unsigned>(e->elemType());
+        assert(idx < DescSize);
+        auto desc = Desc[idx] + " \"" + comms::scopeFor(*e, m_generator) + "\"";
+        auto instantiations = instantiationsFor(*e, m_generator);
+        for (auto& i : instantiations) {
+            i = "template " + i;
+        }
+
+        if (!writeSourceInternal(comms::sourcePathFor(*e, m_generator), m_generator, desc, instantiations)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace commsdsl2comms
@@ -53,6 +53,9 @@ const std::string ExtraMessagesBundleStr("extra-messages-bundle");
 const std::string MultipleSchemasEnabledStr("multiple-schemas-enabled");
 const std::string FullMultipleSchemasEnabledStr("s," + MultipleSchemasEnabledStr);
 const std::string ForceMainNamespaceInOptionsStr("force-main-ns-in-options");
+const std::string PrecompiledLibStr("precompiled-lib");
+const std::string DedupFieldsStr("dedup-fields");
+const std::string FramePipelineStr("frame-pipeline");
 
 
 } // namespace
@@ -102,7 +105,31 @@ CommsProgramOptions::CommsProgramOptions()
     (FullMultipleSchemasEnabledStr, 
         "Allow having multiple schemas with different names.")
     (ForceMainNamespaceInOptionsStr, "Force having main namespace struct in generated options.")
+    (PrecompiledLibStr,
+        "Generate sources with explicit template instantiations of the protocol definition "
+        "and define static library out of them in the generated CMakeLists.txt. The parameter "
+        "selects the options used for the instantiation. Supported values are:\n"
+        "  * \"default\" - Use default options.\n"
+        "  * \"client\" - Use client default options, frames are instantiated with client input messages.\n"
+        "  * \"server\" - Use server default options, frames are instantiated with server input messages.\n"
+        "  * \"data-view\" - Use data view default options.\n"
+        "  * \"bare-metal\" - Use bare metal default options.",
+        true)
+    (DedupFieldsStr,
+        "Share the definition of structurally identical message fields. Such fields are defined "
+        "once in the generated \"SharedFields.h\" header and every message member becomes a thin "
+        "subclass of the shared definition, which only provides its own name.")
+    (FramePipelineStr,
+        "Generate parallel in-order decoding pipeline helper (\"<Frame>Pipeline.h\") for every frame "
+        "containing a size layer. The frames are split using only the fields of the layers preceding "
+        "the size one, decoded by the worker threads and delivered to the handler in the original order.")
     ;
+
+    addStatsOptions();
+    addDepfileOptions();
+    addOutputArchiveOption();
+    addWatchOption();
+    addSelectionOptions();
 }
 
 bool CommsProgramOptions::quietRequested() const
@@ -209,4 +236,19 @@ bool CommsProgramOptions::isMainNamespaceInOptionsForced() const
     return isOptUsed(ForceMainNamespaceInOptionsStr);
 }
 
+const std::string& CommsProgramOptions::getPrecompiledLib() const
+{
+    return value(PrecompiledLibStr);
+}
+
+bool CommsProgramOptions::fieldsDedupRequested() const
+{
+    return isOptUsed(DedupFieldsStr);
+}
+
+bool CommsProgramOptions::framePipelineRequested() const
+{
+    return isOptUsed(FramePipelineStr);
+}
+
 } // namespace commsdsl2comms
@@ -50,6 +50,9 @@ public:
     std::vector<std::string> getExtraInputBundles() const;
     bool multipleSchemasEnabled() const;
     bool isMainNamespaceInOptionsForced() const;
+    const std::string& getPrecompiledLib() const;
+    bool fieldsDedupRequested() const;
+    bool framePipelineRequested() const;
 };
 
 } // namespace commsdsl2comms
\ No newline at end of file
@@ -20,6 +20,9 @@
 
 #include "commsdsl/gen/Schema.h"
 
+#include <map>
+#include <vector>
+
 namespace commsdsl2comms
 {
 
@@ -29,6 +32,9 @@ class CommsSchema final: public commsdsl::gen::Schema
     using Base = commsdsl::gen::Schema;
 
 public:
+    using CommsSharedFieldsList = std::vector<const CommsField*>;
+    using CommsSharedFieldsMap = std::map<const CommsField*, unsigned>;
+
     explicit CommsSchema(CommsGenerator& generator, commsdsl::parse::Schema dslObj, Elem* parent);
     virtual ~CommsSchema();
 
@@ -48,6 +54,26 @@ public:
     bool commsHasAnyGeneratedCode() const;
 
     const CommsField* findValidInterfaceReferencedField(const std::string& refStr) const;
+
+    const CommsSharedFieldsList& commsSharedFields() const
+    {
+        return m_commsSharedFields;
+    }
+
+    const CommsSharedFieldsMap& commsSharedFieldsMap() const
+    {
+        return m_commsSharedFieldsMap;
+    }
+
+    void commsSetSharedFields(CommsSharedFieldsList&& fields, CommsSharedFieldsMap&& map)
+    {
+        m_commsSharedFields = std::move(fields);
+        m_commsSharedFieldsMap = std::move(map);
+    }
+
+private:
+    CommsSharedFieldsList m_commsSharedFields;
+    CommsSharedFieldsMap m_commsSharedFieldsMap;
 };
 
 } // namespace commsdsl2comms
@@ -0,0 +1,321 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsShardKey.h"
+
+#include "CommsGenerator.h"
+#include "CommsMessage.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+#include "commsdsl/parse/RefField.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace util = commsdsl::gen::util;
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+
+namespace commsdsl2comms
+{
+
+namespace 
+{
+
+const std::string ShardKeyStr("ShardKey");
+const std::string ShardKeyAttrStr("comms.shardKey");
+
+bool isShardKeyKind(const commsdsl::parse::Field& dslObj)
+{
+    if (dslObj.kind() == commsdsl::parse::Field::Kind::Ref) {
+        return isShardKeyKind(commsdsl::parse::RefField(dslObj).field());
+    }
+
+    return 
+        (dslObj.kind() == commsdsl::parse::Field::Kind::Int) ||
+        (dslObj.kind() == commsdsl::parse::Field::Kind::Enum);
+}
+
+} // namespace 
+
+bool CommsShardKey::write(CommsGenerator& generator)
+{
+    CommsShardKey obj(generator);
+    return obj.commsWriteInternal();
+}
+
+bool CommsShardKey::commsWriteInternal() const
+{
+    auto allMessages = m_generator.getAllMessagesIdSorted();
+    util::StringsList cases;
+    util::StringsList includes = {
+        "<cstddef>",
+        "<cstdint>",
+        "comms/ErrorStatus.h",
+        comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator),
+        comms::relHeaderForOptions(strings::defaultOptionsClassStr(), m_generator),
+    };
+
+    for (auto idx = 0U; idx < allMessages.size(); ++idx) {
+        auto* m = allMessages[idx];
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        auto* commsMsg = static_cast<const CommsMessage*>(m);
+        auto keyIdx = commsKeyFieldIdxInternal(*commsMsg);
+        if (commsMsg->commsFields().size() <= keyIdx) {
+            continue;
+        }
+
+        auto id = m->dslObj().id();
+        bool sharedId = 
+            ((0U < idx) && (allMessages[idx - 1U]->dslObj().id() == id)) ||
+            (((idx + 1U) < allMessages.size()) && (allMessages[idx + 1U]->dslObj().id() == id));
+
+        if (sharedId) {
+            m_generator.logger().warning(
+                "Message \"" + m->dslObj().externalRef() + "\" shares its numeric ID with other messages, "
+                "shard key extraction for it is not generated.");
+            continue;
+        }
+
+        cases.push_back(commsCaseInternal(*commsMsg, keyIdx));
+        includes.push_back(comms::relHeaderPathFor(*m, m_generator));
+    }
+
+    if (cases.empty()) {
+        return true;
+    }
+
+    auto filePath = comms::headerPathRoot(ShardKeyStr, m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the shard key extraction function.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @cond INTERNAL\n"
+        "template <typename TField>\n"
+        "bool shardKeyReadInternal(TField& field, const std::uint8_t*& iter, const std::uint8_t* end)\n"
+        "{\n"
+        "    return field.read(iter, static_cast<std::size_t>(end - iter)) == comms::ErrorStatus::Success;\n"
+        "}\n"
+        "/// @endcond\n\n"
+        "/// @brief Extract value of the shard key field from the serialised message payload.\n"
+        "/// @details The shard key fields are marked in the schema with the @b comms.shardKey extra attribute.\n"
+        "///     When the offset of the key field is known at compile time only the key field itself is read.\n"
+        "///     Otherwise only the fields preceding the key field are read, and the full message object is\n"
+        "///     decoded only when the message has custom or version dependent read logic.\n"
+        "/// @tparam TMsgBase Common interface class, used only when the full message object is decoded.\n"
+        "/// @tparam TOpt Protocol options.\n"
+        "/// @param[in] id Numeric ID of the message.\n"
+        "/// @param[in] payload Pointer to the message payload (after the framing).\n"
+        "/// @param[in] len Length of the message payload.\n"
+        "/// @param[out] key Extracted key value.\n"
+        "/// @return @b true when the key was extracted, @b false when the message doesn't have\n"
+        "///     a shard key or the payload is malformed.\n"
+        "template <typename TMsgBase, typename TOpt = #^#DEFAULT_OPTIONS#$#>\n"
+        "bool extractShardKey(#^#MSG_ID_TYPE#$# id, const std::uint8_t* payload, std::size_t len, std::uintmax_t& key)\n"
+        "{\n"
+        "    const std::uint8_t* end = payload + len;\n"
+        "    static_cast<void>(end);\n"
+        "    switch (id) {\n"
+        "        #^#CASES#$#\n"
+        "        default: break;\n"
+        "    }\n\n"
+        "    return false;\n"
+        "}\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n"
+        ;
+
+    comms::prepareIncludeStatement(includes);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
+        {"INCLUDES", util::strListToString(includes, "\n", "\n")},
+        {"DEFAULT_OPTIONS", comms::scopeForOptions(strings::defaultOptionsClassStr(), m_generator)},
+        {"MSG_ID_TYPE", comms::scopeForRoot(strings::msgIdEnumNameStr(), m_generator)},
+        {"CASES", util::strListToString(cases, "\n", "")},
+    };
+
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+std::size_t CommsShardKey::commsKeyFieldIdxInternal(const CommsMessage& msg) const
+{
+    auto& fields = msg.commsFields();
+    auto result = fields.size();
+    for (auto idx = 0U; idx < fields.size(); ++idx) {
+        auto* f = fields[idx];
+        auto dslObj = f->field().dslObj();
+        if (!comms::isExtraAttributeEnabled(dslObj.extraAttributes(), ShardKeyAttrStr)) {
+            continue;
+        }
+
+        auto fieldRef = msg.dslObj().externalRef() + '.' + dslObj.name();
+        if (result < fields.size()) {
+            m_generator.logger().warning(
+                "Field \"" + fieldRef + "\" is ignored as shard key, the message already has one.");
+            continue;
+        }
+
+        if (!isShardKeyKind(dslObj)) {
+            m_generator.logger().warning(
+                "Field \"" + fieldRef + "\" is ignored as shard key, only <int> and <enum> fields are supported.");
+            continue;
+        }
+
+        if (f->commsIsVersionOptional()) {
+            m_generator.logger().warning(
+                "Field \"" + fieldRef + "\" is ignored as shard key, the field is version dependent.");
+            continue;
+        }
+
+        result = idx;
+    }
+
+    return result;
+}
+
+std::string CommsShardKey::commsCaseInternal(const CommsMessage& msg, std::size_t keyIdx) const
+{
+    auto& fields = msg.commsFields();
+    assert(keyIdx < fields.size());
+    auto keyAcc = comms::accessName(fields[keyIdx]->field().dslObj().name());
+    auto msgScope = comms::scopeFor(msg, m_generator);
+
+    bool fullDecode = msg.commsHasCustomRead();
+    bool fixedOffset = true;
+    std::size_t offset = 0U;
+    for (auto idx = 0U; (idx < keyIdx) && (!fullDecode); ++idx) {
+        auto* f = fields[idx];
+        if (f->commsIsVersionDependent() || f->commsIsVersionOptional()) {
+            fullDecode = true;
+            break;
+        }
+
+        if ((f->commsMinLength() != f->commsMaxLength()) || (f->commsHasCustomLength())) {
+            fixedOffset = false;
+            continue;
+        }
+
+        offset += f->commsMinLength();
+    }
+
+    if (fullDecode) {
+        static const std::string Templ = 
+            "case #^#ID#$#:\n"
+            "{\n"
+            "    // Full decode, the message has custom or version dependent read\n"
+            "    #^#MSG_SCOPE#$#<TMsgBase, TOpt> msg;\n"
+            "    const std::uint8_t* iter = payload;\n"
+            "    if (msg.doRead(iter, len) != comms::ErrorStatus::Success) {\n"
+            "        return false;\n"
+            "    }\n\n"
+            "    key = static_cast<std::uintmax_t>(msg.field_#^#KEY#$#().value());\n"
+            "    return true;\n"
+            "}";
+
+        util::ReplacementMap repl = {
+            {"ID", comms::messageIdStrFor(msg, m_generator)},
+            {"MSG_SCOPE", msgScope},
+            {"KEY", keyAcc},
+        };
+
+        return util::processTemplate(Templ, repl);
+    }
+
+    static const std::string Templ = 
+        "case #^#ID#$#:\n"
+        "{\n"
+        "    using Fields = #^#MSG_SCOPE#$#Fields<TOpt>;\n"
+        "    #^#SKIP#$#\n"
+        "    typename Fields::#^#KEY_CLASS#$# field;\n"
+        "    if (!shardKeyReadInternal(field, iter, end)) {\n"
+        "        return false;\n"
+        "    }\n\n"
+        "    key = static_cast<std::uintmax_t>(field.value());\n"
+        "    return true;\n"
+        "}";
+
+    util::ReplacementMap repl = {
+        {"ID", comms::messageIdStrFor(msg, m_generator)},
+        {"MSG_SCOPE", msgScope},
+        {"KEY_CLASS", comms::className(fields[keyIdx]->field().dslObj().name())},
+    };
+
+    if (fixedOffset && (offset == 0U)) {
+        repl["SKIP"] = "const std::uint8_t* iter = payload;\n";
+        return util::processTemplate(Templ, repl);
+    }
+
+    if (fixedOffset) {
+        static const std::string OffsetTempl = 
+            "// Fixed offset of the key field\n"
+            "const std::size_t Offset = #^#OFFSET#$#;\n"
+            "if (len < Offset) {\n"
+            "    return false;\n"
+            "}\n\n"
+            "const std::uint8_t* iter = payload + Offset;\n";
+
+        util::ReplacementMap offsetRepl = {
+            {"OFFSET", util::numToString(static_cast<std::uintmax_t>(offset))},
+        };
+
+        repl["SKIP"] = util::processTemplate(OffsetTempl, offsetRepl);
+        return util::processTemplate(Templ, repl);
+    }
+
+    util::StringsList skips = {
+        "// Read preceding fields to find the key field\n"
+        "const std::uint8_t* iter = payload;"
+    };
+
+    for (auto idx = 0U; idx < keyIdx; ++idx) {
+        static const std::string SkipTempl = 
+            "typename Fields::#^#CLASS#$# #^#ACC#$#;\n"
+            "if (!shardKeyReadInternal(#^#ACC#$#, iter, end)) {\n"
+            "    return false;\n"
+            "}\n";
+
+        auto& name = fields[idx]->field().dslObj().name();
+        util::ReplacementMap skipRepl = {
+            {"CLASS", comms::className(name)},
+            {"ACC", comms::accessName(name) + "Field"},
+        };
+
+        skips.push_back(util::processTemplate(SkipTempl, skipRepl));
+    }
+
+    repl["SKIP"] = util::strListToString(skips, "\n", "");
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2comms
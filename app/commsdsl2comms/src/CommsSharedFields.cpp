@@ -0,0 +1,724 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "CommsSharedFields.h"
+
+#include "CommsField.h"
+#include "CommsGenerator.h"
+#include "CommsMessage.h"
+#include "CommsSchema.h"
+
+#include "commsdsl/gen/BitfieldField.h"
+#include "commsdsl/gen/BundleField.h"
+#include "commsdsl/gen/DataField.h"
+#include "commsdsl/gen/ListField.h"
+#include "commsdsl/gen/OptionalField.h"
+#include "commsdsl/gen/RefField.h"
+#include "commsdsl/gen/StringField.h"
+#include "commsdsl/gen/VariantField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/parse/SetField.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2comms
+{
+
+namespace
+{
+
+const std::string SharedFieldsStr("SharedFields");
+const std::string SharedClassPrefixStr("Shared");
+
+std::string ownClassName(const CommsField& field)
+{
+    return comms::className(field.field().dslObj().name());
+}
+
+const CommsField& commsFieldOf(const commsdsl::gen::Field& field)
+{
+    auto* commsField = dynamic_cast<const CommsField*>(&field);
+    assert(commsField != nullptr);
+    return *commsField;
+}
+
+bool fieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second, bool member);
+
+bool fieldsListsEquivalent(const commsdsl::gen::Field::FieldsList& first, const commsdsl::gen::Field::FieldsList& second)
+{
+    return
+        std::equal(
+            first.begin(), first.end(), second.begin(), second.end(),
+            [](auto& f1, auto& f2)
+            {
+                return fieldsEquivalent(*f1, *f2, true);
+            });
+}
+
+// The optional member fields such as the length prefixes are equivalent if
+// both either reference the same external field or define equivalent members.
+bool optFieldsEquivalent(
+    const commsdsl::gen::Field* firstExternal,
+    const commsdsl::gen::Field* firstMember,
+    const commsdsl::gen::Field* secondExternal,
+    const commsdsl::gen::Field* secondMember)
+{
+    if (firstExternal != secondExternal) {
+        return false;
+    }
+
+    if ((firstMember == nullptr) || (secondMember == nullptr)) {
+        return firstMember == secondMember;
+    }
+
+    return fieldsEquivalent(*firstMember, *secondMember, true);
+}
+
+template <typename TRanges>
+bool validRangesEquivalent(const TRanges& first, const TRanges& second)
+{
+    return
+        std::equal(
+            first.begin(), first.end(), second.begin(), second.end(),
+            [](auto& r1, auto& r2)
+            {
+                return
+                    (r1.m_min == r2.m_min) &&
+                    (r1.m_max == r2.m_max) &&
+                    (r1.m_sinceVersion == r2.m_sinceVersion) &&
+                    (r1.m_deprecatedSince == r2.m_deprecatedSince);
+            });
+}
+
+template <typename TSpecials>
+bool specialsEquivalent(const TSpecials& first, const TSpecials& second)
+{
+    return
+        std::equal(
+            first.begin(), first.end(), second.begin(), second.end(),
+            [](auto& s1, auto& s2)
+            {
+                return
+                    (s1.first == s2.first) &&
+                    (s1.second.m_value == s2.second.m_value) &&
+                    (s1.second.m_sinceVersion == s2.second.m_sinceVersion) &&
+                    (s1.second.m_deprecatedSince == s2.second.m_deprecatedSince) &&
+                    (s1.second.m_displayName == s2.second.m_displayName);
+            });
+}
+
+bool condsEquivalent(const commsdsl::parse::OptCond& first, const commsdsl::parse::OptCond& second)
+{
+    if (first.valid() != second.valid()) {
+        return false;
+    }
+
+    if (!first.valid()) {
+        return true;
+    }
+
+    if (first.kind() != second.kind()) {
+        return false;
+    }
+
+    if (first.kind() == commsdsl::parse::OptCond::Kind::Expr) {
+        commsdsl::parse::OptCondExpr firstExpr(first);
+        commsdsl::parse::OptCondExpr secondExpr(second);
+        return
+            (firstExpr.left() == secondExpr.left()) &&
+            (firstExpr.op() == secondExpr.op()) &&
+            (firstExpr.right() == secondExpr.right());
+    }
+
+    assert(first.kind() == commsdsl::parse::OptCond::Kind::List);
+    commsdsl::parse::OptCondList firstList(first);
+    commsdsl::parse::OptCondList secondList(second);
+    if (firstList.type() != secondList.type()) {
+        return false;
+    }
+
+    auto firstConds = firstList.conditions();
+    auto secondConds = secondList.conditions();
+    return
+        std::equal(
+            firstConds.begin(), firstConds.end(), secondConds.begin(), secondConds.end(),
+            [](auto& c1, auto& c2)
+            {
+                return condsEquivalent(c1, c2);
+            });
+}
+
+bool intFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    commsdsl::parse::IntField firstObj(first.dslObj());
+    commsdsl::parse::IntField secondObj(second.dslObj());
+    return
+        (firstObj.type() == secondObj.type()) &&
+        (firstObj.endian() == secondObj.endian()) &&
+        (firstObj.serOffset() == secondObj.serOffset()) &&
+        (firstObj.minValue() == secondObj.minValue()) &&
+        (firstObj.maxValue() == secondObj.maxValue()) &&
+        (firstObj.defaultValue() == secondObj.defaultValue()) &&
+        (firstObj.scaling() == secondObj.scaling()) &&
+        validRangesEquivalent(firstObj.validRanges(), secondObj.validRanges()) &&
+        specialsEquivalent(firstObj.specialValues(), secondObj.specialValues()) &&
+        (firstObj.units() == secondObj.units()) &&
+        (firstObj.validCheckVersion() == secondObj.validCheckVersion()) &&
+        (firstObj.displayDecimals() == secondObj.displayDecimals()) &&
+        (firstObj.displayOffset() == secondObj.displayOffset()) &&
+        (firstObj.signExt() == secondObj.signExt()) &&
+        (firstObj.displaySpecials() == secondObj.displaySpecials()) &&
+        (firstObj.availableLengthLimit() == secondObj.availableLengthLimit());
+}
+
+bool setFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    commsdsl::parse::SetField firstObj(first.dslObj());
+    commsdsl::parse::SetField secondObj(second.dslObj());
+    auto& firstBits = firstObj.bits();
+    auto& secondBits = secondObj.bits();
+    bool bitsEquivalent =
+        std::equal(
+            firstBits.begin(), firstBits.end(), secondBits.begin(), secondBits.end(),
+            [](auto& b1, auto& b2)
+            {
+                return
+                    (b1.first == b2.first) &&
+                    (b1.second.m_idx == b2.second.m_idx) &&
+                    (b1.second.m_sinceVersion == b2.second.m_sinceVersion) &&
+                    (b1.second.m_deprecatedSince == b2.second.m_deprecatedSince) &&
+                    (b1.second.m_displayName == b2.second.m_displayName) &&
+                    (b1.second.m_defaultValue == b2.second.m_defaultValue) &&
+                    (b1.second.m_reserved == b2.second.m_reserved) &&
+                    (b1.second.m_reservedValue == b2.second.m_reservedValue);
+            });
+
+    return
+        bitsEquivalent &&
+        (firstObj.type() == secondObj.type()) &&
+        (firstObj.endian() == secondObj.endian()) &&
+        (firstObj.defaultBitValue() == secondObj.defaultBitValue()) &&
+        (firstObj.reservedBitValue() == secondObj.reservedBitValue()) &&
+        (firstObj.isNonUniqueAllowed() == secondObj.isNonUniqueAllowed()) &&
+        (firstObj.validCheckVersion() == secondObj.validCheckVersion()) &&
+        (firstObj.availableLengthLimit() == secondObj.availableLengthLimit());
+}
+
+bool floatFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    commsdsl::parse::FloatField firstObj(first.dslObj());
+    commsdsl::parse::FloatField secondObj(second.dslObj());
+    return
+        (firstObj.type() == secondObj.type()) &&
+        (firstObj.endian() == secondObj.endian()) &&
+        (firstObj.defaultValue() == secondObj.defaultValue()) &&
+        validRangesEquivalent(firstObj.validRanges(), secondObj.validRanges()) &&
+        specialsEquivalent(firstObj.specialValues(), secondObj.specialValues()) &&
+        (firstObj.validCheckVersion() == secondObj.validCheckVersion()) &&
+        (firstObj.units() == secondObj.units()) &&
+        (firstObj.displayDecimals() == secondObj.displayDecimals()) &&
+        (firstObj.displaySpecials() == secondObj.displaySpecials());
+}
+
+bool bitfieldFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::BitfieldField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::BitfieldField&>(second);
+    commsdsl::parse::BitfieldField firstObj(first.dslObj());
+    commsdsl::parse::BitfieldField secondObj(second.dslObj());
+    return
+        (firstObj.endian() == secondObj.endian()) &&
+        fieldsListsEquivalent(firstField.members(), secondField.members());
+}
+
+bool bundleFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::BundleField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::BundleField&>(second);
+    commsdsl::parse::BundleField firstObj(first.dslObj());
+    commsdsl::parse::BundleField secondObj(second.dslObj());
+    auto& firstAliases = firstObj.aliasesView();
+    auto& secondAliases = secondObj.aliasesView();
+    bool aliasesEquivalent =
+        std::equal(
+            firstAliases.begin(), firstAliases.end(), secondAliases.begin(), secondAliases.end(),
+            [](auto& a1, auto& a2)
+            {
+                return (a1.name() == a2.name()) && (a1.fieldName() == a2.fieldName());
+            });
+
+    return
+        aliasesEquivalent &&
+        fieldsListsEquivalent(firstField.members(), secondField.members());
+}
+
+bool stringFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::StringField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::StringField&>(second);
+    commsdsl::parse::StringField firstObj(first.dslObj());
+    commsdsl::parse::StringField secondObj(second.dslObj());
+    return
+        (firstObj.defaultValue() == secondObj.defaultValue()) &&
+        (firstObj.encodingStr() == secondObj.encodingStr()) &&
+        (firstObj.fixedLength() == secondObj.fixedLength()) &&
+        (firstObj.hasZeroTermSuffix() == secondObj.hasZeroTermSuffix()) &&
+        optFieldsEquivalent(
+            firstField.externalPrefixField(), firstField.memberPrefixField(),
+            secondField.externalPrefixField(), secondField.memberPrefixField());
+}
+
+bool dataFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::DataField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::DataField&>(second);
+    commsdsl::parse::DataField firstObj(first.dslObj());
+    commsdsl::parse::DataField secondObj(second.dslObj());
+    return
+        (firstObj.defaultValue() == secondObj.defaultValue()) &&
+        (firstObj.fixedLength() == secondObj.fixedLength()) &&
+        optFieldsEquivalent(
+            firstField.externalPrefixField(), firstField.memberPrefixField(),
+            secondField.externalPrefixField(), secondField.memberPrefixField());
+}
+
+bool listFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::ListField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::ListField&>(second);
+    commsdsl::parse::ListField firstObj(first.dslObj());
+    commsdsl::parse::ListField secondObj(second.dslObj());
+    return
+        (firstObj.fixedCount() == secondObj.fixedCount()) &&
+        (firstObj.elemFixedLength() == secondObj.elemFixedLength()) &&
+        optFieldsEquivalent(
+            firstField.externalElementField(), firstField.memberElementField(),
+            secondField.externalElementField(), secondField.memberElementField()) &&
+        optFieldsEquivalent(
+            firstField.externalCountPrefixField(), firstField.memberCountPrefixField(),
+            secondField.externalCountPrefixField(), secondField.memberCountPrefixField()) &&
+        optFieldsEquivalent(
+            firstField.externalLengthPrefixField(), firstField.memberLengthPrefixField(),
+            secondField.externalLengthPrefixField(), secondField.memberLengthPrefixField()) &&
+        optFieldsEquivalent(
+            firstField.externalElemLengthPrefixField(), firstField.memberElemLengthPrefixField(),
+            secondField.externalElemLengthPrefixField(), secondField.memberElemLengthPrefixField()) &&
+        optFieldsEquivalent(
+            firstField.externalTermSuffixField(), firstField.memberTermSuffixField(),
+            secondField.externalTermSuffixField(), secondField.memberTermSuffixField());
+}
+
+bool refFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::RefField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::RefField&>(second);
+    return firstField.referencedField() == secondField.referencedField();
+}
+
+bool optionalFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::OptionalField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::OptionalField&>(second);
+    commsdsl::parse::OptionalField firstObj(first.dslObj());
+    commsdsl::parse::OptionalField secondObj(second.dslObj());
+    return
+        (firstObj.defaultMode() == secondObj.defaultMode()) &&
+        (firstObj.externalModeCtrl() == secondObj.externalModeCtrl()) &&
+        (firstObj.missingOnReadFail() == secondObj.missingOnReadFail()) &&
+        (firstObj.missingOnInvalid() == secondObj.missingOnInvalid()) &&
+        condsEquivalent(firstObj.cond(), secondObj.cond()) &&
+        optFieldsEquivalent(
+            firstField.externalField(), firstField.memberField(),
+            secondField.externalField(), secondField.memberField());
+}
+
+bool variantFieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second)
+{
+    auto& firstField = static_cast<const commsdsl::gen::VariantField&>(first);
+    auto& secondField = static_cast<const commsdsl::gen::VariantField&>(second);
+    commsdsl::parse::VariantField firstObj(first.dslObj());
+    commsdsl::parse::VariantField secondObj(second.dslObj());
+    return
+        (firstObj.defaultMemberIdx() == secondObj.defaultMemberIdx()) &&
+        (firstObj.displayIdxReadOnlyHidden() == secondObj.displayIdxReadOnlyHidden()) &&
+        fieldsListsEquivalent(firstField.members(), secondField.members());
+}
+
+// Compares the parsed properties of the fields. The name, display name and
+// description of the compared message fields themselves are ignored, while
+// the names of their members are part of the interface and must be equal.
+bool fieldsEquivalent(const commsdsl::gen::Field& first, const commsdsl::gen::Field& second, bool member)
+{
+    auto firstObj = first.dslObj();
+    auto secondObj = second.dslObj();
+    if (firstObj.kind() != secondObj.kind()) {
+        return false;
+    }
+
+    if (member &&
+        ((firstObj.name() != secondObj.name()) ||
+         (firstObj.displayName() != secondObj.displayName()))) {
+        return false;
+    }
+
+    // Custom code and customization options are provided per field,
+    // such fields cannot share their definitions.
+    auto& firstCommsField = commsFieldOf(first);
+    auto& secondCommsField = commsFieldOf(second);
+    if (firstCommsField.commsHasCustomCode() ||
+        secondCommsField.commsHasCustomCode() ||
+        firstCommsField.commsIsFieldCustomizable() ||
+        secondCommsField.commsIsFieldCustomizable()) {
+        return false;
+    }
+
+    bool propsEquivalent =
+        (firstObj.semanticType() == secondObj.semanticType()) &&
+        (firstObj.minLength() == secondObj.minLength()) &&
+        (firstObj.maxLength() == secondObj.maxLength()) &&
+        (firstObj.bitLength() == secondObj.bitLength()) &&
+        (firstObj.sinceVersion() == secondObj.sinceVersion()) &&
+        (firstObj.deprecatedSince() == secondObj.deprecatedSince()) &&
+        (firstObj.isDeprecatedRemoved() == secondObj.isDeprecatedRemoved()) &&
+        (firstObj.isPseudo() == secondObj.isPseudo()) &&
+        (firstObj.isDisplayReadOnly() == secondObj.isDisplayReadOnly()) &&
+        (firstObj.isDisplayHidden() == secondObj.isDisplayHidden()) &&
+        (firstObj.isFailOnInvalid() == secondObj.isFailOnInvalid()) &&
+        (firstObj.valueOverride() == secondObj.valueOverride()) &&
+        (firstObj.readOverride() == secondObj.readOverride()) &&
+        (firstObj.writeOverride() == secondObj.writeOverride()) &&
+        (firstObj.refreshOverride() == secondObj.refreshOverride()) &&
+        (firstObj.lengthOverride() == secondObj.lengthOverride()) &&
+        (firstObj.validOverride() == secondObj.validOverride()) &&
+        (firstObj.nameOverride() == secondObj.nameOverride());
+
+    if (!propsEquivalent) {
+        return false;
+    }
+
+    using EquivalentFunc = bool (*)(const commsdsl::gen::Field&, const commsdsl::gen::Field&);
+    static const EquivalentFunc Map[] = {
+        /* Int */ &intFieldsEquivalent,
+        /* Enum */ nullptr,
+        /* Set */ &setFieldsEquivalent,
+        /* Float */ &floatFieldsEquivalent,
+        /* Bitfield */ &bitfieldFieldsEquivalent,
+        /* Bundle */ &bundleFieldsEquivalent,
+        /* String */ &stringFieldsEquivalent,
+        /* Data */ &dataFieldsEquivalent,
+        /* List */ &listFieldsEquivalent,
+        /* Ref */ &refFieldsEquivalent,
+        /* Optional */ &optionalFieldsEquivalent,
+        /* Variant */ &variantFieldsEquivalent,
+    };
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(commsdsl::parse::Field::Kind::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(firstObj.kind());
+    if ((MapSize <= idx) || (Map[idx] == nullptr)) {
+        // The enums declared by the common code are distinct types
+        // even when structurally identical, the fields using them
+        // must remain separate.
+        return false;
+    }
+
+    return Map[idx](first, second);
+}
+
+bool isShareable(const CommsField& field)
+{
+    auto& genField = field.field();
+    if ((!comms::isMessageShallowMemberField(genField)) ||
+        (genField.dslObj().kind() == commsdsl::parse::Field::Kind::Ref) ||
+        (field.commsIsVersionOptional())) {
+        return false;
+    }
+
+    // The detached prefixes are handled by the message definition
+    auto dslObj = genField.dslObj();
+    if (dslObj.kind() == commsdsl::parse::Field::Kind::String) {
+        return commsdsl::parse::StringField(dslObj).detachedPrefixFieldName().empty();
+    }
+
+    if (dslObj.kind() == commsdsl::parse::Field::Kind::Data) {
+        return commsdsl::parse::DataField(dslObj).detachedPrefixFieldName().empty();
+    }
+
+    if (dslObj.kind() == commsdsl::parse::Field::Kind::List) {
+        commsdsl::parse::ListField listObj(dslObj);
+        return
+            listObj.detachedCountPrefixFieldName().empty() &&
+            listObj.detachedLengthPrefixFieldName().empty() &&
+            listObj.detachedElemLengthPrefixFieldName().empty() &&
+            listObj.detachedTermSuffixFieldName().empty();
+    }
+
+    return true;
+}
+
+std::string sharedClassName(unsigned idx)
+{
+    return SharedClassPrefixStr + std::to_string(idx);
+}
+
+const CommsSchema& schemaOf(const CommsGenerator& generator, const CommsField& field)
+{
+    return CommsSchema::cast(generator.schemaOf(field.field()));
+}
+
+} // namespace
+
+bool CommsSharedFields::prepare(CommsGenerator& generator)
+{
+    using FieldsGroup = std::vector<const CommsField*>;
+    std::vector<FieldsGroup> groups;
+
+    auto allMessages = generator.getAllMessages();
+    for (auto* m : allMessages) {
+        assert(m != nullptr);
+        if (!m->isReferenced()) {
+            continue;
+        }
+
+        for (auto* f : static_cast<const CommsMessage*>(m)->commsFields()) {
+            assert(f != nullptr);
+            if (!isShareable(*f)) {
+                continue;
+            }
+
+            auto iter =
+                std::find_if(
+                    groups.begin(), groups.end(),
+                    [f](auto& g)
+                    {
+                        return fieldsEquivalent(g.front()->field(), f->field(), false);
+                    });
+
+            if (iter == groups.end()) {
+                groups.push_back(FieldsGroup{f});
+                continue;
+            }
+
+            iter->push_back(f);
+        }
+    }
+
+    CommsSchema::CommsSharedFieldsList sharedFields;
+    CommsSchema::CommsSharedFieldsMap sharedFieldsMap;
+    for (auto& g : groups) {
+        if (g.size() < 2U) {
+            continue;
+        }
+
+        auto idx = static_cast<unsigned>(sharedFields.size());
+        sharedFields.push_back(g.front());
+        for (auto* f : g) {
+            sharedFieldsMap[f] = idx;
+        }
+
+        generator.logger().debug(
+            "Sharing definition of " + comms::scopeFor(g.front()->field(), generator) +
+            " between " + std::to_string(g.size()) + " message fields");
+    }
+
+    auto& schema = static_cast<CommsSchema&>(generator.currentSchema());
+    schema.commsSetSharedFields(std::move(sharedFields), std::move(sharedFieldsMap));
+    return true;
+}
+
+bool CommsSharedFields::write(CommsGenerator& generator)
+{
+    auto& schema = CommsSchema::cast(generator.currentSchema());
+    if (schema.commsSharedFields().empty()) {
+        return true;
+    }
+
+    CommsSharedFields obj(generator);
+    return obj.commsWriteInternal();
+}
+
+bool CommsSharedFields::commsIsShared(const CommsGenerator& generator, const CommsField& field)
+{
+    auto& map = schemaOf(generator, field).commsSharedFieldsMap();
+    return map.find(&field) != map.end();
+}
+
+std::string CommsSharedFields::commsDefCode(const CommsGenerator& generator, const CommsField& field)
+{
+    auto& schema = schemaOf(generator, field);
+    auto& map = schema.commsSharedFieldsMap();
+    auto iter = map.find(&field);
+    if (iter == map.end()) {
+        return strings::emptyString();
+    }
+
+    static const std::string Templ =
+        "#^#MEMBERS#$#\n"
+        "/// @brief Definition of <b>\"#^#DISP_NAME#$#\"</b> field.\n"
+        "/// @details Shares the definition with the structurally identical fields,\n"
+        "///     see @ref #^#SHARED_DOC_SCOPE#$#.\n"
+        "class #^#CLASS_NAME#$# : public\n"
+        "    #^#SHARED_SCOPE#$#\n"
+        "{\n"
+        "public:\n"
+        "    /// @brief Name of the field.\n"
+        "    static const char* name()\n"
+        "    {\n"
+        "        return #^#COMMON_SCOPE#$#::name();\n"
+        "    }\n"
+        "};\n";
+
+    static const std::string MembersTempl =
+        "/// @brief Scope for all the member fields of\n"
+        "///     @ref #^#CLASS_NAME#$# field.\n"
+        "using #^#CLASS_NAME#$#Members = typename #^#SHARED_SCOPE#$#Members;\n";
+
+    auto* canonical = schema.commsSharedFields()[iter->second];
+    assert(canonical != nullptr);
+
+    auto& genField = field.field();
+    auto dslObj = genField.dslObj();
+    auto sharedName = sharedClassName(iter->second) + "::" + ownClassName(*canonical);
+    auto sharedScope = comms::scopeForRoot(SharedFieldsStr, generator);
+
+    util::ReplacementMap repl = {
+        {"CLASS_NAME", ownClassName(field)},
+        {"DISP_NAME", util::displayName(dslObj.displayName(), dslObj.name())},
+        {"SHARED_SCOPE", sharedScope + "<TOpt>::" + sharedName},
+        {"SHARED_DOC_SCOPE", sharedScope + "::" + sharedName},
+        {"COMMON_SCOPE", comms::commonScopeFor(genField, generator)},
+    };
+
+    if (canonical->commsHasMembersCode()) {
+        repl["MEMBERS"] = util::processTemplate(MembersTempl, repl);
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string CommsSharedFields::commsRelHeaderPath(const CommsGenerator& generator)
+{
+    return comms::relHeaderForRoot(SharedFieldsStr, generator);
+}
+
+bool CommsSharedFields::commsWriteInternal() const
+{
+    auto filePath = comms::headerPathRoot(SharedFieldsStr, m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the fields shared by multiple messages.\n\n"
+        "#pragma once\n\n"
+        "#^#INCLUDES#$#\n"
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Definitions of the structurally identical message fields.\n"
+        "/// @details Every message field using one of the definitions is its\n"
+        "///     thin subclass, which provides its own name.\n"
+        "/// @tparam TOpt Extra options\n"
+        "/// @headerfile #^#HEADERFILE#$#\n"
+        "template <typename TOpt = #^#OPTIONS#$#>\n"
+        "struct #^#CLASS_NAME#$#\n"
+        "{\n"
+        "    #^#FIELDS_DEF#$#\n"
+        "};\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n";
+
+    util::ReplacementMap repl = {
+        {"GENERATED", CommsGenerator::commsFileGeneratedComment()},
+        {"INCLUDES", commsIncludesInternal()},
+        {"PROT_NAMESPACE", m_generator.currentSchema().mainNamespace()},
+        {"HEADERFILE", commsRelHeaderPath(m_generator)},
+        {"OPTIONS", comms::scopeForOptions(strings::defaultOptionsClassStr(), m_generator)},
+        {"CLASS_NAME", SharedFieldsStr},
+        {"FIELDS_DEF", commsFieldsDefInternal()},
+    };
+
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+std::string CommsSharedFields::commsIncludesInternal() const
+{
+    util::StringsList includes = {
+        comms::relHeaderForOptions(strings::defaultOptionsStr(), m_generator),
+    };
+
+    auto& schema = CommsSchema::cast(m_generator.currentSchema());
+    for (auto* f : schema.commsSharedFields()) {
+        assert(f != nullptr);
+        auto* parent = f->field().getParent();
+        assert(parent != nullptr);
+        includes.push_back(comms::relCommonHeaderPathFor(*parent, m_generator));
+
+        auto fIncludes = f->commsDefIncludes();
+        includes.reserve(includes.size() + fIncludes.size());
+        std::move(fIncludes.begin(), fIncludes.end(), std::back_inserter(includes));
+    }
+
+    comms::prepareIncludeStatement(includes);
+    return util::strListToString(includes, "\n", "\n");
+}
+
+std::string CommsSharedFields::commsFieldsDefInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Scope of the definition originating from\n"
+        "///     @ref #^#ORIG_SCOPE#$# field.\n"
+        "struct #^#SHARED_NAME#$#\n"
+        "{\n"
+        "    #^#DEF#$#\n"
+        "};\n";
+
+    // The definition of the first field in the group is placed into its own
+    // scope unchanged, the rest of the fields in the group subclass it.
+    auto& schema = CommsSchema::cast(m_generator.currentSchema());
+    auto& sharedFields = schema.commsSharedFields();
+    util::StringsList defs;
+    defs.reserve(sharedFields.size());
+    for (auto idx = 0U; idx < sharedFields.size(); ++idx) {
+        auto* f = sharedFields[idx];
+        assert(f != nullptr);
+
+        util::ReplacementMap repl = {
+            {"ORIG_SCOPE", comms::scopeFor(f->field(), m_generator)},
+            {"SHARED_NAME", sharedClassName(idx)},
+            {"DEF", f->commsDefCode()},
+        };
+
+        defs.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(defs, "\n", "");
+}
+
+} // namespace commsdsl2comms
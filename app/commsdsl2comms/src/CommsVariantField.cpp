@@ -16,6 +16,7 @@
 #include "CommsVariantField.h"
 
 #include "CommsBundleField.h"
+#include "CommsEnumField.h"
 #include "CommsGenerator.h"
 #include "CommsIntField.h"
 #include "CommsRefField.h"
@@ -27,6 +28,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <set>
 
@@ -96,14 +98,162 @@ const CommsField* bundleGetValidPropKeyInternal(const CommsBundleField& bundle)
     return first;
 }
 
+const CommsField* memberGetValidPropKeyInternal(const CommsField& member)
+{
+    auto kind = member.field().dslObj().kind();
+    if (kind == commsdsl::parse::Field::Kind::Bundle) {
+        return bundleGetValidPropKeyInternal(static_cast<const CommsBundleField&>(member));
+    }
+
+    if (kind != commsdsl::parse::Field::Kind::Int) {
+        return nullptr;
+    }
+
+    auto& intField = static_cast<const CommsIntField&>(member);
+    if ((!intIsValidPropKeyInternal(intField)) || 
+        (intField.commsHasGeneratedReadCode())) {
+        return nullptr;
+    }
+
+    return &member;
+}
+
+using PropKeyRangesList = CommsEnumField::ValueRangesList;
+
+// Key field with valid values not limited to the single one, 
+// the returned condition checks the "prefixValue" variable. 
+std::string validPropKeyRangeCondInternal(const PropKeyRangesList& validRanges, bool unsignedType)
+{
+    if (validRanges.empty()) {
+        return strings::emptyString();
+    }
+
+    auto valueStrFunc = 
+        [unsignedType](std::intmax_t val)
+        {
+            if (unsignedType) {
+                return util::numToString(static_cast<std::uintmax_t>(val));
+            }
+
+            if (val == std::numeric_limits<std::intmax_t>::min()) {
+                return std::string("std::numeric_limits<std::intmax_t>::min()");
+            }
+
+            return util::numToString(val);
+        };
+
+    auto lowestValue = unsignedType ? std::intmax_t(0) : std::numeric_limits<std::intmax_t>::min();
+    auto highestValue = unsignedType ? static_cast<std::intmax_t>(std::numeric_limits<std::uintmax_t>::max()) : std::numeric_limits<std::intmax_t>::max();
+
+    util::StringsList conds;
+    for (auto& r : validRanges) {
+        if (r.first == r.second) {
+            conds.push_back("(prefixValue == " + valueStrFunc(r.first) + ")");
+            continue;
+        }
+
+        util::StringsList bounds;
+        if (r.first != lowestValue) {
+            bounds.push_back("(" + valueStrFunc(r.first) + " <= prefixValue)");
+        }
+
+        if (r.second != highestValue) {
+            bounds.push_back("(prefixValue <= " + valueStrFunc(r.second) + ")");
+        }
+
+        if (bounds.empty()) {
+            // Any value is valid
+            return strings::emptyString();
+        }
+
+        conds.push_back("(" + util::strListToString(bounds, " && ", "") + ")");
+    }
+
+    return util::strListToString(conds, " ||\n", "");
+}
+
+std::string intValidPropKeyRangeCondInternal(const CommsIntField& intField)
+{
+    auto obj = intField.field().dslObj();
+    if ((!obj.isFailOnInvalid()) || obj.isPseudo() || intField.commsHasGeneratedReadCode()) {
+        return strings::emptyString();
+    }
+
+    auto intDslObj = commsdsl::parse::IntField(obj);
+    PropKeyRangesList validRanges;
+    for (auto& r : intDslObj.validRanges()) {
+        if ((r.m_sinceVersion != 0U) || (r.m_deprecatedSince != commsdsl::parse::Protocol::notYetDeprecated())) {
+            // Version dependent validity, don't bother
+            return strings::emptyString();
+        }
+
+        validRanges.emplace_back(r.m_min, r.m_max);
+    }
+
+    return validPropKeyRangeCondInternal(validRanges, intField.isUnsignedType());
+}
+
+// Enum keys are always selected via the range condition, the
+// valid ranges are empty when the validity is version dependent.
+std::string enumValidPropKeyRangeCondInternal(const CommsEnumField& enumField)
+{
+    return 
+        validPropKeyRangeCondInternal(
+            enumField.commsVariantPropKeyValidRanges(), 
+            enumField.commsVariantIsUnsignedPropKey());
+}
+
+const CommsField* memberGetValidPropKeyRangeInternal(const CommsField& member, std::string& cond)
+{
+    auto* keyField = &member;
+    auto kind = member.field().dslObj().kind();
+    if (kind == commsdsl::parse::Field::Kind::Bundle) {
+        auto& members = static_cast<const CommsBundleField&>(member).commsMembers();
+        if (members.empty()) {
+            return nullptr;
+        }
+
+        keyField = members.front();
+        kind = keyField->field().dslObj().kind();
+    }
+
+    if (kind == commsdsl::parse::Field::Kind::Int) {
+        cond = intValidPropKeyRangeCondInternal(static_cast<const CommsIntField&>(*keyField));
+    }
+    else if (kind == commsdsl::parse::Field::Kind::Enum) {
+        cond = enumValidPropKeyRangeCondInternal(static_cast<const CommsEnumField&>(*keyField));
+    }
+
+    if (cond.empty()) {
+        return nullptr;
+    }
+
+    return keyField;
+}
+
 std::string propKeyTypeInternal(const CommsField& field)
 {
-    assert(field.field().dslObj().kind() == commsdsl::parse::Field::Kind::Int);
+    auto kind = field.field().dslObj().kind();
+    if (kind == commsdsl::parse::Field::Kind::Enum) {
+        return static_cast<const CommsEnumField&>(field).commsVariantPropKeyType();
+    }
 
+    assert(kind == commsdsl::parse::Field::Kind::Int);
     auto& keyField = static_cast<const CommsIntField&>(field);
     return keyField.commsVariantPropKeyType();
 }
 
+bool propKeyIsUnsignedInternal(const CommsField& field)
+{
+    auto kind = field.field().dslObj().kind();
+    if (kind == commsdsl::parse::Field::Kind::Enum) {
+        return static_cast<const CommsEnumField&>(field).commsVariantIsUnsignedPropKey();
+    }
+
+    assert(kind == commsdsl::parse::Field::Kind::Int);
+    return static_cast<const CommsIntField&>(field).isUnsignedType();
+}
+
 std::string propKeyValueStrInternal(const CommsField& field)
 {
     assert(field.field().dslObj().kind() == commsdsl::parse::Field::Kind::Int);
@@ -114,9 +264,16 @@ std::string propKeyValueStrInternal(const CommsField& field)
 
 bool propKeysEquivalent(const CommsField& first, const CommsField& second)
 {
-    assert(first.field().dslObj().kind() == commsdsl::parse::Field::Kind::Int);
-    assert(second.field().dslObj().kind() == commsdsl::parse::Field::Kind::Int);
+    auto kind = first.field().dslObj().kind();
+    if (kind != second.field().dslObj().kind()) {
+        return false;
+    }
+
+    if (kind == commsdsl::parse::Field::Kind::Enum) {
+        return static_cast<const CommsEnumField&>(first).commsVariantIsPropKeyEquivalent(static_cast<const CommsEnumField&>(second));
+    }
 
+    assert(kind == commsdsl::parse::Field::Kind::Int);
     return static_cast<const CommsIntField&>(first).commsVariantIsPropKeyEquivalent(static_cast<const CommsIntField&>(second));
 }
 
@@ -194,6 +351,10 @@ CommsVariantField::IncludesList CommsVariantField::commsDefIncludesImpl() const
         "comms/field/Variant.h",
         "<tuple>"        
     };
+
+    if (!m_prefixKeys.empty()) {
+        result.insert(result.end(), {"<algorithm>", "<iterator>"});
+    }
     
     for (auto* m : m_commsMembers) {
         assert(m != nullptr);
@@ -313,12 +474,21 @@ std::string CommsVariantField::commsDefPrivateCodeImpl() const
         "    #else // #ifdef _MSC_VER\n"
         "        func.template operator()<TIdx>(std::forward<TField>(f)); // All other compilers\n"
         "    #endif // #ifdef _MSC_VER\n"
-        "}\n";
-    return Templ;
+        "}\n"
+        "#^#PREFIX_READ_CANDIDATE#$#\n";
+
+    util::ReplacementMap repl = {
+        {"PREFIX_READ_CANDIDATE", commsDefPrefixReadCandidateCodeInternal()},
+    };
+    return util::processTemplate(Templ, repl);
 }
 
 std::string CommsVariantField::commsDefReadFuncBodyImpl() const
 {
+    if (!m_prefixKeys.empty()) {
+        return commsDefPrefixReadFuncBodyInternal();
+    }
+
     if (m_optimizedReadKey.empty()) {
         return strings::emptyString();
     }
@@ -611,6 +781,9 @@ bool CommsVariantField::commsPrepareInternal()
     }
 
     m_optimizedReadKey = commsOptimizedReadKeyInternal();
+    if (m_optimizedReadKey.empty()) {
+        commsPreparePrefixReadInternal();
+    }
     return true;
 }
 
@@ -1050,9 +1223,196 @@ std::string CommsVariantField::commsDefSelectFieldCodeInternal() const
 }
 
 
+std::string CommsVariantField::commsDefPrefixReadFuncBodyInternal() const
+{
+    assert(!m_prefixKeys.empty());
+
+    StringsList candidates;
+    StringsList prefixReads;
+    for (auto keyIdx = 0U; keyIdx < m_prefixKeys.size(); ++keyIdx) {
+        auto& info = m_prefixKeys[keyIdx];
+        assert(info.m_keyField != nullptr);
+
+        std::string switchStr;
+        if (!info.m_cases.empty()) {
+            auto slotIdx = candidates.size();
+            candidates.push_back("FieldIdx_numOfValues");
+
+            StringsList cases;
+            for (auto& c : info.m_cases) {
+                static const std::string CaseTempl = 
+                    "case #^#VAL#$#: candidates[#^#SLOT_IDX#$#] = FieldIdx_#^#MEM_NAME#$#; break;";
+
+                util::ReplacementMap caseRepl = {
+                    {"VAL", c.first},
+                    {"SLOT_IDX", std::to_string(slotIdx)},
+                    {"MEM_NAME", comms::accessName(m_commsMembers[c.second]->field().dslObj().name())},
+                };
+
+                cases.push_back(util::processTemplate(CaseTempl, caseRepl));
+            }
+
+            static const std::string SwitchTempl = 
+                "switch (prefixKeyField.getValue()) {\n"
+                "    #^#CASES#$#\n"
+                "    default: break;\n"
+                "};\n";
+
+            util::ReplacementMap switchRepl = {
+                {"CASES", util::strListToString(cases, "\n", "")},
+            };
+
+            switchStr = util::processTemplate(SwitchTempl, switchRepl);
+        }
+
+        StringsList ranges;
+        for (auto& r : info.m_ranges) {
+            static const std::string RangeTempl = 
+                "if (#^#COND#$#) {\n"
+                "    candidates[#^#SLOT_IDX#$#] = FieldIdx_#^#MEM_NAME#$#;\n"
+                "}\n";
+
+            util::ReplacementMap rangeRepl = {
+                {"COND", r.first},
+                {"SLOT_IDX", std::to_string(candidates.size())},
+                {"MEM_NAME", comms::accessName(m_commsMembers[r.second]->field().dslObj().name())},
+            };
+
+            candidates.push_back("FieldIdx_numOfValues");
+            ranges.push_back(util::processTemplate(RangeTempl, rangeRepl));
+        }
+
+        if (!ranges.empty()) {
+            auto valueType = propKeyIsUnsignedInternal(*info.m_keyField) ? "std::uintmax_t" : "std::intmax_t";
+            ranges.insert(ranges.begin(), "auto prefixValue = static_cast<" + std::string(valueType) + ">(prefixKeyField.getValue());");
+        }
+
+        static const std::string Templ = 
+            "do {\n"
+            "    using PrefixKeyField#^#KEY_IDX#$# =\n"
+            "        #^#KEY_FIELD_TYPE#$#;\n"
+            "    PrefixKeyField#^#KEY_IDX#$# prefixKeyField;\n"
+            "    auto prefixIter = iter;\n"
+            "    auto prefixEs = prefixKeyField.read(prefixIter, len);\n"
+            "    if (prefixEs != comms::ErrorStatus::Success) {\n"
+            "        if ((es == comms::ErrorStatus::NumOfErrorStatuses) || (prefixEs == comms::ErrorStatus::NotEnoughData)) {\n"
+            "            es = prefixEs;\n"
+            "        }\n"
+            "        break;\n"
+            "    }\n\n"
+            "    #^#SWITCH#$#\n"
+            "    #^#RANGES#$#\n"
+            "} while (false);\n";
+
+        util::ReplacementMap repl = {
+            {"KEY_IDX", std::to_string(keyIdx)},
+            {"KEY_FIELD_TYPE", propKeyTypeInternal(*info.m_keyField)},
+            {"SWITCH", std::move(switchStr)},
+            {"RANGES", util::strListToString(ranges, "\n", "")},
+        };
+
+        prefixReads.push_back(util::processTemplate(Templ, repl));
+    }
+
+    for (auto idx : m_prefixSequentialMembers) {
+        candidates.push_back("FieldIdx_" + comms::accessName(m_commsMembers[idx]->field().dslObj().name()));
+    }
+
+    static const std::string Templ =
+        "reset();\n"
+        "#^#VERSION_DEP#$#\n"
+        "// Members with a fixed value or value ranges key field are selected by the leading\n"
+        "// bytes, the rest are tried in order of their definition.\n"
+        "std::size_t candidates[] = {\n"
+        "    #^#CANDIDATES#$#\n"
+        "};\n\n"
+        "auto es = comms::ErrorStatus::NumOfErrorStatuses;\n"
+        "#^#PREFIX_READS#$#\n"
+        "std::sort(std::begin(candidates), std::end(candidates));\n"
+        "for (auto idx : candidates) {\n"
+        "    if (static_cast<std::size_t>(FieldIdx_numOfValues) <= idx) {\n"
+        "        break;\n"
+        "    }\n\n"
+        "    auto candidateIter = iter;\n"
+        "    auto candidateEs = readPrefixCandidateInternal(idx, candidateIter, len);\n"
+        "    if (candidateEs == comms::ErrorStatus::Success) {\n"
+        "        iter = candidateIter;\n"
+        "        return candidateEs;\n"
+        "    }\n\n"
+        "    reset();\n"
+        "    if ((es == comms::ErrorStatus::NumOfErrorStatuses) || (candidateEs == comms::ErrorStatus::NotEnoughData)) {\n"
+        "        es = candidateEs;\n"
+        "    }\n"
+        "}\n\n"
+        "if (es == comms::ErrorStatus::NumOfErrorStatuses) {\n"
+        "    es = comms::ErrorStatus::InvalidMsgData;\n"
+        "}\n\n"
+        "return es;\n";
+
+    util::ReplacementMap repl = {
+        {"CANDIDATES", util::strListToString(candidates, ",\n", "")},
+        {"PREFIX_READS", util::strListToString(prefixReads, "\n", "")},
+    };
+
+    if (commsIsVersionDependent()) {
+        static const std::string CheckStr =
+            "static_assert(Base::isVersionDependent(), \"The field must be recognised as version dependent\");";
+        repl["VERSION_DEP"] = CheckStr;
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string CommsVariantField::commsDefPrefixReadCandidateCodeInternal() const
+{
+    if (m_prefixKeys.empty()) {
+        return strings::emptyString();
+    }
+
+    StringsList cases;
+    for (auto* memPtr : m_commsMembers) {
+        static const std::string CaseTempl =
+            "case FieldIdx_#^#MEM_NAME#$#:\n"
+            "{\n"
+            "    auto& field_#^#MEM_NAME#$# = initField_#^#MEM_NAME#$#();\n"
+            "    #^#VERSION_ASSIGN#$#\n"
+            "    return field_#^#MEM_NAME#$#.read(iter, len);\n"
+            "}";
+
+        auto memAccName = comms::accessName(memPtr->field().dslObj().name());
+        util::ReplacementMap caseRepl = {
+            {"MEM_NAME", memAccName},
+        };
+
+        if (getReferenceFieldInternal(memPtr)->commsIsVersionDependent()) {
+            caseRepl["VERSION_ASSIGN"] = "field_" + memAccName + ".setVersion(Base::getVersion());";
+        }
+
+        cases.push_back(util::processTemplate(CaseTempl, caseRepl));
+    }
+
+    static const std::string Templ =
+        "template <typename TIter>\n"
+        "comms::ErrorStatus readPrefixCandidateInternal(std::size_t idx, TIter& iter, std::size_t len)\n"
+        "{\n"
+        "    switch (idx) {\n"
+        "        #^#CASES#$#\n"
+        "        default: break;\n"
+        "    }\n\n"
+        "    COMMS_ASSERT(false); // Should not be reached\n"
+        "    return comms::ErrorStatus::InvalidMsgData;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"CASES", util::strListToString(cases, "\n", "")}
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
 void CommsVariantField::commsAddCustomReadOptInternal(StringsList& opts) const
 {
-    if (!m_optimizedReadKey.empty()) {
+    if ((!m_optimizedReadKey.empty()) || (!m_prefixKeys.empty())) {
         util::addToStrList("comms::option::def::HasCustomRead", opts);
     }
 }
@@ -1106,4 +1466,106 @@ std::string CommsVariantField::commsOptimizedReadKeyInternal() const
     return result;
 }
 
+void CommsVariantField::commsPreparePrefixReadInternal()
+{
+    m_prefixKeys.clear();
+    m_prefixSequentialMembers.clear();
+    if (m_commsMembers.size() <= 1U) {
+        return;
+    }
+
+    PrefixKeysList keys;
+    static const std::size_t NoKeyIdx = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> memKeyIdx(m_commsMembers.size(), NoKeyIdx);
+    for (auto idx = 0U; idx < m_commsMembers.size(); ++idx) {
+        auto* member = getReferenceFieldInternal(m_commsMembers[idx]);
+        std::string rangeCond;
+        const CommsField* propKey = memberGetValidPropKeyInternal(*member);
+        if (propKey == nullptr) {
+            propKey = memberGetValidPropKeyRangeInternal(*member, rangeCond);
+        }
+
+        if (propKey == nullptr) {
+            continue;
+        }
+
+        auto iter = 
+            std::find_if(
+                keys.begin(), keys.end(),
+                [propKey](auto& info)
+                {
+                    return propKeysEquivalent(*info.m_keyField, *propKey);
+                });
+
+        if (iter == keys.end()) {
+            keys.resize(keys.size() + 1U);
+            iter = std::prev(keys.end());
+            iter->m_keyField = propKey;
+        }
+
+        memKeyIdx[idx] = static_cast<std::size_t>(std::distance(keys.begin(), iter));
+        if (!rangeCond.empty()) {
+            // Every member with the range key has its own candidate slot,
+            // the ranges are allowed to overlap.
+            iter->m_ranges.emplace_back(std::move(rangeCond), idx);
+            continue;
+        }
+
+        iter->m_cases.emplace_back(propKeyValueStrInternal(*propKey), idx);
+    }
+
+    // Members sharing the same key value are ambiguous, try them in order
+    std::size_t selectableCount = 0U;
+    for (auto& info : keys) {
+        auto& cases = info.m_cases;
+        for (auto& c : cases) {
+            auto count = 
+                std::count_if(
+                    cases.begin(), cases.end(),
+                    [&c](auto& other)
+                    {
+                        return other.first == c.first;
+                    });
+
+            if (count <= 1) {
+                continue;
+            }
+
+            memKeyIdx[c.second] = NoKeyIdx;
+        }
+
+        cases.erase(
+            std::remove_if(
+                cases.begin(), cases.end(),
+                [&memKeyIdx](auto& c)
+                {
+                    return memKeyIdx[c.second] == NoKeyIdx;
+                }),
+            cases.end());
+
+        selectableCount += cases.size() + info.m_ranges.size();
+    }
+
+    if (selectableCount <= 1U) {
+        return;
+    }
+
+    keys.erase(
+        std::remove_if(
+            keys.begin(), keys.end(),
+            [](auto& info)
+            {
+                return info.m_cases.empty() && info.m_ranges.empty();
+            }),
+        keys.end());
+
+    for (auto idx = 0U; idx < m_commsMembers.size(); ++idx) {
+        if (memKeyIdx[idx] == NoKeyIdx) {
+            m_prefixSequentialMembers.push_back(idx);
+        }
+    }
+
+    m_prefixKeys = std::move(keys);
+}
+
 } // namespace commsdsl2comms
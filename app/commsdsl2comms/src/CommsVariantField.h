@@ -20,6 +20,10 @@
 #include "commsdsl/gen/VariantField.h"
 #include "commsdsl/gen/util.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace commsdsl2comms
 {
 
@@ -71,11 +75,26 @@ private:
     std::string commsDefCanWriteCodeInternal() const;
     std::string commsDefSelectFieldCodeInternal() const;
 
+    std::string commsDefPrefixReadFuncBodyInternal() const;
+    std::string commsDefPrefixReadCandidateCodeInternal() const;
+
     void commsAddCustomReadOptInternal(StringsList& opts) const;
     std::string commsOptimizedReadKeyInternal() const;
+    void commsPreparePrefixReadInternal();
+
+    struct PrefixKeyInfo
+    {
+        const CommsField* m_keyField = nullptr;
+        std::vector<std::pair<std::string, std::size_t> > m_cases;
+        std::vector<std::pair<std::string, std::size_t> > m_ranges;
+    };
+    using PrefixKeysList = std::vector<PrefixKeyInfo>;
+    using MemberIdxList = std::vector<std::size_t>;
 
     CommsFieldsList m_commsMembers;
     std::string m_optimizedReadKey;
+    PrefixKeysList m_prefixKeys;
+    MemberIdxList m_prefixSequentialMembers;
 };
 
 } // namespace commsdsl2comms
@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 #include "commsdsl/gen/comms.h"
 
-#include <fstream>
 #include <cassert>
 
 namespace comms = commsdsl::gen::comms;
@@ -62,11 +61,6 @@ bool CommsVersion::writeInternal() const
     auto filePath = comms::headerPathRoot(strings::versionFileNameStr(), m_generator);
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     const std::string Templ = 
         "#^#GENERATED#$#\n"
@@ -100,14 +94,10 @@ bool CommsVersion::writeInternal() const
         {"COMMS_MIN", util::strReplace(CommsGenerator::commsMinCommsVersion(), ".", ", ")},
         {"PROT_VER_DEFINE", commsProtVersionDefineInternal()},
         {"PROT_VER_FUNC", commsProtVersionFuncsInternal()},
-        {"APPEND", util::readFileContents(comms::inputCodePathForRoot(strings::versionFileNameStr(), m_generator))},
+        {"APPEND", m_generator.readCodeFile(comms::inputCodePathForRoot(strings::versionFileNameStr(), m_generator))},
     };        
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
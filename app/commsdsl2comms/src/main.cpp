@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include "commsdsl/version.h"
+#include "commsdsl/gen/FileWatcher.h"
 #include "commsdsl/gen/util.h"
 
 #include "CommsProgramOptions.h"
@@ -56,6 +57,101 @@ std::vector<std::string> getFilesList(
     return result;
 }
 
+int generate(CommsGenerator& generator, const CommsProgramOptions& options)
+{
+    auto& logger = generator.logger();
+
+    if (options.quietRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+    }
+
+    if (options.debugRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Debug);
+    }        
+
+    if (options.warnAsErrRequested()) {
+        logger.setWarnAsError();
+    }
+
+    if (options.listOutputsRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+        generator.setDryRun();
+    }
+
+    generator.setSkipUnchangedFiles(options.watchRequested());
+    generator.setSelectedMessages(options.getSelectedMessages());
+    generator.setSelectedFrames(options.getSelectedFrames());
+
+    if (options.hasNamespaceOverride()) {
+        generator.setNamespaceOverride(options.getNamespace());
+    }
+
+    generator.setOutputDir(options.getOutputDirectory());
+
+    auto& outputTar = options.getOutputTar();
+    if (!outputTar.empty()) {
+        generator.setOutputSink(std::make_unique<commsdsl::gen::TarOutputSink>(outputTar, generator.getOutputDir()));
+    }
+
+    generator.setVersionIndependentCodeForced(options.versionIndependentCodeRequested());
+    generator.setMultipleSchemasEnabled(options.multipleSchemasEnabled());
+    generator.setCodeDir(options.getCodeInputDirectory());
+    generator.setMinRemoteVersion(options.getMinRemoteVersion());
+
+    generator.commsSetCustomizationLevel(options.getCustomizationLevel());
+    generator.commsSetProtocolVersion(options.getProtocolVersion());
+    generator.commsSetExtraInputBundles(options.getExtraInputBundles());
+    generator.commsSetMainNamespaceInOptionsForced(options.isMainNamespaceInOptionsForced());
+    generator.commsSetPrecompiledLib(options.getPrecompiledLib());
+    generator.commsSetFieldsDedupEnabled(options.fieldsDedupRequested());
+    generator.commsSetFramePipelineEnabled(options.framePipelineRequested());
+
+    auto files = getFilesList(options.getFilesListFile(), options.getFilesListPrefix());
+    auto otherFiles = options.getFiles();
+    files.insert(files.end(), otherFiles.begin(), otherFiles.end());
+
+    if (files.empty()) {
+        logger.error("No input files are provided");
+        return -1;
+    }
+
+    auto& traceJsonFile = options.getTraceJsonFile();
+    if (options.statsRequested() || (!traceJsonFile.empty())) {
+        generator.stats().setEnabled();
+    }
+
+    if (!generator.prepare(files)) {
+        return -1;
+    }
+
+    if (!generator.write()) {
+        return -1;
+    }
+
+    if (options.listOutputsRequested()) {
+        auto outputs = generator.outputFiles();
+        for (auto& f : outputs) {
+            std::cout << f << '\n';
+        }
+    }
+
+    auto& depfile = options.getDepfile();
+    if ((!depfile.empty()) && (!generator.writeDepfile(depfile))) {
+        return -1;
+    }
+
+    if (options.statsRequested()) {
+        std::cout << generator.stats().summary();
+    }
+
+    if ((!traceJsonFile.empty()) && (!generator.stats().writeTraceJson(traceJsonFile))) {
+        logger.error("Failed to write \"" + traceJsonFile + "\"");
+        return -1;
+    }
+    
+    return 0;
+}
+
 } // namespace commsdsl2comms
 int main(int argc, const char* argv[])
 {
@@ -76,54 +172,26 @@ int main(int argc, const char* argv[])
             return 0;
         }        
 
-        commsdsl2comms::CommsGenerator generator;
-        auto& logger = generator.logger();
-
-        if (options.quietRequested()) {
-            logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
-        }
-
-        if (options.debugRequested()) {
-            logger.setMinLevel(commsdsl::parse::ErrorLevel_Debug);
-        }        
-
-        if (options.warnAsErrRequested()) {
-            logger.setWarnAsError();
+        commsdsl::gen::FileWatcher watcher;
+        while (true) {
+            commsdsl2comms::CommsGenerator generator;
+            auto result = commsdsl2comms::generate(generator, options);
+            if (!options.watchRequested()) {
+                return result;
+            }
+
+            auto inputFiles = generator.inputFiles();
+            if (inputFiles.empty()) {
+                return result;
+            }
+
+            watcher.watch(inputFiles);
+            std::cout << "Watching " << inputFiles.size() << " input files for changes..." << std::endl;
+            auto changedFiles = watcher.waitForChanges();
+            for (auto& f : changedFiles) {
+                std::cout << "Detected change in " << f << std::endl;
+            }
         }
-
-        if (options.hasNamespaceOverride()) {
-            generator.setNamespaceOverride(options.getNamespace());
-        }
-
-        generator.setOutputDir(options.getOutputDirectory());
-        generator.setVersionIndependentCodeForced(options.versionIndependentCodeRequested());
-        generator.setMultipleSchemasEnabled(options.multipleSchemasEnabled());
-        generator.setCodeDir(options.getCodeInputDirectory());
-        generator.setMinRemoteVersion(options.getMinRemoteVersion());
-
-        generator.commsSetCustomizationLevel(options.getCustomizationLevel());
-        generator.commsSetProtocolVersion(options.getProtocolVersion());
-        generator.commsSetExtraInputBundles(options.getExtraInputBundles());
-        generator.commsSetMainNamespaceInOptionsForced(options.isMainNamespaceInOptionsForced());
-
-        auto files = commsdsl2comms::getFilesList(options.getFilesListFile(), options.getFilesListPrefix());
-        auto otherFiles = options.getFiles();
-        files.insert(files.end(), otherFiles.begin(), otherFiles.end());
-
-        if (files.empty()) {
-            logger.error("No input files are provided");
-            return -1;
-        }
-
-        if (!generator.prepare(files)) {
-            return -1;
-        }
-
-        if (!generator.write()) {
-            return -1;
-        }
-        
-        return 0;
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -23,7 +23,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -73,11 +72,6 @@ bool EmscriptenAllMessages::emscriptenWriteHeaderInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     util::StringsList includes = {
         "<tuple>"
@@ -117,14 +111,7 @@ bool EmscriptenAllMessages::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 bool EmscriptenAllMessages::emscriptenWriteHeaderFwdInternal() const
@@ -137,11 +124,6 @@ bool EmscriptenAllMessages::emscriptenWriteHeaderFwdInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     util::StringsList msgs;
 
@@ -168,14 +150,7 @@ bool EmscriptenAllMessages::emscriptenWriteHeaderFwdInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 
@@ -28,7 +28,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -53,11 +52,6 @@ bool EmscriptenCmake::emscriptenWriteInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "cmake_minimum_required (VERSION 3.12)\n"
@@ -126,19 +120,12 @@ bool EmscriptenCmake::emscriptenWriteInternal() const
 
     util::ReplacementMap repl = {
         {"PROJ_NAME", m_generator.protocolSchema().mainNamespace()},
-        {"APPEND", util::readFileContents(util::pathAddElem(m_generator.getCodeDir(), strings::cmakeListsFileStr()) + strings::appendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(util::pathAddElem(m_generator.getCodeDir(), strings::cmakeListsFileStr()) + strings::appendFileSuffixStr())},
         {"SOURCES", util::strListToString(sources, "\n", "")}
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write " + filePath + ".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 } // namespace commsdsl2emscripten
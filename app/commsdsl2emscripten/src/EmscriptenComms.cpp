@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -65,11 +64,6 @@ bool EmscriptenComms::emscriptenWriteErrorStatusInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Values[] = {
         "Success",
@@ -115,14 +109,7 @@ bool EmscriptenComms::emscriptenWriteErrorStatusInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 
@@ -137,11 +124,6 @@ bool EmscriptenComms::emscriptenWriteOptionalModeInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Values[] = {
         "Tentative",
@@ -181,14 +163,7 @@ bool EmscriptenComms::emscriptenWriteOptionalModeInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 } // namespace commsdsl2emscripten
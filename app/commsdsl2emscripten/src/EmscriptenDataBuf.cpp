@@ -22,7 +22,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -84,11 +83,6 @@ bool EmscriptenDataBuf::emscriptenWriteHeaderInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "#^#GENERATED#$#\n\n"
@@ -108,14 +102,7 @@ bool EmscriptenDataBuf::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 
@@ -129,11 +116,6 @@ bool EmscriptenDataBuf::emscriptenWriteSrcInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "#^#GENERATED#$#\n\n"
@@ -163,14 +145,7 @@ bool EmscriptenDataBuf::emscriptenWriteSrcInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 } // namespace commsdsl2emscripten
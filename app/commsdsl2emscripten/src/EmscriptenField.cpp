@@ -26,7 +26,6 @@
 
 #include <cassert>
 #include <algorithm>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -406,12 +405,6 @@ bool EmscriptenField::emscriptenWriteHeaderInternal() const
     auto& logger = generator.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n\n"
         "#pragma once\n\n"
@@ -424,12 +417,10 @@ bool EmscriptenField::emscriptenWriteHeaderInternal() const
         {"GENERATED", EmscriptenGenerator::fileGeneratedComment()},
         {"INCLUDES", emscriptenHeaderIncludesInternal()},
         {"CLASS", emscriptenHeaderClass()},
-        {"APPEND", util::readFileContents(generator.emspriptenInputAbsHeaderFor(m_field) + strings::appendFileSuffixStr())}
+        {"APPEND", generator.readCodeFile(generator.emspriptenInputAbsHeaderFor(m_field) + strings::appendFileSuffixStr())}
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good(); 
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool EmscriptenField::emscriptenWriteSrcInternal() const
@@ -445,12 +436,6 @@ bool EmscriptenField::emscriptenWriteSrcInternal() const
     auto& logger = generator.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n\n"
         "#^#INCLUDES#$#\n"
@@ -463,9 +448,7 @@ bool EmscriptenField::emscriptenWriteSrcInternal() const
         {"CODE", emscriptenSourceCode()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good(); 
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenField::emscriptenHeaderIncludesInternal() const
@@ -487,7 +470,7 @@ std::string EmscriptenField::emscriptenHeaderIncludesInternal() const
 
     comms::prepareIncludeStatement(includes);
     auto result = util::strListToString(includes, "\n", "\n");
-    result.append(util::readFileContents(generator.emspriptenInputAbsHeaderFor(m_field) + strings::incFileSuffixStr()));
+    result.append(generator.readCodeFile(generator.emspriptenInputAbsHeaderFor(m_field) + strings::incFileSuffixStr()));
     return result;
 }
 
@@ -500,9 +483,9 @@ std::string EmscriptenField::emscriptenHeaderClassInternal() const
     std::string privateCode;
     if (comms::isGlobalField(m_field)) {
         auto inputCodePrefix = generator.emspriptenInputAbsHeaderFor(m_field);
-        publicCode = util::readFileContents(inputCodePrefix + strings::publicFileSuffixStr());
-        protectedCode = util::readFileContents(inputCodePrefix + strings::protectedFileSuffixStr());
-        privateCode = util::readFileContents(inputCodePrefix + strings::privateFileSuffixStr());
+        publicCode = generator.readCodeFile(inputCodePrefix + strings::publicFileSuffixStr());
+        protectedCode = generator.readCodeFile(inputCodePrefix + strings::protectedFileSuffixStr());
+        privateCode = generator.readCodeFile(inputCodePrefix + strings::privateFileSuffixStr());
     }
 
     if (!protectedCode.empty()) {
@@ -681,7 +664,7 @@ std::string EmscriptenField::emscriptenSourceBindInternal() const
         {"VALUE_ACC", emscriptenSourceBindValueAccImpl()},
         {"FUNCS", emscriptenSourceBindFuncsImpl()},
         {"COMMON", emscriptenSourceBindCommonInternal()},
-        {"CUSTOM", util::readFileContents(generator.emspriptenInputAbsSourceFor(m_field) + strings::bindFileSuffixStr())},
+        {"CUSTOM", generator.readCodeFile(generator.emspriptenInputAbsSourceFor(m_field) + strings::bindFileSuffixStr())},
         {"VECTOR", emscriptenSourceRegisterVectorInternal()},
         {"EXTRA", emscriptenSourceBindExtraImpl()},
     };
@@ -29,7 +29,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -47,7 +46,7 @@ EmscriptenFrame::~EmscriptenFrame() = default;
 
 void EmscriptenFrame::emscriptenAddSourceFiles(StringsList& sources) const
 {
-    if (!m_validFrame) {
+    if ((!isReferenced()) || (!m_validFrame)) {
         return;
     }
 
@@ -108,12 +107,6 @@ bool EmscriptenFrame::emscriptenWriteHeaderInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -131,9 +124,7 @@ bool EmscriptenFrame::emscriptenWriteHeaderInternal() const
         {"DEF", emscriptenHeaderClassInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool EmscriptenFrame::emscriptenWriteSourceInternal() const
@@ -149,12 +140,6 @@ bool EmscriptenFrame::emscriptenWriteSourceInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -174,9 +159,7 @@ bool EmscriptenFrame::emscriptenWriteSourceInternal() const
         {"HEADER", gen.emscriptenRelHeaderFor(*this)},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenFrame::emscriptenHeaderIncludesInternal() const
@@ -24,7 +24,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -91,12 +90,6 @@ bool EmscriptenInterface::emscriptenWriteHeaderInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -112,9 +105,7 @@ bool EmscriptenInterface::emscriptenWriteHeaderInternal() const
         {"DEF", emscriptenHeaderClassInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool EmscriptenInterface::emscriptenWriteSourceInternal() const
@@ -130,12 +121,6 @@ bool EmscriptenInterface::emscriptenWriteSourceInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -153,9 +138,7 @@ bool EmscriptenInterface::emscriptenWriteSourceInternal() const
         {"MSG_HANDLER", EmscriptenMsgHandler::emscriptenRelHeader(gen)},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenInterface::emscriptenHeaderIncludesInternal() const
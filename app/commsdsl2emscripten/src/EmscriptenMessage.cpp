@@ -26,7 +26,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -92,12 +91,6 @@ bool EmscriptenMessage::emscriptenWriteHeaderInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -113,9 +106,7 @@ bool EmscriptenMessage::emscriptenWriteHeaderInternal() const
         {"DEF", emscriptenHeaderClassInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool EmscriptenMessage::emscriptenWriteSourceInternal() const
@@ -131,12 +122,6 @@ bool EmscriptenMessage::emscriptenWriteSourceInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#include \"#^#HEADER#$#\"\n\n"
@@ -152,9 +137,7 @@ bool EmscriptenMessage::emscriptenWriteSourceInternal() const
         {"CODE", emscriptenSourceCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string EmscriptenMessage::emscriptenHeaderIncludesInternal() const
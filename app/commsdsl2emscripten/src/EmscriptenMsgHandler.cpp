@@ -26,7 +26,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -77,11 +76,6 @@ bool EmscriptenMsgHandler::emscriptenWriteHeaderInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "#^#GENERATED#$#\n\n"
@@ -111,14 +105,7 @@ bool EmscriptenMsgHandler::emscriptenWriteHeaderInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 bool EmscriptenMsgHandler::emscriptenWriteSrcInternal() const
@@ -131,11 +118,6 @@ bool EmscriptenMsgHandler::emscriptenWriteSrcInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "#^#GENERATED#$#\n\n"
@@ -159,14 +141,7 @@ bool EmscriptenMsgHandler::emscriptenWriteSrcInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 std::string EmscriptenMsgHandler::emscriptenHeaderIncludesInternal() const
@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -69,12 +68,6 @@ bool EmscriptenMsgId::emscriptenWriteSrcInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n" 
         "#include <emscripten/bind.h>\n\n"
@@ -94,10 +87,7 @@ bool EmscriptenMsgId::emscriptenWriteSrcInternal() const
         {"HEADER", comms::relHeaderForRoot(strings::msgIdEnumNameStr(), m_generator)},
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
@@ -23,7 +23,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <limits>
 
 namespace util = commsdsl::gen::util;
@@ -141,12 +140,6 @@ bool EmscriptenProtocolOptions::emsciptenWriteHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     const std::string Templ =
         "#^#GENERATED#$#\n" 
         "#^#INCLUDES#$#\n"
@@ -159,10 +152,7 @@ bool EmscriptenProtocolOptions::emsciptenWriteHeaderInternal()
         {"DEF", emscriptenTypeDefInternal()}
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
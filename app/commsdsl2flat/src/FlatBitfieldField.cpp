@@ -0,0 +1,182 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatBitfieldField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <limits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatBitfieldField::FlatBitfieldField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatBitfieldField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    m_members = flatTransformFieldsList(members());
+    return true;
+}
+
+bool FlatBitfieldField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatBitfieldField::flatUnsupportedReasonImpl() const
+{
+    for (auto* m : m_members) {
+        if (!m->flatIsSerValue()) {
+            return flatUnsupportedStr("has unsupported member \"" + m->field().name() + "\"");
+        }
+    }
+
+    return flatMembersUnsupportedReason(m_members);
+}
+
+void FlatBitfieldField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatMembersAddIncludes(m_members, list);
+}
+
+std::string FlatBitfieldField::flatMembersDefImpl() const
+{
+    return flatMembersDefCode(m_members);
+}
+
+std::string FlatBitfieldField::flatValueDefImpl() const
+{
+    return flatMembersDataCode(m_members);
+}
+
+std::string FlatBitfieldField::flatMembersSourceImpl() const
+{
+    return flatMembersSourceCode(m_members);
+}
+
+std::string FlatBitfieldField::flatReadBodyImpl() const
+{
+    static const std::string Templ =
+        "if (len < #^#LEN#$#) {\n"
+        "    return ErrorStatus::NotEnoughData;\n"
+        "}\n"
+        "\n"
+        "auto bits = #^#FUNC#$#(iter, #^#LEN#$#);\n"
+        "len -= #^#LEN#$#;\n"
+        "#^#MEMBERS#$#\n";
+
+    bool little = (bitfieldDslObj().endian() == commsdsl::parse::Endian_Little);
+    util::ReplacementMap repl = {
+        {"LEN", std::to_string(flatSerBytes()) + 'U'},
+        {"FUNC", little ? "readLittleUnsigned" : "readBigUnsigned"},
+        {"MEMBERS", flatBitsCalcInternal(true)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatBitfieldField::flatWriteBodyImpl() const
+{
+    static const std::string Templ =
+        "if (len < #^#LEN#$#) {\n"
+        "    return ErrorStatus::BufferOverflow;\n"
+        "}\n"
+        "\n"
+        "std::uint64_t bits = 0U;\n"
+        "#^#MEMBERS#$#\n"
+        "#^#FUNC#$#(bits, #^#LEN#$#, iter);\n"
+        "len -= #^#LEN#$#;\n";
+
+    bool little = (bitfieldDslObj().endian() == commsdsl::parse::Endian_Little);
+    util::ReplacementMap repl = {
+        {"LEN", std::to_string(flatSerBytes()) + 'U'},
+        {"FUNC", little ? "writeLittleUnsigned" : "writeBigUnsigned"},
+        {"MEMBERS", flatBitsCalcInternal(false)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatBitfieldField::flatLengthBodyImpl() const
+{
+    return flatSerValueLengthBody();
+}
+
+std::string FlatBitfieldField::flatValidBodyImpl() const
+{
+    return flatMembersValidCode(m_members);
+}
+
+std::string FlatBitfieldField::flatBitsCalcInternal(bool read) const
+{
+    util::StringsList result;
+    std::size_t pos = 0U;
+    for (auto& mPtr : members()) {
+        auto bitLength = mPtr->dslObj().bitLength();
+        auto mask = ~static_cast<std::uintmax_t>(0);
+        if (bitLength < static_cast<std::size_t>(std::numeric_limits<std::uintmax_t>::digits)) {
+            mask = (static_cast<std::uintmax_t>(1U) << bitLength) - 1;
+        }
+
+        auto* flatMember = cast(mPtr.get());
+        auto maskStr = util::numToString(mask, true);
+        auto posStr = std::to_string(pos) + 'U';
+        if (read) {
+            std::string bitsStr = "bits";
+            if (pos != 0U) {
+                bitsStr = "(bits >> " + posStr + ")";
+            }
+
+            result.push_back(flatMember->flatDataName() + ".setSerValue(" + bitsStr + " & " + maskStr + ");");
+            if (mPtr->dslObj().isFailOnInvalid()) {
+                result.push_back(
+                    "if (!" + flatMember->flatDataName() + ".valid()) {\n"
+                    "    return ErrorStatus::InvalidMsgData;\n"
+                    "}\n");
+            }
+        }
+        else {
+            std::string valueStr = "(" + flatMember->flatDataName() + ".serValue() & " + maskStr + ")";
+            if (pos != 0U) {
+                valueStr = "(" + valueStr + " << " + posStr + ")";
+            }
+
+            result.push_back("bits |= " + valueStr + ";");
+        }
+
+        pos += bitLength;
+    }
+
+    return util::strListToString(result, "\n", "\n");
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,105 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatBundleField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatBundleField::FlatBundleField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatBundleField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    m_members = flatTransformFieldsList(members());
+    return true;
+}
+
+bool FlatBundleField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatBundleField::flatUnsupportedReasonImpl() const
+{
+    for (auto* m : m_members) {
+        if (m->field().dslObj().semanticType() == commsdsl::parse::Field::SemanticType::Length) {
+            return flatUnsupportedStr("has member with length semantic type");
+        }
+    }
+
+    return flatMembersUnsupportedReason(m_members);
+}
+
+void FlatBundleField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatMembersAddIncludes(m_members, list);
+}
+
+std::string FlatBundleField::flatMembersDefImpl() const
+{
+    return flatMembersDefCode(m_members);
+}
+
+std::string FlatBundleField::flatValueDefImpl() const
+{
+    return flatMembersDataCode(m_members);
+}
+
+std::string FlatBundleField::flatMembersSourceImpl() const
+{
+    return flatMembersSourceCode(m_members);
+}
+
+std::string FlatBundleField::flatReadBodyImpl() const
+{
+    return flatMembersReadCode(m_members);
+}
+
+std::string FlatBundleField::flatWriteBodyImpl() const
+{
+    return flatMembersWriteCode(m_members);
+}
+
+std::string FlatBundleField::flatLengthBodyImpl() const
+{
+    return flatMembersLengthCode(m_members);
+}
+
+std::string FlatBundleField::flatValidBodyImpl() const
+{
+    return flatMembersValidCode(m_members);
+}
+
+} // namespace commsdsl2flat
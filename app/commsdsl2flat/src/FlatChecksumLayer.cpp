@@ -0,0 +1,139 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatChecksumLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string& checksumFuncFor(commsdsl::parse::ChecksumLayer::Alg alg)
+{
+    static const std::string Map[] = {
+        /* Custom */ strings::emptyString(),
+        /* Sum */ "checksumSum",
+        /* Crc_CCITT */ "checksumCrcCcitt",
+        /* Crc_16 */ "checksumCrc16",
+        /* Crc_32 */ "checksumCrc32",
+        /* Xor */ "checksumXor",
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(commsdsl::parse::ChecksumLayer::Alg::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(alg);
+    if (MapSize <= idx) {
+        assert(false); // Should not happen
+        return strings::emptyString();
+    }
+
+    return Map[idx];
+}
+
+} // namespace
+
+FlatChecksumLayer::FlatChecksumLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatChecksumLayer::flatFromLayerName() const
+{
+    return checksumDslObj().fromLayer();
+}
+
+std::string FlatChecksumLayer::flatFromVarName() const
+{
+    return "csumFrom_" + comms::accessName(dslObj().name());
+}
+
+std::string FlatChecksumLayer::flatUnsupportedReasonImpl() const
+{
+    auto obj = checksumDslObj();
+    if (obj.alg() == commsdsl::parse::ChecksumLayer::Alg::Custom) {
+        return flatUnsupportedStr("uses custom checksum algorithm");
+    }
+
+    if (!obj.untilLayer().empty()) {
+        return flatUnsupportedStr("is checksum prefix");
+    }
+
+    auto* field = flatActualField();
+    if ((field == nullptr) || (!FlatField::cast(field)->flatIsSerValue())) {
+        return flatUnsupportedStr("uses non-integral checksum field");
+    }
+
+    return strings::emptyString();
+}
+
+std::string FlatChecksumLayer::flatReadCodeImpl() const
+{
+    static const std::string Templ =
+        "auto #^#CSUM#$# = truncateUnsigned(#^#FUNC#$#(#^#FROM#$#, static_cast<std::size_t>(iter - #^#FROM#$#)), #^#LEN#$#);\n"
+        "#^#READ#$#\n"
+        "if (#^#VAR#$#.serValue() != #^#CSUM#$#) {\n"
+        "    return ErrorStatus::ProtocolError;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"CSUM", "csum_" + comms::accessName(dslObj().name())},
+        {"FUNC", checksumFuncFor(checksumDslObj().alg())},
+        {"FROM", flatFromVarName()},
+        {"LEN", std::to_string(flatActualField()->dslObj().minLength()) + 'U'},
+        {"READ", flatFieldReadCode()},
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatChecksumLayer::flatWriteCodeImpl() const
+{
+    static const std::string Templ =
+        "#^#TYPE#$# #^#VAR#$#;\n"
+        "#^#VAR#$#.setSerValue(truncateUnsigned(#^#FUNC#$#(#^#FROM#$#, static_cast<std::size_t>(iter - #^#FROM#$#)), #^#LEN#$#));\n"
+        "es = #^#VAR#$#.write(iter, remLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"TYPE", flatFieldTypeRef()},
+        {"VAR", flatFieldVarName()},
+        {"FUNC", checksumFuncFor(checksumDslObj().alg())},
+        {"FROM", flatFromVarName()},
+        {"LEN", std::to_string(flatActualField()->dslObj().minLength()) + 'U'},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2flat
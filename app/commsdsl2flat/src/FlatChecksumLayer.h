@@ -0,0 +1,43 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "FlatLayer.h"
+
+#include "commsdsl/gen/ChecksumLayer.h"
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator;
+class FlatChecksumLayer final : public commsdsl::gen::ChecksumLayer, public FlatLayer
+{
+    using Base = commsdsl::gen::ChecksumLayer;
+    using FlatBase = FlatLayer;
+public:
+    FlatChecksumLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent);
+
+    std::string flatFromLayerName() const;
+    std::string flatFromVarName() const;
+
+protected:
+    // FlatBase overrides
+    virtual std::string flatUnsupportedReasonImpl() const override;
+    virtual std::string flatReadCodeImpl() const override;
+    virtual std::string flatWriteCodeImpl() const override;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,107 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatCmake.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+bool FlatCmake::write(FlatGenerator& generator)
+{
+    FlatCmake obj(generator);
+    return obj.flatWriteInternal();
+}
+
+bool FlatCmake::flatWriteInternal() const
+{
+    static const std::string Templ =
+        "cmake_minimum_required (VERSION 3.10)\n"
+        "project (\"#^#PROJ_NAME#$#_flat\")\n"
+        "\n"
+        "option (OPT_BUILD_CONFORMANCE \"Build conformance check against the COMMS based protocol definition.\" OFF)\n"
+        "\n"
+        "# Other parameters:\n"
+        "# OPT_MSVC_FORCE_WARN_LEVEL - Force msvc warning level\n"
+        "\n"
+        "if (CMAKE_TOOLCHAIN_FILE AND EXISTS ${CMAKE_TOOLCHAIN_FILE})\n"
+        "    message(STATUS \"Loading toolchain from ${CMAKE_TOOLCHAIN_FILE}\")\n"
+        "endif()\n"
+        "\n"
+        "set(CMAKE_CXX_STANDARD 11 CACHE STRING \"The C++ standard to use\")\n"
+        "\n"
+        "include(GNUInstallDirs)\n"
+        "\n"
+        "set (lib_name #^#PROJ_NS#$#_flat)\n"
+        "file (GLOB_RECURSE src \"src/*.cpp\")\n"
+        "add_library(${lib_name} STATIC ${src})\n"
+        "target_include_directories(${lib_name} PUBLIC\n"
+        "    $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/include>\n"
+        "    $<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>\n"
+        ")\n"
+        "\n"
+        "install (\n"
+        "    TARGETS ${lib_name}\n"
+        "    DESTINATION ${CMAKE_INSTALL_LIBDIR}\n"
+        ")\n"
+        "\n"
+        "install (\n"
+        "    DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/include/\n"
+        "    DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}\n"
+        ")\n"
+        "\n"
+        "if (NOT OPT_BUILD_CONFORMANCE)\n"
+        "    return ()\n"
+        "endif ()\n"
+        "\n"
+        "find_package (LibComms REQUIRED)\n"
+        "find_package (#^#PROJ_NS#$# REQUIRED)\n"
+        "\n"
+        "include(${LibComms_DIR}/CC_Compile.cmake)\n"
+        "cc_compile(WARN_AS_ERR)\n"
+        "cc_msvc_force_warn_opt(/W4)\n"
+        "\n"
+        "set (conformance_name flat_conformance)\n"
+        "add_executable(${conformance_name} test/flat_conformance.cpp)\n"
+        "target_link_libraries(${conformance_name} PRIVATE ${lib_name} cc::#^#PROJ_NS#$# cc::comms)\n"
+        "target_compile_options(${conformance_name} PRIVATE\n"
+        "    $<$<CXX_COMPILER_ID:MSVC>:/wd4996 /bigobj>\n"
+        "    $<$<CXX_COMPILER_ID:GNU>:-ftemplate-depth=2048 -fconstexpr-depth=4096>\n"
+        "    $<$<CXX_COMPILER_ID:Clang>:-ftemplate-depth=2048 -fconstexpr-depth=4096>\n"
+        ")\n"
+        "\n"
+        "install (\n"
+        "    TARGETS ${conformance_name}\n"
+        "    DESTINATION ${CMAKE_INSTALL_BINDIR}\n"
+        ")\n"
+        ;
+
+    util::ReplacementMap repl = {
+        {"PROJ_NAME", m_generator.currentSchema().schemaName()},
+        {"PROJ_NS", m_generator.currentSchema().mainNamespace()},
+    };
+
+    auto filePath = util::pathAddElem(m_generator.getOutputDir(), strings::cmakeListsFileStr());
+    return m_generator.flatWriteFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+} // namespace commsdsl2flat
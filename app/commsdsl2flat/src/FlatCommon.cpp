@@ -0,0 +1,407 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatCommon.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string CommonNameStr("Common");
+
+const std::string CommonNames[] = {
+    "ErrorStatus",
+    "DataView",
+    "StringView",
+    "StaticVector",
+    "readBigUnsigned",
+    "readLittleUnsigned",
+    "writeBigUnsigned",
+    "writeLittleUnsigned",
+    "signExtend",
+    "truncateUnsigned",
+    "writeBytes",
+    "checksumSum",
+    "checksumXor",
+    "checksumCrcCcitt",
+    "checksumCrc16",
+    "checksumCrc32",
+};
+
+} // namespace
+
+bool FlatCommon::write(FlatGenerator& generator)
+{
+    FlatCommon obj(generator);
+    return obj.flatWriteInternal();
+}
+
+const std::string& FlatCommon::flatName()
+{
+    return CommonNameStr;
+}
+
+bool FlatCommon::flatWriteInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains common definitions used by the flat protocol code.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "#^#DEFS#$#\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto ns = m_generator.flatScopeForRoot(strings::emptyString());
+    ns.resize(ns.size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(ns)},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(ns)},
+    };
+
+    if (m_generator.isCurrentProtocolSchema()) {
+        repl["INCLUDES"] =
+            "#include <cmath>\n"
+            "#include <cstddef>\n"
+            "#include <cstdint>\n"
+            "#include <cstring>\n"
+            "#include <limits>";
+        repl["DEFS"] = flatProtocolDefsInternal();
+    }
+    else {
+        repl["INCLUDES"] = "#include \"" + m_generator.protocolSchema().mainNamespace() + "/flat/" + flatName() + strings::cppHeaderSuffixStr() + '\"';
+        repl["DEFS"] = flatAliasesInternal();
+    }
+
+    return m_generator.flatWriteFile(m_generator.flatHeaderPathForRoot(flatName()), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatCommon::flatProtocolDefsInternal() const
+{
+    static const std::string Str =
+        "/// @brief Status of the read / write operations.\n"
+        "enum class ErrorStatus\n"
+        "{\n"
+        "    Success, ///< Operation is successful.\n"
+        "    NotEnoughData, ///< Input buffer does not contain enough data.\n"
+        "    ProtocolError, ///< Input data violates the protocol.\n"
+        "    BufferOverflow, ///< Output buffer is too small.\n"
+        "    InvalidMsgId, ///< Unknown message id.\n"
+        "    InvalidMsgData, ///< Message contents are invalid.\n"
+        "    CapacityExceeded, ///< Storage capacity is exceeded.\n"
+        "    NumOfValues ///< Limit to available values, must be last.\n"
+        "};\n"
+        "\n"
+        "/// @brief Non-owning view of raw bytes.\n"
+        "struct DataView\n"
+        "{\n"
+        "    constexpr DataView() = default;\n"
+        "    constexpr DataView(const std::uint8_t* d, std::size_t s) : data(d), size(s) {}\n"
+        "\n"
+        "    const std::uint8_t* data = nullptr;\n"
+        "    std::size_t size = 0U;\n"
+        "};\n"
+        "\n"
+        "/// @brief Non-owning view of characters.\n"
+        "struct StringView\n"
+        "{\n"
+        "    constexpr StringView() = default;\n"
+        "    constexpr StringView(const char* d, std::size_t s) : data(d), size(s) {}\n"
+        "\n"
+        "    const char* data = nullptr;\n"
+        "    std::size_t size = 0U;\n"
+        "};\n"
+        "\n"
+        "/// @brief Fixed capacity storage of elements.\n"
+        "template <typename T, std::size_t TCapacity>\n"
+        "struct StaticVector\n"
+        "{\n"
+        "    T elems[TCapacity];\n"
+        "    std::size_t count = 0U;\n"
+        "\n"
+        "    static constexpr std::size_t capacity()\n"
+        "    {\n"
+        "        return TCapacity;\n"
+        "    }\n"
+        "\n"
+        "    std::size_t size() const\n"
+        "    {\n"
+        "        return count;\n"
+        "    }\n"
+        "\n"
+        "    bool empty() const\n"
+        "    {\n"
+        "        return count == 0U;\n"
+        "    }\n"
+        "\n"
+        "    void clear()\n"
+        "    {\n"
+        "        count = 0U;\n"
+        "    }\n"
+        "\n"
+        "    bool resize(std::size_t newSize)\n"
+        "    {\n"
+        "        if (TCapacity < newSize) {\n"
+        "            return false;\n"
+        "        }\n"
+        "\n"
+        "        for (auto idx = count; idx < newSize; ++idx) {\n"
+        "            elems[idx] = T();\n"
+        "        }\n"
+        "\n"
+        "        count = newSize;\n"
+        "        return true;\n"
+        "    }\n"
+        "\n"
+        "    bool push_back(const T& elem)\n"
+        "    {\n"
+        "        if (TCapacity <= count) {\n"
+        "            return false;\n"
+        "        }\n"
+        "\n"
+        "        elems[count] = elem;\n"
+        "        ++count;\n"
+        "        return true;\n"
+        "    }\n"
+        "\n"
+        "    T& back()\n"
+        "    {\n"
+        "        return elems[count - 1U];\n"
+        "    }\n"
+        "\n"
+        "    const T& back() const\n"
+        "    {\n"
+        "        return elems[count - 1U];\n"
+        "    }\n"
+        "\n"
+        "    T& operator[](std::size_t idx)\n"
+        "    {\n"
+        "        return elems[idx];\n"
+        "    }\n"
+        "\n"
+        "    const T& operator[](std::size_t idx) const\n"
+        "    {\n"
+        "        return elems[idx];\n"
+        "    }\n"
+        "\n"
+        "    T* begin()\n"
+        "    {\n"
+        "        return &elems[0];\n"
+        "    }\n"
+        "\n"
+        "    T* end()\n"
+        "    {\n"
+        "        return begin() + count;\n"
+        "    }\n"
+        "\n"
+        "    const T* begin() const\n"
+        "    {\n"
+        "        return &elems[0];\n"
+        "    }\n"
+        "\n"
+        "    const T* end() const\n"
+        "    {\n"
+        "        return begin() + count;\n"
+        "    }\n"
+        "};\n"
+        "\n"
+        "/// @brief Read big endian unsigned value of specified length in bytes.\n"
+        "inline std::uint64_t readBigUnsigned(const std::uint8_t*& iter, std::size_t bytes)\n"
+        "{\n"
+        "    std::uint64_t result = 0U;\n"
+        "    for (auto idx = 0U; idx < bytes; ++idx) {\n"
+        "        result = (result << 8U) | static_cast<std::uint64_t>(*iter);\n"
+        "        ++iter;\n"
+        "    }\n"
+        "    return result;\n"
+        "}\n"
+        "\n"
+        "/// @brief Read little endian unsigned value of specified length in bytes.\n"
+        "inline std::uint64_t readLittleUnsigned(const std::uint8_t*& iter, std::size_t bytes)\n"
+        "{\n"
+        "    std::uint64_t result = 0U;\n"
+        "    for (auto idx = 0U; idx < bytes; ++idx) {\n"
+        "        result |= static_cast<std::uint64_t>(*iter) << (idx * 8U);\n"
+        "        ++iter;\n"
+        "    }\n"
+        "    return result;\n"
+        "}\n"
+        "\n"
+        "/// @brief Write big endian unsigned value of specified length in bytes.\n"
+        "inline void writeBigUnsigned(std::uint64_t value, std::size_t bytes, std::uint8_t*& iter)\n"
+        "{\n"
+        "    for (auto idx = 0U; idx < bytes; ++idx) {\n"
+        "        *iter = static_cast<std::uint8_t>(value >> ((bytes - idx - 1U) * 8U));\n"
+        "        ++iter;\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "/// @brief Write little endian unsigned value of specified length in bytes.\n"
+        "inline void writeLittleUnsigned(std::uint64_t value, std::size_t bytes, std::uint8_t*& iter)\n"
+        "{\n"
+        "    for (auto idx = 0U; idx < bytes; ++idx) {\n"
+        "        *iter = static_cast<std::uint8_t>(value >> (idx * 8U));\n"
+        "        ++iter;\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "/// @brief Sign extend the value of specified length in bits.\n"
+        "inline std::int64_t signExtend(std::uint64_t value, std::size_t bits)\n"
+        "{\n"
+        "    if (64U <= bits) {\n"
+        "        return static_cast<std::int64_t>(value);\n"
+        "    }\n"
+        "\n"
+        "    auto signMask = static_cast<std::uint64_t>(1U) << (bits - 1U);\n"
+        "    auto mask = (signMask << 1U) - 1U;\n"
+        "    value &= mask;\n"
+        "    if ((value & signMask) == 0U) {\n"
+        "        return static_cast<std::int64_t>(value);\n"
+        "    }\n"
+        "\n"
+        "    return -static_cast<std::int64_t>(((~value) & mask) + 1U);\n"
+        "}\n"
+        "\n"
+        "/// @brief Truncate the value to the specified length in bytes.\n"
+        "inline std::uint64_t truncateUnsigned(std::uint64_t value, std::size_t bytes)\n"
+        "{\n"
+        "    if (sizeof(std::uint64_t) <= bytes) {\n"
+        "        return value;\n"
+        "    }\n"
+        "\n"
+        "    return value & ((static_cast<std::uint64_t>(1U) << (bytes * 8U)) - 1U);\n"
+        "}\n"
+        "\n"
+        "/// @brief Copy raw bytes to the output buffer.\n"
+        "inline void writeBytes(const std::uint8_t* src, std::size_t len, std::uint8_t*& iter)\n"
+        "{\n"
+        "    if ((src == nullptr) || (len == 0U)) {\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    std::memcpy(iter, src, len);\n"
+        "    iter += len;\n"
+        "}\n"
+        "\n"
+        "/// @brief Arithmetic summary of all the bytes.\n"
+        "inline std::uint64_t checksumSum(const std::uint8_t* data, std::size_t len)\n"
+        "{\n"
+        "    std::uint64_t result = 0U;\n"
+        "    for (auto idx = 0U; idx < len; ++idx) {\n"
+        "        result += data[idx];\n"
+        "    }\n"
+        "    return result;\n"
+        "}\n"
+        "\n"
+        "/// @brief XOR of all the bytes.\n"
+        "inline std::uint64_t checksumXor(const std::uint8_t* data, std::size_t len)\n"
+        "{\n"
+        "    std::uint64_t result = 0U;\n"
+        "    for (auto idx = 0U; idx < len; ++idx) {\n"
+        "        result ^= data[idx];\n"
+        "    }\n"
+        "    return result;\n"
+        "}\n"
+        "\n"
+        "/// @brief CRC-CCITT (polynomial 0x1021, initial value 0xffff).\n"
+        "inline std::uint64_t checksumCrcCcitt(const std::uint8_t* data, std::size_t len)\n"
+        "{\n"
+        "    std::uint16_t crc = 0xffff;\n"
+        "    for (auto idx = 0U; idx < len; ++idx) {\n"
+        "        crc = static_cast<std::uint16_t>(crc ^ (static_cast<std::uint16_t>(data[idx]) << 8U));\n"
+        "        for (auto bit = 0U; bit < 8U; ++bit) {\n"
+        "            if ((crc & 0x8000U) != 0U) {\n"
+        "                crc = static_cast<std::uint16_t>((crc << 1U) ^ 0x1021U);\n"
+        "            }\n"
+        "            else {\n"
+        "                crc = static_cast<std::uint16_t>(crc << 1U);\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "    return crc;\n"
+        "}\n"
+        "\n"
+        "/// @brief CRC-16 (polynomial 0x8005 reflected, initial value 0).\n"
+        "inline std::uint64_t checksumCrc16(const std::uint8_t* data, std::size_t len)\n"
+        "{\n"
+        "    std::uint16_t crc = 0U;\n"
+        "    for (auto idx = 0U; idx < len; ++idx) {\n"
+        "        crc = static_cast<std::uint16_t>(crc ^ data[idx]);\n"
+        "        for (auto bit = 0U; bit < 8U; ++bit) {\n"
+        "            if ((crc & 0x1U) != 0U) {\n"
+        "                crc = static_cast<std::uint16_t>((crc >> 1U) ^ 0xa001U);\n"
+        "            }\n"
+        "            else {\n"
+        "                crc = static_cast<std::uint16_t>(crc >> 1U);\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "    return crc;\n"
+        "}\n"
+        "\n"
+        "/// @brief CRC-32 (polynomial 0x04c11db7 reflected, initial and final XOR value 0xffffffff).\n"
+        "inline std::uint64_t checksumCrc32(const std::uint8_t* data, std::size_t len)\n"
+        "{\n"
+        "    std::uint32_t crc = 0xffffffffU;\n"
+        "    for (auto idx = 0U; idx < len; ++idx) {\n"
+        "        crc ^= data[idx];\n"
+        "        for (auto bit = 0U; bit < 8U; ++bit) {\n"
+        "            if ((crc & 0x1U) != 0U) {\n"
+        "                crc = (crc >> 1U) ^ 0xedb88320U;\n"
+        "            }\n"
+        "            else {\n"
+        "                crc >>= 1U;\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "    return crc ^ 0xffffffffU;\n"
+        "}\n"
+        ;
+
+    return Str;
+}
+
+std::string FlatCommon::flatAliasesInternal() const
+{
+    auto& protNs = m_generator.protocolSchema().mainNamespace();
+    util::StringsList aliases;
+    for (auto& n : CommonNames) {
+        aliases.push_back("using " + protNs + "::flat::" + n + ';');
+    }
+
+    return util::strListToString(aliases, "\n", "");
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,569 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatConformance.h"
+
+#include "FlatFrame.h"
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string ConformanceDirStr("test");
+const std::string ConformanceFileStr("flat_conformance.cpp");
+
+std::string interfaceScopeFor(const FlatGenerator& generator)
+{
+    auto allInterfaces = generator.getAllInterfaces();
+    if (!allInterfaces.empty()) {
+        auto* firstInterface = allInterfaces.front();
+        assert(!firstInterface->name().empty());
+        return comms::scopeFor(*firstInterface, generator);
+    }
+
+    return comms::scopeForInterface(strings::messageClassStr(), generator);
+}
+
+} // namespace
+
+bool FlatConformance::write(FlatGenerator& generator)
+{
+    FlatConformance obj(generator);
+    return obj.flatWriteInternal();
+}
+
+bool FlatConformance::flatWriteInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Conformance check of the flat protocol code against the COMMS one.\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "namespace\n"
+        "{\n"
+        "\n"
+        "using Interface =\n"
+        "    #^#INTERFACE#$#<\n"
+        "        comms::option::app::ReadIterator<const std::uint8_t*>,\n"
+        "        comms::option::app::WriteIterator<std::uint8_t*>,\n"
+        "        comms::option::app::LengthInfoInterface,\n"
+        "        comms::option::app::IdInfoInterface\n"
+        "    >;\n"
+        "\n"
+        "unsigned failures = 0U;\n"
+        "\n"
+        "void reportFailure(const char* name, const char* reason)\n"
+        "{\n"
+        "    std::cerr << \"FAILURE: \" << name << \": \" << reason << std::endl;\n"
+        "    ++failures;\n"
+        "}\n"
+        "\n"
+        "struct EnumFieldTag {};\n"
+        "struct BitmaskFieldTag {};\n"
+        "struct GenericFieldTag {};\n"
+        "struct IntElementTag {};\n"
+        "struct FieldElementTag {};\n"
+        "\n"
+        "template <typename TField>\n"
+        "using FieldTag =\n"
+        "    typename std::conditional<\n"
+        "        comms::field::isEnumValue<TField>(),\n"
+        "        EnumFieldTag,\n"
+        "        typename std::conditional<\n"
+        "            comms::field::isBitmaskValue<TField>(),\n"
+        "            BitmaskFieldTag,\n"
+        "            GenericFieldTag\n"
+        "        >::type\n"
+        "    >::type;\n"
+        "\n"
+        "template <typename TList>\n"
+        "using ElementTag =\n"
+        "    typename std::conditional<\n"
+        "        std::is_integral<typename TList::ElementType>::value,\n"
+        "        IntElementTag,\n"
+        "        FieldElementTag\n"
+        "    >::type;\n"
+        "\n"
+        "// The field is written, read back and written again, the modified value\n"
+        "// is kept only when both outputs are the same.\n"
+        "template <typename TField>\n"
+        "bool fieldReadsBack(const TField& field)\n"
+        "{\n"
+        "    std::vector<std::uint8_t> buf(field.length());\n"
+        "    std::uint8_t* writeIter = buf.data();\n"
+        "    if (field.write(writeIter, buf.size()) != comms::ErrorStatus::Success) {\n"
+        "        return false;\n"
+        "    }\n"
+        "\n"
+        "    TField readField(field);\n"
+        "    const std::uint8_t* readIter = buf.data();\n"
+        "    if ((readField.read(readIter, buf.size()) != comms::ErrorStatus::Success) ||\n"
+        "        (static_cast<std::size_t>(readIter - buf.data()) != buf.size()) ||\n"
+        "        (readField.length() != buf.size())) {\n"
+        "        return false;\n"
+        "    }\n"
+        "\n"
+        "    std::vector<std::uint8_t> rewrittenBuf(buf.size());\n"
+        "    writeIter = rewrittenBuf.data();\n"
+        "    return\n"
+        "        (readField.write(writeIter, rewrittenBuf.size()) == comms::ErrorStatus::Success) &&\n"
+        "        (rewrittenBuf == buf);\n"
+        "}\n"
+        "\n"
+        "// Assigns non-default values to the fields: non-empty lists, strings and data,\n"
+        "// existing optionals and selected variant members. The variant member is chosen\n"
+        "// by the pass number, the number of passes required to select every member of\n"
+        "// the largest variant is reported back via @b passes.\n"
+        "class Populator\n"
+        "{\n"
+        "public:\n"
+        "    Populator(unsigned pass, unsigned& passes) : m_pass(pass), m_passes(passes) {}\n"
+        "\n"
+        "    template <typename TField>\n"
+        "    void operator()(TField& field) const\n"
+        "    {\n"
+        "        populate(field);\n"
+        "    }\n"
+        "\n"
+        "    template <std::size_t TIdx, typename TField>\n"
+        "    void operator()(TField& field) const\n"
+        "    {\n"
+        "        populate(field);\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField>\n"
+        "    void populate(TField& field) const\n"
+        "    {\n"
+        "        TField origField(field);\n"
+        "        populateValue<TField>(field, FieldTag<TField>());\n"
+        "        if ((!field.valid()) || (!fieldReadsBack(field))) {\n"
+        "            field = origField;\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "private:\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    void populateValue(comms::field::IntValue<TFieldBase, T, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        using ValueType = typename TField::ValueType;\n"
+        "        auto origValue = actField.value();\n"
+        "        actField.value() = static_cast<ValueType>(origValue ^ static_cast<ValueType>(1U));\n"
+        "        if (!actField.valid()) {\n"
+        "            actField.value() = static_cast<ValueType>(origValue ^ static_cast<ValueType>(2U));\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField>\n"
+        "    void populateValue(TField& field, EnumFieldTag) const\n"
+        "    {\n"
+        "        auto info = TField::valueNamesMap();\n"
+        "        if (info.second == 0U) {\n"
+        "            return;\n"
+        "        }\n"
+        "\n"
+        "        field.value() = info.first[(m_pass + 1U) % info.second].first;\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField>\n"
+        "    void populateValue(TField& field, BitmaskFieldTag) const\n"
+        "    {\n"
+        "        for (auto idx = 0U; idx < static_cast<unsigned>(TField::BitIdx_numOfValues); ++idx) {\n"
+        "            field.setBitValue(idx, ((idx + m_pass) % 2U) == 0U);\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    void populateValue(comms::field::Bitfield<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        comms::util::tupleForEach(actField.value(), *this);\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    void populateValue(comms::field::Bundle<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        comms::util::tupleForEach(actField.value(), *this);\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename T, typename... TOptions>\n"
+        "    void populateValue(comms::field::FloatValue<TFieldBase, T, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        using ValueType = typename TField::ValueType;\n"
+        "        actField.value() = static_cast<ValueType>(actField.value() + static_cast<ValueType>(1.5));\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename... TOptions>\n"
+        "    void populateValue(comms::field::String<TFieldBase, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        actField.value() = \"ab\";\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename TElement, typename... TOptions>\n"
+        "    void populateValue(comms::field::ArrayList<TFieldBase, TElement, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        populateList(actField.value(), ElementTag<TField>());\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TOptField, typename... TOptions>\n"
+        "    void populateValue(comms::field::Optional<TOptField, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        actField.setExists();\n"
+        "        populate(actField.field());\n"
+        "    }\n"
+        "\n"
+        "    template <typename TField, typename TFieldBase, typename TMembers, typename... TOptions>\n"
+        "    void populateValue(comms::field::Variant<TFieldBase, TMembers, TOptions...>& field, GenericFieldTag) const\n"
+        "    {\n"
+        "        auto membersCount = static_cast<unsigned>(std::tuple_size<TMembers>::value);\n"
+        "        if (membersCount == 0U) {\n"
+        "            return;\n"
+        "        }\n"
+        "\n"
+        "        m_passes = std::max(m_passes, membersCount);\n"
+        "        auto& actField = static_cast<TField&>(field);\n"
+        "        actField.selectField(m_pass % membersCount);\n"
+        "        actField.currentFieldExec(*this);\n"
+        "    }\n"
+        "\n"
+        "    template <typename TVec>\n"
+        "    void populateList(TVec& data, IntElementTag) const\n"
+        "    {\n"
+        "        using ElemType = typename TVec::value_type;\n"
+        "        if (data.empty()) {\n"
+        "            data.push_back(static_cast<ElemType>(0x5a));\n"
+        "            data.push_back(static_cast<ElemType>(0xa5));\n"
+        "            return;\n"
+        "        }\n"
+        "\n"
+        "        for (auto& byte : data) {\n"
+        "            byte = static_cast<ElemType>(byte ^ 0x5a);\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    template <typename TVec>\n"
+        "    void populateList(TVec& data, FieldElementTag) const\n"
+        "    {\n"
+        "        if (data.empty()) {\n"
+        "            data.resize(2U);\n"
+        "        }\n"
+        "\n"
+        "        for (auto& elem : data) {\n"
+        "            populate(elem);\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    unsigned m_pass = 0U;\n"
+        "    unsigned& m_passes;\n"
+        "};\n"
+        "\n"
+        "template <typename TCommsMsg>\n"
+        "void populateMessage(TCommsMsg& msg, unsigned pass, unsigned& passes)\n"
+        "{\n"
+        "    comms::util::tupleForEach(msg.fields(), Populator(pass, passes));\n"
+        "    msg.doRefresh();\n"
+        "}\n"
+        "\n"
+        "template <typename TCommsMsg>\n"
+        "bool writeMessage(const TCommsMsg& msg, std::vector<std::uint8_t>& buf)\n"
+        "{\n"
+        "    buf.resize(msg.length());\n"
+        "    std::uint8_t* writeIter = buf.data();\n"
+        "    return msg.write(writeIter, buf.size()) == comms::ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "std::string passName(const char* name, unsigned pass)\n"
+        "{\n"
+        "    return std::string(name) + \" (populated, pass \" + std::to_string(pass) + \")\";\n"
+        "}\n"
+        "\n"
+        "template <typename TCommsMsg, typename TFlatMsg>\n"
+        "void checkPayload(const std::string& name, const std::vector<std::uint8_t>& commsBuf)\n"
+        "{\n"
+        "    TFlatMsg decodedMsg;\n"
+        "    if (decode(commsBuf.data(), commsBuf.size(), decodedMsg) != #^#FLAT_NS#$#::ErrorStatus::Success) {\n"
+        "        reportFailure(name.c_str(), \"flat decode failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    std::vector<std::uint8_t> reencodedBuf(decodedMsg.length());\n"
+        "    std::size_t written = 0U;\n"
+        "    if ((encode(decodedMsg, reencodedBuf.data(), reencodedBuf.size(), written) != #^#FLAT_NS#$#::ErrorStatus::Success) ||\n"
+        "        (written != reencodedBuf.size()) ||\n"
+        "        (reencodedBuf != commsBuf)) {\n"
+        "        reportFailure(name.c_str(), \"re-encoded payload is different\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    TCommsMsg readMsg;\n"
+        "    const std::uint8_t* commsReadIter = reencodedBuf.data();\n"
+        "    if ((readMsg.read(commsReadIter, reencodedBuf.size()) != comms::ErrorStatus::Success) ||\n"
+        "        (static_cast<std::size_t>(commsReadIter - reencodedBuf.data()) != reencodedBuf.size())) {\n"
+        "        reportFailure(name.c_str(), \"COMMS read of flat payload failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    std::vector<std::uint8_t> rewrittenBuf;\n"
+        "    if ((!writeMessage(readMsg, rewrittenBuf)) || (rewrittenBuf != reencodedBuf)) {\n"
+        "        reportFailure(name.c_str(), \"COMMS re-write of flat payload is different\");\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "template <typename TCommsMsg, typename TFlatMsg>\n"
+        "void checkMessage()\n"
+        "{\n"
+        "    TCommsMsg commsMsg;\n"
+        "    std::vector<std::uint8_t> commsBuf;\n"
+        "    if (!writeMessage(commsMsg, commsBuf)) {\n"
+        "        reportFailure(TFlatMsg::name(), \"COMMS write failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    TFlatMsg flatMsg;\n"
+        "    std::vector<std::uint8_t> flatBuf(flatMsg.length());\n"
+        "    std::size_t written = 0U;\n"
+        "    if (encode(flatMsg, flatBuf.data(), flatBuf.size(), written) != #^#FLAT_NS#$#::ErrorStatus::Success) {\n"
+        "        reportFailure(TFlatMsg::name(), \"flat encode failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    flatBuf.resize(written);\n"
+        "    if (flatBuf != commsBuf) {\n"
+        "        reportFailure(TFlatMsg::name(), \"encoded payloads are different\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    checkPayload<TCommsMsg, TFlatMsg>(TFlatMsg::name(), commsBuf);\n"
+        "\n"
+        "    unsigned passes = 1U;\n"
+        "    for (auto pass = 0U; pass < passes; ++pass) {\n"
+        "        auto name = passName(TFlatMsg::name(), pass);\n"
+        "        TCommsMsg populatedMsg;\n"
+        "        populateMessage(populatedMsg, pass, passes);\n"
+        "        std::vector<std::uint8_t> populatedBuf;\n"
+        "        if (!writeMessage(populatedMsg, populatedBuf)) {\n"
+        "            reportFailure(name.c_str(), \"COMMS write failed\");\n"
+        "            continue;\n"
+        "        }\n"
+        "\n"
+        "        checkPayload<TCommsMsg, TFlatMsg>(name, populatedBuf);\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "#^#FRAME_CHECKS#$#\n"
+        "} // namespace\n"
+        "\n"
+        "int main()\n"
+        "{\n"
+        "    #^#CALLS#$#\n"
+        "    if (failures != 0U) {\n"
+        "        std::cerr << failures << \" conformance check(s) failed\" << std::endl;\n"
+        "        return -1;\n"
+        "    }\n"
+        "\n"
+        "    std::cout << \"All conformance checks passed\" << std::endl;\n"
+        "    return 0;\n"
+        "}\n"
+        ;
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"INCLUDES", flatIncludesInternal()},
+        {"INTERFACE", interfaceScopeFor(m_generator)},
+        {"FLAT_NS", m_generator.currentSchema().mainNamespace() + "::flat"},
+        {"FRAME_CHECKS", flatFrameChecksInternal()},
+        {"CALLS", flatCallsInternal()},
+    };
+
+    auto filePath =
+        util::pathAddElem(
+            util::pathAddElem(m_generator.getOutputDir(), ConformanceDirStr), ConformanceFileStr);
+
+    return m_generator.flatWriteFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatConformance::flatIncludesInternal() const
+{
+    util::StringsList includes = {
+        "comms/comms.h",
+        "comms/util/Tuple.h",
+        "<algorithm>",
+        "<cstdint>",
+        "<iostream>",
+        "<string>",
+        "<tuple>",
+        "<type_traits>",
+        "<vector>",
+    };
+
+    auto interfaceHeader = util::strReplace(interfaceScopeFor(m_generator), "::", "/") + strings::cppHeaderSuffixStr();
+    includes.push_back(interfaceHeader);
+
+    for (auto* m : m_generator.flatSupportedMessagesOf(m_generator.currentSchema())) {
+        includes.push_back(comms::relHeaderPathFor(*m, m_generator));
+        includes.push_back(m_generator.flatRelHeaderFor(*m));
+    }
+
+    for (auto* f : m_generator.getAllFrames()) {
+        if ((!f->isReferenced()) || (!FlatFrame::cast(f)->flatIsSupported())) {
+            continue;
+        }
+
+        includes.push_back(comms::relHeaderPathFor(*f, m_generator));
+        includes.push_back(m_generator.flatRelHeaderFor(*f));
+    }
+
+    comms::prepareIncludeStatement(includes);
+    return util::strListToString(includes, "\n", "");
+}
+
+std::string FlatConformance::flatFrameChecksInternal() const
+{
+    static const std::string Templ =
+        "template <typename TCommsMsg, typename TFlatMsg>\n"
+        "void checkFrameMessage_#^#NAME#$#(const std::string& name, const TCommsMsg& commsMsg)\n"
+        "{\n"
+        "    using CommsFrame = #^#COMMS_FRAME#$#<Interface>;\n"
+        "\n"
+        "    std::vector<std::uint8_t> payloadBuf;\n"
+        "    TFlatMsg flatMsg;\n"
+        "    if ((!writeMessage(commsMsg, payloadBuf)) ||\n"
+        "        (decode(payloadBuf.data(), payloadBuf.size(), flatMsg) != #^#FLAT_NS#$#::ErrorStatus::Success)) {\n"
+        "        reportFailure(name.c_str(), \"flat decode of COMMS payload failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    CommsFrame commsFrame;\n"
+        "    std::vector<std::uint8_t> commsBuf(commsFrame.length(commsMsg));\n"
+        "    std::uint8_t* commsWriteIter = commsBuf.data();\n"
+        "    if (commsFrame.write(commsMsg, commsWriteIter, commsBuf.size()) != comms::ErrorStatus::Success) {\n"
+        "        reportFailure(name.c_str(), \"COMMS frame write failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    #^#FLAT_FRAME#$#::Info info;\n"
+        "    std::vector<std::uint8_t> flatBuf(commsBuf.size());\n"
+        "    std::size_t written = 0U;\n"
+        "    if (#^#FLAT_FRAME_NS#$#::encode(flatMsg, info, flatBuf.data(), flatBuf.size(), written) != #^#FLAT_NS#$#::ErrorStatus::Success) {\n"
+        "        reportFailure(name.c_str(), \"flat frame encode failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    flatBuf.resize(written);\n"
+        "    if (flatBuf != commsBuf) {\n"
+        "        reportFailure(name.c_str(), \"encoded frames are different\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    #^#FLAT_FRAME#$#::Info decodedInfo;\n"
+        "    std::size_t consumed = 0U;\n"
+        "    if ((#^#FLAT_FRAME_NS#$#::decode(commsBuf.data(), commsBuf.size(), decodedInfo, consumed) != #^#FLAT_NS#$#::ErrorStatus::Success) ||\n"
+        "        (consumed != commsBuf.size())) {\n"
+        "        reportFailure(name.c_str(), \"flat frame decode failed\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    if (decodedInfo.id != TFlatMsg::msgId()) {\n"
+        "        reportFailure(name.c_str(), \"decoded message id is different\");\n"
+        "        return;\n"
+        "    }\n"
+        "\n"
+        "    if ((decodedInfo.payload.size != payloadBuf.size()) ||\n"
+        "        (!std::equal(payloadBuf.begin(), payloadBuf.end(), decodedInfo.payload.data))) {\n"
+        "        reportFailure(name.c_str(), \"decoded payload is different\");\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "template <typename TCommsMsg, typename TFlatMsg>\n"
+        "void checkFrame_#^#NAME#$#()\n"
+        "{\n"
+        "    static const std::string Name = std::string(\"#^#NAME#$#::\") + TFlatMsg::name();\n"
+        "    checkFrameMessage_#^#NAME#$#<TCommsMsg, TFlatMsg>(Name, TCommsMsg());\n"
+        "\n"
+        "    unsigned passes = 1U;\n"
+        "    for (auto pass = 0U; pass < passes; ++pass) {\n"
+        "        TCommsMsg populatedMsg;\n"
+        "        populateMessage(populatedMsg, pass, passes);\n"
+        "        checkFrameMessage_#^#NAME#$#<TCommsMsg, TFlatMsg>(passName(Name.c_str(), pass), populatedMsg);\n"
+        "    }\n"
+        "}\n";
+
+    util::StringsList checks;
+    auto flatNs = m_generator.currentSchema().mainNamespace() + "::flat";
+    for (auto* f : m_generator.getAllFrames()) {
+        if ((!f->isReferenced()) || (!FlatFrame::cast(f)->flatIsSupported())) {
+            continue;
+        }
+
+        auto flatFrame = m_generator.flatScopeFor(*f);
+        auto flatFrameNs = flatFrame.substr(0, flatFrame.size() - comms::className(f->name()).size() - 2U);
+        util::ReplacementMap repl = {
+            {"NAME", comms::className(f->name())},
+            {"COMMS_FRAME", comms::scopeFor(*f, m_generator)},
+            {"FLAT_FRAME", flatFrame},
+            {"FLAT_FRAME_NS", flatFrameNs},
+            {"FLAT_NS", flatNs},
+        };
+
+        checks.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(checks, "\n", "");
+}
+
+std::string FlatConformance::flatCallsInternal() const
+{
+    util::StringsList frames;
+    for (auto* f : m_generator.getAllFrames()) {
+        if ((!f->isReferenced()) || (!FlatFrame::cast(f)->flatIsSupported())) {
+            continue;
+        }
+
+        frames.push_back(comms::className(f->name()));
+    }
+
+    util::StringsList calls;
+    for (auto* m : m_generator.flatSupportedMessagesOf(m_generator.currentSchema())) {
+        auto msgTypes = comms::scopeFor(*m, m_generator) + "<Interface>, " + m_generator.flatScopeFor(*m);
+        calls.push_back("checkMessage<" + msgTypes + ">();");
+        for (auto& f : frames) {
+            calls.push_back("checkFrame_" + f + '<' + msgTypes + ">();");
+        }
+    }
+
+    return util::strListToString(calls, "\n", "\n");
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,34 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatCustomLayer.h"
+
+#include "FlatGenerator.h"
+
+namespace commsdsl2flat
+{
+
+FlatCustomLayer::FlatCustomLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatCustomLayer::flatUnsupportedReasonImpl() const
+{
+    return flatUnsupportedStr("requires custom code");
+}
+
+} // namespace commsdsl2flat
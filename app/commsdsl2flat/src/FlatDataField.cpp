@@ -0,0 +1,269 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatDataField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string LengthPrefixStr("LengthPrefix");
+
+} // namespace
+
+FlatDataField::FlatDataField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatDataField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    auto* prefix = memberPrefixField();
+    if (prefix != nullptr) {
+        cast(prefix)->flatSetForcedTypeName(LengthPrefixStr);
+    }
+
+    return true;
+}
+
+bool FlatDataField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatDataField::flatUnsupportedReasonImpl() const
+{
+    if (!dataDslObj().detachedPrefixFieldName().empty()) {
+        return flatUnsupportedStr("uses detached length prefix");
+    }
+
+    auto* prefix = memberPrefixField();
+    if (prefix == nullptr) {
+        prefix = externalPrefixField();
+    }
+
+    return flatPrefixUnsupportedReason(prefix, "length prefix");
+}
+
+void FlatDataField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatRefAddIncludes(memberPrefixField(), externalPrefixField(), list);
+}
+
+std::string FlatDataField::flatMembersDefImpl() const
+{
+    return flatRefDefCode(memberPrefixField(), externalPrefixField(), LengthPrefixStr);
+}
+
+std::string FlatDataField::flatValueDefImpl() const
+{
+    if (dataDslObj().defaultValue().empty()) {
+        return
+            "/// @brief Stored value.\n"
+            "DataView value;\n";
+    }
+
+    return
+        "/// @brief Stored value.\n"
+        "DataView value = defaultValue();\n";
+}
+
+std::string FlatDataField::flatMembersSourceImpl() const
+{
+    return flatRefSourceCode(memberPrefixField());
+}
+
+std::string FlatDataField::flatExtraFuncsDeclImpl() const
+{
+    if (dataDslObj().defaultValue().empty()) {
+        return strings::emptyString();
+    }
+
+    return
+        "/// @brief Get the default value.\n"
+        "/// @details Refers to the static storage.\n"
+        "static DataView defaultValue();\n";
+}
+
+std::string FlatDataField::flatExtraFuncsSourceImpl() const
+{
+    auto& defaultValue = dataDslObj().defaultValue();
+    if (defaultValue.empty()) {
+        return strings::emptyString();
+    }
+
+    static const std::string Templ =
+        "DataView #^#SCOPE#$#::defaultValue()\n"
+        "{\n"
+        "    static const std::uint8_t Data[] = {\n"
+        "        #^#BYTES#$#\n"
+        "    };\n"
+        "\n"
+        "    return DataView(Data, #^#LEN#$#);\n"
+        "}\n";
+
+    util::StringsList bytes;
+    for (auto b : defaultValue) {
+        bytes.push_back(util::numToString(static_cast<unsigned>(b), 2U));
+    }
+
+    util::ReplacementMap repl = {
+        {"SCOPE", flatSourceScope()},
+        {"BYTES", util::strListToString(bytes, ", ", "")},
+        {"LEN", std::to_string(defaultValue.size()) + 'U'},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatDataField::flatReadBodyImpl() const
+{
+    auto obj = dataDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "auto count = static_cast<std::size_t>(prefix.value);\n"
+            "if (len < count) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "value = DataView(iter, count);\n"
+            "iter += count;\n"
+            "len -= count;\n";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        static const std::string Templ =
+            "if (len < #^#LEN#$#) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "value = DataView(iter, #^#LEN#$#);\n"
+            "iter += #^#LEN#$#;\n"
+            "len -= #^#LEN#$#;\n";
+
+        util::ReplacementMap repl = {
+            {"LEN", std::to_string(fixedLength) + 'U'},
+        };
+
+        return util::processTemplate(Templ, repl);
+    }
+
+    return
+        "value = DataView(iter, len);\n"
+        "iter += len;\n"
+        "len = 0U;\n";
+}
+
+std::string FlatDataField::flatWriteBodyImpl() const
+{
+    auto obj = dataDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(value.size);\n"
+            "auto es = prefix.write(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "if (len < value.size) {\n"
+            "    return ErrorStatus::BufferOverflow;\n"
+            "}\n"
+            "\n"
+            "writeBytes(value.data, value.size, iter);\n"
+            "len -= value.size;\n";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        static const std::string Templ =
+            "if (len < #^#LEN#$#) {\n"
+            "    return ErrorStatus::BufferOverflow;\n"
+            "}\n"
+            "\n"
+            "auto count = value.size;\n"
+            "if (#^#LEN#$# < count) {\n"
+            "    count = #^#LEN#$#;\n"
+            "}\n"
+            "\n"
+            "writeBytes(value.data, count, iter);\n"
+            "for (auto idx = count; idx < #^#LEN#$#; ++idx) {\n"
+            "    *iter = 0U;\n"
+            "    ++iter;\n"
+            "}\n"
+            "\n"
+            "len -= #^#LEN#$#;\n";
+
+        util::ReplacementMap repl = {
+            {"LEN", std::to_string(fixedLength) + 'U'},
+        };
+
+        return util::processTemplate(Templ, repl);
+    }
+
+    return
+        "if (len < value.size) {\n"
+        "    return ErrorStatus::BufferOverflow;\n"
+        "}\n"
+        "\n"
+        "writeBytes(value.data, value.size, iter);\n"
+        "len -= value.size;\n";
+}
+
+std::string FlatDataField::flatLengthBodyImpl() const
+{
+    auto obj = dataDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(value.size);\n"
+            "return prefix.length() + value.size;";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        return "return " + std::to_string(fixedLength) + "U;";
+    }
+
+    return "return value.size;";
+}
+
+} // namespace commsdsl2flat
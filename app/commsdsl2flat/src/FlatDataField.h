@@ -0,0 +1,51 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "FlatField.h"
+
+#include "commsdsl/gen/DataField.h"
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator;
+class FlatDataField final : public commsdsl::gen::DataField, public FlatField
+{
+    using Base = commsdsl::gen::DataField;
+    using FlatBase = FlatField;
+public:
+    FlatDataField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent);
+
+protected:
+    // Base overrides
+    virtual bool prepareImpl() override;
+    virtual bool writeImpl() const override;
+
+    // FlatBase overrides
+    virtual std::string flatUnsupportedReasonImpl() const override;
+    virtual void flatAddIncludesImpl(IncludesList& list) const override;
+    virtual std::string flatMembersDefImpl() const override;
+    virtual std::string flatValueDefImpl() const override;
+    virtual std::string flatMembersSourceImpl() const override;
+    virtual std::string flatExtraFuncsDeclImpl() const override;
+    virtual std::string flatExtraFuncsSourceImpl() const override;
+    virtual std::string flatReadBodyImpl() const override;
+    virtual std::string flatWriteBodyImpl() const override;
+    virtual std::string flatLengthBodyImpl() const override;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,184 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatDispatch.h"
+
+#include "FlatCommon.h"
+#include "FlatGenerator.h"
+#include "FlatMsgHandler.h"
+#include "FlatMsgId.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <set>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string DispatchNameStr("Dispatch");
+
+} // namespace
+
+bool FlatDispatch::write(FlatGenerator& generator)
+{
+    FlatDispatch obj(generator);
+    return obj.flatWriteInternal();
+}
+
+const std::string& FlatDispatch::flatName()
+{
+    return DispatchNameStr;
+}
+
+bool FlatDispatch::flatWriteInternal() const
+{
+    return
+        flatWriteHeaderInternal() &&
+        flatWriteSourceInternal();
+}
+
+bool FlatDispatch::flatWriteHeaderInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains dispatch of the flat messages to their handling functions.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Decode message payload and dispatch the message to its handling function.\n"
+        "/// @param[in] id Numeric message ID.\n"
+        "/// @param[in] payload Raw bytes of the message payload.\n"
+        "/// @param[in] len Number of bytes in the payload.\n"
+        "/// @param[in] handler Handler object.\n"
+        "/// @return ErrorStatus::InvalidMsgId for unknown message ID, otherwise\n"
+        "///     status of the payload decoding.\n"
+        "ErrorStatus dispatchMessage(MsgId id, const std::uint8_t* payload, std::size_t len, #^#HANDLER#$#& handler);\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto ns = m_generator.flatScopeForRoot(strings::emptyString());
+    ns.resize(ns.size() - 2U);
+
+    util::StringsList includes = {
+        m_generator.flatRelHeaderForRoot(FlatCommon::flatName()),
+        m_generator.flatRelHeaderForRoot(FlatMsgHandler::flatName()),
+        m_generator.flatRelHeaderForRoot(FlatMsgId::flatName()),
+    };
+    comms::prepareIncludeStatement(includes);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"INCLUDES", util::strListToString(includes, "\n", "")},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(ns)},
+        {"HANDLER", FlatMsgHandler::flatName()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(ns)},
+    };
+
+    return m_generator.flatWriteFile(m_generator.flatHeaderPathForRoot(flatName()), util::processTemplate(Templ, repl, true));
+}
+
+bool FlatDispatch::flatWriteSourceInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "#include \"#^#HEADER#$#\"\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "ErrorStatus dispatchMessage(MsgId id, const std::uint8_t* payload, std::size_t len, #^#HANDLER#$#& handler)\n"
+        "{\n"
+        "    #^#UNUSED#$#\n"
+        "    switch (id) {\n"
+        "    #^#CASES#$#\n"
+        "    default:\n"
+        "        break;\n"
+        "    }\n"
+        "\n"
+        "    return ErrorStatus::InvalidMsgId;\n"
+        "}\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto ns = m_generator.flatScopeForRoot(strings::emptyString());
+    ns.resize(ns.size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"HEADER", m_generator.flatRelHeaderForRoot(flatName())},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(ns)},
+        {"HANDLER", FlatMsgHandler::flatName()},
+        {"CASES", flatCasesInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(ns)},
+    };
+
+    if (repl["CASES"].empty()) {
+        repl["UNUSED"] =
+            "static_cast<void>(payload);\n"
+            "static_cast<void>(len);\n"
+            "static_cast<void>(handler);\n";
+    }
+
+    return m_generator.flatWriteFile(m_generator.flatSourcePathForRoot(flatName()), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatDispatch::flatCasesInternal() const
+{
+    static const std::string Templ =
+        "case #^#ID#$#:\n"
+        "{\n"
+        "    #^#MSG#$# msg;\n"
+        "    auto es = decode(payload, len, msg);\n"
+        "    if (es != ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n"
+        "\n"
+        "    handler.handle(msg);\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n";
+
+    util::StringsList cases;
+    std::set<std::uintmax_t> ids;
+    for (auto* m : m_generator.flatSupportedMessagesOf(m_generator.currentSchema())) {
+        if (!ids.insert(m->dslObj().id()).second) {
+            // Only the first message with the same id is dispatched
+            continue;
+        }
+
+        util::ReplacementMap repl = {
+            {"ID", FlatMsgId::flatMsgIdStrFor(m_generator, *m)},
+            {"MSG", m_generator.flatScopeFor(*m)},
+        };
+
+        cases.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(cases, "", "");
+}
+
+} // namespace commsdsl2flat
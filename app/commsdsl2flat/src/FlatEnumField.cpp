@@ -0,0 +1,175 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatEnumField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatEnumField::FlatEnumField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatEnumField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatEnumField::flatUnsupportedReasonImpl() const
+{
+    auto obj = enumDslObj();
+    if (obj.minLength() != obj.maxLength()) {
+        return flatUnsupportedStr("has variable length");
+    }
+
+    if (obj.availableLengthLimit()) {
+        return flatUnsupportedStr("uses available length limit");
+    }
+
+    return strings::emptyString();
+}
+
+bool FlatEnumField::flatIsSerValueImpl() const
+{
+    return true;
+}
+
+std::string FlatEnumField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Underlying type of the stored value.\n"
+        "using UnderlyingType = #^#TYPE#$#;\n"
+        "\n"
+        "/// @brief Values enumeration.\n"
+        "enum class ValueType : UnderlyingType\n"
+        "{\n"
+        "    #^#VALUES#$#\n"
+        "};\n"
+        "\n"
+        "/// @brief Stored value.\n"
+        "ValueType value = #^#DEFAULT#$#;\n";
+
+    auto obj = enumDslObj();
+    util::StringsList values;
+    for (auto& v : obj.values()) {
+        values.push_back(v.first + " = " + flatValueStrInternal(v.second.m_value) + ", ///< Value <b>" + v.first + "</b>.");
+    }
+
+    std::string defaultStr;
+    auto& revValues = obj.revValues();
+    auto defIter = revValues.find(obj.defaultValue());
+    if (defIter != revValues.end()) {
+        defaultStr = "ValueType::" + defIter->second;
+    }
+    else {
+        defaultStr = "static_cast<ValueType>(" + flatValueStrInternal(obj.defaultValue()) + ")";
+    }
+
+    util::ReplacementMap repl = {
+        {"TYPE", comms::cppIntTypeFor(obj.type(), obj.maxLength())},
+        {"VALUES", util::strListToString(values, "\n", "")},
+        {"DEFAULT", std::move(defaultStr)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatEnumField::flatReadBodyImpl() const
+{
+    return flatSerValueReadBody(enumDslObj().endian());
+}
+
+std::string FlatEnumField::flatWriteBodyImpl() const
+{
+    return flatSerValueWriteBody(enumDslObj().endian());
+}
+
+std::string FlatEnumField::flatLengthBodyImpl() const
+{
+    return flatSerValueLengthBody();
+}
+
+std::string FlatEnumField::flatValidBodyImpl() const
+{
+    auto obj = enumDslObj();
+    auto& revValues = obj.revValues();
+    if (revValues.empty()) {
+        return "return false;";
+    }
+
+    static const std::string Templ =
+        "switch (value) {\n"
+        "#^#CASES#$#\n"
+        "    return true;\n"
+        "default:\n"
+        "    break;\n"
+        "}\n"
+        "\n"
+        "return false;";
+
+    util::StringsList cases;
+    for (auto iter = revValues.begin(); iter != revValues.end(); iter = revValues.upper_bound(iter->first)) {
+        cases.push_back("case ValueType::" + iter->second + ':');
+    }
+
+    util::ReplacementMap repl = {
+        {"CASES", util::strListToString(cases, "\n", "")},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatEnumField::flatSetSerValueBodyImpl() const
+{
+    if (isUnsignedUnderlyingType()) {
+        return "value = static_cast<ValueType>(static_cast<UnderlyingType>(ser));";
+    }
+
+    return "value = static_cast<ValueType>(static_cast<UnderlyingType>(signExtend(ser, " + std::to_string(flatSerBits()) + "U)));";
+}
+
+std::string FlatEnumField::flatSerValueBodyImpl() const
+{
+    if (isUnsignedUnderlyingType()) {
+        return "return static_cast<std::uint64_t>(static_cast<UnderlyingType>(value));";
+    }
+
+    return "return static_cast<std::uint64_t>(static_cast<std::int64_t>(static_cast<UnderlyingType>(value)));";
+}
+
+std::string FlatEnumField::flatValueStrInternal(std::intmax_t value) const
+{
+    if (isUnsignedUnderlyingType()) {
+        return util::numToString(static_cast<std::uintmax_t>(value));
+    }
+
+    return util::numToString(value);
+}
+
+} // namespace commsdsl2flat
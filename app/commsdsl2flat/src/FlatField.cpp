@@ -0,0 +1,853 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatField.h"
+
+#include "FlatCommon.h"
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/RefField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+bool isCustomOverride(commsdsl::parse::OverrideType value)
+{
+    return
+        (value == commsdsl::parse::OverrideType_Replace) ||
+        (value == commsdsl::parse::OverrideType_Extend);
+}
+
+std::string serValueReadFuncFor(commsdsl::parse::Endian endian)
+{
+    if (endian == commsdsl::parse::Endian_Little) {
+        return "readLittleUnsigned";
+    }
+
+    return "readBigUnsigned";
+}
+
+std::string serValueWriteFuncFor(commsdsl::parse::Endian endian)
+{
+    if (endian == commsdsl::parse::Endian_Little) {
+        return "writeLittleUnsigned";
+    }
+
+    return "writeBigUnsigned";
+}
+
+} // namespace
+
+FlatField::FlatField(commsdsl::gen::Field& field) :
+    m_field(field)
+{
+}
+
+FlatField::~FlatField() = default;
+
+const FlatField* FlatField::cast(const commsdsl::gen::Field* field)
+{
+    if (field == nullptr) {
+        return nullptr;
+    }
+
+    auto* flatField = dynamic_cast<const FlatField*>(field);
+    assert(flatField != nullptr);
+    return flatField;
+}
+
+FlatField* FlatField::cast(commsdsl::gen::Field* field)
+{
+    return const_cast<FlatField*>(cast(static_cast<const commsdsl::gen::Field*>(field)));
+}
+
+FlatField::FlatFieldsList FlatField::flatTransformFieldsList(const commsdsl::gen::Field::FieldsList& fields)
+{
+    FlatFieldsList result;
+    result.reserve(fields.size());
+    for (auto& fPtr : fields) {
+        assert(fPtr);
+
+        auto& dslObj = fPtr->dslObj();
+        if (!fPtr->generator().doesElementExist(dslObj.sinceVersion(), dslObj.deprecatedSince(), dslObj.isDeprecatedRemoved())) {
+            continue;
+        }
+
+        auto* flatField = cast(fPtr.get());
+        assert(flatField != nullptr);
+        result.push_back(flatField);
+    }
+
+    return result;
+}
+
+std::string FlatField::flatUnsupportedReason() const
+{
+    auto reason = flatOverrideUnsupportedReasonInternal();
+    if (!reason.empty()) {
+        return reason;
+    }
+
+    return flatUnsupportedReasonImpl();
+}
+
+bool FlatField::flatIsSupported() const
+{
+    return flatUnsupportedReason().empty();
+}
+
+bool FlatField::flatIsSerValue() const
+{
+    return flatIsSerValueImpl();
+}
+
+bool FlatField::flatIsBitfieldMember() const
+{
+    auto* parent = m_field.getParent();
+    if ((parent == nullptr) || (parent->elemType() != commsdsl::gen::Elem::Type_Field)) {
+        return false;
+    }
+
+    auto* parentField = static_cast<const commsdsl::gen::Field*>(parent);
+    return parentField->dslObj().kind() == commsdsl::parse::Field::Kind::Bitfield;
+}
+
+std::string FlatField::flatTypeName() const
+{
+    if (comms::isGlobalField(m_field)) {
+        return comms::className(m_field.name());
+    }
+
+    if (!m_forcedTypeName.empty()) {
+        return m_forcedTypeName;
+    }
+
+    auto result = "Field_" + comms::accessName(m_field.name());
+    auto* parent = m_field.getParent();
+    if ((parent != nullptr) &&
+        (parent->elemType() == commsdsl::gen::Elem::Type_Field) &&
+        (cast(static_cast<const commsdsl::gen::Field*>(parent))->flatTypeName() == result)) {
+        // Member type cannot have the same name as its parent
+        result += '_';
+    }
+
+    return result;
+}
+
+std::string FlatField::flatTypeRef() const
+{
+    if (comms::isGlobalField(m_field)) {
+        return FlatGenerator::cast(m_field.generator()).flatScopeFor(m_field);
+    }
+
+    return flatTypeName();
+}
+
+std::string FlatField::flatDataName() const
+{
+    return "field_" + comms::accessName(m_field.name());
+}
+
+std::string FlatField::flatSourceScope() const
+{
+    auto* parent = m_field.getParent();
+    assert(parent != nullptr);
+    auto parentType = parent->elemType();
+    if (parentType == commsdsl::gen::Elem::Type_Field) {
+        return cast(static_cast<const commsdsl::gen::Field*>(parent))->flatSourceScope() + "::" + flatTypeName();
+    }
+
+    if (parentType == commsdsl::gen::Elem::Type_Layer) {
+        auto* frame = parent->getParent();
+        assert(frame != nullptr);
+        return comms::className(frame->name()) + "::" + flatTypeName();
+    }
+
+    if (parentType != commsdsl::gen::Elem::Type_Namespace) {
+        return comms::className(parent->name()) + "::" + flatTypeName();
+    }
+
+    return flatTypeName();
+}
+
+void FlatField::flatSetForcedTypeName(const std::string& name)
+{
+    m_forcedTypeName = name;
+}
+
+void FlatField::flatAddIncludes(IncludesList& list) const
+{
+    flatAddIncludesImpl(list);
+}
+
+std::string FlatField::flatDefCode() const
+{
+    return flatDefCodeImpl();
+}
+
+std::string FlatField::flatSourceCode() const
+{
+    return flatSourceCodeImpl();
+}
+
+bool FlatField::flatWrite() const
+{
+    if (!comms::isGlobalField(m_field)) {
+        // Skip write for non-global fields,
+        // The code generation will be driven by other means
+        return true;
+    }
+
+    if (!m_field.isReferenced()) {
+        // Code for not referenced does not exist
+        return true;
+    }
+
+    auto& generator = FlatGenerator::cast(m_field.generator());
+    auto reason = flatUnsupportedReason();
+    if (!reason.empty()) {
+        generator.logger().warning("Skipping flat definition of " + comms::scopeFor(m_field, generator) + ", " + reason + ".");
+        return true;
+    }
+
+    auto scope = generator.flatScopeFor(m_field);
+    auto nsScope = scope.substr(0, scope.size() - flatTypeName().size() - 2U);
+
+    IncludesList includes = {
+        generator.flatRelRootHeaderFor(m_field, FlatCommon::flatName()),
+    };
+    flatAddIncludes(includes);
+    comms::prepareIncludeStatement(includes);
+
+    static const std::string HeaderTempl =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains flat definition of <b>\"#^#NAME#$#\"</b> field.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "#^#DEF#$#\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    util::ReplacementMap headerRepl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"NAME", util::displayName(m_field.dslObj().displayName(), m_field.dslObj().name())},
+        {"INCLUDES", util::strListToString(includes, "\n", "")},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"DEF", flatDefCode()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    if (!generator.flatWriteFile(generator.flatHeaderPathFor(m_field), util::processTemplate(HeaderTempl, headerRepl, true))) {
+        return false;
+    }
+
+    auto source = flatSourceCode();
+    if (source.empty()) {
+        return true;
+    }
+
+    static const std::string SourceTempl =
+        "#^#GENERATED#$#\n"
+        "#include \"#^#HEADER#$#\"\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "#^#CODE#$#\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    util::ReplacementMap sourceRepl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"HEADER", generator.flatRelHeaderFor(m_field)},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"CODE", source},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    return generator.flatWriteFile(generator.flatSourcePathFor(m_field), util::processTemplate(SourceTempl, sourceRepl, true));
+}
+
+std::string FlatField::flatMembersUnsupportedReason(const FlatFieldsList& members)
+{
+    for (auto* m : members) {
+        auto reason = m->flatUnsupportedReason();
+        if (!reason.empty()) {
+            return reason;
+        }
+    }
+
+    return strings::emptyString();
+}
+
+void FlatField::flatMembersAddIncludes(const FlatFieldsList& members, IncludesList& list)
+{
+    for (auto* m : members) {
+        m->flatAddIncludes(list);
+    }
+}
+
+std::string FlatField::flatMembersDefCode(const FlatFieldsList& members)
+{
+    util::StringsList defs;
+    for (auto* m : members) {
+        defs.push_back(m->flatDefCode());
+    }
+
+    return util::strListToString(defs, "\n", "");
+}
+
+std::string FlatField::flatMembersDataCode(const FlatFieldsList& members)
+{
+    static const std::string Templ =
+        "/// @brief Member field <b>\"#^#NAME#$#\"</b>.\n"
+        "#^#TYPE#$# #^#DATA#$#;\n";
+
+    util::StringsList fields;
+    for (auto* m : members) {
+        auto& dslObj = m->field().dslObj();
+        util::ReplacementMap repl = {
+            {"NAME", util::displayName(dslObj.displayName(), dslObj.name())},
+            {"TYPE", m->flatTypeName()},
+            {"DATA", m->flatDataName()},
+        };
+
+        fields.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(fields, "\n", "");
+}
+
+std::string FlatField::flatMembersReadCode(const FlatFieldsList& members)
+{
+    if (members.empty()) {
+        return
+            "static_cast<void>(iter);\n"
+            "static_cast<void>(len);\n";
+    }
+
+    static const std::string Templ =
+        "#^#ES#$# = #^#DATA#$#.read(iter, len);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::StringsList reads;
+    for (auto* m : members) {
+        util::ReplacementMap repl = {
+            {"ES", reads.empty() ? "auto es" : "es"},
+            {"DATA", m->flatDataName()},
+        };
+
+        reads.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(reads, "\n", "");
+}
+
+std::string FlatField::flatMembersWriteCode(const FlatFieldsList& members)
+{
+    if (members.empty()) {
+        return
+            "static_cast<void>(iter);\n"
+            "static_cast<void>(len);\n";
+    }
+
+    static const std::string Templ =
+        "#^#ES#$# = #^#DATA#$#.write(iter, len);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::StringsList writes;
+    for (auto* m : members) {
+        util::ReplacementMap repl = {
+            {"ES", writes.empty() ? "auto es" : "es"},
+            {"DATA", m->flatDataName()},
+        };
+
+        writes.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(writes, "\n", "");
+}
+
+std::string FlatField::flatMembersLengthCode(const FlatFieldsList& members)
+{
+    if (members.empty()) {
+        return "return 0U;";
+    }
+
+    util::StringsList lengths;
+    for (auto* m : members) {
+        lengths.push_back(m->flatDataName() + ".length()");
+    }
+
+    return "return\n    " + util::strListToString(lengths, " +\n    ", ";");
+}
+
+std::string FlatField::flatMembersValidCode(const FlatFieldsList& members)
+{
+    if (members.empty()) {
+        return "return true;";
+    }
+
+    util::StringsList valids;
+    for (auto* m : members) {
+        valids.push_back(m->flatDataName() + ".valid()");
+    }
+
+    return "return\n    " + util::strListToString(valids, " &&\n    ", ";");
+}
+
+std::string FlatField::flatMembersSourceCode(const FlatFieldsList& members)
+{
+    util::StringsList sources;
+    for (auto* m : members) {
+        auto code = m->flatSourceCode();
+        if (!code.empty()) {
+            sources.push_back(std::move(code));
+        }
+    }
+
+    return util::strListToString(sources, "\n", "");
+}
+
+std::string FlatField::flatUnsupportedReasonImpl() const
+{
+    return strings::emptyString();
+}
+
+bool FlatField::flatIsSerValueImpl() const
+{
+    return false;
+}
+
+void FlatField::flatAddIncludesImpl(IncludesList& list) const
+{
+    static_cast<void>(list);
+}
+
+std::string FlatField::flatDefCodeImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Definition of <b>\"#^#NAME#$#\"</b> field.\n"
+        "struct #^#TYPE#$#\n"
+        "{\n"
+        "    #^#MEMBERS#$#\n"
+        "    #^#VALUE#$#\n"
+        "\n"
+        "    #^#FUNCS#$#\n"
+        "    #^#EXTRA#$#\n"
+        "};\n";
+
+    auto& dslObj = m_field.dslObj();
+    util::ReplacementMap repl = {
+        {"NAME", util::displayName(dslObj.displayName(), dslObj.name())},
+        {"TYPE", flatTypeName()},
+        {"MEMBERS", flatMembersDefImpl()},
+        {"VALUE", flatValueDefImpl()},
+        {"FUNCS", flatFuncsDeclInternal()},
+        {"EXTRA", flatExtraFuncsDeclImpl()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatSourceCodeImpl() const
+{
+    static const std::string Templ =
+        "#^#MEMBERS#$#\n"
+        "#^#FUNCS#$#\n"
+        "#^#EXTRA#$#\n";
+
+    util::ReplacementMap repl = {
+        {"MEMBERS", flatMembersSourceImpl()},
+        {"FUNCS", flatFuncsSourceInternal()},
+        {"EXTRA", flatExtraFuncsSourceImpl()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatMembersDefImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatValueDefImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatExtraFuncsDeclImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatMembersSourceImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatExtraFuncsSourceImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatReadBodyImpl() const
+{
+    assert(false); // Should not be called
+    return strings::emptyString();
+}
+
+std::string FlatField::flatWriteBodyImpl() const
+{
+    assert(false); // Should not be called
+    return strings::emptyString();
+}
+
+std::string FlatField::flatLengthBodyImpl() const
+{
+    assert(false); // Should not be called
+    return strings::emptyString();
+}
+
+std::string FlatField::flatValidBodyImpl() const
+{
+    return "return true;";
+}
+
+std::string FlatField::flatSetSerValueBodyImpl() const
+{
+    return strings::emptyString();
+}
+
+std::string FlatField::flatSerValueBodyImpl() const
+{
+    return strings::emptyString();
+}
+
+std::size_t FlatField::flatSerBits() const
+{
+    auto& dslObj = m_field.dslObj();
+    if (flatIsBitfieldMember()) {
+        return dslObj.bitLength();
+    }
+
+    return dslObj.minLength() * 8U;
+}
+
+std::size_t FlatField::flatSerBytes() const
+{
+    return m_field.dslObj().minLength();
+}
+
+std::string FlatField::flatSerValueReadBody(commsdsl::parse::Endian endian) const
+{
+    static const std::string Templ =
+        "if (len < #^#LEN#$#) {\n"
+        "    return ErrorStatus::NotEnoughData;\n"
+        "}\n"
+        "\n"
+        "setSerValue(#^#FUNC#$#(iter, #^#LEN#$#));\n"
+        "len -= #^#LEN#$#;\n";
+
+    util::ReplacementMap repl = {
+        {"LEN", std::to_string(flatSerBytes()) + 'U'},
+        {"FUNC", serValueReadFuncFor(endian)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatSerValueWriteBody(commsdsl::parse::Endian endian) const
+{
+    static const std::string Templ =
+        "if (len < #^#LEN#$#) {\n"
+        "    return ErrorStatus::BufferOverflow;\n"
+        "}\n"
+        "\n"
+        "#^#FUNC#$#(serValue(), #^#LEN#$#, iter);\n"
+        "len -= #^#LEN#$#;\n";
+
+    util::ReplacementMap repl = {
+        {"LEN", std::to_string(flatSerBytes()) + 'U'},
+        {"FUNC", serValueWriteFuncFor(endian)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatSerValueLengthBody() const
+{
+    return "return " + std::to_string(flatSerBytes()) + "U;";
+}
+
+std::string FlatField::flatUnsupportedStr(const std::string& reason) const
+{
+    return "field \"" + comms::scopeFor(m_field, m_field.generator()) + "\" " + reason;
+}
+
+std::string FlatField::flatExternalRefUnsupportedReason(const commsdsl::gen::Field* field)
+{
+    if (field == nullptr) {
+        return strings::emptyString();
+    }
+
+    return cast(field)->flatUnsupportedReason();
+}
+
+std::string FlatField::flatPrefixUnsupportedReason(const commsdsl::gen::Field* field, const std::string& prefixName)
+{
+    if (field == nullptr) {
+        return strings::emptyString();
+    }
+
+    auto reason = cast(field)->flatUnsupportedReason();
+    if (!reason.empty()) {
+        return reason;
+    }
+
+    auto* actField = field;
+    while (actField->dslObj().kind() == commsdsl::parse::Field::Kind::Ref) {
+        actField = static_cast<const commsdsl::gen::RefField*>(actField)->referencedField();
+        assert(actField != nullptr);
+    }
+
+    if (actField->dslObj().kind() != commsdsl::parse::Field::Kind::Int) {
+        return cast(field)->flatUnsupportedStr("uses non-integral " + prefixName);
+    }
+
+    return strings::emptyString();
+}
+
+std::string FlatField::flatRefDefCode(const commsdsl::gen::Field* memberField, const commsdsl::gen::Field* externalField, const std::string& name)
+{
+    if (memberField != nullptr) {
+        auto* flatMember = cast(memberField);
+        assert(flatMember->flatTypeName() == name);
+        return flatMember->flatDefCode();
+    }
+
+    if (externalField == nullptr) {
+        return strings::emptyString();
+    }
+
+    auto& dslObj = externalField->dslObj();
+    return
+        "/// @brief Definition of <b>\"" + name + "\"</b> as reference to <b>\"" +
+        util::displayName(dslObj.displayName(), dslObj.name()) + "\"</b> field.\n" +
+        "using " + name + " = " + cast(externalField)->flatTypeRef() + ";\n";
+}
+
+void FlatField::flatRefAddIncludes(const commsdsl::gen::Field* memberField, const commsdsl::gen::Field* externalField, IncludesList& list)
+{
+    if (memberField != nullptr) {
+        cast(memberField)->flatAddIncludes(list);
+        return;
+    }
+
+    if (externalField == nullptr) {
+        return;
+    }
+
+    list.push_back(FlatGenerator::cast(externalField->generator()).flatRelHeaderFor(*externalField));
+}
+
+std::string FlatField::flatRefSourceCode(const commsdsl::gen::Field* memberField)
+{
+    if (memberField == nullptr) {
+        return strings::emptyString();
+    }
+
+    return cast(memberField)->flatSourceCode();
+}
+
+std::string FlatField::flatFuncsDeclInternal() const
+{
+    static const std::string ValidTempl =
+        "/// @brief Check validity of the field value.\n"
+        "bool valid() const;\n";
+
+    if (flatIsBitfieldMember()) {
+        return flatSerValueFuncsDeclInternal() + '\n' + ValidTempl;
+    }
+
+    static const std::string Templ =
+        "/// @brief Read the field value from the input buffer.\n"
+        "/// @details Advances @b iter and decrements @b len by the number of consumed bytes.\n"
+        "ErrorStatus read(const std::uint8_t*& iter, std::size_t& len);\n"
+        "\n"
+        "/// @brief Write the field value to the output buffer.\n"
+        "/// @details Advances @b iter and decrements @b len by the number of written bytes.\n"
+        "ErrorStatus write(std::uint8_t*& iter, std::size_t& len) const;\n"
+        "\n"
+        "/// @brief Get serialization length of the field.\n"
+        "std::size_t length() const;\n"
+        "\n"
+        "#^#VALID#$#\n"
+        "#^#SER_VALUE#$#\n"
+        ;
+
+    util::ReplacementMap repl = {
+        {"VALID", ValidTempl},
+        {"SER_VALUE", flatSerValueFuncsDeclInternal()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatFuncsSourceInternal() const
+{
+    static const std::string ValidTempl =
+        "bool #^#SCOPE#$#::valid() const\n"
+        "{\n"
+        "    #^#VALID#$#\n"
+        "}\n";
+
+    auto scope = flatSourceScope();
+    if (flatIsBitfieldMember()) {
+        util::ReplacementMap repl = {
+            {"SCOPE", scope},
+            {"VALID", flatValidBodyImpl()},
+        };
+
+        return flatSerValueFuncsSourceInternal() + '\n' + util::processTemplate(ValidTempl, repl);
+    }
+
+    static const std::string Templ =
+        "ErrorStatus #^#SCOPE#$#::read(const std::uint8_t*& iter, std::size_t& len)\n"
+        "{\n"
+        "    #^#READ#$#\n"
+        "    #^#FAIL_ON_INVALID#$#\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "ErrorStatus #^#SCOPE#$#::write(std::uint8_t*& iter, std::size_t& len) const\n"
+        "{\n"
+        "    #^#WRITE#$#\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "std::size_t #^#SCOPE#$#::length() const\n"
+        "{\n"
+        "    #^#LENGTH#$#\n"
+        "}\n"
+        "\n"
+        "bool #^#SCOPE#$#::valid() const\n"
+        "{\n"
+        "    #^#VALID#$#\n"
+        "}\n"
+        "\n"
+        "#^#SER_VALUE#$#\n"
+        ;
+
+    static const std::string PseudoStr =
+        "static_cast<void>(iter);\n"
+        "static_cast<void>(len);\n";
+
+    auto& dslObj = m_field.dslObj();
+    bool pseudo = dslObj.isPseudo();
+    util::ReplacementMap repl = {
+        {"SCOPE", scope},
+        {"READ", pseudo ? PseudoStr : flatReadBodyImpl()},
+        {"WRITE", pseudo ? PseudoStr : flatWriteBodyImpl()},
+        {"LENGTH", pseudo ? std::string("return 0U;") : flatLengthBodyImpl()},
+        {"VALID", flatValidBodyImpl()},
+        {"SER_VALUE", flatSerValueFuncsSourceInternal()},
+    };
+
+    if (dslObj.isFailOnInvalid()) {
+        repl["FAIL_ON_INVALID"] =
+            "\n"
+            "if (!valid()) {\n"
+            "    return ErrorStatus::InvalidMsgData;\n"
+            "}\n";
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatSerValueFuncsDeclInternal() const
+{
+    if (!flatIsSerValue()) {
+        return strings::emptyString();
+    }
+
+    return
+        "/// @brief Update the value from its serialized representation.\n"
+        "void setSerValue(std::uint64_t ser);\n"
+        "\n"
+        "/// @brief Get the serialized representation of the value.\n"
+        "std::uint64_t serValue() const;\n";
+}
+
+std::string FlatField::flatSerValueFuncsSourceInternal() const
+{
+    if (!flatIsSerValue()) {
+        return strings::emptyString();
+    }
+
+    static const std::string Templ =
+        "void #^#SCOPE#$#::setSerValue(std::uint64_t ser)\n"
+        "{\n"
+        "    #^#SET#$#\n"
+        "}\n"
+        "\n"
+        "std::uint64_t #^#SCOPE#$#::serValue() const\n"
+        "{\n"
+        "    #^#GET#$#\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"SCOPE", flatSourceScope()},
+        {"SET", flatSetSerValueBodyImpl()},
+        {"GET", flatSerValueBodyImpl()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatField::flatOverrideUnsupportedReasonInternal() const
+{
+    auto& dslObj = m_field.dslObj();
+    if (isCustomOverride(dslObj.readOverride()) ||
+        isCustomOverride(dslObj.writeOverride()) ||
+        isCustomOverride(dslObj.lengthOverride()) ||
+        isCustomOverride(dslObj.validOverride())) {
+        return flatUnsupportedStr("requires custom code");
+    }
+
+    return strings::emptyString();
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,121 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/Field.h"
+#include "commsdsl/gen/util.h"
+#include "commsdsl/parse/Endian.h"
+
+#include <string>
+#include <vector>
+
+namespace commsdsl2flat
+{
+
+class FlatField
+{
+public:
+    using StringsList = commsdsl::gen::util::StringsList;
+    using IncludesList = StringsList;
+    using FlatFieldsList = std::vector<FlatField*>;
+
+    explicit FlatField(commsdsl::gen::Field& field);
+    virtual ~FlatField();
+
+    static const FlatField* cast(const commsdsl::gen::Field* field);
+    static FlatField* cast(commsdsl::gen::Field* field);
+    static FlatFieldsList flatTransformFieldsList(const commsdsl::gen::Field::FieldsList& fields);
+
+    commsdsl::gen::Field& field()
+    {
+        return m_field;
+    }
+
+    const commsdsl::gen::Field& field() const
+    {
+        return m_field;
+    }
+
+    std::string flatUnsupportedReason() const;
+    bool flatIsSupported() const;
+    bool flatIsSerValue() const;
+    bool flatIsBitfieldMember() const;
+
+    std::string flatTypeName() const;
+    std::string flatTypeRef() const;
+    std::string flatDataName() const;
+    std::string flatSourceScope() const;
+    void flatSetForcedTypeName(const std::string& name);
+
+    void flatAddIncludes(IncludesList& list) const;
+    std::string flatDefCode() const;
+    std::string flatSourceCode() const;
+
+    bool flatWrite() const;
+
+    static std::string flatMembersUnsupportedReason(const FlatFieldsList& members);
+    static void flatMembersAddIncludes(const FlatFieldsList& members, IncludesList& list);
+    static std::string flatMembersDefCode(const FlatFieldsList& members);
+    static std::string flatMembersDataCode(const FlatFieldsList& members);
+    static std::string flatMembersReadCode(const FlatFieldsList& members);
+    static std::string flatMembersWriteCode(const FlatFieldsList& members);
+    static std::string flatMembersLengthCode(const FlatFieldsList& members);
+    static std::string flatMembersValidCode(const FlatFieldsList& members);
+    static std::string flatMembersSourceCode(const FlatFieldsList& members);
+    static std::string flatRefDefCode(const commsdsl::gen::Field* memberField, const commsdsl::gen::Field* externalField, const std::string& name);
+    static void flatRefAddIncludes(const commsdsl::gen::Field* memberField, const commsdsl::gen::Field* externalField, IncludesList& list);
+    static std::string flatRefSourceCode(const commsdsl::gen::Field* memberField);
+
+protected:
+    virtual std::string flatUnsupportedReasonImpl() const;
+    virtual bool flatIsSerValueImpl() const;
+    virtual void flatAddIncludesImpl(IncludesList& list) const;
+    virtual std::string flatDefCodeImpl() const;
+    virtual std::string flatSourceCodeImpl() const;
+    virtual std::string flatMembersDefImpl() const;
+    virtual std::string flatValueDefImpl() const;
+    virtual std::string flatExtraFuncsDeclImpl() const;
+    virtual std::string flatMembersSourceImpl() const;
+    virtual std::string flatExtraFuncsSourceImpl() const;
+    virtual std::string flatReadBodyImpl() const;
+    virtual std::string flatWriteBodyImpl() const;
+    virtual std::string flatLengthBodyImpl() const;
+    virtual std::string flatValidBodyImpl() const;
+    virtual std::string flatSetSerValueBodyImpl() const;
+    virtual std::string flatSerValueBodyImpl() const;
+
+    std::size_t flatSerBits() const;
+    std::size_t flatSerBytes() const;
+    std::string flatSerValueReadBody(commsdsl::parse::Endian endian) const;
+    std::string flatSerValueWriteBody(commsdsl::parse::Endian endian) const;
+    std::string flatSerValueLengthBody() const;
+    std::string flatUnsupportedStr(const std::string& reason) const;
+
+    static std::string flatExternalRefUnsupportedReason(const commsdsl::gen::Field* field);
+    static std::string flatPrefixUnsupportedReason(const commsdsl::gen::Field* field, const std::string& prefixName);
+
+private:
+    std::string flatFuncsDeclInternal() const;
+    std::string flatFuncsSourceInternal() const;
+    std::string flatSerValueFuncsDeclInternal() const;
+    std::string flatSerValueFuncsSourceInternal() const;
+    std::string flatOverrideUnsupportedReasonInternal() const;
+
+    commsdsl::gen::Field& m_field;
+    std::string m_forcedTypeName;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,178 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatFloatField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+std::string floatValueStr(double value)
+{
+    if (std::isnan(value)) {
+        return "std::numeric_limits<ValueType>::quiet_NaN()";
+    }
+
+    if (std::isinf(value)) {
+        if (value < 0) {
+            return "-std::numeric_limits<ValueType>::infinity()";
+        }
+
+        return "std::numeric_limits<ValueType>::infinity()";
+    }
+
+    char buf[64] = {0};
+    std::snprintf(buf, sizeof(buf), "%.17g", value);
+    return "static_cast<ValueType>(" + std::string(buf) + ")";
+}
+
+} // namespace
+
+FlatFloatField::FlatFloatField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatFloatField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatFloatField::flatUnsupportedReasonImpl() const
+{
+    if (flatIsBitfieldMember()) {
+        return flatUnsupportedStr("is a floating point bitfield member");
+    }
+
+    return strings::emptyString();
+}
+
+bool FlatFloatField::flatIsSerValueImpl() const
+{
+    return true;
+}
+
+std::string FlatFloatField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Type of the stored value.\n"
+        "using ValueType = #^#TYPE#$#;\n"
+        "\n"
+        "/// @brief Stored value.\n"
+        "ValueType value = #^#DEFAULT#$#;\n";
+
+    auto obj = floatDslObj();
+    util::ReplacementMap repl = {
+        {"TYPE", comms::cppFloatTypeFor(obj.type())},
+        {"DEFAULT", floatValueStr(obj.defaultValue())},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatFloatField::flatReadBodyImpl() const
+{
+    return flatSerValueReadBody(floatDslObj().endian());
+}
+
+std::string FlatFloatField::flatWriteBodyImpl() const
+{
+    return flatSerValueWriteBody(floatDslObj().endian());
+}
+
+std::string FlatFloatField::flatLengthBodyImpl() const
+{
+    return flatSerValueLengthBody();
+}
+
+std::string FlatFloatField::flatValidBodyImpl() const
+{
+    auto obj = floatDslObj();
+    util::StringsList conds;
+    for (auto& r : obj.validRanges()) {
+        if (std::isnan(r.m_min) || std::isnan(r.m_max)) {
+            conds.push_back("std::isnan(value)");
+            continue;
+        }
+
+        if (r.m_min == r.m_max) {
+            conds.push_back("(value == " + floatValueStr(r.m_min) + ")");
+            continue;
+        }
+
+        conds.push_back("((" + floatValueStr(r.m_min) + " <= value) && (value <= " + floatValueStr(r.m_max) + "))");
+    }
+
+    if (conds.empty()) {
+        return "return true;";
+    }
+
+    return "return\n    " + util::strListToString(conds, " ||\n    ", ";");
+}
+
+std::string FlatFloatField::flatSetSerValueBodyImpl() const
+{
+    static const std::string Templ =
+        "auto raw = static_cast<#^#RAW#$#>(ser);\n"
+        "std::memcpy(&value, &raw, sizeof(value));";
+
+    util::ReplacementMap repl = {
+        {"RAW", flatRawTypeInternal()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatFloatField::flatSerValueBodyImpl() const
+{
+    static const std::string Templ =
+        "#^#RAW#$# raw = 0U;\n"
+        "std::memcpy(&raw, &value, sizeof(raw));\n"
+        "return raw;";
+
+    util::ReplacementMap repl = {
+        {"RAW", flatRawTypeInternal()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatFloatField::flatRawTypeInternal() const
+{
+    if (floatDslObj().type() == commsdsl::parse::FloatField::Type::Float) {
+        return "std::uint32_t";
+    }
+
+    return "std::uint64_t";
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,542 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatFrame.h"
+
+#include "FlatChecksumLayer.h"
+#include "FlatCommon.h"
+#include "FlatGenerator.h"
+#include "FlatLayer.h"
+#include "FlatMessage.h"
+#include "FlatMsgId.h"
+#include "FlatPayloadLayer.h"
+#include "FlatSizeLayer.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatFrame::FlatFrame(FlatGenerator& generator, commsdsl::parse::Frame dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent)
+{
+}
+
+FlatFrame::~FlatFrame() = default;
+
+std::string FlatFrame::flatUnsupportedReason() const
+{
+    LayoutInfo info;
+    return flatAnalyzeLayoutInternal(info);
+}
+
+bool FlatFrame::flatIsSupported() const
+{
+    return flatUnsupportedReason().empty();
+}
+
+bool FlatFrame::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    for (auto& lPtr : layers()) {
+        assert(lPtr);
+        auto* memberField = lPtr->memberField();
+        if (memberField == nullptr) {
+            continue;
+        }
+
+        FlatField::cast(memberField)->flatSetForcedTypeName(FlatLayer::cast(lPtr.get())->flatFieldTypeName());
+    }
+
+    return true;
+}
+
+bool FlatFrame::writeImpl() const
+{
+    auto reason = flatUnsupportedReason();
+    if (!reason.empty()) {
+        generator().logger().warning("Skipping flat definition of " + comms::scopeFor(*this, generator()) + ", " + reason + ".");
+        return true;
+    }
+
+    return
+        flatWriteHeaderInternal() &&
+        flatWriteSourceInternal();
+}
+
+std::string FlatFrame::flatAnalyzeLayoutInternal(LayoutInfo& info) const
+{
+    auto frameStr = "frame \"" + comms::scopeFor(*this, generator()) + "\" ";
+    auto& allLayers = layers();
+    bool hasPayload = false;
+    for (auto idx = 0U; idx < allLayers.size(); ++idx) {
+        auto* flatLayer = FlatLayer::cast(allLayers[idx].get());
+        auto reason = flatLayer->flatUnsupportedReason();
+        if (!reason.empty()) {
+            return reason;
+        }
+
+        auto kind = allLayers[idx]->dslObj().kind();
+        if (kind == commsdsl::parse::Layer::Kind::Payload) {
+            hasPayload = true;
+            info.m_payloadIdx = idx;
+            continue;
+        }
+
+        if (kind != commsdsl::parse::Layer::Kind::Size) {
+            continue;
+        }
+
+        if (info.m_hasSize) {
+            return frameStr + "uses multiple size layers";
+        }
+
+        info.m_hasSize = true;
+        info.m_sizeIdx = idx;
+    }
+
+    if (!hasPayload) {
+        return frameStr + "has no payload layer";
+    }
+
+    auto regionEnd = allLayers.size() - 1U;
+    if (info.m_hasSize) {
+        bool success = true;
+        auto commsOrder = getCommsOrderOfLayers(success);
+        if (!success) {
+            return frameStr + "has invalid layers order";
+        }
+
+        auto* sizeLayer = allLayers[info.m_sizeIdx].get();
+        auto sizeIter = std::find(commsOrder.begin(), commsOrder.end(), sizeLayer);
+        assert(sizeIter != commsOrder.end());
+        auto coveredCount = static_cast<std::size_t>(std::distance(sizeIter, commsOrder.end())) - 1U;
+        info.m_lastCoveredIdx = info.m_sizeIdx + coveredCount;
+        for (auto idx = info.m_sizeIdx + 1U; idx <= info.m_lastCoveredIdx; ++idx) {
+            if ((allLayers.size() <= idx) ||
+                (std::find(sizeIter, commsOrder.end(), allLayers[idx].get()) == commsOrder.end())) {
+                return frameStr + "has layers covered by the size layer that are not contiguous";
+            }
+        }
+
+        if ((info.m_payloadIdx <= info.m_sizeIdx) || (info.m_lastCoveredIdx < info.m_payloadIdx)) {
+            return frameStr + "has payload not covered by the size layer";
+        }
+
+        regionEnd = info.m_lastCoveredIdx;
+    }
+
+    info.m_trailLen = 0U;
+    for (auto idx = info.m_payloadIdx + 1U; idx <= regionEnd; ++idx) {
+        auto& lPtr = allLayers[idx];
+        if ((lPtr->dslObj().kind() == commsdsl::parse::Layer::Kind::Value) &&
+            (!FlatLayer::cast(lPtr.get())->flatIsInfoMember())) {
+            continue;
+        }
+
+        auto* field = FlatLayer::cast(lPtr.get())->flatField();
+        assert(field != nullptr);
+        auto fieldObj = field->field().dslObj();
+        if (fieldObj.minLength() != fieldObj.maxLength()) {
+            return frameStr + "has variable length layer after payload";
+        }
+
+        info.m_trailLen += fieldObj.minLength();
+    }
+
+    for (auto idx = 0U; idx < allLayers.size(); ++idx) {
+        auto& lPtr = allLayers[idx];
+        if (lPtr->dslObj().kind() != commsdsl::parse::Layer::Kind::Checksum) {
+            continue;
+        }
+
+        auto fromName = static_cast<const FlatChecksumLayer*>(lPtr.get())->flatFromLayerName();
+        auto fromIter =
+            std::find_if(
+                allLayers.begin(), allLayers.begin() + idx,
+                [&fromName](auto& l)
+                {
+                    return l->dslObj().name() == fromName;
+                });
+
+        if (fromIter == allLayers.begin() + idx) {
+            return frameStr + "has checksum calculated on following layers";
+        }
+    }
+
+    return strings::emptyString();
+}
+
+bool FlatFrame::flatWriteHeaderInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains flat definition of <b>\"#^#NAME#$#\"</b> frame.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Definition of <b>\"#^#NAME#$#\"</b> frame.\n"
+        "struct #^#CLASS_NAME#$#\n"
+        "{\n"
+        "    #^#LAYERS_DEF#$#\n"
+        "\n"
+        "    /// @brief Transport information of the frame.\n"
+        "    struct Info\n"
+        "    {\n"
+        "        /// @brief Id of the message.\n"
+        "        MsgId id = static_cast<MsgId>(0);\n"
+        "\n"
+        "        /// @brief Raw bytes of the message payload.\n"
+        "        DataView payload;\n"
+        "\n"
+        "        #^#INFO_MEMBERS#$#\n"
+        "    };\n"
+        "};\n"
+        "\n"
+        "/// @brief Decode the frame from the input buffer.\n"
+        "/// @details The message payload is not decoded, it is reported via @b info.payload.\n"
+        "/// @param[out] consumed Number of bytes consumed from the buffer.\n"
+        "ErrorStatus decode(const std::uint8_t* buf, std::size_t len, #^#CLASS_NAME#$#::Info& info, std::size_t& consumed);\n"
+        "\n"
+        "/// @brief Encode the frame with already serialized message payload.\n"
+        "/// @details The @b info.id and @b info.payload members are ignored.\n"
+        "/// @param[out] written Number of bytes written to the buffer.\n"
+        "ErrorStatus encode(MsgId id, const std::uint8_t* payload, std::size_t payloadLen, const #^#CLASS_NAME#$#::Info& info, std::uint8_t* buf, std::size_t len, std::size_t& written);\n"
+        "\n"
+        "#^#MSG_ENCODE#$#\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto& gen = FlatGenerator::cast(generator());
+    auto scope = gen.flatScopeFor(*this);
+    auto className = comms::className(name());
+    auto nsScope = scope.substr(0, scope.size() - className.size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"NAME", dslObj().name()},
+        {"INCLUDES", flatIncludesInternal()},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"CLASS_NAME", className},
+        {"LAYERS_DEF", flatLayersDefInternal()},
+        {"INFO_MEMBERS", flatInfoMembersInternal()},
+        {"MSG_ENCODE", flatMsgEncodeDeclsInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    return gen.flatWriteFile(gen.flatHeaderPathFor(*this), util::processTemplate(Templ, repl, true));
+}
+
+bool FlatFrame::flatWriteSourceInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "#include \"#^#HEADER#$#\"\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "#^#LAYERS#$#\n"
+        "namespace\n"
+        "{\n"
+        "\n"
+        "using PayloadWriteFunc = ErrorStatus (*)(const void* msg, std::uint8_t*& iter, std::size_t& len);\n"
+        "\n"
+        "struct RawPayload\n"
+        "{\n"
+        "    const std::uint8_t* m_data;\n"
+        "    std::size_t m_len;\n"
+        "};\n"
+        "\n"
+        "ErrorStatus encodeInternal(MsgId id, const void* msg, PayloadWriteFunc payloadWrite, const #^#CLASS_NAME#$#::Info& info, std::uint8_t* buf, std::size_t len, std::size_t& written)\n"
+        "{\n"
+        "    static_cast<void>(id);\n"
+        "    static_cast<void>(info);\n"
+        "    std::uint8_t* iter = buf;\n"
+        "    std::size_t remLen = len;\n"
+        "    auto es = ErrorStatus::Success;\n"
+        "\n"
+        "    #^#ENCODE#$#\n"
+        "    written = static_cast<std::size_t>(iter - buf);\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "} // namespace\n"
+        "\n"
+        "ErrorStatus decode(const std::uint8_t* buf, std::size_t len, #^#CLASS_NAME#$#::Info& info, std::size_t& consumed)\n"
+        "{\n"
+        "    const std::uint8_t* iter = buf;\n"
+        "    std::size_t remLen = len;\n"
+        "    #^#ES#$#\n"
+        "\n"
+        "    #^#DECODE#$#\n"
+        "    consumed = static_cast<std::size_t>(iter - buf);\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "ErrorStatus encode(MsgId id, const std::uint8_t* payload, std::size_t payloadLen, const #^#CLASS_NAME#$#::Info& info, std::uint8_t* buf, std::size_t len, std::size_t& written)\n"
+        "{\n"
+        "    RawPayload raw = {payload, payloadLen};\n"
+        "    return\n"
+        "        encodeInternal(\n"
+        "            id, &raw,\n"
+        "            [](const void* msg, std::uint8_t*& iter, std::size_t& remLen) -> ErrorStatus\n"
+        "            {\n"
+        "                auto* rawPtr = static_cast<const RawPayload*>(msg);\n"
+        "                if (remLen < rawPtr->m_len) {\n"
+        "                    return ErrorStatus::BufferOverflow;\n"
+        "                }\n"
+        "\n"
+        "                writeBytes(rawPtr->m_data, rawPtr->m_len, iter);\n"
+        "                remLen -= rawPtr->m_len;\n"
+        "                return ErrorStatus::Success;\n"
+        "            },\n"
+        "            info, buf, len, written);\n"
+        "}\n"
+        "\n"
+        "#^#MSG_ENCODE#$#\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto& gen = FlatGenerator::cast(generator());
+    auto scope = gen.flatScopeFor(*this);
+    auto className = comms::className(name());
+    auto nsScope = scope.substr(0, scope.size() - className.size() - 2U);
+
+    util::StringsList layersSrc;
+    for (auto& lPtr : layers()) {
+        auto code = FlatLayer::cast(lPtr.get())->flatFieldSourceCode();
+        if (!code.empty()) {
+            layersSrc.push_back(std::move(code));
+        }
+    }
+
+    LayoutInfo info;
+    auto reason = flatAnalyzeLayoutInternal(info);
+    static_cast<void>(reason);
+    assert(reason.empty());
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"HEADER", gen.flatRelHeaderFor(*this)},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"LAYERS", util::strListToString(layersSrc, "\n", "")},
+        {"CLASS_NAME", className},
+        {"ENCODE", flatEncodeBodyInternal(info)},
+        {"DECODE", flatDecodeBodyInternal(info)},
+        {"MSG_ENCODE", flatMsgEncodeFuncsInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    bool usesStatus =
+        std::any_of(
+            layers().begin(), layers().end(),
+            [](auto& l)
+            {
+                return
+                    (l->dslObj().kind() != commsdsl::parse::Layer::Kind::Payload) &&
+                    (!FlatLayer::cast(l.get())->flatReadCode().empty());
+            });
+
+    if (usesStatus) {
+        repl["ES"] = "auto es = ErrorStatus::Success;";
+    }
+
+    return gen.flatWriteFile(gen.flatSourcePathFor(*this), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatFrame::flatIncludesInternal() const
+{
+    auto& gen = FlatGenerator::cast(generator());
+    FlatLayer::IncludesList includes = {
+        gen.flatRelRootHeaderFor(*this, FlatCommon::flatName()),
+        gen.flatRelRootHeaderFor(*this, FlatMsgId::flatName()),
+    };
+
+    for (auto& lPtr : layers()) {
+        FlatLayer::cast(lPtr.get())->flatAddIncludes(includes);
+    }
+
+    for (auto* m : gen.flatSupportedMessagesOf(gen.schemaOf(*this))) {
+        includes.push_back(gen.flatRelHeaderFor(*m));
+    }
+
+    comms::prepareIncludeStatement(includes);
+    return util::strListToString(includes, "\n", "");
+}
+
+std::string FlatFrame::flatLayersDefInternal() const
+{
+    util::StringsList defs;
+    for (auto& lPtr : layers()) {
+        auto code = FlatLayer::cast(lPtr.get())->flatFieldDefCode();
+        if (!code.empty()) {
+            defs.push_back(std::move(code));
+        }
+    }
+
+    return util::strListToString(defs, "\n", "");
+}
+
+std::string FlatFrame::flatInfoMembersInternal() const
+{
+    util::StringsList members;
+    for (auto& lPtr : layers()) {
+        auto* flatLayer = FlatLayer::cast(lPtr.get());
+        if (!flatLayer->flatIsInfoMember()) {
+            continue;
+        }
+
+        members.push_back(
+            "/// @brief Value of the <b>\"" + lPtr->dslObj().name() + "\"</b> layer.\n" +
+            flatLayer->flatFieldTypeName() + ' ' + flatLayer->flatFieldVarName() + ";\n");
+    }
+
+    return util::strListToString(members, "\n", "");
+}
+
+std::string FlatFrame::flatMsgEncodeDeclsInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Encode the frame with <b>\"#^#MSG_NAME#$#\"</b> message.\n"
+        "/// @param[out] written Number of bytes written to the buffer.\n"
+        "ErrorStatus encode(const #^#MSG#$#& msg, const #^#CLASS_NAME#$#::Info& info, std::uint8_t* buf, std::size_t len, std::size_t& written);\n";
+
+    auto& gen = FlatGenerator::cast(generator());
+    util::StringsList decls;
+    for (auto* m : gen.flatSupportedMessagesOf(gen.schemaOf(*this))) {
+        auto obj = m->dslObj();
+        util::ReplacementMap repl = {
+            {"MSG_NAME", util::displayName(obj.displayName(), obj.name())},
+            {"MSG", gen.flatScopeFor(*m)},
+            {"CLASS_NAME", comms::className(name())},
+        };
+
+        decls.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(decls, "\n", "");
+}
+
+std::string FlatFrame::flatChecksumFromInternal(const std::string& layerName, bool readOnly) const
+{
+    std::string result;
+    for (auto& lPtr : layers()) {
+        if (lPtr->dslObj().kind() != commsdsl::parse::Layer::Kind::Checksum) {
+            continue;
+        }
+
+        auto* checksumLayer = static_cast<const FlatChecksumLayer*>(lPtr.get());
+        if (checksumLayer->flatFromLayerName() != layerName) {
+            continue;
+        }
+
+        result += (readOnly ? "const std::uint8_t* " : "std::uint8_t* ") + checksumLayer->flatFromVarName() + " = iter;\n";
+    }
+
+    return result;
+}
+
+std::string FlatFrame::flatDecodeBodyInternal(const LayoutInfo& info) const
+{
+    util::StringsList codes;
+    auto& allLayers = layers();
+    for (auto idx = 0U; idx < allLayers.size(); ++idx) {
+        auto& lPtr = allLayers[idx];
+        std::string code = flatChecksumFromInternal(lPtr->dslObj().name(), true);
+        if (idx == info.m_payloadIdx) {
+            code += static_cast<const FlatPayloadLayer*>(lPtr.get())->flatPayloadReadCode(info.m_trailLen);
+        }
+        else {
+            code += FlatLayer::cast(lPtr.get())->flatReadCode();
+        }
+
+        if (info.m_hasSize && (idx == info.m_lastCoveredIdx)) {
+            code += '\n' + static_cast<const FlatSizeLayer*>(allLayers[info.m_sizeIdx].get())->flatRestoreLenCode();
+        }
+
+        if (!code.empty()) {
+            codes.push_back(std::move(code));
+        }
+    }
+
+    return util::strListToString(codes, "\n", "");
+}
+
+std::string FlatFrame::flatEncodeBodyInternal(const LayoutInfo& info) const
+{
+    util::StringsList codes;
+    auto& allLayers = layers();
+    for (auto idx = 0U; idx < allLayers.size(); ++idx) {
+        auto& lPtr = allLayers[idx];
+        std::string code = flatChecksumFromInternal(lPtr->dslObj().name(), false);
+        code += FlatLayer::cast(lPtr.get())->flatWriteCode();
+
+        if (info.m_hasSize && (idx == info.m_lastCoveredIdx)) {
+            code += '\n' + static_cast<const FlatSizeLayer*>(allLayers[info.m_sizeIdx].get())->flatFixupCode();
+        }
+
+        if (!code.empty()) {
+            codes.push_back(std::move(code));
+        }
+    }
+
+    return util::strListToString(codes, "\n", "");
+}
+
+std::string FlatFrame::flatMsgEncodeFuncsInternal() const
+{
+    static const std::string Templ =
+        "ErrorStatus encode(const #^#MSG#$#& msg, const #^#CLASS_NAME#$#::Info& info, std::uint8_t* buf, std::size_t len, std::size_t& written)\n"
+        "{\n"
+        "    return\n"
+        "        encodeInternal(\n"
+        "            msg.msgId(), &msg,\n"
+        "            [](const void* msgPtr, std::uint8_t*& iter, std::size_t& remLen) -> ErrorStatus\n"
+        "            {\n"
+        "                return static_cast<const #^#MSG#$#*>(msgPtr)->write(iter, remLen);\n"
+        "            },\n"
+        "            info, buf, len, written);\n"
+        "}\n";
+
+    auto& gen = FlatGenerator::cast(generator());
+    util::StringsList funcs;
+    for (auto* m : gen.flatSupportedMessagesOf(gen.schemaOf(*this))) {
+        util::ReplacementMap repl = {
+            {"MSG", gen.flatScopeFor(*m)},
+            {"CLASS_NAME", comms::className(name())},
+        };
+
+        funcs.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(funcs, "\n", "");
+}
+
+} // namespace commsdsl2flat
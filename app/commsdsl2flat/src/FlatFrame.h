@@ -0,0 +1,69 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/Frame.h"
+
+#include <string>
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator;
+class FlatFrame final: public commsdsl::gen::Frame
+{
+    using Base = commsdsl::gen::Frame;
+
+public:
+    explicit FlatFrame(FlatGenerator& generator, commsdsl::parse::Frame dslObj, commsdsl::gen::Elem* parent);
+    virtual ~FlatFrame();
+
+    static const FlatFrame* cast(const commsdsl::gen::Frame* frame)
+    {
+        return static_cast<const FlatFrame*>(frame);
+    }
+
+    std::string flatUnsupportedReason() const;
+    bool flatIsSupported() const;
+
+protected:
+    virtual bool prepareImpl() override;
+    virtual bool writeImpl() const override;
+
+private:
+    struct LayoutInfo
+    {
+        std::size_t m_payloadIdx = 0U;
+        std::size_t m_sizeIdx = 0U;
+        std::size_t m_lastCoveredIdx = 0U;
+        std::size_t m_trailLen = 0U;
+        bool m_hasSize = false;
+    };
+
+    std::string flatAnalyzeLayoutInternal(LayoutInfo& info) const;
+    bool flatWriteHeaderInternal() const;
+    bool flatWriteSourceInternal() const;
+    std::string flatIncludesInternal() const;
+    std::string flatLayersDefInternal() const;
+    std::string flatInfoMembersInternal() const;
+    std::string flatMsgEncodeDeclsInternal() const;
+    std::string flatChecksumFromInternal(const std::string& layerName, bool readOnly) const;
+    std::string flatDecodeBodyInternal(const LayoutInfo& info) const;
+    std::string flatEncodeBodyInternal(const LayoutInfo& info) const;
+    std::string flatMsgEncodeFuncsInternal() const;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,331 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatGenerator.h"
+
+#include "FlatBitfieldField.h"
+#include "FlatBundleField.h"
+#include "FlatChecksumLayer.h"
+#include "FlatCmake.h"
+#include "FlatCommon.h"
+#include "FlatConformance.h"
+#include "FlatCustomLayer.h"
+#include "FlatDataField.h"
+#include "FlatDispatch.h"
+#include "FlatEnumField.h"
+#include "FlatFloatField.h"
+#include "FlatFrame.h"
+#include "FlatIdLayer.h"
+#include "FlatIntField.h"
+#include "FlatListField.h"
+#include "FlatMessage.h"
+#include "FlatMsgHandler.h"
+#include "FlatMsgId.h"
+#include "FlatOptionalField.h"
+#include "FlatPayloadLayer.h"
+#include "FlatRefField.h"
+#include "FlatSetField.h"
+#include "FlatSizeLayer.h"
+#include "FlatStringField.h"
+#include "FlatSyncLayer.h"
+#include "FlatValueLayer.h"
+#include "FlatVariantField.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+#include "commsdsl/version.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string FlatNamespaceStr("flat");
+const std::string ScopeSep("::");
+const std::string PathSep("/");
+
+// The schema attributes used by commsdsl2comms are not reported as unexpected
+const std::string CommsExtraAttrPrefix("comms.");
+
+} // namespace
+
+FlatGenerator::FlatGenerator()
+{
+    Base::addExpectedExtraPrefix(CommsExtraAttrPrefix);
+}
+
+const std::string& FlatGenerator::fileGeneratedComment()
+{
+    static const std::string Str =
+        "// Generated by commsdsl2flat v" + std::to_string(commsdsl::versionMajor()) +
+        '.' + std::to_string(commsdsl::versionMinor()) + '.' +
+        std::to_string(commsdsl::versionPatch()) + '\n';
+    return Str;
+}
+
+std::string FlatGenerator::flatScopeFor(const Elem& elem) const
+{
+    return
+        schemaOf(elem).mainNamespace() + ScopeSep + FlatNamespaceStr + ScopeSep +
+        comms::scopeFor(elem, *this, false);
+}
+
+std::string FlatGenerator::flatScopeForRoot(const std::string& name) const
+{
+    return currentSchema().mainNamespace() + ScopeSep + FlatNamespaceStr + ScopeSep + name;
+}
+
+std::string FlatGenerator::flatRelHeaderFor(const Elem& elem) const
+{
+    return
+        schemaOf(elem).mainNamespace() + PathSep + FlatNamespaceStr + PathSep +
+        comms::relHeaderPathFor(elem, *this, false);
+}
+
+std::string FlatGenerator::flatRelSourceFor(const Elem& elem) const
+{
+    return
+        schemaOf(elem).mainNamespace() + PathSep + FlatNamespaceStr + PathSep +
+        comms::relSourcePathFor(elem, *this, false);
+}
+
+std::string FlatGenerator::flatRelHeaderForRoot(const std::string& name) const
+{
+    return currentSchema().mainNamespace() + PathSep + FlatNamespaceStr + PathSep + name + strings::cppHeaderSuffixStr();
+}
+
+std::string FlatGenerator::flatRelSourceForRoot(const std::string& name) const
+{
+    return currentSchema().mainNamespace() + PathSep + FlatNamespaceStr + PathSep + name + strings::cppSourceSuffixStr();
+}
+
+std::string FlatGenerator::flatRelRootHeaderFor(const Elem& elem, const std::string& name) const
+{
+    return schemaOf(elem).mainNamespace() + PathSep + FlatNamespaceStr + PathSep + name + strings::cppHeaderSuffixStr();
+}
+
+std::string FlatGenerator::flatHeaderPathFor(const Elem& elem) const
+{
+    return util::pathAddElem(util::pathAddElem(getOutputDir(), strings::includeDirStr()), flatRelHeaderFor(elem));
+}
+
+std::string FlatGenerator::flatSourcePathFor(const Elem& elem) const
+{
+    return util::pathAddElem(util::pathAddElem(getOutputDir(), strings::srcDirStr()), flatRelSourceFor(elem));
+}
+
+std::string FlatGenerator::flatHeaderPathForRoot(const std::string& name) const
+{
+    return util::pathAddElem(util::pathAddElem(getOutputDir(), strings::includeDirStr()), flatRelHeaderForRoot(name));
+}
+
+std::string FlatGenerator::flatSourcePathForRoot(const std::string& name) const
+{
+    return util::pathAddElem(util::pathAddElem(getOutputDir(), strings::srcDirStr()), flatRelSourceForRoot(name));
+}
+
+std::string FlatGenerator::flatNamespaceBeginFor(const std::string& scope)
+{
+    auto elems = util::strSplitByAnyChar(scope, ":");
+    std::string result;
+    for (auto& e : elems) {
+        result += "namespace " + e + "\n{\n\n";
+    }
+    return result;
+}
+
+std::string FlatGenerator::flatNamespaceEndFor(const std::string& scope)
+{
+    auto elems = util::strSplitByAnyChar(scope, ":");
+    std::string result;
+    for (auto iter = elems.rbegin(); iter != elems.rend(); ++iter) {
+        result += "} // namespace " + *iter + "\n\n";
+    }
+    return result;
+}
+
+void FlatGenerator::flatSetListCapacity(unsigned value)
+{
+    m_listCapacity = value;
+}
+
+unsigned FlatGenerator::flatListCapacity() const
+{
+    return m_listCapacity;
+}
+
+FlatGenerator::MessagesAccessList FlatGenerator::flatSupportedMessagesOf(const commsdsl::gen::Schema& schema) const
+{
+    MessagesAccessList result;
+    auto allMessages = schema.getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        if ((!m->isReferenced()) || (!FlatMessage::cast(m)->flatIsSupported())) {
+            continue;
+        }
+
+        result.push_back(m);
+    }
+
+    return result;
+}
+
+bool FlatGenerator::flatWriteFile(const std::string& filePath, const std::string& contents) const
+{
+    logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!createDirectory(dirPath)) {
+        return false;
+    }
+
+    return writeFile(filePath, contents);
+}
+
+bool FlatGenerator::writeImpl()
+{
+    for (auto idx = 0U; idx < schemas().size(); ++idx) {
+        chooseCurrentSchema(idx);
+        bool result =
+            FlatCommon::write(*this) &&
+            FlatMsgId::write(*this);
+
+        if (!result) {
+            return false;
+        }
+    }
+
+    chooseProtocolSchema();
+    return
+        FlatMsgHandler::write(*this) &&
+        FlatDispatch::write(*this) &&
+        FlatConformance::write(*this) &&
+        FlatCmake::write(*this);
+}
+
+FlatGenerator::MessagePtr FlatGenerator::createMessageImpl(commsdsl::parse::Message dslObj, Elem* parent)
+{
+    return std::make_unique<FlatMessage>(*this, dslObj, parent);
+}
+
+FlatGenerator::FramePtr FlatGenerator::createFrameImpl(commsdsl::parse::Frame dslObj, Elem* parent)
+{
+    return std::make_unique<FlatFrame>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createIntFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatIntField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createEnumFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatEnumField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createSetFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatSetField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createFloatFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatFloatField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createBitfieldFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatBitfieldField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createBundleFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatBundleField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createStringFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatStringField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createDataFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatDataField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createListFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatListField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createRefFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatRefField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createOptionalFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatOptionalField>(*this, dslObj, parent);
+}
+
+FlatGenerator::FieldPtr FlatGenerator::createVariantFieldImpl(commsdsl::parse::Field dslObj, Elem* parent)
+{
+    return std::make_unique<FlatVariantField>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createCustomLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatCustomLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createSyncLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatSyncLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createSizeLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatSizeLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createIdLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatIdLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createValueLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatValueLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createPayloadLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatPayloadLayer>(*this, dslObj, parent);
+}
+
+FlatGenerator::LayerPtr FlatGenerator::createChecksumLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent)
+{
+    return std::make_unique<FlatChecksumLayer>(*this, dslObj, parent);
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,106 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/Generator.h"
+
+#include <string>
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator final : public commsdsl::gen::Generator
+{
+    using Base = commsdsl::gen::Generator;
+
+public:
+    using Elem = commsdsl::gen::Elem;
+    using FieldPtr = commsdsl::gen::FieldPtr;
+    using MessagePtr = commsdsl::gen::MessagePtr;
+    using FramePtr = commsdsl::gen::FramePtr;
+    using LayerPtr = commsdsl::gen::LayerPtr;
+    using MessagesAccessList = Base::MessagesAccessList;
+
+    static const unsigned DefaultListCapacity = 32U;
+
+    FlatGenerator();
+
+    static const std::string& fileGeneratedComment();
+
+    static FlatGenerator& cast(commsdsl::gen::Generator& generator)
+    {
+        return static_cast<FlatGenerator&>(generator);
+    }
+
+    static const FlatGenerator& cast(const commsdsl::gen::Generator& generator)
+    {
+        return static_cast<const FlatGenerator&>(generator);
+    }
+
+    std::string flatScopeFor(const Elem& elem) const;
+    std::string flatScopeForRoot(const std::string& name) const;
+    std::string flatRelHeaderFor(const Elem& elem) const;
+    std::string flatRelSourceFor(const Elem& elem) const;
+    std::string flatRelHeaderForRoot(const std::string& name) const;
+    std::string flatRelSourceForRoot(const std::string& name) const;
+    std::string flatRelRootHeaderFor(const Elem& elem, const std::string& name) const;
+    std::string flatHeaderPathFor(const Elem& elem) const;
+    std::string flatSourcePathFor(const Elem& elem) const;
+    std::string flatHeaderPathForRoot(const std::string& name) const;
+    std::string flatSourcePathForRoot(const std::string& name) const;
+
+    static std::string flatNamespaceBeginFor(const std::string& scope);
+    static std::string flatNamespaceEndFor(const std::string& scope);
+
+    void flatSetListCapacity(unsigned value);
+    unsigned flatListCapacity() const;
+
+    MessagesAccessList flatSupportedMessagesOf(const commsdsl::gen::Schema& schema) const;
+
+    bool flatWriteFile(const std::string& filePath, const std::string& contents) const;
+
+protected:
+    virtual bool writeImpl() override;
+
+    virtual MessagePtr createMessageImpl(commsdsl::parse::Message dslObj, Elem* parent) override;
+    virtual FramePtr createFrameImpl(commsdsl::parse::Frame dslObj, Elem* parent) override;
+
+    virtual FieldPtr createIntFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createEnumFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createSetFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createFloatFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createBitfieldFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createBundleFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createStringFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createDataFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createListFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createRefFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createOptionalFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+    virtual FieldPtr createVariantFieldImpl(commsdsl::parse::Field dslObj, Elem* parent) override;
+
+    virtual LayerPtr createCustomLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createSyncLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createSizeLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createIdLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createValueLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createPayloadLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+    virtual LayerPtr createChecksumLayerImpl(commsdsl::parse::Layer dslObj, Elem* parent) override;
+
+private:
+    unsigned m_listCapacity = DefaultListCapacity;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,71 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatIdLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatIdLayer::FlatIdLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatIdLayer::flatUnsupportedReasonImpl() const
+{
+    auto* field = flatActualField();
+    if (field != nullptr) {
+        auto kind = field->dslObj().kind();
+        if ((kind == commsdsl::parse::Field::Kind::Int) || (kind == commsdsl::parse::Field::Kind::Enum)) {
+            return strings::emptyString();
+        }
+    }
+
+    return flatUnsupportedStr("uses non-integral message id field");
+}
+
+std::string FlatIdLayer::flatReadCodeImpl() const
+{
+    return flatFieldReadCode() + "info.id = static_cast<MsgId>(" + flatFieldVarName() + ".value);\n";
+}
+
+std::string FlatIdLayer::flatWriteCodeImpl() const
+{
+    static const std::string Templ =
+        "#^#TYPE#$# #^#VAR#$#;\n"
+        "#^#VAR#$#.value = static_cast<decltype(#^#VAR#$#.value)>(id);\n"
+        "es = #^#VAR#$#.write(iter, remLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"TYPE", flatFieldTypeRef()},
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,260 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatIntField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+std::string signedLiteral(std::intmax_t value)
+{
+    if (value == std::numeric_limits<std::intmax_t>::min()) {
+        return "(-0x7fffffffffffffffLL - 1)";
+    }
+
+    return util::numToString(value);
+}
+
+std::intmax_t minValueFor(commsdsl::parse::IntField::Type type)
+{
+    static const std::intmax_t Map[] = {
+        /* Int8 */ std::numeric_limits<std::int8_t>::min(),
+        /* Uint8 */ 0,
+        /* Int16 */ std::numeric_limits<std::int16_t>::min(),
+        /* Uint16 */ 0,
+        /* Int32 */ std::numeric_limits<std::int32_t>::min(),
+        /* Uint32 */ 0,
+        /* Int64 */ std::numeric_limits<std::int64_t>::min(),
+        /* Uint64 */ 0,
+        /* Intvar */ std::numeric_limits<std::int64_t>::min(),
+        /* Uintvar */ 0,
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(commsdsl::parse::IntField::Type::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(type);
+    assert(idx < MapSize);
+    return Map[idx];
+}
+
+std::uintmax_t maxValueFor(commsdsl::parse::IntField::Type type)
+{
+    static const std::uintmax_t Map[] = {
+        /* Int8 */ std::numeric_limits<std::int8_t>::max(),
+        /* Uint8 */ std::numeric_limits<std::uint8_t>::max(),
+        /* Int16 */ std::numeric_limits<std::int16_t>::max(),
+        /* Uint16 */ std::numeric_limits<std::uint16_t>::max(),
+        /* Int32 */ std::numeric_limits<std::int32_t>::max(),
+        /* Uint32 */ std::numeric_limits<std::uint32_t>::max(),
+        /* Int64 */ std::numeric_limits<std::int64_t>::max(),
+        /* Uint64 */ std::numeric_limits<std::uint64_t>::max(),
+        /* Intvar */ std::numeric_limits<std::int64_t>::max(),
+        /* Uintvar */ std::numeric_limits<std::uint64_t>::max(),
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(commsdsl::parse::IntField::Type::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(type);
+    assert(idx < MapSize);
+    return Map[idx];
+}
+
+} // namespace
+
+FlatIntField::FlatIntField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatIntField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatIntField::flatUnsupportedReasonImpl() const
+{
+    auto obj = intDslObj();
+    if (obj.minLength() != obj.maxLength()) {
+        return flatUnsupportedStr("has variable length");
+    }
+
+    if (obj.availableLengthLimit()) {
+        return flatUnsupportedStr("uses available length limit");
+    }
+
+    return strings::emptyString();
+}
+
+bool FlatIntField::flatIsSerValueImpl() const
+{
+    return true;
+}
+
+std::string FlatIntField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Type of the stored value.\n"
+        "using ValueType = #^#TYPE#$#;\n"
+        "\n"
+        "/// @brief Stored value.\n"
+        "ValueType value = static_cast<ValueType>(#^#DEFAULT#$#);\n";
+
+    auto obj = intDslObj();
+    std::string defaultStr;
+    if (isUnsignedType()) {
+        defaultStr = util::numToString(static_cast<std::uintmax_t>(obj.defaultValue()));
+    }
+    else {
+        defaultStr = signedLiteral(obj.defaultValue());
+    }
+
+    util::ReplacementMap repl = {
+        {"TYPE", comms::cppIntTypeFor(obj.type(), obj.maxLength())},
+        {"DEFAULT", std::move(defaultStr)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatIntField::flatReadBodyImpl() const
+{
+    return flatSerValueReadBody(intDslObj().endian());
+}
+
+std::string FlatIntField::flatWriteBodyImpl() const
+{
+    return flatSerValueWriteBody(intDslObj().endian());
+}
+
+std::string FlatIntField::flatLengthBodyImpl() const
+{
+    return flatSerValueLengthBody();
+}
+
+std::string FlatIntField::flatValidBodyImpl() const
+{
+    auto obj = intDslObj();
+    auto& validRanges = obj.validRanges();
+    if (validRanges.empty()) {
+        return "return true;";
+    }
+
+    auto type = obj.type();
+    bool unsignedType = isUnsignedType();
+    auto typeMin = minValueFor(type);
+    auto typeMax = maxValueFor(type);
+
+    util::StringsList conds;
+    for (auto& r : validRanges) {
+        util::StringsList checks;
+        if (unsignedType) {
+            auto minVal = static_cast<std::uintmax_t>(r.m_min);
+            auto maxVal = static_cast<std::uintmax_t>(r.m_max);
+            if (0U < minVal) {
+                checks.push_back("(" + util::numToString(minVal) + " <= static_cast<std::uint64_t>(value))");
+            }
+
+            if (maxVal < typeMax) {
+                checks.push_back("(static_cast<std::uint64_t>(value) <= " + util::numToString(maxVal) + ")");
+            }
+        }
+        else {
+            if (typeMin < r.m_min) {
+                checks.push_back("(" + signedLiteral(r.m_min) + " <= static_cast<std::int64_t>(value))");
+            }
+
+            if ((r.m_max < 0) || (static_cast<std::uintmax_t>(r.m_max) < typeMax)) {
+                checks.push_back("(static_cast<std::int64_t>(value) <= " + signedLiteral(r.m_max) + ")");
+            }
+        }
+
+        if (checks.empty()) {
+            return "return true;";
+        }
+
+        if (checks.size() == 1U) {
+            conds.push_back(checks.front());
+            continue;
+        }
+
+        conds.push_back("(" + util::strListToString(checks, " && ", "") + ")");
+    }
+
+    return "return\n    " + util::strListToString(conds, " ||\n    ", ";");
+}
+
+std::string FlatIntField::flatSetSerValueBodyImpl() const
+{
+    auto obj = intDslObj();
+    auto offset = obj.serOffset();
+    if (isUnsignedType()) {
+        if (offset == 0) {
+            return "value = static_cast<ValueType>(ser);";
+        }
+
+        return "value = static_cast<ValueType>(ser - static_cast<std::uint64_t>(" + signedLiteral(offset) + "));";
+    }
+
+    std::string serStr = "static_cast<std::int64_t>(ser)";
+    if (obj.signExt()) {
+        serStr = "signExtend(ser, " + std::to_string(flatSerBits()) + "U)";
+    }
+
+    if (offset == 0) {
+        return "value = static_cast<ValueType>(" + serStr + ");";
+    }
+
+    return "value = static_cast<ValueType>(" + serStr + " - " + signedLiteral(offset) + ");";
+}
+
+std::string FlatIntField::flatSerValueBodyImpl() const
+{
+    auto offset = intDslObj().serOffset();
+    if (isUnsignedType()) {
+        if (offset == 0) {
+            return "return static_cast<std::uint64_t>(value);";
+        }
+
+        return "return static_cast<std::uint64_t>(value) + static_cast<std::uint64_t>(" + signedLiteral(offset) + ");";
+    }
+
+    if (offset == 0) {
+        return "return static_cast<std::uint64_t>(static_cast<std::int64_t>(value));";
+    }
+
+    return "return static_cast<std::uint64_t>(static_cast<std::int64_t>(value) + " + signedLiteral(offset) + ");";
+}
+
+} // namespace commsdsl2flat
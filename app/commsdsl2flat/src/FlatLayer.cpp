@@ -0,0 +1,195 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatLayer.h"
+
+#include "commsdsl/gen/RefField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatLayer::FlatLayer(commsdsl::gen::Layer& layer) :
+    m_layer(layer)
+{
+}
+
+FlatLayer::~FlatLayer() = default;
+
+const FlatLayer* FlatLayer::cast(const commsdsl::gen::Layer* layer)
+{
+    if (layer == nullptr) {
+        return nullptr;
+    }
+
+    auto* flatLayer = dynamic_cast<const FlatLayer*>(layer);
+    assert(flatLayer != nullptr);
+    return flatLayer;
+}
+
+const FlatField* FlatLayer::flatField() const
+{
+    auto* field = m_layer.memberField();
+    if (field == nullptr) {
+        field = m_layer.externalField();
+    }
+
+    return FlatField::cast(field);
+}
+
+std::string FlatLayer::flatFieldTypeName() const
+{
+    return "Field_" + comms::accessName(m_layer.dslObj().name());
+}
+
+std::string FlatLayer::flatFieldTypeRef() const
+{
+    auto* frame = m_layer.getParent();
+    assert(frame != nullptr);
+    return comms::className(frame->name()) + "::" + flatFieldTypeName();
+}
+
+std::string FlatLayer::flatFieldVarName() const
+{
+    return "field_" + comms::accessName(m_layer.dslObj().name());
+}
+
+std::string FlatLayer::flatUnsupportedReason() const
+{
+    auto* field = flatField();
+    if (field != nullptr) {
+        auto reason = field->flatUnsupportedReason();
+        if (!reason.empty()) {
+            return reason;
+        }
+    }
+
+    return flatUnsupportedReasonImpl();
+}
+
+bool FlatLayer::flatIsInfoMember() const
+{
+    return flatIsInfoMemberImpl();
+}
+
+void FlatLayer::flatAddIncludes(IncludesList& list) const
+{
+    FlatField::flatRefAddIncludes(m_layer.memberField(), m_layer.externalField(), list);
+}
+
+std::string FlatLayer::flatFieldDefCode() const
+{
+    return FlatField::flatRefDefCode(m_layer.memberField(), m_layer.externalField(), flatFieldTypeName());
+}
+
+std::string FlatLayer::flatFieldSourceCode() const
+{
+    return FlatField::flatRefSourceCode(m_layer.memberField());
+}
+
+std::string FlatLayer::flatReadCode() const
+{
+    return flatReadCodeImpl();
+}
+
+std::string FlatLayer::flatWriteCode() const
+{
+    return flatWriteCodeImpl();
+}
+
+std::string FlatLayer::flatUnsupportedReasonImpl() const
+{
+    return strings::emptyString();
+}
+
+bool FlatLayer::flatIsInfoMemberImpl() const
+{
+    return false;
+}
+
+std::string FlatLayer::flatReadCodeImpl() const
+{
+    return flatFieldReadCode();
+}
+
+std::string FlatLayer::flatWriteCodeImpl() const
+{
+    return flatFieldWriteCode();
+}
+
+std::string FlatLayer::flatUnsupportedStr(const std::string& reason) const
+{
+    auto* frame = m_layer.getParent();
+    assert(frame != nullptr);
+    return "layer \"" + comms::scopeFor(*frame, m_layer.generator()) + "::" + m_layer.dslObj().name() + "\" " + reason;
+}
+
+std::string FlatLayer::flatFieldReadCode() const
+{
+    static const std::string Templ =
+        "#^#TYPE#$# #^#VAR#$#;\n"
+        "es = #^#VAR#$#.read(iter, remLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"TYPE", flatFieldTypeRef()},
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatLayer::flatFieldWriteCode() const
+{
+    static const std::string Templ =
+        "#^#TYPE#$# #^#VAR#$#;\n"
+        "es = #^#VAR#$#.write(iter, remLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"TYPE", flatFieldTypeRef()},
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+const commsdsl::gen::Field* FlatLayer::flatActualField() const
+{
+    const commsdsl::gen::Field* field = m_layer.memberField();
+    if (field == nullptr) {
+        field = m_layer.externalField();
+    }
+
+    while ((field != nullptr) && (field->dslObj().kind() == commsdsl::parse::Field::Kind::Ref)) {
+        field = static_cast<const commsdsl::gen::RefField*>(field)->referencedField();
+    }
+
+    return field;
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,76 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "FlatField.h"
+
+#include "commsdsl/gen/Layer.h"
+
+#include <string>
+
+namespace commsdsl2flat
+{
+
+class FlatLayer
+{
+public:
+    using IncludesList = FlatField::IncludesList;
+
+    explicit FlatLayer(commsdsl::gen::Layer& layer);
+    virtual ~FlatLayer();
+
+    static const FlatLayer* cast(const commsdsl::gen::Layer* layer);
+
+    commsdsl::gen::Layer& layer()
+    {
+        return m_layer;
+    }
+
+    const commsdsl::gen::Layer& layer() const
+    {
+        return m_layer;
+    }
+
+    const FlatField* flatField() const;
+    std::string flatFieldTypeName() const;
+    std::string flatFieldTypeRef() const;
+    std::string flatFieldVarName() const;
+
+    std::string flatUnsupportedReason() const;
+    bool flatIsInfoMember() const;
+
+    void flatAddIncludes(IncludesList& list) const;
+    std::string flatFieldDefCode() const;
+    std::string flatFieldSourceCode() const;
+    std::string flatReadCode() const;
+    std::string flatWriteCode() const;
+
+protected:
+    virtual std::string flatUnsupportedReasonImpl() const;
+    virtual bool flatIsInfoMemberImpl() const;
+    virtual std::string flatReadCodeImpl() const;
+    virtual std::string flatWriteCodeImpl() const;
+
+    std::string flatUnsupportedStr(const std::string& reason) const;
+    std::string flatFieldReadCode() const;
+    std::string flatFieldWriteCode() const;
+    const commsdsl::gen::Field* flatActualField() const;
+
+private:
+    commsdsl::gen::Layer& m_layer;
+};
+
+} // namespace commsdsl2flat
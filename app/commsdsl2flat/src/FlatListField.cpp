@@ -0,0 +1,352 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatListField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string ElementStr("Element");
+const std::string CountPrefixStr("CountPrefix");
+const std::string LengthPrefixStr("LengthPrefix");
+
+const std::string ElemsWriteStr =
+    "for (auto& elem : value) {\n"
+    "    es = elem.write(iter, len);\n"
+    "    if (es != ErrorStatus::Success) {\n"
+    "        return es;\n"
+    "    }\n"
+    "}\n";
+
+const std::string ElemsLengthStr =
+    "for (auto& elem : value) {\n"
+    "    result += elem.length();\n"
+    "}\n";
+
+} // namespace
+
+FlatListField::FlatListField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatListField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    auto* elem = memberElementField();
+    if (elem != nullptr) {
+        cast(elem)->flatSetForcedTypeName(ElementStr);
+    }
+
+    auto* countPrefix = memberCountPrefixField();
+    if (countPrefix != nullptr) {
+        cast(countPrefix)->flatSetForcedTypeName(CountPrefixStr);
+    }
+
+    auto* lengthPrefix = memberLengthPrefixField();
+    if (lengthPrefix != nullptr) {
+        cast(lengthPrefix)->flatSetForcedTypeName(LengthPrefixStr);
+    }
+
+    return true;
+}
+
+bool FlatListField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatListField::flatUnsupportedReasonImpl() const
+{
+    auto obj = listDslObj();
+    if ((!obj.detachedCountPrefixFieldName().empty()) ||
+        (!obj.detachedLengthPrefixFieldName().empty()) ||
+        (!obj.detachedElemLengthPrefixFieldName().empty()) ||
+        (!obj.detachedTermSuffixFieldName().empty())) {
+        return flatUnsupportedStr("uses detached prefix or suffix");
+    }
+
+    if (obj.hasElemLengthPrefixField()) {
+        return flatUnsupportedStr("uses element length prefix");
+    }
+
+    if (obj.hasTermSuffixField()) {
+        return flatUnsupportedStr("uses termination suffix");
+    }
+
+    auto* elem = memberElementField();
+    if (elem == nullptr) {
+        elem = externalElementField();
+    }
+
+    auto reason = flatExternalRefUnsupportedReason(elem);
+    if (!reason.empty()) {
+        return reason;
+    }
+
+    auto* countPrefix = memberCountPrefixField();
+    if (countPrefix == nullptr) {
+        countPrefix = externalCountPrefixField();
+    }
+
+    reason = flatPrefixUnsupportedReason(countPrefix, "count prefix");
+    if (!reason.empty()) {
+        return reason;
+    }
+
+    auto* lengthPrefix = memberLengthPrefixField();
+    if (lengthPrefix == nullptr) {
+        lengthPrefix = externalLengthPrefixField();
+    }
+
+    return flatPrefixUnsupportedReason(lengthPrefix, "length prefix");
+}
+
+void FlatListField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatRefAddIncludes(memberElementField(), externalElementField(), list);
+    flatRefAddIncludes(memberCountPrefixField(), externalCountPrefixField(), list);
+    flatRefAddIncludes(memberLengthPrefixField(), externalLengthPrefixField(), list);
+}
+
+std::string FlatListField::flatMembersDefImpl() const
+{
+    static const std::string Templ =
+        "#^#ELEMENT#$#\n"
+        "#^#COUNT_PREFIX#$#\n"
+        "#^#LENGTH_PREFIX#$#\n";
+
+    util::ReplacementMap repl = {
+        {"ELEMENT", flatRefDefCode(memberElementField(), externalElementField(), ElementStr)},
+        {"COUNT_PREFIX", flatRefDefCode(memberCountPrefixField(), externalCountPrefixField(), CountPrefixStr)},
+        {"LENGTH_PREFIX", flatRefDefCode(memberLengthPrefixField(), externalLengthPrefixField(), LengthPrefixStr)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatListField::flatValueDefImpl() const
+{
+    auto fixedCount = listDslObj().fixedCount();
+    if (fixedCount != 0U) {
+        return
+            "/// @brief Stored value.\n"
+            "Element value[" + std::to_string(fixedCount) + "U];\n";
+    }
+
+    auto& generator = FlatGenerator::cast(this->generator());
+    return
+        "/// @brief Stored value.\n"
+        "StaticVector<Element, " + std::to_string(generator.flatListCapacity()) + "U> value;\n";
+}
+
+std::string FlatListField::flatMembersSourceImpl() const
+{
+    static const std::string Templ =
+        "#^#ELEMENT#$#\n"
+        "#^#COUNT_PREFIX#$#\n"
+        "#^#LENGTH_PREFIX#$#\n";
+
+    util::ReplacementMap repl = {
+        {"ELEMENT", flatRefSourceCode(memberElementField())},
+        {"COUNT_PREFIX", flatRefSourceCode(memberCountPrefixField())},
+        {"LENGTH_PREFIX", flatRefSourceCode(memberLengthPrefixField())},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatListField::flatReadBodyImpl() const
+{
+    if (flatHasCountPrefixInternal()) {
+        return
+            "CountPrefix prefix;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "auto count = static_cast<std::size_t>(prefix.value);\n"
+            "if (value.capacity() < count) {\n"
+            "    return ErrorStatus::CapacityExceeded;\n"
+            "}\n"
+            "\n"
+            "value.resize(count);\n"
+            "for (auto& elem : value) {\n"
+            "    es = elem.read(iter, len);\n"
+            "    if (es != ErrorStatus::Success) {\n"
+            "        return es;\n"
+            "    }\n"
+            "}\n";
+    }
+
+    if (flatHasLengthPrefixInternal()) {
+        return
+            "LengthPrefix prefix;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "auto remLen = static_cast<std::size_t>(prefix.value);\n"
+            "if (len < remLen) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "len -= remLen;\n"
+            "value.clear();\n"
+            "while (0U < remLen) {\n"
+            "    if (value.size() == value.capacity()) {\n"
+            "        return ErrorStatus::CapacityExceeded;\n"
+            "    }\n"
+            "\n"
+            "    value.resize(value.size() + 1U);\n"
+            "    es = value.back().read(iter, remLen);\n"
+            "    if (es != ErrorStatus::Success) {\n"
+            "        return es;\n"
+            "    }\n"
+            "}\n";
+    }
+
+    if (listDslObj().fixedCount() != 0U) {
+        return
+            "for (auto& elem : value) {\n"
+            "    auto es = elem.read(iter, len);\n"
+            "    if (es != ErrorStatus::Success) {\n"
+            "        return es;\n"
+            "    }\n"
+            "}\n";
+    }
+
+    return
+        "value.clear();\n"
+        "while (0U < len) {\n"
+        "    if (value.size() == value.capacity()) {\n"
+        "        return ErrorStatus::CapacityExceeded;\n"
+        "    }\n"
+        "\n"
+        "    value.resize(value.size() + 1U);\n"
+        "    auto es = value.back().read(iter, len);\n"
+        "    if (es != ErrorStatus::Success) {\n"
+        "        return es;\n"
+        "    }\n"
+        "}\n";
+}
+
+std::string FlatListField::flatWriteBodyImpl() const
+{
+    if (flatHasCountPrefixInternal()) {
+        return
+            "CountPrefix prefix;\n"
+            "prefix.value = static_cast<CountPrefix::ValueType>(value.size());\n"
+            "auto es = prefix.write(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n" +
+            ElemsWriteStr;
+    }
+
+    if (flatHasLengthPrefixInternal()) {
+        return
+            "std::size_t result = 0U;\n" +
+            ElemsLengthStr +
+            "\n"
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(result);\n"
+            "auto es = prefix.write(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n" +
+            ElemsWriteStr;
+    }
+
+    return
+        "auto es = ErrorStatus::Success;\n" +
+        ElemsWriteStr;
+}
+
+std::string FlatListField::flatLengthBodyImpl() const
+{
+    if (flatHasCountPrefixInternal()) {
+        return
+            "CountPrefix prefix;\n"
+            "prefix.value = static_cast<CountPrefix::ValueType>(value.size());\n"
+            "std::size_t result = prefix.length();\n" +
+            ElemsLengthStr +
+            "\n"
+            "return result;";
+    }
+
+    if (flatHasLengthPrefixInternal()) {
+        return
+            "std::size_t result = 0U;\n" +
+            ElemsLengthStr +
+            "\n"
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(result);\n"
+            "return prefix.length() + result;";
+    }
+
+    return
+        "std::size_t result = 0U;\n" +
+        ElemsLengthStr +
+        "\n"
+        "return result;";
+}
+
+std::string FlatListField::flatValidBodyImpl() const
+{
+    return
+        "for (auto& elem : value) {\n"
+        "    if (!elem.valid()) {\n"
+        "        return false;\n"
+        "    }\n"
+        "}\n"
+        "\n"
+        "return true;";
+}
+
+bool FlatListField::flatHasCountPrefixInternal() const
+{
+    return (memberCountPrefixField() != nullptr) || (externalCountPrefixField() != nullptr);
+}
+
+bool FlatListField::flatHasLengthPrefixInternal() const
+{
+    return (memberLengthPrefixField() != nullptr) || (externalLengthPrefixField() != nullptr);
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,280 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatMessage.h"
+
+#include "FlatCommon.h"
+#include "FlatGenerator.h"
+#include "FlatMsgId.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+bool isCustomOverride(commsdsl::parse::OverrideType value)
+{
+    return
+        (value == commsdsl::parse::OverrideType_Replace) ||
+        (value == commsdsl::parse::OverrideType_Extend);
+}
+
+} // namespace
+
+FlatMessage::FlatMessage(FlatGenerator& generator, commsdsl::parse::Message dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent)
+{
+}
+
+FlatMessage::~FlatMessage() = default;
+
+std::string FlatMessage::flatUnsupportedReason() const
+{
+    auto obj = dslObj();
+    auto msgStr = "message \"" + comms::scopeFor(*this, generator()) + "\" ";
+    if (isCustomOverride(obj.readOverride()) ||
+        isCustomOverride(obj.writeOverride()) ||
+        isCustomOverride(obj.lengthOverride()) ||
+        isCustomOverride(obj.validOverride())) {
+        return msgStr + "requires custom code";
+    }
+
+    if (obj.construct().valid() || obj.readCond().valid() || obj.validCond().valid()) {
+        return msgStr + "uses conditional construction, read, or validation";
+    }
+
+    return FlatField::flatMembersUnsupportedReason(m_fields);
+}
+
+bool FlatMessage::flatIsSupported() const
+{
+    return flatUnsupportedReason().empty();
+}
+
+bool FlatMessage::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    m_fields = FlatField::flatTransformFieldsList(fields());
+    return true;
+}
+
+bool FlatMessage::writeImpl() const
+{
+    auto reason = flatUnsupportedReason();
+    if (!reason.empty()) {
+        generator().logger().warning("Skipping flat definition of " + comms::scopeFor(*this, generator()) + ", " + reason + ".");
+        return true;
+    }
+
+    return
+        flatWriteHeaderInternal() &&
+        flatWriteSourceInternal();
+}
+
+bool FlatMessage::flatWriteHeaderInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains flat definition of <b>\"#^#NAME#$#\"</b> message.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Definition of <b>\"#^#NAME#$#\"</b> message.\n"
+        "struct #^#CLASS_NAME#$#\n"
+        "{\n"
+        "    #^#FIELDS_DEF#$#\n"
+        "    #^#FIELDS_DATA#$#\n"
+        "\n"
+        "    /// @brief Id of the message.\n"
+        "    static constexpr MsgId msgId()\n"
+        "    {\n"
+        "        return #^#MSG_ID#$#;\n"
+        "    }\n"
+        "\n"
+        "    /// @brief Name of the message.\n"
+        "    static const char* name();\n"
+        "\n"
+        "    /// @brief Read the message payload from the input buffer.\n"
+        "    /// @details Advances @b iter and decrements @b len by the number of consumed bytes.\n"
+        "    ErrorStatus read(const std::uint8_t*& iter, std::size_t& len);\n"
+        "\n"
+        "    /// @brief Write the message payload to the output buffer.\n"
+        "    /// @details Advances @b iter and decrements @b len by the number of written bytes.\n"
+        "    ErrorStatus write(std::uint8_t*& iter, std::size_t& len) const;\n"
+        "\n"
+        "    /// @brief Get serialization length of the message payload.\n"
+        "    std::size_t length() const;\n"
+        "\n"
+        "    /// @brief Check validity of all the message fields.\n"
+        "    bool valid() const;\n"
+        "};\n"
+        "\n"
+        "/// @brief Decode the message payload from the input buffer.\n"
+        "ErrorStatus decode(const std::uint8_t* buf, std::size_t len, #^#CLASS_NAME#$#& msg);\n"
+        "\n"
+        "/// @brief Encode the message payload into the output buffer.\n"
+        "/// @param[out] written Number of bytes written to the buffer.\n"
+        "ErrorStatus encode(const #^#CLASS_NAME#$#& msg, std::uint8_t* buf, std::size_t len, std::size_t& written);\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto& gen = FlatGenerator::cast(generator());
+    auto scope = gen.flatScopeFor(*this);
+    auto className = comms::className(name());
+    auto nsScope = scope.substr(0, scope.size() - className.size() - 2U);
+    auto obj = dslObj();
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"NAME", util::displayName(obj.displayName(), obj.name())},
+        {"INCLUDES", flatIncludesInternal()},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"CLASS_NAME", className},
+        {"FIELDS_DEF", FlatField::flatMembersDefCode(m_fields)},
+        {"FIELDS_DATA", FlatField::flatMembersDataCode(m_fields)},
+        {"MSG_ID", FlatMsgId::flatMsgIdStrFor(gen, *this)},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    return gen.flatWriteFile(gen.flatHeaderPathFor(*this), util::processTemplate(Templ, repl, true));
+}
+
+bool FlatMessage::flatWriteSourceInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "#include \"#^#HEADER#$#\"\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "#^#FIELDS#$#\n"
+        "#^#FUNCS#$#\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto& gen = FlatGenerator::cast(generator());
+    auto scope = gen.flatScopeFor(*this);
+    auto nsScope = scope.substr(0, scope.size() - comms::className(name()).size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"HEADER", gen.flatRelHeaderFor(*this)},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(nsScope)},
+        {"FIELDS", FlatField::flatMembersSourceCode(m_fields)},
+        {"FUNCS", flatFuncsSourceInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(nsScope)},
+    };
+
+    return gen.flatWriteFile(gen.flatSourcePathFor(*this), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatMessage::flatIncludesInternal() const
+{
+    auto& gen = FlatGenerator::cast(generator());
+    FlatField::IncludesList includes = {
+        gen.flatRelRootHeaderFor(*this, FlatCommon::flatName()),
+        gen.flatRelRootHeaderFor(*this, FlatMsgId::flatName()),
+    };
+
+    FlatField::flatMembersAddIncludes(m_fields, includes);
+    comms::prepareIncludeStatement(includes);
+    return util::strListToString(includes, "\n", "");
+}
+
+std::string FlatMessage::flatFuncsSourceInternal() const
+{
+    static const std::string Templ =
+        "const char* #^#CLASS_NAME#$#::name()\n"
+        "{\n"
+        "    return \"#^#NAME#$#\";\n"
+        "}\n"
+        "\n"
+        "ErrorStatus #^#CLASS_NAME#$#::read(const std::uint8_t*& iter, std::size_t& len)\n"
+        "{\n"
+        "    #^#READ#$#\n"
+        "    #^#FAIL_ON_INVALID#$#\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "ErrorStatus #^#CLASS_NAME#$#::write(std::uint8_t*& iter, std::size_t& len) const\n"
+        "{\n"
+        "    #^#WRITE#$#\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "std::size_t #^#CLASS_NAME#$#::length() const\n"
+        "{\n"
+        "    #^#LENGTH#$#\n"
+        "}\n"
+        "\n"
+        "bool #^#CLASS_NAME#$#::valid() const\n"
+        "{\n"
+        "    #^#VALID#$#\n"
+        "}\n"
+        "\n"
+        "ErrorStatus decode(const std::uint8_t* buf, std::size_t len, #^#CLASS_NAME#$#& msg)\n"
+        "{\n"
+        "    return msg.read(buf, len);\n"
+        "}\n"
+        "\n"
+        "ErrorStatus encode(const #^#CLASS_NAME#$#& msg, std::uint8_t* buf, std::size_t len, std::size_t& written)\n"
+        "{\n"
+        "    auto* iter = buf;\n"
+        "    auto es = msg.write(iter, len);\n"
+        "    written = static_cast<std::size_t>(iter - buf);\n"
+        "    return es;\n"
+        "}\n"
+        ;
+
+    auto obj = dslObj();
+    util::ReplacementMap repl = {
+        {"CLASS_NAME", comms::className(name())},
+        {"NAME", util::displayName(obj.displayName(), obj.name())},
+        {"READ", FlatField::flatMembersReadCode(m_fields)},
+        {"WRITE", FlatField::flatMembersWriteCode(m_fields)},
+        {"LENGTH", FlatField::flatMembersLengthCode(m_fields)},
+        {"VALID", FlatField::flatMembersValidCode(m_fields)},
+    };
+
+    if (obj.isFailOnInvalid()) {
+        repl["FAIL_ON_INVALID"] =
+            "\n"
+            "if (!valid()) {\n"
+            "    return ErrorStatus::InvalidMsgData;\n"
+            "}\n";
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2flat
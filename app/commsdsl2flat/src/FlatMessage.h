@@ -0,0 +1,59 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "FlatField.h"
+
+#include "commsdsl/gen/Message.h"
+
+#include <string>
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator;
+class FlatMessage final: public commsdsl::gen::Message
+{
+    using Base = commsdsl::gen::Message;
+
+public:
+    using FlatFieldsList = FlatField::FlatFieldsList;
+
+    explicit FlatMessage(FlatGenerator& generator, commsdsl::parse::Message dslObj, commsdsl::gen::Elem* parent);
+    virtual ~FlatMessage();
+
+    static const FlatMessage* cast(const commsdsl::gen::Message* msg)
+    {
+        return static_cast<const FlatMessage*>(msg);
+    }
+
+    std::string flatUnsupportedReason() const;
+    bool flatIsSupported() const;
+
+protected:
+    virtual bool prepareImpl() override;
+    virtual bool writeImpl() const override;
+
+private:
+    bool flatWriteHeaderInternal() const;
+    bool flatWriteSourceInternal() const;
+    std::string flatIncludesInternal() const;
+    std::string flatFuncsSourceInternal() const;
+
+    FlatFieldsList m_fields;
+};
+
+} // namespace commsdsl2flat
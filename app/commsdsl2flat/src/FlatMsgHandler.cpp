@@ -0,0 +1,124 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatMsgHandler.h"
+
+#include "FlatCommon.h"
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string MsgHandlerNameStr("MsgHandler");
+
+} // namespace
+
+bool FlatMsgHandler::write(FlatGenerator& generator)
+{
+    FlatMsgHandler obj(generator);
+    return obj.flatWriteInternal();
+}
+
+const std::string& FlatMsgHandler::flatName()
+{
+    return MsgHandlerNameStr;
+}
+
+bool FlatMsgHandler::flatWriteInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the flat messages handler.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#^#INCLUDES#$#\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Common interface class for handling of all the flat messages.\n"
+        "/// @details Override the relevant @b handle() member functions.\n"
+        "class #^#NAME#$#\n"
+        "{\n"
+        "public:\n"
+        "    virtual ~#^#NAME#$#() = default;\n"
+        "\n"
+        "    #^#FUNCS#$#\n"
+        "};\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto ns = m_generator.flatScopeForRoot(strings::emptyString());
+    ns.resize(ns.size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"INCLUDES", flatIncludesInternal()},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(ns)},
+        {"NAME", flatName()},
+        {"FUNCS", flatHandleFuncsInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(ns)},
+    };
+
+    return m_generator.flatWriteFile(m_generator.flatHeaderPathForRoot(flatName()), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatMsgHandler::flatIncludesInternal() const
+{
+    util::StringsList includes;
+    for (auto* m : m_generator.flatSupportedMessagesOf(m_generator.currentSchema())) {
+        includes.push_back(m_generator.flatRelHeaderFor(*m));
+    }
+
+    comms::prepareIncludeStatement(includes);
+    return util::strListToString(includes, "\n", "");
+}
+
+std::string FlatMsgHandler::flatHandleFuncsInternal() const
+{
+    static const std::string Templ =
+        "/// @brief Handle <b>\"#^#MSG_NAME#$#\"</b> message.\n"
+        "virtual void handle(const #^#MSG#$#& msg)\n"
+        "{\n"
+        "    static_cast<void>(msg);\n"
+        "}\n";
+
+    util::StringsList funcs;
+    for (auto* m : m_generator.flatSupportedMessagesOf(m_generator.currentSchema())) {
+        auto obj = m->dslObj();
+        util::ReplacementMap repl = {
+            {"MSG_NAME", util::displayName(obj.displayName(), obj.name())},
+            {"MSG", m_generator.flatScopeFor(*m)},
+        };
+
+        funcs.push_back(util::processTemplate(Templ, repl));
+    }
+
+    return util::strListToString(funcs, "\n", "");
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,177 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatMsgId.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/EnumField.h"
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+bool FlatMsgId::write(FlatGenerator& generator)
+{
+    FlatMsgId obj(generator);
+    return obj.flatWriteInternal();
+}
+
+const std::string& FlatMsgId::flatName()
+{
+    return strings::msgIdEnumNameStr();
+}
+
+std::string FlatMsgId::flatMsgIdStrFor(const FlatGenerator& generator, const commsdsl::gen::Message& msg)
+{
+    auto& schema = generator.schemaOf(msg);
+    auto scope = schema.mainNamespace() + "::flat::";
+    auto* msgIdField = schema.getMessageIdField();
+    if (msgIdField == nullptr) {
+        return scope + strings::msgIdPrefixStr() + comms::fullNameFor(msg);
+    }
+
+    assert(msgIdField->dslObj().kind() == commsdsl::parse::Field::Kind::Enum);
+    auto* castedEnumField = static_cast<const commsdsl::gen::EnumField*>(msgIdField);
+    auto obj = castedEnumField->enumDslObj();
+
+    auto& revValues = obj.revValues();
+    auto id = static_cast<std::intmax_t>(msg.dslObj().id());
+    auto iter = revValues.find(id);
+    if (iter != revValues.end()) {
+        return scope + strings::msgIdPrefixStr() + iter->second;
+    }
+
+    return "static_cast<" + scope + flatName() + ">(" + util::numToString(id) + ")";
+}
+
+bool FlatMsgId::flatWriteInternal() const
+{
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "/// @file\n"
+        "/// @brief Contains definition of the flat message IDs enumeration.\n"
+        "\n"
+        "#pragma once\n"
+        "\n"
+        "#include <cstdint>\n"
+        "\n"
+        "#^#NS_BEGIN#$#\n"
+        "/// @brief Message ids enumeration.\n"
+        "enum #^#NAME#$# : #^#TYPE#$#\n"
+        "{\n"
+        "    #^#IDS#$#\n"
+        "};\n"
+        "\n"
+        "#^#NS_END#$#\n"
+        ;
+
+    auto ns = m_generator.flatScopeForRoot(strings::emptyString());
+    ns.resize(ns.size() - 2U);
+
+    util::ReplacementMap repl = {
+        {"GENERATED", FlatGenerator::fileGeneratedComment()},
+        {"NS_BEGIN", FlatGenerator::flatNamespaceBeginFor(ns)},
+        {"NAME", flatName()},
+        {"TYPE", flatTypeInternal()},
+        {"IDS", flatIdsInternal()},
+        {"NS_END", FlatGenerator::flatNamespaceEndFor(ns)},
+    };
+
+    return m_generator.flatWriteFile(m_generator.flatHeaderPathForRoot(flatName()), util::processTemplate(Templ, repl, true));
+}
+
+std::string FlatMsgId::flatTypeInternal() const
+{
+    auto* msgIdField = m_generator.currentSchema().getMessageIdField();
+    if (msgIdField != nullptr) {
+        assert(msgIdField->dslObj().kind() == commsdsl::parse::Field::Kind::Enum);
+        auto* castedMsgIdField = static_cast<const commsdsl::gen::EnumField*>(msgIdField);
+        auto dslObj = castedMsgIdField->enumDslObj();
+        return comms::cppIntTypeFor(dslObj.type(), dslObj.maxLength());
+    }
+
+    auto allMessages = m_generator.currentSchema().getAllMessages();
+    auto iter =
+        std::max_element(
+            allMessages.begin(), allMessages.end(),
+            [](auto* first, auto* second)
+            {
+                return first->dslObj().id() < second->dslObj().id();
+            });
+
+    std::string result = "unsigned";
+    do {
+        if (iter == allMessages.end()) {
+            break;
+        }
+
+        auto maxId = (*iter)->dslObj().id();
+        bool fitsUnsigned = maxId <= std::numeric_limits<unsigned>::max();
+        if (fitsUnsigned) {
+            break;
+        }
+
+        result = "unsigned long long";
+    } while (false);
+
+    return result;
+}
+
+std::string FlatMsgId::flatIdsInternal() const
+{
+    util::StringsList ids;
+    auto& prefix = strings::msgIdPrefixStr();
+    auto* msgIdField = m_generator.currentSchema().getMessageIdField();
+    if (msgIdField != nullptr) {
+        assert(msgIdField->dslObj().kind() == commsdsl::parse::Field::Kind::Enum);
+        auto* castedMsgIdField = static_cast<const commsdsl::gen::EnumField*>(msgIdField);
+        bool isUnsigned = castedMsgIdField->isUnsignedUnderlyingType();
+        auto dslObj = castedMsgIdField->enumDslObj();
+        for (auto& v : dslObj.values()) {
+            std::string valStr;
+            if (isUnsigned) {
+                valStr = util::numToString(static_cast<std::uintmax_t>(v.second.m_value));
+            }
+            else {
+                valStr = util::numToString(v.second.m_value);
+            }
+
+            ids.push_back(prefix + v.first + " = " + valStr + ", ///< Message id of <b>" + v.first + "</b>.");
+        }
+
+        return util::strListToString(ids, "\n", "");
+    }
+
+    auto allMessages = m_generator.currentSchema().getAllMessagesIdSorted();
+    for (auto* m : allMessages) {
+        auto name = comms::fullNameFor(*m);
+        ids.push_back(prefix + name + " = " + util::numToString(m->dslObj().id()) + ", ///< Message id of <b>" + name + "</b>.");
+    }
+
+    return util::strListToString(ids, "\n", "");
+}
+
+} // namespace commsdsl2flat
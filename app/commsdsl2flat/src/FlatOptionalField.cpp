@@ -0,0 +1,230 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatOptionalField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string FieldStr("Field");
+
+const std::string& modeStr(commsdsl::parse::OptionalField::Mode value)
+{
+    static const std::string Map[] = {
+        /* Tentative */ "Tentative",
+        /* Exists */ "Exists",
+        /* Missing */ "Missing",
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == static_cast<std::size_t>(commsdsl::parse::OptionalField::Mode::NumOfValues), "Invalid map");
+
+    auto idx = static_cast<std::size_t>(value);
+    if (MapSize <= idx) {
+        static constexpr bool Should_not_happen = false;
+        static_cast<void>(Should_not_happen);
+        assert(Should_not_happen);
+        idx = 0U;
+    }
+
+    return Map[idx];
+}
+
+} // namespace
+
+FlatOptionalField::FlatOptionalField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatOptionalField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    auto* field = memberField();
+    if (field != nullptr) {
+        cast(field)->flatSetForcedTypeName(FieldStr);
+    }
+
+    return true;
+}
+
+bool FlatOptionalField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatOptionalField::flatUnsupportedReasonImpl() const
+{
+    if (optionalDslObj().cond().valid()) {
+        return flatUnsupportedStr("has existence condition");
+    }
+
+    auto* field = memberField();
+    if (field == nullptr) {
+        field = externalField();
+    }
+
+    return flatExternalRefUnsupportedReason(field);
+}
+
+void FlatOptionalField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatRefAddIncludes(memberField(), externalField(), list);
+}
+
+std::string FlatOptionalField::flatMembersDefImpl() const
+{
+    return flatRefDefCode(memberField(), externalField(), FieldStr);
+}
+
+std::string FlatOptionalField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Mode of the optional field.\n"
+        "enum class Mode\n"
+        "{\n"
+        "    Tentative, ///< Existence is determined by the available data.\n"
+        "    Exists, ///< Field exists.\n"
+        "    Missing, ///< Field is missing.\n"
+        "};\n"
+        "\n"
+        "/// @brief Wrapped field.\n"
+        "Field field;\n"
+        "\n"
+        "/// @brief Current mode.\n"
+        "Mode mode = Mode::#^#MODE#$#;\n";
+
+    util::ReplacementMap repl = {
+        {"MODE", modeStr(optionalDslObj().defaultMode())},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatOptionalField::flatMembersSourceImpl() const
+{
+    return flatRefSourceCode(memberField());
+}
+
+std::string FlatOptionalField::flatReadBodyImpl() const
+{
+    static const std::string Templ =
+        "if (mode == Mode::Missing) {\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "if ((mode == Mode::Tentative) && (len == 0U)) {\n"
+        "    mode = Mode::Missing;\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "#^#SAVE#$#\n"
+        "auto es = field.read(iter, len);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    #^#READ_FAIL#$#\n"
+        "}\n"
+        "\n"
+        "#^#INVALID#$#\n"
+        "mode = Mode::Exists;\n";
+
+    static const std::string RestoreStr =
+        "iter = origIter;\n"
+        "len = origLen;\n"
+        "mode = Mode::Missing;\n"
+        "return ErrorStatus::Success;";
+
+    auto obj = optionalDslObj();
+    util::ReplacementMap repl = {
+        {"READ_FAIL", "return es;"},
+    };
+
+    if (obj.missingOnReadFail() || obj.missingOnInvalid()) {
+        repl["SAVE"] =
+            "auto* origIter = iter;\n"
+            "auto origLen = len;\n";
+    }
+
+    if (obj.missingOnReadFail()) {
+        repl["READ_FAIL"] = RestoreStr;
+    }
+
+    if (obj.missingOnInvalid()) {
+        repl["INVALID"] =
+            "if (!field.valid()) {\n" +
+            util::strInsertIndent(RestoreStr) + "\n"
+            "}\n";
+    }
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatOptionalField::flatWriteBodyImpl() const
+{
+    return
+        "if (mode == Mode::Missing) {\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "if ((mode == Mode::Tentative) && (len == 0U)) {\n"
+        "    return ErrorStatus::Success;\n"
+        "}\n"
+        "\n"
+        "auto es = field.write(iter, len);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+}
+
+std::string FlatOptionalField::flatLengthBodyImpl() const
+{
+    return
+        "if (mode != Mode::Exists) {\n"
+        "    return 0U;\n"
+        "}\n"
+        "\n"
+        "return field.length();";
+}
+
+std::string FlatOptionalField::flatValidBodyImpl() const
+{
+    return
+        "if (mode == Mode::Missing) {\n"
+        "    return true;\n"
+        "}\n"
+        "\n"
+        "return field.valid();";
+}
+
+} // namespace commsdsl2flat
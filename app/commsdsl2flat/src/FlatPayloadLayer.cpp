@@ -0,0 +1,73 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatPayloadLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/util.h"
+
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatPayloadLayer::FlatPayloadLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatPayloadLayer::flatPayloadReadCode(std::size_t trailLen) const
+{
+    if (trailLen == 0U) {
+        return
+            "info.payload = DataView(iter, remLen);\n"
+            "iter += remLen;\n"
+            "remLen = 0U;\n";
+    }
+
+    static const std::string Templ =
+        "if (remLen < #^#TRAIL#$#) {\n"
+        "    return ErrorStatus::NotEnoughData;\n"
+        "}\n"
+        "\n"
+        "auto payloadLen = remLen - #^#TRAIL#$#;\n"
+        "info.payload = DataView(iter, payloadLen);\n"
+        "iter += payloadLen;\n"
+        "remLen -= payloadLen;\n";
+
+    util::ReplacementMap repl = {
+        {"TRAIL", std::to_string(trailLen) + 'U'},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatPayloadLayer::flatReadCodeImpl() const
+{
+    return flatPayloadReadCode(0U);
+}
+
+std::string FlatPayloadLayer::flatWriteCodeImpl() const
+{
+    return
+        "es = payloadWrite(msg, iter, remLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,71 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatRefField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatRefField::FlatRefField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatRefField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatRefField::flatUnsupportedReasonImpl() const
+{
+    return flatExternalRefUnsupportedReason(referencedField());
+}
+
+bool FlatRefField::flatIsSerValueImpl() const
+{
+    auto* field = referencedField();
+    assert(field != nullptr);
+    return cast(field)->flatIsSerValue();
+}
+
+void FlatRefField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatRefAddIncludes(nullptr, referencedField(), list);
+}
+
+std::string FlatRefField::flatDefCodeImpl() const
+{
+    return flatRefDefCode(nullptr, referencedField(), flatTypeName());
+}
+
+std::string FlatRefField::flatSourceCodeImpl() const
+{
+    return strings::emptyString();
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,202 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatSetField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+#include <limits>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::size_t MaxBits = std::numeric_limits<std::uintmax_t>::digits;
+
+} // namespace
+
+FlatSetField::FlatSetField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatSetField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatSetField::flatUnsupportedReasonImpl() const
+{
+    auto obj = setDslObj();
+    if (obj.minLength() != obj.maxLength()) {
+        return flatUnsupportedStr("has variable length");
+    }
+
+    if (obj.availableLengthLimit()) {
+        return flatUnsupportedStr("uses available length limit");
+    }
+
+    return strings::emptyString();
+}
+
+bool FlatSetField::flatIsSerValueImpl() const
+{
+    return true;
+}
+
+std::string FlatSetField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Bits indices enumeration.\n"
+        "enum class BitIdx\n"
+        "{\n"
+        "    #^#BITS#$#\n"
+        "};\n"
+        "\n"
+        "/// @brief Type of the stored value.\n"
+        "using ValueType = #^#TYPE#$#;\n"
+        "\n"
+        "/// @brief Stored value.\n"
+        "ValueType value = static_cast<ValueType>(#^#DEFAULT#$#);\n";
+
+    auto obj = setDslObj();
+    std::uintmax_t defaultValue = 0U;
+    if (obj.defaultBitValue()) {
+        defaultValue = ~defaultValue;
+    }
+
+    util::StringsList bits;
+    for (auto& bitInfo : obj.bits()) {
+        if (MaxBits <= bitInfo.second.m_idx) {
+            static constexpr bool Should_not_happen = false;
+            static_cast<void>(Should_not_happen);
+            assert(Should_not_happen);
+            continue;
+        }
+
+        auto bitMask = static_cast<decltype(defaultValue)>(1U) << bitInfo.second.m_idx;
+        if (bitInfo.second.m_defaultValue) {
+            defaultValue |= bitMask;
+        }
+        else {
+            defaultValue &= ~(bitMask);
+        }
+
+        if (!bitInfo.second.m_reserved) {
+            bits.push_back(bitInfo.first + " = " + std::to_string(bitInfo.second.m_idx) + ", ///< Index of bit <b>" + bitInfo.first + "</b>.");
+        }
+    }
+
+    bits.push_back("NumOfValues = " + std::to_string(flatSerBits()) + " ///< Upper limit of the bits indices.");
+
+    util::ReplacementMap repl = {
+        {"BITS", util::strListToString(bits, "\n", "")},
+        {"TYPE", comms::cppIntTypeFor(obj.type(), obj.maxLength())},
+        {"DEFAULT", util::numToString(defaultValue & flatSerMaskInternal(), true)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatSetField::flatReadBodyImpl() const
+{
+    return flatSerValueReadBody(setDslObj().endian());
+}
+
+std::string FlatSetField::flatWriteBodyImpl() const
+{
+    return flatSerValueWriteBody(setDslObj().endian());
+}
+
+std::string FlatSetField::flatLengthBodyImpl() const
+{
+    return flatSerValueLengthBody();
+}
+
+std::string FlatSetField::flatValidBodyImpl() const
+{
+    auto obj = setDslObj();
+    std::uintmax_t reservedMask = ~static_cast<std::uintmax_t>(0U);
+    std::uintmax_t reservedValue = 0U;
+    if (obj.reservedBitValue()) {
+        reservedValue = ~reservedValue;
+    }
+
+    for (auto& bitInfo : obj.bits()) {
+        if (MaxBits <= bitInfo.second.m_idx) {
+            continue;
+        }
+
+        auto bitMask = static_cast<decltype(reservedValue)>(1U) << bitInfo.second.m_idx;
+        if (!bitInfo.second.m_reserved) {
+            reservedMask &= ~(bitMask);
+            reservedValue &= ~(bitMask);
+            continue;
+        }
+
+        if (bitInfo.second.m_reservedValue) {
+            reservedValue |= bitMask;
+        }
+        else {
+            reservedValue &= ~(bitMask);
+        }
+    }
+
+    auto mask = flatSerMaskInternal();
+    reservedMask &= mask;
+    reservedValue &= (reservedMask & mask);
+
+    if (reservedMask == 0U) {
+        return "return true;";
+    }
+
+    return
+        "return (static_cast<std::uint64_t>(value) & " + util::numToString(reservedMask, true) + ") == " +
+        util::numToString(reservedValue, true) + ";";
+}
+
+std::string FlatSetField::flatSetSerValueBodyImpl() const
+{
+    return "value = static_cast<ValueType>(ser);";
+}
+
+std::string FlatSetField::flatSerValueBodyImpl() const
+{
+    return "return static_cast<std::uint64_t>(value);";
+}
+
+std::uintmax_t FlatSetField::flatSerMaskInternal() const
+{
+    auto bitLength = flatSerBits();
+    if (MaxBits <= bitLength) {
+        return ~static_cast<std::uintmax_t>(0);
+    }
+
+    return (static_cast<std::uintmax_t>(1U) << bitLength) - 1;
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,52 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "FlatField.h"
+
+#include "commsdsl/gen/SetField.h"
+
+namespace commsdsl2flat
+{
+
+class FlatGenerator;
+class FlatSetField final : public commsdsl::gen::SetField, public FlatField
+{
+    using Base = commsdsl::gen::SetField;
+    using FlatBase = FlatField;
+public:
+    FlatSetField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent);
+
+protected:
+    // Base overrides
+    virtual bool writeImpl() const override;
+
+    // FlatBase overrides
+    virtual std::string flatUnsupportedReasonImpl() const override;
+    virtual bool flatIsSerValueImpl() const override;
+    virtual std::string flatValueDefImpl() const override;
+    virtual std::string flatReadBodyImpl() const override;
+    virtual std::string flatWriteBodyImpl() const override;
+    virtual std::string flatLengthBodyImpl() const override;
+    virtual std::string flatValidBodyImpl() const override;
+    virtual std::string flatSetSerValueBodyImpl() const override;
+    virtual std::string flatSerValueBodyImpl() const override;
+
+private:
+    std::uintmax_t flatSerMaskInternal() const;
+};
+
+} // namespace commsdsl2flat
@@ -0,0 +1,93 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatSizeLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatSizeLayer::FlatSizeLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatSizeLayer::flatFixupCode() const
+{
+    static const std::string Templ =
+        "#^#VAR#$#.value = static_cast<decltype(#^#VAR#$#.value)>(static_cast<std::size_t>(iter - sizeIter) - #^#VAR#$#.length());\n"
+        "std::uint8_t* sizeWriteIter = sizeIter;\n"
+        "std::size_t sizeWriteLen = #^#VAR#$#.length();\n"
+        "es = #^#VAR#$#.write(sizeWriteIter, sizeWriteLen);\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatSizeLayer::flatRestoreLenCode() const
+{
+    return "remLen += extraLen;\n";
+}
+
+std::string FlatSizeLayer::flatUnsupportedReasonImpl() const
+{
+    auto* field = flatActualField();
+    if ((field == nullptr) || (field->dslObj().kind() != commsdsl::parse::Field::Kind::Int)) {
+        return flatUnsupportedStr("uses non-integral size field");
+    }
+
+    return strings::emptyString();
+}
+
+std::string FlatSizeLayer::flatReadCodeImpl() const
+{
+    static const std::string Templ =
+        "#^#READ#$#\n"
+        "auto sizeVal = static_cast<std::size_t>(#^#VAR#$#.value);\n"
+        "if (remLen < sizeVal) {\n"
+        "    return ErrorStatus::NotEnoughData;\n"
+        "}\n"
+        "\n"
+        "auto extraLen = remLen - sizeVal;\n"
+        "remLen = sizeVal;\n";
+
+    util::ReplacementMap repl = {
+        {"READ", flatFieldReadCode()},
+        {"VAR", flatFieldVarName()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatSizeLayer::flatWriteCodeImpl() const
+{
+    return "std::uint8_t* sizeIter = iter;\n" + flatFieldWriteCode();
+}
+
+} // namespace commsdsl2flat
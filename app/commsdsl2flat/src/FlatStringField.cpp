@@ -0,0 +1,280 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatStringField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string LengthPrefixStr("LengthPrefix");
+
+std::string escapedStr(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (auto ch : str) {
+        if ((ch == '\"') || (ch == '\\')) {
+            result += '\\';
+        }
+
+        result += ch;
+    }
+    return result;
+}
+
+} // namespace
+
+FlatStringField::FlatStringField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatStringField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    auto* prefix = memberPrefixField();
+    if (prefix != nullptr) {
+        cast(prefix)->flatSetForcedTypeName(LengthPrefixStr);
+    }
+
+    return true;
+}
+
+bool FlatStringField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatStringField::flatUnsupportedReasonImpl() const
+{
+    if (!stringDslObj().detachedPrefixFieldName().empty()) {
+        return flatUnsupportedStr("uses detached length prefix");
+    }
+
+    auto* prefix = memberPrefixField();
+    if (prefix == nullptr) {
+        prefix = externalPrefixField();
+    }
+
+    return flatPrefixUnsupportedReason(prefix, "length prefix");
+}
+
+void FlatStringField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatRefAddIncludes(memberPrefixField(), externalPrefixField(), list);
+}
+
+std::string FlatStringField::flatMembersDefImpl() const
+{
+    return flatRefDefCode(memberPrefixField(), externalPrefixField(), LengthPrefixStr);
+}
+
+std::string FlatStringField::flatValueDefImpl() const
+{
+    auto& defaultValue = stringDslObj().defaultValue();
+    if (defaultValue.empty()) {
+        return
+            "/// @brief Stored value.\n"
+            "StringView value;\n";
+    }
+
+    return
+        "/// @brief Stored value.\n"
+        "StringView value = StringView(\"" + escapedStr(defaultValue) + "\", " + std::to_string(defaultValue.size()) + "U);\n";
+}
+
+std::string FlatStringField::flatMembersSourceImpl() const
+{
+    return flatRefSourceCode(memberPrefixField());
+}
+
+std::string FlatStringField::flatReadBodyImpl() const
+{
+    auto obj = stringDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "auto es = prefix.read(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "auto count = static_cast<std::size_t>(prefix.value);\n"
+            "if (len < count) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "value = StringView(reinterpret_cast<const char*>(iter), count);\n"
+            "iter += count;\n"
+            "len -= count;\n";
+    }
+
+    if (obj.hasZeroTermSuffix()) {
+        return
+            "if (len == 0U) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "auto* term = static_cast<const std::uint8_t*>(std::memchr(iter, 0, len));\n"
+            "if (term == nullptr) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "auto count = static_cast<std::size_t>(term - iter);\n"
+            "value = StringView(reinterpret_cast<const char*>(iter), count);\n"
+            "iter += count + 1U;\n"
+            "len -= count + 1U;\n";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        static const std::string Templ =
+            "if (len < #^#LEN#$#) {\n"
+            "    return ErrorStatus::NotEnoughData;\n"
+            "}\n"
+            "\n"
+            "std::size_t count = #^#LEN#$#;\n"
+            "auto* term = static_cast<const std::uint8_t*>(std::memchr(iter, 0, count));\n"
+            "if (term != nullptr) {\n"
+            "    count = static_cast<std::size_t>(term - iter);\n"
+            "}\n"
+            "\n"
+            "value = StringView(reinterpret_cast<const char*>(iter), count);\n"
+            "iter += #^#LEN#$#;\n"
+            "len -= #^#LEN#$#;\n";
+
+        util::ReplacementMap repl = {
+            {"LEN", std::to_string(fixedLength) + 'U'},
+        };
+
+        return util::processTemplate(Templ, repl);
+    }
+
+    return
+        "value = StringView(reinterpret_cast<const char*>(iter), len);\n"
+        "iter += len;\n"
+        "len = 0U;\n";
+}
+
+std::string FlatStringField::flatWriteBodyImpl() const
+{
+    auto obj = stringDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(value.size);\n"
+            "auto es = prefix.write(iter, len);\n"
+            "if (es != ErrorStatus::Success) {\n"
+            "    return es;\n"
+            "}\n"
+            "\n"
+            "if (len < value.size) {\n"
+            "    return ErrorStatus::BufferOverflow;\n"
+            "}\n"
+            "\n"
+            "writeBytes(reinterpret_cast<const std::uint8_t*>(value.data), value.size, iter);\n"
+            "len -= value.size;\n";
+    }
+
+    if (obj.hasZeroTermSuffix()) {
+        return
+            "if (len < (value.size + 1U)) {\n"
+            "    return ErrorStatus::BufferOverflow;\n"
+            "}\n"
+            "\n"
+            "writeBytes(reinterpret_cast<const std::uint8_t*>(value.data), value.size, iter);\n"
+            "*iter = 0U;\n"
+            "++iter;\n"
+            "len -= value.size + 1U;\n";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        static const std::string Templ =
+            "if (len < #^#LEN#$#) {\n"
+            "    return ErrorStatus::BufferOverflow;\n"
+            "}\n"
+            "\n"
+            "auto count = value.size;\n"
+            "if (#^#LEN#$# < count) {\n"
+            "    count = #^#LEN#$#;\n"
+            "}\n"
+            "\n"
+            "writeBytes(reinterpret_cast<const std::uint8_t*>(value.data), count, iter);\n"
+            "for (auto idx = count; idx < #^#LEN#$#; ++idx) {\n"
+            "    *iter = 0U;\n"
+            "    ++iter;\n"
+            "}\n"
+            "\n"
+            "len -= #^#LEN#$#;\n";
+
+        util::ReplacementMap repl = {
+            {"LEN", std::to_string(fixedLength) + 'U'},
+        };
+
+        return util::processTemplate(Templ, repl);
+    }
+
+    return
+        "if (len < value.size) {\n"
+        "    return ErrorStatus::BufferOverflow;\n"
+        "}\n"
+        "\n"
+        "writeBytes(reinterpret_cast<const std::uint8_t*>(value.data), value.size, iter);\n"
+        "len -= value.size;\n";
+}
+
+std::string FlatStringField::flatLengthBodyImpl() const
+{
+    auto obj = stringDslObj();
+    if ((memberPrefixField() != nullptr) || (externalPrefixField() != nullptr)) {
+        return
+            "LengthPrefix prefix;\n"
+            "prefix.value = static_cast<LengthPrefix::ValueType>(value.size);\n"
+            "return prefix.length() + value.size;";
+    }
+
+    if (obj.hasZeroTermSuffix()) {
+        return "return value.size + 1U;";
+    }
+
+    auto fixedLength = obj.fixedLength();
+    if (fixedLength != 0U) {
+        return "return " + std::to_string(fixedLength) + "U;";
+    }
+
+    return "return value.size;";
+}
+
+} // namespace commsdsl2flat
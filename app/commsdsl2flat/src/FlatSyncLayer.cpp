@@ -0,0 +1,62 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatSyncLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatSyncLayer::FlatSyncLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+std::string FlatSyncLayer::flatUnsupportedReasonImpl() const
+{
+    auto* field = flatActualField();
+    if ((field == nullptr) || (!FlatField::cast(field)->flatIsSerValue())) {
+        return flatUnsupportedStr("uses non-integral synchronization field");
+    }
+
+    return strings::emptyString();
+}
+
+std::string FlatSyncLayer::flatReadCodeImpl() const
+{
+    static const std::string Templ =
+        "#^#READ#$#\n"
+        "if (#^#VAR#$#.serValue() != #^#TYPE#$#().serValue()) {\n"
+        "    return ErrorStatus::ProtocolError;\n"
+        "}\n";
+
+    util::ReplacementMap repl = {
+        {"READ", flatFieldReadCode()},
+        {"VAR", flatFieldVarName()},
+        {"TYPE", flatFieldTypeRef()},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,79 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatValueLayer.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+namespace
+{
+
+const std::string InfoAccessTempl =
+    "es = info.#^#VAR#$#.#^#FUNC#$#(iter, remLen);\n"
+    "if (es != ErrorStatus::Success) {\n"
+    "    return es;\n"
+    "}\n";
+
+} // namespace
+
+FlatValueLayer::FlatValueLayer(FlatGenerator& generator, commsdsl::parse::Layer dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatValueLayer::flatIsInfoMemberImpl() const
+{
+    return !valueDslObj().pseudo();
+}
+
+std::string FlatValueLayer::flatReadCodeImpl() const
+{
+    if (valueDslObj().pseudo()) {
+        return strings::emptyString();
+    }
+
+    util::ReplacementMap repl = {
+        {"VAR", flatFieldVarName()},
+        {"FUNC", "read"},
+    };
+
+    return util::processTemplate(InfoAccessTempl, repl);
+}
+
+std::string FlatValueLayer::flatWriteCodeImpl() const
+{
+    if (valueDslObj().pseudo()) {
+        return strings::emptyString();
+    }
+
+    util::ReplacementMap repl = {
+        {"VAR", flatFieldVarName()},
+        {"FUNC", "write"},
+    };
+
+    return util::processTemplate(InfoAccessTempl, repl);
+}
+
+} // namespace commsdsl2flat
@@ -0,0 +1,223 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FlatVariantField.h"
+
+#include "FlatGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2flat
+{
+
+FlatVariantField::FlatVariantField(FlatGenerator& generator, commsdsl::parse::Field dslObj, commsdsl::gen::Elem* parent) :
+    Base(generator, dslObj, parent),
+    FlatBase(static_cast<Base&>(*this))
+{
+}
+
+bool FlatVariantField::prepareImpl()
+{
+    if (!Base::prepareImpl()) {
+        return false;
+    }
+
+    m_members = flatTransformFieldsList(members());
+    return true;
+}
+
+bool FlatVariantField::writeImpl() const
+{
+    return flatWrite();
+}
+
+std::string FlatVariantField::flatUnsupportedReasonImpl() const
+{
+    return flatMembersUnsupportedReason(m_members);
+}
+
+void FlatVariantField::flatAddIncludesImpl(IncludesList& list) const
+{
+    flatMembersAddIncludes(m_members, list);
+}
+
+std::string FlatVariantField::flatMembersDefImpl() const
+{
+    return flatMembersDefCode(m_members);
+}
+
+std::string FlatVariantField::flatValueDefImpl() const
+{
+    static const std::string Templ =
+        "/// @brief Indices of the member fields.\n"
+        "enum class FieldIdx\n"
+        "{\n"
+        "    #^#INDICES#$#\n"
+        "    NumOfValues ///< Invalid index, no member is selected.\n"
+        "};\n"
+        "\n"
+        "#^#MEMBERS#$#\n"
+        "\n"
+        "/// @brief Index of the currently selected member.\n"
+        "FieldIdx idx = FieldIdx::#^#DEFAULT#$#;\n";
+
+    util::StringsList indices;
+    for (auto* m : m_members) {
+        indices.push_back(flatIdxStrInternal(*m) + ", ///< Index of member <b>" + m->field().name() + "</b>.");
+    }
+
+    std::string defaultStr = "NumOfValues";
+    auto defaultIdx = variantDslObj().defaultMemberIdx();
+    auto& allMembers = members();
+    if (defaultIdx < allMembers.size()) {
+        auto* defaultMember = cast(allMembers[defaultIdx].get());
+        auto iter = std::find(m_members.begin(), m_members.end(), defaultMember);
+        if (iter != m_members.end()) {
+            defaultStr = flatIdxStrInternal(*defaultMember);
+        }
+    }
+
+    util::ReplacementMap repl = {
+        {"INDICES", util::strListToString(indices, "\n", "")},
+        {"MEMBERS", flatMembersDataCode(m_members)},
+        {"DEFAULT", std::move(defaultStr)},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatVariantField::flatMembersSourceImpl() const
+{
+    return flatMembersSourceCode(m_members);
+}
+
+std::string FlatVariantField::flatReadBodyImpl() const
+{
+    if (m_members.empty()) {
+        return
+            "static_cast<void>(iter);\n"
+            "static_cast<void>(len);\n"
+            "idx = FieldIdx::NumOfValues;\n"
+            "return ErrorStatus::ProtocolError;\n";
+    }
+
+    static const std::string Templ =
+        "auto es = ErrorStatus::ProtocolError;\n"
+        "do {\n"
+        "    #^#READS#$#\n"
+        "    idx = FieldIdx::NumOfValues;\n"
+        "} while (false);\n"
+        "\n"
+        "if (es != ErrorStatus::Success) {\n"
+        "    return es;\n"
+        "}\n";
+
+    static const std::string ReadTempl =
+        "#^#DATA#$# = #^#TYPE#$#();\n"
+        "auto #^#DATA#$#Iter = iter;\n"
+        "auto #^#DATA#$#Len = len;\n"
+        "es = #^#DATA#$#.read(#^#DATA#$#Iter, #^#DATA#$#Len);\n"
+        "if (es == ErrorStatus::Success) {\n"
+        "    iter = #^#DATA#$#Iter;\n"
+        "    len = #^#DATA#$#Len;\n"
+        "    idx = FieldIdx::#^#IDX#$#;\n"
+        "    break;\n"
+        "}\n";
+
+    util::StringsList reads;
+    for (auto* m : m_members) {
+        util::ReplacementMap readRepl = {
+            {"DATA", m->flatDataName()},
+            {"TYPE", m->flatTypeName()},
+            {"IDX", flatIdxStrInternal(*m)},
+        };
+
+        reads.push_back(util::processTemplate(ReadTempl, readRepl));
+    }
+
+    util::ReplacementMap repl = {
+        {"READS", util::strListToString(reads, "\n", "")},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string FlatVariantField::flatWriteBodyImpl() const
+{
+    return flatSwitchInternal("return #^#DATA#$#.write(iter, len);", "static_cast<void>(iter);\nstatic_cast<void>(len);");
+}
+
+std::string FlatVariantField::flatLengthBodyImpl() const
+{
+    return flatSwitchInternal("return #^#DATA#$#.length();", "return 0U;");
+}
+
+std::string FlatVariantField::flatValidBodyImpl() const
+{
+    return flatSwitchInternal("return #^#DATA#$#.valid();", "return false;");
+}
+
+std::string FlatVariantField::flatIdxStrInternal(const FlatField& member) const
+{
+    return comms::accessName(member.field().name());
+}
+
+std::string FlatVariantField::flatSwitchInternal(const std::string& memberExpr, const std::string& defaultExpr) const
+{
+    static const std::string Templ =
+        "switch (idx) {\n"
+        "#^#CASES#$#\n"
+        "default:\n"
+        "    break;\n"
+        "}\n"
+        "\n"
+        "#^#DEFAULT#$#";
+
+    static const std::string CaseTempl =
+        "case FieldIdx::#^#IDX#$#:\n"
+        "    #^#EXPR#$#";
+
+    util::StringsList cases;
+    for (auto* m : m_members) {
+        util::ReplacementMap exprRepl = {
+            {"DATA", m->flatDataName()},
+        };
+
+        util::ReplacementMap repl = {
+            {"IDX", flatIdxStrInternal(*m)},
+            {"EXPR", util::processTemplate(memberExpr, exprRepl)},
+        };
+
+        cases.push_back(util::processTemplate(CaseTempl, repl));
+    }
+
+    util::ReplacementMap repl = {
+        {"CASES", util::strListToString(cases, "\n", "")},
+        {"DEFAULT", defaultExpr},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl2flat
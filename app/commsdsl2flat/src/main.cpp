@@ -0,0 +1,189 @@
+//
+// Copyright 2023 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/version.h"
+#include "commsdsl/gen/FileWatcher.h"
+#include "commsdsl/gen/util.h"
+
+#include "FlatGenerator.h"
+#include "FlatProgramOptions.h"
+
+#include <stdexcept>
+#include <iostream>
+#include <cassert>
+#include <fstream>
+
+namespace commsdsl2flat
+{
+
+std::vector<std::string> getFilesList(
+    const std::string& fileName,
+    const std::string& prefix)
+{
+    std::vector<std::string> result;
+    do {
+        if (fileName.empty()) {
+            break;
+        }
+        
+        std::ifstream stream(fileName);
+        if (!stream) {
+            break;
+        }
+        
+        std::string contents(std::istreambuf_iterator<char>(stream), (std::istreambuf_iterator<char>()));
+
+        result = commsdsl::gen::util::strSplitByAnyChar(contents, "\r\n");
+        if (prefix.empty()) {
+            break;
+        }
+
+        for (auto& f : result) {
+            f = commsdsl::gen::util::pathAddElem(prefix, f);
+        }
+    } while (false);
+    return result;
+}
+
+int generate(FlatGenerator& generator, const FlatProgramOptions& options)
+{
+    auto& logger = generator.logger();
+
+    if (options.quietRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+    }
+
+    if (options.warnAsErrRequested()) {
+        logger.setWarnAsError();
+    }
+
+    if (options.listOutputsRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+        generator.setDryRun();
+    }
+
+    generator.setSkipUnchangedFiles(options.watchRequested());
+    generator.setSelectedMessages(options.getSelectedMessages());
+    generator.setSelectedFrames(options.getSelectedFrames());
+
+    if (options.hasNamespaceOverride()) {
+        generator.setNamespaceOverride(options.getNamespace());
+    }
+
+    generator.setOutputDir(options.getOutputDirectory());
+
+    auto& outputTar = options.getOutputTar();
+    if (!outputTar.empty()) {
+        generator.setOutputSink(std::make_unique<commsdsl::gen::TarOutputSink>(outputTar, generator.getOutputDir()));
+    }
+
+    generator.setCodeDir(options.getCodeInputDirectory());
+    generator.setMultipleSchemasEnabled(options.multipleSchemasEnabled());
+    generator.flatSetListCapacity(options.getListCapacity());
+
+    auto files = getFilesList(options.getFilesListFile(), options.getFilesListPrefix());
+    auto otherFiles = options.getFiles();
+    files.insert(files.end(), otherFiles.begin(), otherFiles.end());
+
+    if (files.empty()) {
+        logger.error("No input files are provided");
+        return -1;
+    }
+
+    auto& traceJsonFile = options.getTraceJsonFile();
+    if (options.statsRequested() || (!traceJsonFile.empty())) {
+        generator.stats().setEnabled();
+    }
+
+    if (!generator.prepare(files)) {
+        return -1;
+    }
+
+    if (!generator.write()) {
+        return -1;
+    }
+
+    if (options.listOutputsRequested()) {
+        auto outputs = generator.outputFiles();
+        for (auto& f : outputs) {
+            std::cout << f << '\n';
+        }
+    }
+
+    auto& depfile = options.getDepfile();
+    if ((!depfile.empty()) && (!generator.writeDepfile(depfile))) {
+        return -1;
+    }
+
+    if (options.statsRequested()) {
+        std::cout << generator.stats().summary();
+    }
+
+    if ((!traceJsonFile.empty()) && (!generator.stats().writeTraceJson(traceJsonFile))) {
+        logger.error("Failed to write \"" + traceJsonFile + "\"");
+        return -1;
+    }
+    
+    return 0;
+}
+
+} // namespace commsdsl2flat
+int main(int argc, const char* argv[])
+{
+    try {
+        commsdsl2flat::FlatProgramOptions options;
+        options.parse(argc, argv);
+        if (options.helpRequested()) {
+            std::cout << "Usage:\n\t" << argv[0] << " [OPTIONS] schema_file1 [schema_file2] [schema_file3] ...\n\n";
+            std::cout << options.helpStr();
+            return 0;
+        }
+
+        if (options.versionRequested()) {
+            std::cout << 
+                commsdsl::versionMajor() << '.' << 
+                commsdsl::versionMinor() << '.' <<
+                commsdsl::versionPatch() << std::endl;
+            return 0;
+        }        
+
+        commsdsl::gen::FileWatcher watcher;
+        while (true) {
+            commsdsl2flat::FlatGenerator generator;
+            auto result = commsdsl2flat::generate(generator, options);
+            if (!options.watchRequested()) {
+                return result;
+            }
+
+            auto inputFiles = generator.inputFiles();
+            if (inputFiles.empty()) {
+                return result;
+            }
+
+            watcher.watch(inputFiles);
+            std::cout << "Watching " << inputFiles.size() << " input files for changes..." << std::endl;
+            auto changedFiles = watcher.waitForChanges();
+            for (auto& f : changedFiles) {
+                std::cout << "Detected change in " << f << std::endl;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Unhandled exception: " << e.what() << std::endl;
+        assert(false);
+    }
+
+    return -1;
+}
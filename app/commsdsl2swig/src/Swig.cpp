@@ -32,7 +32,6 @@
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -53,48 +52,32 @@ bool Swig::swigWriteInternal()
     auto swigName = swigFileNameInternal();
     auto filePath = util::pathAddElem(m_generator.getOutputDir(), swigName);
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
-
-    do {
-        auto replaceFile = util::readFileContents(m_generator.swigInputCodePathForFile(swigName + strings::replaceFileSuffixStr()));
-        if (!replaceFile.empty()) {
-            stream << replaceFile;
-            break;
-        }
-
-        const std::string Templ = 
-            "%module(directors=\"1\") #^#NS#$#\n\n"
-            "#^#LANG_DEFS#$#\n"
-            "#^#PREPEND#$#\n"
-            "#^#CODE#$#\n"
-            "#^#DEF#$#\n"
-            "#^#APPEND#$#\n"
-            ;      
-
-        util::ReplacementMap repl = {
-            {"NS", m_generator.protocolSchema().mainNamespace()},
-            {"LANG_DEFS", swigLangDefsInternal()},
-            {"CODE", swigCodeBlockInternal()},
-            {"DEF", swigDefInternal()},
-            {"PREPEND", swigPrependInternal()},
-            {"APPEND", swigAppendInternal()},
-        };
-
-        auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-        stream << str;
-    } while (false);
 
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
+    auto replaceFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(swigName + strings::replaceFileSuffixStr()));
+    if (!replaceFile.empty()) {
+        return m_generator.writeFile(filePath, replaceFile);
     }
 
-    return true;
+    const std::string Templ = 
+        "%module(directors=\"1\") #^#NS#$#\n\n"
+        "#^#LANG_DEFS#$#\n"
+        "#^#PREPEND#$#\n"
+        "#^#CODE#$#\n"
+        "#^#DEF#$#\n"
+        "#^#APPEND#$#\n"
+        ;      
+
+    util::ReplacementMap repl = {
+        {"NS", m_generator.protocolSchema().mainNamespace()},
+        {"LANG_DEFS", swigLangDefsInternal()},
+        {"CODE", swigCodeBlockInternal()},
+        {"DEF", swigDefInternal()},
+        {"PREPEND", swigPrependInternal()},
+        {"APPEND", swigAppendInternal()},
+    };
+
+    auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
+    return m_generator.writeFile(filePath, str);
 }
 
 std::string Swig::swigCodeBlockInternal()
@@ -231,7 +214,7 @@ std::string Swig::swigLangDefsInternal() const
 std::string Swig::swigPrependInternal() const
 {
     auto swigName = swigFileNameInternal();
-    auto fromFile = util::readFileContents(m_generator.swigInputCodePathForFile(swigName + strings::prependFileSuffixStr()));
+    auto fromFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(swigName + strings::prependFileSuffixStr()));
     if (!fromFile.empty()) {
         return fromFile;
     }
@@ -250,7 +233,7 @@ std::string Swig::swigPrependInternal() const
 std::string Swig::swigAppendInternal() const
 {
     auto swigName = swigFileNameInternal();
-    auto fromFile = util::readFileContents(m_generator.swigInputCodePathForFile(swigName + strings::appendFileSuffixStr()));
+    auto fromFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(swigName + strings::appendFileSuffixStr()));
     if (!fromFile.empty()) {
         return fromFile;
     }
@@ -21,7 +21,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -45,11 +44,6 @@ bool SwigCmake::swigWriteInternal() const
     }       
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }     
 
     const std::string Templ = 
         "cmake_minimum_required (VERSION 3.12)\n"
@@ -108,20 +102,13 @@ bool SwigCmake::swigWriteInternal() const
     };
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write " + filePath + ".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 std::string SwigCmake::swigPrependInternal() const
 {
     auto& name = strings::cmakeListsFileStr();
-    auto fromFile = util::readFileContents(m_generator.swigInputCodePathForFile(name + strings::prependFileSuffixStr()));
+    auto fromFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(name + strings::prependFileSuffixStr()));
     if (!fromFile.empty()) {
         return fromFile;
     }
@@ -141,7 +128,7 @@ std::string SwigCmake::swigPrependLangInternal() const
 {
     auto& name = strings::cmakeListsFileStr();
     std::string langSuffix(strings::prependFileSuffixStr() + "_lang");
-    auto fromFile = util::readFileContents(m_generator.swigInputCodePathForFile(name + langSuffix));
+    auto fromFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(name + langSuffix));
     if (!fromFile.empty()) {
         return fromFile;
     }
@@ -161,7 +148,7 @@ std::string SwigCmake::swigAppendInternal() const
 {
     auto& name = strings::cmakeListsFileStr();
     auto& suffix = strings::appendFileSuffixStr();
-    auto fromFile = util::readFileContents(m_generator.swigInputCodePathForFile(name + suffix));
+    auto fromFile = m_generator.readCodeFile(m_generator.swigInputCodePathForFile(name + suffix));
     if (!fromFile.empty()) {
         return fromFile;
     }
@@ -27,7 +27,6 @@
 
 #include <cassert>
 #include <algorithm>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -204,12 +203,6 @@ bool SwigField::swigWrite() const
     auto& logger = generator.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -221,9 +214,7 @@ bool SwigField::swigWrite() const
         {"DEF", swigClassDecl()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();    
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string SwigField::swigMembersDeclImpl() const
@@ -391,7 +382,7 @@ std::string SwigField::swigClassDeclInternal() const
 
     if (comms::isGlobalField(m_field)) {
         repl["CUSTOM"] = 
-            util::readFileContents(generator.swigInputCodePathFor(m_field) + strings::publicFileSuffixStr());
+            generator.readCodeFile(generator.swigInputCodePathFor(m_field) + strings::publicFileSuffixStr());
     }
 
     return util::processTemplate(Templ, repl);
@@ -432,9 +423,9 @@ std::string SwigField::swigClassCodeInternal() const
 {
     auto& gen = SwigGenerator::cast(m_field.generator());
 
-    std::string publicCode = util::readFileContents(gen.swigInputCodePathFor(m_field) + strings::publicFileSuffixStr());
-    std::string protectedCode = util::readFileContents(gen.swigInputCodePathFor(m_field) + strings::protectedFileSuffixStr());
-    std::string privateCode = util::readFileContents(gen.swigInputCodePathFor(m_field) + strings::privateFileSuffixStr());
+    std::string publicCode = gen.readCodeFile(gen.swigInputCodePathFor(m_field) + strings::publicFileSuffixStr());
+    std::string protectedCode = gen.readCodeFile(gen.swigInputCodePathFor(m_field) + strings::protectedFileSuffixStr());
+    std::string privateCode = gen.readCodeFile(gen.swigInputCodePathFor(m_field) + strings::privateFileSuffixStr());
     std::string extraFuncs = swigExtraPublicFuncsCodeImpl();
 
     if (!protectedCode.empty()) {
@@ -29,7 +29,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -47,7 +46,7 @@ SwigFrame::~SwigFrame() = default;
 
 void SwigFrame::swigAddCodeIncludes(StringsList& list) const
 {
-    if (!m_validFrame) {
+    if ((!isReferenced()) || (!m_validFrame)) {
         return;
     }
 
@@ -56,7 +55,7 @@ void SwigFrame::swigAddCodeIncludes(StringsList& list) const
 
 void SwigFrame::swigAddCode(StringsList& list) const
 {
-    if (!m_validFrame) {
+    if ((!isReferenced()) || (!m_validFrame)) {
         return;
     }
 
@@ -70,7 +69,7 @@ void SwigFrame::swigAddCode(StringsList& list) const
 
 void SwigFrame::swigAddDef(StringsList& list) const
 {
-    if (!m_validFrame) {
+    if ((!isReferenced()) || (!m_validFrame)) {
         return;
     }
 
@@ -130,12 +129,6 @@ bool SwigFrame::writeImpl() const
     auto& logger = generator().logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -151,9 +144,7 @@ bool SwigFrame::writeImpl() const
         {"DEF", swigClassDeclInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator().writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string SwigFrame::swigLayerDeclsInternal() const
@@ -190,7 +181,7 @@ std::string SwigFrame::swigClassDeclInternal() const
         {"CLASS_NAME", gen.swigClassName(*this)},
         {"INTERFACE", gen.swigClassName(*iFace)},
         {"LAYERS", swigLayersAccDeclInternal()},
-        {"CUSTOM", util::readFileContents(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
+        {"CUSTOM", gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
         {"DATA_BUF", SwigDataBuf::swigClassName(gen)},
         {"SIZE_T", gen.swigConvertCppType("std::size_t")},
         {"HANDLER", SwigMsgHandler::swigClassName(gen)},
@@ -329,7 +320,7 @@ std::string SwigFrame::swigFrameCodeInternal() const
         {"CLASS_NAME", gen.swigClassName(*this)},
         {"INTERFACE", gen.swigClassName(*iFace)},
         {"LAYERS", swigLayersAccCodeInternal()},
-        {"CUSTOM", util::readFileContents(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
+        {"CUSTOM", gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
         {"SIZE_T", gen.swigConvertCppType("std::size_t")},
         {"COMMS_CLASS", comms::scopeFor(*this, gen)},
         {"DATA_BUF", SwigDataBuf::swigClassName(gen)},
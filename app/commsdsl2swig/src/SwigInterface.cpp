@@ -26,7 +26,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -72,9 +71,9 @@ void SwigInterface::swigAddCode(StringsList& list) const
         {"MSG_HANDLER", SwigMsgHandler::swigClassName(gen)}
     };    
 
-    std::string publicCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr());
-    std::string protectedCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::protectedFileSuffixStr());
-    std::string privateCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::privateFileSuffixStr());    
+    std::string publicCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr());
+    std::string protectedCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::protectedFileSuffixStr());
+    std::string privateCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::privateFileSuffixStr());    
 
     if (!protectedCode.empty()) {
         static const std::string TemplTmp = 
@@ -184,12 +183,6 @@ bool SwigInterface::writeImpl() const
     auto& logger = generator().logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -203,9 +196,7 @@ bool SwigInterface::writeImpl() const
         {"DEF", swigClassDeclInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return generator().writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string SwigInterface::swigFieldDeclsInternal() const
@@ -247,7 +238,7 @@ std::string SwigInterface::swigClassDeclInternal() const
     util::ReplacementMap repl = {
         {"CLASS_NAME", gen.swigClassName(*this)},
         {"FIELDS", swigFieldsAccDeclInternal()},
-        {"CUSTOM", util::readFileContents(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
+        {"CUSTOM", gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::appendFileSuffixStr())},
         {"SIZE_T", gen.swigConvertCppType("std::size_t")},
         {"MSG_ID", SwigMsgId::swigClassName(gen)},
         {"DATA_BUF", SwigDataBuf::swigClassName(gen)},
@@ -26,7 +26,6 @@
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -77,9 +76,9 @@ void SwigMessage::swigAddCode(StringsList& list) const
         repl["OPTS"] = ", " + SwigProtocolOptions::swigClassName(gen);
     }
 
-    std::string publicCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr());
-    std::string protectedCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::protectedFileSuffixStr());
-    std::string privateCode = util::readFileContents(gen.swigInputCodePathFor(*this) + strings::privateFileSuffixStr());
+    std::string publicCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr());
+    std::string protectedCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::protectedFileSuffixStr());
+    std::string privateCode = gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::privateFileSuffixStr());
 
     if (!protectedCode.empty()) {
         static const std::string TemplTmp = 
@@ -171,12 +170,6 @@ bool SwigMessage::writeImpl() const
     auto& logger = generator().logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -190,9 +183,7 @@ bool SwigMessage::writeImpl() const
         {"DEF", swigClassDeclInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();   
+    return generator().writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string SwigMessage::swigFieldDefsInternal() const
@@ -228,7 +219,7 @@ std::string SwigMessage::swigClassDeclInternal() const
         {"CLASS_NAME", gen.swigClassName(*this)},
         {"INTERFACE", gen.swigClassName(*iFace)},
         {"FIELDS", swigFieldsAccDeclInternal()},
-        {"CUSTOM", util::readFileContents(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr())},
+        {"CUSTOM", gen.readCodeFile(gen.swigInputCodePathFor(*this) + strings::publicFileSuffixStr())},
     };
 
     return util::processTemplate(Templ, repl);    
@@ -83,6 +83,12 @@ SwigProgramOptions::SwigProgramOptions()
         true)
     (ForcePlatformStr, "Support only messages applicable to specified platform. Requires protocol schema to define it.", true)        
     ;
+
+    addStatsOptions();
+    addDepfileOptions();
+    addOutputArchiveOption();
+    addWatchOption();
+    addSelectionOptions();
 }
 
 bool SwigProgramOptions::quietRequested() const
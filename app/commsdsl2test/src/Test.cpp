@@ -15,7 +15,6 @@
 
 #include "Test.h"
 
-#include <fstream>
 
 #include "TestGenerator.h"
 
@@ -49,11 +48,6 @@ bool Test::writeInputTest() const
     auto filePath = commsdsl::gen::util::pathAddElem(m_generator.getOutputDir(), testName);
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     ReplacementMap repl = {
         std::make_pair("GEN_COMMENT", m_generator.fileGeneratedComment()),
@@ -435,15 +429,7 @@ bool Test::writeInputTest() const
         "}\n\n";
 
     auto str = commsdsl::gen::util::processTemplate(Template, repl, true);
-    stream << str;
-
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
-        return false;
-    }
-
-    return true;
+    return m_generator.writeFile(filePath, str);
 }
 
 } // namespace commsdsl2test
\ No newline at end of file
@@ -21,7 +21,7 @@
 #include "commsdsl/gen/util.h"
 #include "commsdsl/gen/comms.h"
 
-#include <fstream>
+#include <algorithm>
 #include <cassert>
 
 namespace commsdsl2test
@@ -49,11 +49,6 @@ bool TestCmake::testWriteInternal() const
             m_generator.getOutputDir(), commsdsl::gen::strings::cmakeListsFileStr());    
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     std::string interfaceScope;
     auto allInterfaces = m_generator.getAllInterfaces();
@@ -67,8 +62,15 @@ bool TestCmake::testWriteInternal() const
     }
 
     auto allFrames = m_generator.getAllFrames();
-    assert(!allFrames.empty());
-    auto* firstFrame = allFrames.front();
+    auto frameIter = 
+        std::find_if(
+            allFrames.begin(), allFrames.end(),
+            [](auto* f)
+            {
+                return f->isReferenced();
+            });
+    assert(frameIter != allFrames.end());
+    auto* firstFrame = *frameIter;
     assert(!firstFrame->name().empty());
 
 
@@ -178,10 +180,7 @@ bool TestCmake::testWriteInternal() const
         "define_test(#^#PROJ_NS#$#_input_test)\n";
 
     auto str = commsdsl::gen::util::processTemplate(Template, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -33,6 +33,19 @@ namespace util = commsdsl::gen::util;
 namespace commsdsl2test
 {
 
+namespace
+{
+
+// The schema attributes used by commsdsl2comms are not reported as unexpected
+const std::string CommsExtraAttrPrefix("comms.");
+
+} // namespace
+
+TestGenerator::TestGenerator()
+{
+    addExpectedExtraPrefix(CommsExtraAttrPrefix);
+}
+
 const std::string& TestGenerator::fileGeneratedComment()
 {
     static const std::string Str =
@@ -106,36 +119,23 @@ bool TestGenerator::testWriteExtraFilesInternal() const
             return false;
         }
 
-        std::error_code ec;
-        fs::copy_file(srcPath, destPath, fs::copy_options::overwrite_existing, ec);
-        if (ec) {
-            logger().error("Failed to copy with reason: " + ec.message());
-            return false;
-        }
-
-        if (protSchema.mainNamespace() != schemaNs) {
-            // The namespace has changed
-
-            auto destStr = destPath.string();
-            std::ifstream stream(destStr);
-            if (!stream) {
-                logger().error("Failed to open " + destStr + " for modification.");
+        if (protSchema.mainNamespace() == schemaNs) {
+            if (!copyFile(srcPath.string(), destPath.string())) {
                 return false;
             }
 
-            std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
-            stream.close();
-
-            util::strReplace(content, "namespace " + schemaNs, "namespace " + protSchema.mainNamespace());
-            std::ofstream outStream(destStr, std::ios_base::trunc);
-            if (!outStream) {
-                logger().error("Failed to modify " + destStr + ".");
-                return false;
-            }
+            continue;
+        }
 
-            outStream << content;
-            logger().info("Updated " + destStr + " to have proper main namespace.");
+        // The namespace has changed
+        auto destStr = destPath.string();
+        auto content = readCodeFile(srcPath.string());
+        util::strReplace(content, "namespace " + schemaNs, "namespace " + protSchema.mainNamespace());
+        if (!writeFile(destStr, content)) {
+            return false;
         }
+
+        logger().info("Updated " + destStr + " to have proper main namespace.");
     }
     return true;
 }
@@ -23,6 +23,8 @@ namespace commsdsl2test
 class TestGenerator final : public commsdsl::gen::Generator
 {
 public:
+    TestGenerator();
+
     static const std::string& fileGeneratedComment();
 
 protected:
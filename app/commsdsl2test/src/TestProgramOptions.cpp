@@ -61,6 +61,12 @@ TestProgramOptions::TestProgramOptions()
     (FullCodeInputDirStr, "Directory with code updates.", true)
     (FullMultipleSchemasEnabledStr, "Allow having multiple schemas with different names.")    
     ;
+
+    addStatsOptions();
+    addDepfileOptions();
+    addOutputArchiveOption();
+    addWatchOption();
+    addSelectionOptions();
 }
 
 bool TestProgramOptions::quietRequested() const
@@ -16,12 +16,12 @@
 #include "ToolsQtCmake.h"
 
 #include "ToolsQtGenerator.h"
+#include "ToolsQtUnity.h"
 
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
 #include <cassert>
-#include <fstream>
 
 namespace strings = commsdsl::gen::strings;
 namespace util = commsdsl::gen::util;
@@ -51,11 +51,6 @@ bool ToolsQtCmake::testWriteInternal() const
             m_generator.getOutputDir(), strings::cmakeListsFileStr());    
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     static const std::string Template =
         "cmake_minimum_required (VERSION 3.1)\n"
@@ -69,6 +64,7 @@ bool ToolsQtCmake::testWriteInternal() const
         "cc_compile(WARN_AS_ERR)\n"
         "cc_msvc_force_warn_opt(/W4)\n\n"
         "include(GNUInstallDirs)\n\n"
+        "#^#OPTIONS#$#\n"
         "set (CORE_LIB_NAME \"#^#MAIN_NS#$#_cc_tools_qt_plugin_core\")\n\n"
         "######################################################################\n\n"
         "function (cc_plugin_core)\n"
@@ -76,6 +72,7 @@ bool ToolsQtCmake::testWriteInternal() const
         "    set (src\n"
         "        #^#CORE_FILES#$#\n"
         "    )\n\n"
+        "    #^#UNITY_SRC#$#\n"
         "    add_library (${name} STATIC ${src})\n"
         "    target_link_libraries (${name} PUBLIC cc::#^#MAIN_NS#$# cc::comms cc::cc_tools_qt Qt5::Widgets Qt5::Core)\n"
         "    target_include_directories (${name} PUBLIC ${PROJECT_SOURCE_DIR})\n"
@@ -84,6 +81,7 @@ bool ToolsQtCmake::testWriteInternal() const
         "        $<$<CXX_COMPILER_ID:GNU>:-ftemplate-depth=2048 -fconstexpr-depth=4096 -Wno-unused-local-typedefs>\n"
         "        $<$<CXX_COMPILER_ID:Clang>:-ftemplate-depth=2048 -fconstexpr-depth=4096 -Wno-unused-local-typedefs>\n"
         "    )\n\n"
+        "    #^#PCH#$#\n"
         "endfunction()\n\n"
         "######################################################################\n\n"
         "function (cc_plugin protocol has_config_widget)\n"
@@ -154,11 +152,37 @@ bool ToolsQtCmake::testWriteInternal() const
         {"MAIN_NS", m_generator.protocolSchema().mainNamespace()},
     };
 
+    util::StringsList options;
+    auto chunkFiles = ToolsQtUnity::toolsChunkFiles(m_generator);
+    if (!chunkFiles.empty()) {
+        options.push_back("option (OPT_UNITY_BUILD \"Compile the plugin core from the generated unity chunks.\" ON)");
+
+        auto unitySrc = ToolsQtUnity::toolsStandaloneSourceFiles(m_generator);
+        unitySrc.insert(unitySrc.begin(), chunkFiles.begin(), chunkFiles.end());
+
+        repl["UNITY_SRC"] = 
+            "if (OPT_UNITY_BUILD)\n"
+            "    set (src\n"
+            "        " + util::strListToString(unitySrc, "\n        ", "\n") +
+            "    )\n"
+            "endif ()\n";
+    }
+
+    if (m_generator.toolsPrecompiledHeaderEnabled()) {
+        options.push_back("option (OPT_PRECOMPILED_HEADER \"Use precompiled header when compiling the plugin core.\" ON)");
+
+        repl["PCH"] = 
+            "if (OPT_PRECOMPILED_HEADER AND (COMMAND target_precompile_headers))\n"
+            "    target_precompile_headers(${name} PRIVATE ${PROJECT_SOURCE_DIR}/" + ToolsQtUnity::toolsRelPrecompiledHeaderPath(m_generator) + ")\n"
+            "endif ()\n";
+    }
+
+    if (!options.empty()) {
+        repl["OPTIONS"] = util::strListToString(options, "\n", "\n");
+    }
+
     auto str = commsdsl::gen::util::processTemplate(Template, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
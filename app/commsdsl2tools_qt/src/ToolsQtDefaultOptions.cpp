@@ -25,7 +25,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -120,12 +119,6 @@ bool ToolsQtDefaultOptions::toolsWriteInternal() const
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -168,12 +161,12 @@ bool ToolsQtDefaultOptions::toolsWriteInternal() const
     util::ReplacementMap repl = {
         {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
         {"INCLUDES", util::strListToString(includes, "\n", "")},
-        {"EXTRA_INCLUDES", util::readFileContents(codePrefix + strings::incFileSuffixStr())},
+        {"EXTRA_INCLUDES", m_generator.readCodeFile(codePrefix + strings::incFileSuffixStr())},
         {"TOP_NS", m_generator.getTopNamespace()},
         {"PROT_NAMESPACE", m_generator.protocolSchema().mainNamespace()},
         {"NAME", strings::defaultOptionsClassStr()},
-        {"EXTEND", util::readFileContents(codePrefix + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(codePrefix + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(codePrefix + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(codePrefix + strings::appendFileSuffixStr())},
         {"OPTS_BASE", toolsBaseCodeInternal(m_generator, m_generator.schemas().size() - 1U)},
     };
 
@@ -181,9 +174,7 @@ bool ToolsQtDefaultOptions::toolsWriteInternal() const
         repl["ORIG"] = strings::origSuffixStr();
     }
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();    
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 } // namespace commsdsl2tools_qt
\ No newline at end of file
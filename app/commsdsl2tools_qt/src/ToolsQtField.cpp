@@ -24,7 +24,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -342,12 +341,6 @@ bool ToolsQtField::toolsWriteHeaderInternal() const
     auto includes = toolsHeaderIncludes();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -366,9 +359,7 @@ bool ToolsQtField::toolsWriteHeaderInternal() const
         {"DECL", toolsDeclSig()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtField::toolsWriteSrcInternal() const
@@ -382,12 +373,6 @@ bool ToolsQtField::toolsWriteSrcInternal() const
     auto includes = toolsSrcIncludes();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#include \"#^#NAME#$#.h\"\n\n"
@@ -408,9 +393,7 @@ bool ToolsQtField::toolsWriteSrcInternal() const
         {"ANONIMOUS", toolsDefAnonimousInternal()}
     };
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtField::toolsDeclSigInternal(bool defaultSerHidden) const
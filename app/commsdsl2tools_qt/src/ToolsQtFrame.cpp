@@ -28,7 +28,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <numeric>
 
@@ -156,12 +155,6 @@ bool ToolsQtFrame::toolsWriteHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -219,9 +212,7 @@ bool ToolsQtFrame::toolsWriteHeaderInternal() const
         repl["INTERFACE"] = gen.getTopNamespace() + "::" + comms::scopeFor(*defaultInterface, gen);
     }
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtFrame::toolsWriteTransportMsgHeaderInternal() const
@@ -232,12 +223,6 @@ bool ToolsQtFrame::toolsWriteTransportMsgHeaderInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -342,9 +327,7 @@ bool ToolsQtFrame::toolsWriteTransportMsgHeaderInternal() const
         repl["SEMICOLON"] = ";";
     }
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
@@ -355,12 +338,6 @@ bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
     auto& logger = gen.logger();
     logger.info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -439,7 +416,7 @@ bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
         };        
 
     auto readOverrideFile = gen.getCodeDir() + '/' + toolsTransportMessageSrcFilePathInternal() + strings::readFileSuffixStr();
-    auto readCode = util::readFileContents(readOverrideFile);
+    auto readCode = gen.readCodeFile(readOverrideFile);
 
     do {
         // Handle multiple interfaces;
@@ -527,9 +504,7 @@ bool ToolsQtFrame::toolsWriteTransportMsgSrcInternal() const
         repl["READ_IMPL_FUNC"] = std::move(readFunc);        
     } while (false);
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtFrame::toolsTransportMessageHeaderFilePathInternal() const
@@ -31,6 +31,7 @@
 #include "ToolsQtInterface.h"
 #include "ToolsQtListField.h"
 #include "ToolsQtMessage.h"
+#include "ToolsQtMessagePool.h"
 #include "ToolsQtMsgFactory.h"
 #include "ToolsQtMsgFactoryOptions.h"
 #include "ToolsQtNamespace.h"
@@ -42,6 +43,7 @@
 #include "ToolsQtSizeLayer.h"
 #include "ToolsQtStringField.h"
 #include "ToolsQtSyncLayer.h"
+#include "ToolsQtUnity.h"
 #include "ToolsQtValueLayer.h"
 #include "ToolsQtVariantField.h"
 #include "ToolsQtVersion.h"
@@ -60,8 +62,16 @@ namespace
 
 const std::string MinToolsQtVersion("4.1.0");    
 
+// The schema attributes used by commsdsl2comms are not reported as unexpected
+const std::string CommsExtraAttrPrefix("comms.");
+
 } // namespace 
 
+ToolsQtGenerator::ToolsQtGenerator()
+{
+    Base::addExpectedExtraPrefix(CommsExtraAttrPrefix);
+}
+
 const std::string& ToolsQtGenerator::toolsFileGeneratedComment()
 {
     static const std::string Str =
@@ -127,6 +137,20 @@ bool ToolsQtGenerator::toolsHasMainNamespaceInOptions() const
     return m_mainNamespaceInOptionsForced;
 }
 
+void ToolsQtGenerator::toolsAddUnityNamespaceRepl(const std::string& className, commsdsl::gen::util::ReplacementMap& repl) const
+{
+    if (!toolsUnityChunksEnabled()) {
+        return;
+    }
+
+    // The anonymous namespace helpers of different sources are merged into a single
+    // translation unit when included by the unity chunk, wrap them with unique namespace.
+    auto ns = className + "UnityDetails";
+    repl["UNITY_NS_BEGIN"] = "namespace " + ns + "\n{\n";
+    repl["UNITY_NS_END"] = "} // namespace " + ns;
+    repl["UNITY_NS"] = ns + "::";
+}
+
 const std::string& ToolsQtGenerator::toolsMinCcToolsQtVersion()
 {
     return MinToolsQtVersion;
@@ -152,7 +176,7 @@ bool ToolsQtGenerator::prepareImpl()
 
         auto allInterfaces = schema.getAllInterfaces();
         assert(!allInterfaces.empty());
-        auto allFrames = getAllFrames();
+        auto& allFrames = m_selectedFrames;
         assert(!allFrames.empty());
         auto* interfacePtr = allInterfaces.front();
         assert(interfacePtr != nullptr);
@@ -306,7 +330,9 @@ bool ToolsQtGenerator::writeImpl()
         ToolsQtMsgFactory::write(*this) &&
         ToolsQtDefaultOptions::write(*this) &&
         ToolsQtMsgFactoryOptions::write(*this) &&
-        ToolsQtVersion::write(*this);
+        ToolsQtVersion::write(*this) &&
+        ToolsQtMessagePool::write(*this) &&
+        ToolsQtUnity::write(*this);
 
     if (!result) {
         return false;
@@ -389,11 +415,22 @@ bool ToolsQtGenerator::toolsPrepareSelectedFramesInternal()
             return false;
         }
 
+        if (!frame->isReferenced()) {
+            logger().error("Selected frame \"" + fName + "\" is excluded from code generation");
+            return false;
+        }
+
         m_selectedFrames.push_back(frame);
     }
 
     if (m_selectedFrames.empty()) {
-        m_selectedFrames = getAllFrames();
+        auto allFrames = getAllFrames();
+        std::copy_if(
+            allFrames.begin(), allFrames.end(), std::back_inserter(m_selectedFrames),
+            [](auto* f)
+            {
+                return f->isReferenced();
+            });
     }
 
     return true;    
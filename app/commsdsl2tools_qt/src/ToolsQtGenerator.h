@@ -44,6 +44,8 @@ public:
     using StringsList = commsdsl::gen::util::StringsList;
     using PluginsList = std::vector<ToolsQtPluginPtr>;
 
+    ToolsQtGenerator();
+
     static const std::string& toolsFileGeneratedComment();
     void toolsSetPluginInfosList(PluginInfosList&& value)
     {
@@ -86,6 +88,53 @@ public:
     bool toolsHasMulitpleInterfaces() const;
     bool toolsHasMainNamespaceInOptions() const;
 
+    void toolsSetUnityChunksCount(unsigned value)
+    {
+        m_unityChunksCount = value;
+    }
+
+    unsigned toolsGetUnityChunksCount() const
+    {
+        return m_unityChunksCount;
+    }
+
+    bool toolsUnityChunksEnabled() const
+    {
+        return 0U < m_unityChunksCount;
+    }
+
+    void toolsSetPrecompiledHeaderEnabled(bool value)
+    {
+        m_precompiledHeaderEnabled = value;
+    }
+
+    bool toolsPrecompiledHeaderEnabled() const
+    {
+        return m_precompiledHeaderEnabled;
+    }
+
+    void toolsSetMessageImplStorageSize(unsigned value)
+    {
+        m_messageImplStorageSize = value;
+    }
+
+    unsigned toolsGetMessageImplStorageSize() const
+    {
+        return m_messageImplStorageSize;
+    }
+
+    void toolsSetPooledMessagesEnabled(bool value)
+    {
+        m_pooledMessagesEnabled = value;
+    }
+
+    bool toolsPooledMessagesEnabled() const
+    {
+        return m_pooledMessagesEnabled;
+    }
+
+    void toolsAddUnityNamespaceRepl(const std::string& className, commsdsl::gen::util::ReplacementMap& repl) const;
+
     static const std::string& toolsMinCcToolsQtVersion();
 
 protected:
@@ -128,7 +177,11 @@ private:
     PluginsList m_plugins;
     InterfacesAccessList m_selectedInterfaces;
     FramesAccessList m_selectedFrames;
+    unsigned m_unityChunksCount = 0U;
+    unsigned m_messageImplStorageSize = 0U;
     bool m_mainNamespaceInOptionsForced = false;
+    bool m_precompiledHeaderEnabled = false;
+    bool m_pooledMessagesEnabled = false;
 };
 
 } // namespace commsdsl2tools_qt
@@ -24,7 +24,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -55,12 +54,6 @@ bool writeFileInternal(
         return false;
     }      
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     auto allMessages = generator.getAllMessagesIdSorted();
     util::StringsList includes = {
         "<tuple>",
@@ -76,7 +69,7 @@ bool writeFileInternal(
 
     for (auto* m : allMessages) {
         assert(m != nullptr);
-        if (!func(*m)) {
+        if ((!m->isReferenced()) || (!func(*m))) {
             continue;
         }
 
@@ -118,9 +111,7 @@ bool writeFileInternal(
         repl["TEMPLATE_PARAM"] = "template <typename TInterface>";
     }
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 } // namespace 
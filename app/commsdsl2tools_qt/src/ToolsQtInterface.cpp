@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 
 namespace comms = commsdsl::gen::comms;
@@ -133,12 +132,6 @@ bool ToolsQtInterface::toolsWriteHeaderInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -165,9 +158,7 @@ bool ToolsQtInterface::toolsWriteHeaderInternal() const
         {"DEF", toolsHeaderCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtInterface::toolsWriteSrcInternal() const
@@ -184,12 +175,6 @@ bool ToolsQtInterface::toolsWriteSrcInternal() const
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#include \"#^#CLASS_NAME#$#.h\"\n\n"
@@ -217,9 +202,7 @@ bool ToolsQtInterface::toolsWriteSrcInternal() const
         {"INCLUDES", util::strListToString(includes, "\n", "\n")}
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtInterface::toolsHeaderCodeInternal() const
@@ -17,6 +17,7 @@
 
 #include "ToolsQtDefaultOptions.h"
 #include "ToolsQtGenerator.h"
+#include "ToolsQtMessagePool.h"
 
 #include "commsdsl/gen/comms.h"
 #include "commsdsl/gen/strings.h"
@@ -24,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <iterator>
 #include <type_traits>
 
@@ -74,7 +74,8 @@ const std::string& toolsHeaderCodeSinglePimplInterfaceTemplInternal()
         "    virtual ~#^#CLASS_NAME#$#();\n"
         "    #^#CLASS_NAME#$#& operator=(const #^#CLASS_NAME#$#& other);\n"
         "    #^#CLASS_NAME#$#& operator=(#^#CLASS_NAME#$#&&);\n"
-        "    static MsgIdParamType doGetId();\n\n"
+        "    static MsgIdParamType doGetId();\n"
+        "    #^#PUBLIC#$#\n\n"
         "protected:\n"
         "    virtual const char* nameImpl() const override;\n"
         "    virtual const QVariantList& fieldsPropertiesImpl() const override;\n"
@@ -88,7 +89,7 @@ const std::string& toolsHeaderCodeSinglePimplInterfaceTemplInternal()
         "    virtual std::size_t lengthImpl() const override;\n"
         "    virtual bool refreshImpl() override;\n\n"
         "private:\n"
-        "    std::unique_ptr<#^#CLASS_NAME#$#Impl> m_pImpl;\n"
+        "    #^#IMPL_MEMBERS#$#\n"
         "};";
 
     return Templ;
@@ -109,7 +110,8 @@ const std::string& toolsHeaderCodeSingleInterfaceWithFieldsTemplInternal()
         "    #^#CLASS_NAME#$#(#^#CLASS_NAME#$#&&) = delete;\n"
         "    virtual ~#^#CLASS_NAME#$#();\n"
         "    #^#CLASS_NAME#$#& operator=(const #^#CLASS_NAME#$#&);\n"
-        "    #^#CLASS_NAME#$#& operator=(#^#CLASS_NAME#$#&&);\n\n"
+        "    #^#CLASS_NAME#$#& operator=(#^#CLASS_NAME#$#&&);\n"
+        "    #^#PUBLIC#$#\n\n"
         "protected:\n"
         "    virtual const QVariantList& fieldsPropertiesImpl() const override;\n"
         "};";    
@@ -120,6 +122,7 @@ const std::string& toolsHeaderCodeSingleInterfaceWithFieldsTemplInternal()
 const std::string& toolsSrcCodeMultipleInterfacesTemplInternal() 
 {
     static const std::string Templ =
+        "#^#UNITY_NS_BEGIN#$#\n"
         "namespace\n"
         "{\n\n"
         "#^#FIELDS_PROPS#$#\n"
@@ -129,10 +132,11 @@ const std::string& toolsSrcCodeMultipleInterfacesTemplInternal()
         "    #^#PROPS_APPENDS#$#\n"
         "    return props;\n"
         "}\n\n"
-        "} // namespace\n\n"
+        "} // namespace\n"
+        "#^#UNITY_NS_END#$#\n\n"
         "const QVariantList& #^#CLASS_NAME#$#Fields::props()\n"
         "{\n"
-        "    static const QVariantList Props = createProps();\n"
+        "    static const QVariantList Props = #^#UNITY_NS#$#createProps();\n"
         "    return Props;\n"
         "}";    
     return Templ;
@@ -141,6 +145,7 @@ const std::string& toolsSrcCodeMultipleInterfacesTemplInternal()
 const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal() 
 {
     static const std::string Templ = 
+        "#^#UNITY_NS_BEGIN#$#\n"
         "namespace\n"
         "{\n\n"
         "#^#FIELDS_PROPS#$#\n"
@@ -150,7 +155,8 @@ const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal()
         "    #^#PROPS_APPENDS#$#\n"
         "    return props;\n"
         "}\n\n"
-        "} // namespace\n\n"
+        "} // namespace\n"
+        "#^#UNITY_NS_END#$#\n\n"
         "class #^#CLASS_NAME#$#Impl : public\n"
         "    cc_tools_qt::ProtocolMessageBase<\n"
         "        ::#^#PROT_MESSAGE#$#<#^#TOP_NS#$#::#^#INTERFACE#$#, #^#DEF_OPTIONS#$#>,\n"
@@ -167,12 +173,12 @@ const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal()
         "protected:\n"
         "    virtual const QVariantList& fieldsPropertiesImpl() const override\n"
         "    {\n"
-        "        static const QVariantList Props = createProps();\n"
+        "        static const QVariantList Props = #^#UNITY_NS#$#createProps();\n"
         "        return Props;\n"
         "    }\n"
         "};\n\n"
-        "#^#CLASS_NAME#$#::#^#CLASS_NAME#$#() : m_pImpl(new #^#CLASS_NAME#$#Impl) {}\n"
-        "#^#CLASS_NAME#$#::~#^#CLASS_NAME#$#() = default;\n\n"
+        "#^#IMPL_LIFETIME#$#\n\n"
+        "#^#POOL_FUNCS#$#\n"
         "#^#CLASS_NAME#$#& #^#CLASS_NAME#$#::operator=(const #^#CLASS_NAME#$#& other)\n"
         "{\n"
         "    *m_pImpl = *other.m_pImpl;\n"
@@ -189,7 +195,7 @@ const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal()
         "}\n\n"
         "const char* #^#CLASS_NAME#$#::nameImpl() const\n"
         "{\n"
-        "    return static_cast<const cc_tools_qt::Message*>(m_pImpl.get())->name();\n"
+        "    return static_cast<const cc_tools_qt::Message*>(#^#IMPL_PTR#$#)->name();\n"
         "}\n\n"
         "const QVariantList& #^#CLASS_NAME#$#::fieldsPropertiesImpl() const\n"
         "{\n"
@@ -197,7 +203,7 @@ const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal()
         "}\n\n"
         "void #^#CLASS_NAME#$#::dispatchImpl(cc_tools_qt::MessageHandler& handler)\n"
         "{\n"
-        "    static_cast<cc_tools_qt::Message*>(m_pImpl.get())->dispatch(handler);\n"
+        "    static_cast<cc_tools_qt::Message*>(#^#IMPL_PTR#$#)->dispatch(handler);\n"
         "}\n\n"
         "void #^#CLASS_NAME#$#::resetImpl()\n"
         "{\n"
@@ -242,6 +248,7 @@ const std::string& toolsSrcCodeSinglePimplInterfaceTemplInternal()
 const std::string& toolsSrcCodeSingleInterfaceWithFieldsInternal()
 {
     static const std::string Templ =
+        "#^#UNITY_NS_BEGIN#$#\n"
         "namespace\n"
         "{\n\n"
         "#^#FIELDS_PROPS#$#\n"
@@ -251,14 +258,16 @@ const std::string& toolsSrcCodeSingleInterfaceWithFieldsInternal()
         "    #^#PROPS_APPENDS#$#\n"
         "    return props;\n"
         "}\n\n"
-        "} // namespace\n\n"
+        "} // namespace\n"
+        "#^#UNITY_NS_END#$#\n\n"
         "#^#CLASS_NAME#$#::#^#CLASS_NAME#$#() = default;\n"
         "#^#CLASS_NAME#$#::~#^#CLASS_NAME#$#() = default;\n"
         "#^#CLASS_NAME#$#& #^#CLASS_NAME#$#::operator=(const #^#CLASS_NAME#$#&) = default;\n"
         "#^#CLASS_NAME#$#& #^#CLASS_NAME#$#::operator=(#^#CLASS_NAME#$#&&) = default;\n\n"
+        "#^#POOL_FUNCS#$#\n"
         "const QVariantList& #^#CLASS_NAME#$#::fieldsPropertiesImpl() const\n"
         "{\n"
-        "    static const QVariantList Props = createProps();\n"
+        "    static const QVariantList Props = #^#UNITY_NS#$#createProps();\n"
         "    return Props;\n"
         "}";    
     return Templ;
@@ -323,12 +332,6 @@ bool ToolsQtMessage::toolsWriteHeaderInternal() const
     auto includes = toolsHeaderIncludesInternal();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -347,9 +350,7 @@ bool ToolsQtMessage::toolsWriteHeaderInternal() const
         {"DEF", toolsHeaderCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtMessage::toolsWriteSrcInternal() const
@@ -363,12 +364,6 @@ bool ToolsQtMessage::toolsWriteSrcInternal() const
     auto includes = toolsSrcIncludesInternal();
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -388,9 +383,7 @@ bool ToolsQtMessage::toolsWriteSrcInternal() const
         {"DEF", toolsSrcCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return gen.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtMessage::toolsRelPathInternal() const
@@ -432,8 +425,9 @@ ToolsQtMessage::IncludesList ToolsQtMessage::toolsHeaderIncludesSinglePimplInter
     assert(!interfaces.empty());
     auto* defaultInterface = static_cast<const ToolsQtInterface*>(interfaces.front());
     assert(defaultInterface != nullptr);
+    auto& gen = ToolsQtGenerator::cast(generator());
     return IncludesList {
-        "<memory>",
+        (0U < gen.toolsGetMessageImplStorageSize()) ? "<cstddef>" : "<memory>",
         "<QtCore/QVariantList>",
         defaultInterface->toolsHeaderFilePath()
     };
@@ -481,6 +475,27 @@ std::string ToolsQtMessage::toolsHeaderCodeInternal() const
         {"DEF_OPTIONS", ToolsQtDefaultOptions::toolsScope(gen)},
     };
 
+    util::StringsList publicDecls;
+    if (gen.toolsPooledMessagesEnabled()) {
+        publicDecls.push_back("static void* operator new(std::size_t size);");
+        publicDecls.push_back("static void operator delete(void* ptr, std::size_t size);");
+    }
+
+    auto className = comms::className(dslObj().name());
+    auto implStorageSize = gen.toolsGetMessageImplStorageSize();
+    if (codeType == CodeType_SinglePimplInterface) {
+        if (0U < implStorageSize) {
+            publicDecls.push_back("static const std::size_t ImplSize;");
+            repl["IMPL_MEMBERS"] = 
+                "alignas(std::max_align_t) unsigned char m_implStorage[" + std::to_string(implStorageSize) + "];\n" +
+                className + "Impl* m_pImpl = nullptr;";
+        }
+        else {
+            repl["IMPL_MEMBERS"] = "std::unique_ptr<" + className + "Impl> m_pImpl;";
+        }
+    }
+
+    repl["PUBLIC"] = util::strListToString(publicDecls, "\n", "");
     return util::processTemplate(func(), repl);
 }
 
@@ -517,19 +532,37 @@ ToolsQtMessage::IncludesList ToolsQtMessage::toolsSrcIncludesMultipleInterfacesI
 
 ToolsQtMessage::IncludesList ToolsQtMessage::toolsSrcIncludesSinglePimplInterfaceInternal() const
 {
-    return IncludesList {
+    auto& gen = ToolsQtGenerator::cast(generator());
+    IncludesList result = {
         "cc_tools_qt/property/field.h",
         "cc_tools_qt/ProtocolMessageBase.h",
-        comms::relHeaderPathFor(*this, generator()),
-        ToolsQtDefaultOptions::toolsRelHeaderPath(static_cast<const ToolsQtGenerator&>(generator())),
+        comms::relHeaderPathFor(*this, gen),
+        ToolsQtDefaultOptions::toolsRelHeaderPath(gen),
     };
+
+    if (0U < gen.toolsGetMessageImplStorageSize()) {
+        result.push_back("<new>");
+    }
+
+    if (gen.toolsPooledMessagesEnabled()) {
+        result.push_back(ToolsQtMessagePool::toolsRelHeaderPath(gen));
+    }
+
+    return result;
 }
 
 ToolsQtMessage::IncludesList ToolsQtMessage::toolsSrcIncludesSingleInterfaceWithFieldsInternal() const
 {
-    return IncludesList {
+    IncludesList result = {
         "cc_tools_qt/property/field.h"
     };
+
+    auto& gen = ToolsQtGenerator::cast(generator());
+    if (gen.toolsPooledMessagesEnabled()) {
+        result.push_back(ToolsQtMessagePool::toolsRelHeaderPath(gen));
+    }
+
+    return result;
 }
 
 std::string ToolsQtMessage::toolsSrcCodeInternal() const
@@ -575,6 +608,45 @@ std::string ToolsQtMessage::toolsSrcCodeInternal() const
         {"PROPS_APPENDS", util::strListToString(appends, "\n", "")}
     };
 
+    auto className = repl["CLASS_NAME"];
+    if (gen.toolsPooledMessagesEnabled()) {
+        auto poolScope = ToolsQtMessagePool::toolsClassScope(gen) + "<sizeof(" + className + ")>";
+        repl["POOL_FUNCS"] = 
+            "void* " + className + "::operator new(std::size_t size)\n"
+            "{\n"
+            "    return " + poolScope + "::alloc(size);\n"
+            "}\n\n"
+            "void " + className + "::operator delete(void* ptr, std::size_t size)\n"
+            "{\n"
+            "    " + poolScope + "::free(ptr, size);\n"
+            "}\n";
+    }
+
+    if (0U < gen.toolsGetMessageImplStorageSize()) {
+        auto implName = className + "Impl";
+        repl["IMPL_PTR"] = "m_pImpl";
+        repl["IMPL_LIFETIME"] = 
+            "const std::size_t " + className + "::ImplSize = sizeof(" + implName + ");\n\n" +
+            className + "::" + className + "()\n"
+            "{\n"
+            "    static_assert(ImplSize <= sizeof(m_implStorage),\n"
+            "        \"The " + implName + " doesn't fit into the inline storage, increase the --message-impl-storage value to at least " + className + "::ImplSize\");\n"
+            "    static_assert(alignof(" + implName + ") <= alignof(std::max_align_t), \"Unexpected alignment of " + implName + "\");\n"
+            "    m_pImpl = new (&m_implStorage[0]) " + implName + ";\n"
+            "}\n\n" +
+            className + "::~" + className + "()\n"
+            "{\n"
+            "    m_pImpl->~" + implName + "();\n"
+            "}";
+    }
+    else {
+        repl["IMPL_PTR"] = "m_pImpl.get()";
+        repl["IMPL_LIFETIME"] = 
+            className + "::" + className + "() : m_pImpl(new " + className + "Impl) {}\n" +
+            className + "::~" + className + "() = default;";
+    }
+
+    gen.toolsAddUnityNamespaceRepl(className, repl);
     return util::processTemplate(func(), repl);    
 }
 
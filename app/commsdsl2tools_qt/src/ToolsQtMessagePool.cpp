@@ -0,0 +1,151 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ToolsQtMessagePool.h"
+
+#include "ToolsQtGenerator.h"
+
+#include "commsdsl/gen/comms.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <cassert>
+
+namespace comms = commsdsl::gen::comms;
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2tools_qt
+{
+
+namespace 
+{
+
+const std::string ClassNameStr("MessagePool");
+
+} // namespace 
+
+bool ToolsQtMessagePool::write(ToolsQtGenerator& generator)
+{
+    ToolsQtMessagePool obj(generator);
+    return obj.writeInternal();
+}
+
+std::string ToolsQtMessagePool::toolsRelHeaderPath(const ToolsQtGenerator& generator)
+{
+    return 
+        generator.getTopNamespace() + '/' + 
+        util::strReplace(comms::scopeForRoot(ClassNameStr, generator), "::", "/") + 
+        strings::cppHeaderSuffixStr();
+}
+
+std::string ToolsQtMessagePool::toolsClassScope(const ToolsQtGenerator& generator)
+{
+    return generator.getTopNamespace() + "::" + comms::scopeForRoot(ClassNameStr, generator);
+}
+
+bool ToolsQtMessagePool::writeInternal() const
+{
+    if (!m_generator.toolsPooledMessagesEnabled()) {
+        return true;
+    }
+
+    auto filePath = m_generator.getOutputDir() + '/' + toolsRelHeaderPath(m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    const std::string Templ = 
+        "#^#GENERATED#$#\n"
+        "#pragma once\n\n"
+        "#include <cstddef>\n"
+        "#include <mutex>\n"
+        "#include <new>\n\n"
+        "namespace #^#TOP_NS#$#\n"
+        "{\n\n"        
+        "namespace #^#PROT_NAMESPACE#$#\n"
+        "{\n\n"
+        "/// @brief Pool of the released message objects memory of the same size.\n"
+        "/// @details The released memory blocks are kept in the intrusive free list\n"
+        "///     and reused by the following allocations of the same size. The\n"
+        "///     memory is never returned to the heap.\n"
+        "template <std::size_t TSize>\n"
+        "class #^#CLASS_NAME#$#\n"
+        "{\n"
+        "    static_assert(sizeof(void*) <= TSize, \"The pooled objects are too small\");\n\n"
+        "public:\n"
+        "    static void* alloc(std::size_t size)\n"
+        "    {\n"
+        "        if (size != TSize) {\n"
+        "            return ::operator new(size);\n"
+        "        }\n\n"
+        "        auto& inst = instance();\n"
+        "        std::lock_guard<std::mutex> guard(inst.m_lock);\n"
+        "        if (inst.m_free == nullptr) {\n"
+        "            return ::operator new(size);\n"
+        "        }\n\n"
+        "        auto* block = inst.m_free;\n"
+        "        inst.m_free = block->m_next;\n"
+        "        return block;\n"
+        "    }\n\n"
+        "    static void free(void* ptr, std::size_t size) noexcept\n"
+        "    {\n"
+        "        if (ptr == nullptr) {\n"
+        "            return;\n"
+        "        }\n\n"
+        "        if (size != TSize) {\n"
+        "            ::operator delete(ptr);\n"
+        "            return;\n"
+        "        }\n\n"
+        "        auto& inst = instance();\n"
+        "        std::lock_guard<std::mutex> guard(inst.m_lock);\n"
+        "        auto* block = new (ptr) FreeBlock;\n"
+        "        block->m_next = inst.m_free;\n"
+        "        inst.m_free = block;\n"
+        "    }\n\n"
+        "private:\n"
+        "    struct FreeBlock\n"
+        "    {\n"
+        "        FreeBlock* m_next = nullptr;\n"
+        "    };\n\n"
+        "    #^#CLASS_NAME#$#() = default;\n\n"
+        "    static #^#CLASS_NAME#$#& instance()\n"
+        "    {\n"
+        "        // Intentionally never destructed, the messages may be released\n"
+        "        // during the static objects destruction.\n"
+        "        static #^#CLASS_NAME#$#* Inst = new #^#CLASS_NAME#$#;\n"
+        "        return *Inst;\n"
+        "    }\n\n"
+        "    std::mutex m_lock;\n"
+        "    FreeBlock* m_free = nullptr;\n"
+        "};\n\n"
+        "} // namespace #^#PROT_NAMESPACE#$#\n\n"
+        "} // namespace #^#TOP_NS#$#\n";
+
+    util::ReplacementMap repl = {
+        {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
+        {"TOP_NS", m_generator.getTopNamespace()},
+        {"PROT_NAMESPACE", m_generator.protocolSchema().mainNamespace()},
+        {"CLASS_NAME", ClassNameStr},
+    };        
+    
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+} // namespace commsdsl2tools_qt
@@ -25,7 +25,6 @@
 
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -107,6 +106,10 @@ MessagesMap toolsCreateMessagesMapInternal(const ToolsQtGenerator& generator)
 
     auto allMessages = generator.getAllMessagesIdSorted();
     for (auto* m : allMessages) {
+        if (!m->isReferenced()) {
+            continue;
+        }
+
         mappedMessages[m->dslObj().id()].push_back(m);
     }  
 
@@ -343,12 +346,6 @@ bool ToolsQtMsgFactory::toolsWriteHeaderInternal() const
 
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -373,9 +370,7 @@ bool ToolsQtMsgFactory::toolsWriteHeaderInternal() const
         {"DEF", toolsHeaderCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtMsgFactory::toolsWriteSourceInternal() const
@@ -407,12 +402,6 @@ bool ToolsQtMsgFactory::toolsWriteSourceInternal() const
 
     comms::prepareIncludeStatement(includes);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        logger.error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ = 
         "#^#GENERATED#$#\n"
         "\n"
@@ -437,9 +426,7 @@ bool ToolsQtMsgFactory::toolsWriteSourceInternal() const
         {"CODE", toolsSourceCodeInternal()},
     };
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();    
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 bool ToolsQtMsgFactory::toolsHasUniqueIdsInternal() const
@@ -27,7 +27,6 @@
 #include <algorithm>
 #include <cassert>
 #include <functional>
-#include <fstream>
 
 namespace comms = commsdsl::gen::comms;
 namespace strings = commsdsl::gen::strings;
@@ -78,12 +77,6 @@ bool ToolsQtMsgFactoryOptions::toolsWriteInternal() const
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }    
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "/// @file\n"
@@ -121,12 +114,12 @@ bool ToolsQtMsgFactoryOptions::toolsWriteInternal() const
     util::ReplacementMap repl = {
         {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
         {"INCLUDES", util::strListToString(includes, "\n", "")},
-        {"EXTRA_INCLUDES", util::readFileContents(codePrefix + strings::incFileSuffixStr())},
+        {"EXTRA_INCLUDES", m_generator.readCodeFile(codePrefix + strings::incFileSuffixStr())},
         {"TOP_NS", m_generator.getTopNamespace()},
         {"PROT_NAMESPACE", m_generator.protocolSchema().mainNamespace()},
         {"NAME", ClassName},
-        {"EXTEND", util::readFileContents(codePrefix + strings::extendFileSuffixStr())},
-        {"APPEND", util::readFileContents(codePrefix + strings::appendFileSuffixStr())},
+        {"EXTEND", m_generator.readCodeFile(codePrefix + strings::extendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(codePrefix + strings::appendFileSuffixStr())},
         {"DEFAULT_OPTS", ToolsQtDefaultOptions::toolsScope(m_generator)},
         {"MSG_FACTORY", ToolsQtMsgFactory::toolsClassScope(m_generator)},
         {"CODE", toolsOptionsCodeInternal()},
@@ -140,9 +133,7 @@ bool ToolsQtMsgFactoryOptions::toolsWriteInternal() const
         repl["INTERFACE_TEMPL"] = "<TInterface>";
     }
 
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-    return stream.good();    
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
 }
 
 std::string ToolsQtMsgFactoryOptions::toolsOptionsCodeInternal() const
@@ -62,6 +62,10 @@ ToolsQtNamespace::StringsList ToolsQtNamespace::toolsSourceFiles() const
 
     for (auto& mPtr : messages()) {
         assert(mPtr);
+        if (!mPtr->isReferenced()) {
+            continue;
+        }
+
         auto* toolsMessage = static_cast<const ToolsQtMessage*>(mPtr.get());
         assert(toolsMessage != nullptr);
         addToResult(toolsMessage->toolsSourceFiles());
@@ -92,6 +96,10 @@ std::string ToolsQtNamespace::toolsMsgFactoryOptions() const
     util::StringsList frameElems;
     for (auto& fPtr : frames()) {
         assert(fPtr);
+        if (!fPtr->isReferenced()) {
+            continue;
+        }
+
         auto opts = ToolsQtFrame::cast(fPtr.get())->toolsMsgFactoryOptions();
         if (opts.empty()) {
             continue;
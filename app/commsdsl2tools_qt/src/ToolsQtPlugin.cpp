@@ -21,7 +21,6 @@
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
-#include <fstream>
 #include <cassert>
 
 namespace comms = commsdsl::gen::comms;
@@ -89,12 +88,6 @@ bool ToolsQtPlugin::toolsWriteProtocolHeaderInternal()
         return false;
     }
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -148,10 +141,7 @@ bool ToolsQtPlugin::toolsWriteProtocolHeaderInternal()
     }         
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -166,12 +156,6 @@ bool ToolsQtPlugin::toolsWriteProtocolSrcInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#CLASS_NAME#$#.h\"\n\n"
@@ -416,10 +400,7 @@ bool ToolsQtPlugin::toolsWriteProtocolSrcInternal()
     }
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -434,12 +415,6 @@ bool ToolsQtPlugin::toolsWritePluginHeaderInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -484,10 +459,7 @@ bool ToolsQtPlugin::toolsWritePluginHeaderInternal()
     }
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -502,12 +474,6 @@ bool ToolsQtPlugin::toolsWritePluginSrcInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#CLASS_NAME#$#.h\"\n\n"
@@ -570,10 +536,7 @@ bool ToolsQtPlugin::toolsWritePluginSrcInternal()
     }
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -588,12 +551,6 @@ bool ToolsQtPlugin::toolsWritePluginJsonInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "{\n"
         "    \"name\" : \"#^#NAME#$#\",\n"
@@ -616,10 +573,7 @@ bool ToolsQtPlugin::toolsWritePluginJsonInternal()
     };        
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -635,12 +589,6 @@ bool ToolsQtPlugin::toolsWritePluginConfigInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "{\n"
         "    \"cc_plugins_list\": [\n"
@@ -654,10 +602,7 @@ bool ToolsQtPlugin::toolsWritePluginConfigInternal()
     };        
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -676,12 +621,6 @@ bool ToolsQtPlugin::toolsWriteConfigWidgetHeaderInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#pragma once\n\n"
@@ -722,10 +661,7 @@ bool ToolsQtPlugin::toolsWriteConfigWidgetHeaderInternal()
     };        
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -744,12 +680,6 @@ bool ToolsQtPlugin::toolsWriteConfigWidgetSrcInternal()
 
     m_generator.logger().info("Generating " + filePath);
 
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
-
     static const std::string Templ =
         "#^#GENERATED#$#\n"
         "#include \"#^#CLASS_NAME#$#.h\"\n\n"
@@ -803,10 +733,7 @@ bool ToolsQtPlugin::toolsWriteConfigWidgetSrcInternal()
     };        
 
     auto str = commsdsl::gen::util::processTemplate(Templ, repl, true);
-    stream << str;
-    stream.flush();
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, str)) {
         return false;
     }
     
@@ -48,6 +48,10 @@ const std::string ProtocolStr("protocol");
 const std::string MultipleSchemasEnabledStr("multiple-schemas-enabled");
 const std::string FullMultipleSchemasEnabledStr("s," + MultipleSchemasEnabledStr);
 const std::string ForceMainNamespaceInOptionsStr("force-main-ns-in-options");
+const std::string UnityChunksStr("unity-chunks");
+const std::string PrecompiledHeaderStr("precompiled-header");
+const std::string MessageImplStorageStr("message-impl-storage");
+const std::string PooledMessagesStr("pooled-messages");
 
 
 } // namespace
@@ -75,7 +79,23 @@ ToolsQtProgramOptions::ToolsQtProgramOptions()
         "defined in the schema.", true)    
     (FullMultipleSchemasEnabledStr, "Allow having multiple schemas with different names.")            
     (ForceMainNamespaceInOptionsStr, "Force having main namespace struct in generated options.")
+    (UnityChunksStr, 
+        "Number of unity (jumbo) source chunks to group the generated field and message sources of "
+        "the plugin core library into. The sources are distributed between the chunks by their estimated "
+        "compilation cost. Defaults to 0, which disables the unity chunks generation.", true)
+    (PrecompiledHeaderStr, "Generate precompiled header with common COMMS/Qt includes for the plugin core library.")
+    (MessageImplStorageStr, 
+        "Size in bytes of the inline storage for the hidden message implementation object, used instead "
+        "of its separate heap allocation. The generated code fails to compile when an implementation object does not fit. "
+        "Defaults to 0, which disables the inline storage.", true)
+    (PooledMessagesStr, "Reuse memory of the released message objects when allocating new ones.")
     ;
+
+    addStatsOptions();
+    addDepfileOptions();
+    addOutputArchiveOption();
+    addWatchOption();
+    addSelectionOptions();
 }
 
 bool ToolsQtProgramOptions::quietRequested() const
@@ -168,5 +188,33 @@ bool ToolsQtProgramOptions::isMainNamespaceInOptionsForced() const
     return isOptUsed(ForceMainNamespaceInOptionsStr);
 }
 
+unsigned ToolsQtProgramOptions::getUnityChunksCount() const
+{
+    if (!isOptUsed(UnityChunksStr)) {
+        return 0U;
+    }
+
+    return util::strToUnsigned(value(UnityChunksStr));
+}
+
+bool ToolsQtProgramOptions::precompiledHeaderRequested() const
+{
+    return isOptUsed(PrecompiledHeaderStr);
+}
+
+unsigned ToolsQtProgramOptions::getMessageImplStorageSize() const
+{
+    if (!isOptUsed(MessageImplStorageStr)) {
+        return 0U;
+    }
+
+    return util::strToUnsigned(value(MessageImplStorageStr));
+}
+
+bool ToolsQtProgramOptions::pooledMessagesRequested() const
+{
+    return isOptUsed(PooledMessagesStr);
+}
+
 
 } // namespace commsdsl2tools_qt
@@ -52,6 +52,10 @@ public:
     PluginInfosList getPlugins() const;
     bool multipleSchemasEnabled() const;
     bool isMainNamespaceInOptionsForced() const;
+    unsigned getUnityChunksCount() const;
+    bool precompiledHeaderRequested() const;
+    unsigned getMessageImplStorageSize() const;
+    bool pooledMessagesRequested() const;
 };
 
 } // namespace commsdsl2tools_qt
\ No newline at end of file
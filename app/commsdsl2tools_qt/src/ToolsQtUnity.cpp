@@ -0,0 +1,344 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ToolsQtUnity.h"
+
+#include "ToolsQtField.h"
+#include "ToolsQtGenerator.h"
+#include "ToolsQtMessage.h"
+
+#include "commsdsl/gen/BitfieldField.h"
+#include "commsdsl/gen/BundleField.h"
+#include "commsdsl/gen/ListField.h"
+#include "commsdsl/gen/OptionalField.h"
+#include "commsdsl/gen/RefField.h"
+#include "commsdsl/gen/VariantField.h"
+#include "commsdsl/gen/strings.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <set>
+
+namespace strings = commsdsl::gen::strings;
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl2tools_qt
+{
+
+namespace
+{
+
+const std::string UnityDirStr("unity");
+const std::string ChunkFilePrefixStr("Chunk");
+const std::string PrecompiledHeaderNameStr("Precompiled");
+
+// Every message definition instantiates the message class, the fields tuple
+// as well as the cc_tools_qt message base on top of its fields.
+const unsigned MessageBaseWeight = 4U;
+
+unsigned fieldWeight(const commsdsl::gen::Field* field);
+
+unsigned fieldsListWeight(const commsdsl::gen::Field::FieldsList& fields)
+{
+    return
+        std::accumulate(
+            fields.begin(), fields.end(), 0U,
+            [](unsigned soFar, auto& fPtr)
+            {
+                return soFar + fieldWeight(fPtr.get());
+            });
+}
+
+unsigned fieldWeight(const commsdsl::gen::Field* field)
+{
+    if (field == nullptr) {
+        return 0U;
+    }
+
+    using Kind = commsdsl::parse::Field::Kind;
+    auto kind = field->dslObj().kind();
+    if (kind == Kind::Bitfield) {
+        return 1U + fieldsListWeight(static_cast<const commsdsl::gen::BitfieldField*>(field)->members());
+    }
+
+    if (kind == Kind::Bundle) {
+        return 1U + fieldsListWeight(static_cast<const commsdsl::gen::BundleField*>(field)->members());
+    }
+
+    if (kind == Kind::Variant) {
+        return 1U + fieldsListWeight(static_cast<const commsdsl::gen::VariantField*>(field)->members());
+    }
+
+    if (kind == Kind::List) {
+        auto* listField = static_cast<const commsdsl::gen::ListField*>(field);
+        auto* elemField = listField->memberElementField();
+        if (elemField == nullptr) {
+            elemField = listField->externalElementField();
+        }
+
+        return 1U + fieldWeight(elemField);
+    }
+
+    if (kind == Kind::Optional) {
+        auto* optField = static_cast<const commsdsl::gen::OptionalField*>(field);
+        auto* wrappedField = optField->memberField();
+        if (wrappedField == nullptr) {
+            wrappedField = optField->externalField();
+        }
+
+        return 1U + fieldWeight(wrappedField);
+    }
+
+    if (kind == Kind::Ref) {
+        return fieldWeight(static_cast<const commsdsl::gen::RefField*>(field)->referencedField());
+    }
+
+    return 1U;
+}
+
+} // namespace
+
+bool ToolsQtUnity::write(ToolsQtGenerator& generator)
+{
+    ToolsQtUnity obj(generator);
+    return
+        obj.writeChunksInternal() &&
+        obj.writePrecompiledHeaderInternal();
+}
+
+ToolsQtUnity::StringsList ToolsQtUnity::toolsChunkFiles(const ToolsQtGenerator& generator)
+{
+    StringsList result;
+    auto chunks = toolsChunksInternal(generator);
+    result.reserve(chunks.size());
+    for (auto idx = 0U; idx < chunks.size(); ++idx) {
+        result.push_back(toolsRelChunkPathInternal(generator, idx));
+    }
+
+    return result;
+}
+
+ToolsQtUnity::StringsList ToolsQtUnity::toolsStandaloneSourceFiles(const ToolsQtGenerator& generator)
+{
+    auto unitySources = toolsUnitySourcesInternal(generator);
+    std::set<std::string> chunked;
+    for (auto& s : unitySources) {
+        chunked.insert(s.m_file);
+    }
+
+    auto result = generator.toolsSourceFiles();
+    result.erase(
+        std::remove_if(
+            result.begin(), result.end(),
+            [&chunked](const std::string& file)
+            {
+                return chunked.find(file) != chunked.end();
+            }),
+        result.end());
+    return result;
+}
+
+std::string ToolsQtUnity::toolsRelPrecompiledHeaderPath(const ToolsQtGenerator& generator)
+{
+    return
+        generator.getTopNamespace() + '/' + generator.protocolSchema().mainNamespace() + '/' +
+        PrecompiledHeaderNameStr + strings::cppHeaderSuffixStr();
+}
+
+bool ToolsQtUnity::writeChunksInternal() const
+{
+    auto chunks = toolsChunksInternal(m_generator);
+    if (chunks.empty()) {
+        return true;
+    }
+
+    auto dirPath = util::pathUp(m_generator.getOutputDir() + '/' + toolsRelChunkPathInternal(m_generator, 0U));
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "// Unity chunk of the plugin core sources, estimated weight: #^#WEIGHT#$#\n\n"
+        "#^#INCLUDES#$#\n";
+
+    auto unitySources = toolsUnitySourcesInternal(m_generator);
+    for (auto idx = 0U; idx < chunks.size(); ++idx) {
+        auto filePath = m_generator.getOutputDir() + '/' + toolsRelChunkPathInternal(m_generator, idx);
+        m_generator.logger().info("Generating " + filePath);
+
+        auto& chunk = chunks[idx];
+        unsigned weight = 0U;
+        util::StringsList includes;
+        includes.reserve(chunk.size());
+        for (auto& f : chunk) {
+            auto iter =
+                std::find_if(
+                    unitySources.begin(), unitySources.end(),
+                    [&f](auto& s)
+                    {
+                        return s.m_file == f;
+                    });
+            assert(iter != unitySources.end());
+            weight += iter->m_weight;
+            includes.push_back("#include \"" + f + '\"');
+        }
+
+        util::ReplacementMap repl = {
+            {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
+            {"WEIGHT", std::to_string(weight)},
+            {"INCLUDES", util::strListToString(includes, "\n", "")},
+        };
+
+        if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ToolsQtUnity::writePrecompiledHeaderInternal() const
+{
+    if (!m_generator.toolsPrecompiledHeaderEnabled()) {
+        return true;
+    }
+
+    auto filePath = m_generator.getOutputDir() + '/' + toolsRelPrecompiledHeaderPath(m_generator);
+    m_generator.logger().info("Generating " + filePath);
+
+    auto dirPath = util::pathUp(filePath);
+    assert(!dirPath.empty());
+    if (!m_generator.createDirectory(dirPath)) {
+        return false;
+    }
+
+    static const std::string Templ =
+        "#^#GENERATED#$#\n"
+        "#pragma once\n\n"
+        "#include <cassert>\n"
+        "#include <memory>\n"
+        "#include <tuple>\n\n"
+        "#include <QtCore/QVariantList>\n"
+        "#include <QtCore/QVariantMap>\n\n"
+        "#include \"comms/comms.h\"\n"
+        "#include \"cc_tools_qt/MessageBase.h\"\n"
+        "#include \"cc_tools_qt/ProtocolMessageBase.h\"\n"
+        "#include \"cc_tools_qt/TransportMessageBase.h\"\n"
+        "#include \"cc_tools_qt/property/field.h\"\n";
+
+    util::ReplacementMap repl = {
+        {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
+    };
+
+    return m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true));
+}
+
+ToolsQtUnity::UnitySourcesList ToolsQtUnity::toolsUnitySourcesInternal(const ToolsQtGenerator& generator)
+{
+    UnitySourcesList result;
+    if (!generator.toolsUnityChunksEnabled()) {
+        return result;
+    }
+
+    // Only the global fields and messages are grouped, the interfaces, frames and
+    // message factories instantiate all the messages and are kept standalone.
+    for (auto& s : generator.schemas()) {
+        for (auto& nsPtr : s->namespaces()) {
+            assert(nsPtr);
+            for (auto& fPtr : nsPtr->fields()) {
+                assert(fPtr);
+                auto* toolsField = dynamic_cast<const ToolsQtField*>(fPtr.get());
+                assert(toolsField != nullptr);
+                auto files = toolsField->toolsSourceFiles();
+                for (auto& f : files) {
+                    result.push_back(UnitySource{std::move(f), fieldWeight(fPtr.get())});
+                }
+            }
+
+            for (auto& mPtr : nsPtr->messages()) {
+                assert(mPtr);
+                if (!mPtr->isReferenced()) {
+                    continue;
+                }
+
+                auto weight = MessageBaseWeight + fieldsListWeight(mPtr->fields());
+                auto files = static_cast<const ToolsQtMessage*>(mPtr.get())->toolsSourceFiles();
+                for (auto& f : files) {
+                    result.push_back(UnitySource{std::move(f), weight});
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+ToolsQtUnity::ChunksList ToolsQtUnity::toolsChunksInternal(const ToolsQtGenerator& generator)
+{
+    ChunksList result;
+    auto unitySources = toolsUnitySourcesInternal(generator);
+    if (unitySources.empty()) {
+        return result;
+    }
+
+    auto chunksCount = std::min(static_cast<std::size_t>(generator.toolsGetUnityChunksCount()), unitySources.size());
+    assert(0U < chunksCount);
+
+    // Greedy longest processing time first: the heaviest remaining source
+    // goes to the currently lightest chunk.
+    std::vector<std::size_t> order(unitySources.size());
+    std::iota(order.begin(), order.end(), 0U);
+    std::stable_sort(
+        order.begin(), order.end(),
+        [&unitySources](std::size_t first, std::size_t second)
+        {
+            return unitySources[second].m_weight < unitySources[first].m_weight;
+        });
+
+    std::vector<unsigned> weights(chunksCount, 0U);
+    std::vector<std::vector<std::size_t> > members(chunksCount);
+    for (auto srcIdx : order) {
+        auto lightestIter = std::min_element(weights.begin(), weights.end());
+        auto chunkIdx = static_cast<std::size_t>(std::distance(weights.begin(), lightestIter));
+        *lightestIter += unitySources[srcIdx].m_weight;
+        members[chunkIdx].push_back(srcIdx);
+    }
+
+    result.resize(chunksCount);
+    for (auto idx = 0U; idx < chunksCount; ++idx) {
+        auto& chunkMembers = members[idx];
+        std::sort(chunkMembers.begin(), chunkMembers.end());
+        auto& chunk = result[idx];
+        chunk.reserve(chunkMembers.size());
+        for (auto srcIdx : chunkMembers) {
+            chunk.push_back(unitySources[srcIdx].m_file);
+        }
+    }
+
+    return result;
+}
+
+std::string ToolsQtUnity::toolsRelChunkPathInternal(const ToolsQtGenerator& generator, std::size_t idx)
+{
+    return
+        generator.getTopNamespace() + '/' + generator.protocolSchema().mainNamespace() + '/' +
+        UnityDirStr + '/' + ChunkFilePrefixStr + std::to_string(idx) + strings::cppSourceSuffixStr();
+}
+
+} // namespace commsdsl2tools_qt
@@ -0,0 +1,60 @@
+//
+// Copyright 2019 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/gen/util.h"
+
+#include <string>
+#include <vector>
+
+namespace commsdsl2tools_qt
+{
+
+class ToolsQtGenerator;
+class ToolsQtUnity
+{
+public:
+    using StringsList = commsdsl::gen::util::StringsList;
+
+    static bool write(ToolsQtGenerator& generator);
+
+    static StringsList toolsChunkFiles(const ToolsQtGenerator& generator);
+    static StringsList toolsStandaloneSourceFiles(const ToolsQtGenerator& generator);
+    static std::string toolsRelPrecompiledHeaderPath(const ToolsQtGenerator& generator);
+
+private:
+    struct UnitySource
+    {
+        std::string m_file;
+        unsigned m_weight = 0U;
+    };
+
+    using UnitySourcesList = std::vector<UnitySource>;
+    using ChunksList = std::vector<StringsList>;
+
+    explicit ToolsQtUnity(ToolsQtGenerator& generator) : m_generator(generator) {}
+
+    bool writeChunksInternal() const;
+    bool writePrecompiledHeaderInternal() const;
+
+    static UnitySourcesList toolsUnitySourcesInternal(const ToolsQtGenerator& generator);
+    static ChunksList toolsChunksInternal(const ToolsQtGenerator& generator);
+    static std::string toolsRelChunkPathInternal(const ToolsQtGenerator& generator, std::size_t idx);
+
+    ToolsQtGenerator& m_generator;
+};
+
+} // namespace commsdsl2tools_qt
@@ -21,7 +21,6 @@
 #include "commsdsl/gen/strings.h"
 #include "commsdsl/gen/util.h"
 
-#include <fstream>
 #include <cassert>
 
 namespace comms = commsdsl::gen::comms;
@@ -50,11 +49,6 @@ bool ToolsQtVersion::writeInternal() const
     auto filePath = m_generator.getOutputDir() + '/' + toolsRelHeaderPath(m_generator);
 
     m_generator.logger().info("Generating " + filePath);
-    std::ofstream stream(filePath);
-    if (!stream) {
-        m_generator.logger().error("Failed to open \"" + filePath + "\" for writing.");
-        return false;
-    }
 
     const std::string Templ = 
         "#^#GENERATED#$#\n"
@@ -68,14 +62,10 @@ bool ToolsQtVersion::writeInternal() const
     util::ReplacementMap repl = {
         {"GENERATED", ToolsQtGenerator::toolsFileGeneratedComment()},
         {"TOOLS_QT_MIN", util::strReplace(ToolsQtGenerator::toolsMinCcToolsQtVersion(), ".", ", ")},
-        {"APPEND", util::readFileContents(m_generator.getCodeDir() + '/' + toolsRelHeaderPath(m_generator) + strings::appendFileSuffixStr())},
+        {"APPEND", m_generator.readCodeFile(m_generator.getCodeDir() + '/' + toolsRelHeaderPath(m_generator) + strings::appendFileSuffixStr())},
     };        
     
-    stream << util::processTemplate(Templ, repl, true);
-    stream.flush();
-
-    if (!stream.good()) {
-        m_generator.logger().error("Failed to write \"" + filePath + "\".");
+    if (!m_generator.writeFile(filePath, util::processTemplate(Templ, repl, true))) {
         return false;
     }
     
@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include "commsdsl/version.h"
+#include "commsdsl/gen/FileWatcher.h"
 #include "commsdsl/gen/util.h"
 
 #include "ToolsQtGenerator.h"
@@ -56,6 +57,94 @@ std::vector<std::string> getFilesList(
     return result;
 }
 
+int generate(ToolsQtGenerator& generator, const ToolsQtProgramOptions& options)
+{
+    auto& logger = generator.logger();
+
+    if (options.quietRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+    }
+
+    if (options.warnAsErrRequested()) {
+        logger.setWarnAsError();
+    }
+
+    if (options.listOutputsRequested()) {
+        logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
+        generator.setDryRun();
+    }
+
+    generator.setSkipUnchangedFiles(options.watchRequested());
+    generator.setSelectedMessages(options.getSelectedMessages());
+    generator.setSelectedFrames(options.getSelectedFrames());
+
+    if (options.hasNamespaceOverride()) {
+        generator.setNamespaceOverride(options.getNamespace());
+    }
+
+    generator.setOutputDir(options.getOutputDirectory());
+
+    auto& outputTar = options.getOutputTar();
+    if (!outputTar.empty()) {
+        generator.setOutputSink(std::make_unique<commsdsl::gen::TarOutputSink>(outputTar, generator.getOutputDir()));
+    }
+
+    generator.setCodeDir(options.getCodeInputDirectory());
+    generator.setTopNamespace("cc_tools_qt_plugin");
+    generator.setMultipleSchemasEnabled(options.multipleSchemasEnabled());
+    generator.toolsSetPluginInfosList(options.getPlugins());
+    generator.toolsSetMainNamespaceInOptionsForced(options.isMainNamespaceInOptionsForced());
+    generator.toolsSetUnityChunksCount(options.getUnityChunksCount());
+    generator.toolsSetPrecompiledHeaderEnabled(options.precompiledHeaderRequested());
+    generator.toolsSetMessageImplStorageSize(options.getMessageImplStorageSize());
+    generator.toolsSetPooledMessagesEnabled(options.pooledMessagesRequested());
+
+    auto files = getFilesList(options.getFilesListFile(), options.getFilesListPrefix());
+    auto otherFiles = options.getFiles();
+    files.insert(files.end(), otherFiles.begin(), otherFiles.end());
+
+    if (files.empty()) {
+        logger.error("No input files are provided");
+        return -1;
+    }
+
+    auto& traceJsonFile = options.getTraceJsonFile();
+    if (options.statsRequested() || (!traceJsonFile.empty())) {
+        generator.stats().setEnabled();
+    }
+
+    if (!generator.prepare(files)) {
+        return -1;
+    }
+
+    if (!generator.write()) {
+        return -1;
+    }
+
+    if (options.listOutputsRequested()) {
+        auto outputs = generator.outputFiles();
+        for (auto& f : outputs) {
+            std::cout << f << '\n';
+        }
+    }
+
+    auto& depfile = options.getDepfile();
+    if ((!depfile.empty()) && (!generator.writeDepfile(depfile))) {
+        return -1;
+    }
+
+    if (options.statsRequested()) {
+        std::cout << generator.stats().summary();
+    }
+
+    if ((!traceJsonFile.empty()) && (!generator.stats().writeTraceJson(traceJsonFile))) {
+        logger.error("Failed to write \"" + traceJsonFile + "\"");
+        return -1;
+    }
+    
+    return 0;
+}
+
 } // namespace commsdsl2tools_qt
 int main(int argc, const char* argv[])
 {
@@ -76,46 +165,26 @@ int main(int argc, const char* argv[])
             return 0;
         }        
 
-        commsdsl2tools_qt::ToolsQtGenerator generator;
-        auto& logger = generator.logger();
-
-        if (options.quietRequested()) {
-            logger.setMinLevel(commsdsl::parse::ErrorLevel_Warning);
-        }
-
-        if (options.warnAsErrRequested()) {
-            logger.setWarnAsError();
+        commsdsl::gen::FileWatcher watcher;
+        while (true) {
+            commsdsl2tools_qt::ToolsQtGenerator generator;
+            auto result = commsdsl2tools_qt::generate(generator, options);
+            if (!options.watchRequested()) {
+                return result;
+            }
+
+            auto inputFiles = generator.inputFiles();
+            if (inputFiles.empty()) {
+                return result;
+            }
+
+            watcher.watch(inputFiles);
+            std::cout << "Watching " << inputFiles.size() << " input files for changes..." << std::endl;
+            auto changedFiles = watcher.waitForChanges();
+            for (auto& f : changedFiles) {
+                std::cout << "Detected change in " << f << std::endl;
+            }
         }
-
-        if (options.hasNamespaceOverride()) {
-            generator.setNamespaceOverride(options.getNamespace());
-        }
-
-        generator.setOutputDir(options.getOutputDirectory());
-        generator.setCodeDir(options.getCodeInputDirectory());
-        generator.setTopNamespace("cc_tools_qt_plugin");
-        generator.setMultipleSchemasEnabled(options.multipleSchemasEnabled());
-        generator.toolsSetPluginInfosList(options.getPlugins());
-        generator.toolsSetMainNamespaceInOptionsForced(options.isMainNamespaceInOptionsForced());
-
-        auto files = commsdsl2tools_qt::getFilesList(options.getFilesListFile(), options.getFilesListPrefix());
-        auto otherFiles = options.getFiles();
-        files.insert(files.end(), otherFiles.begin(), otherFiles.end());
-
-        if (files.empty()) {
-            logger.error("No input files are provided");
-            return -1;
-        }
-
-        if (!generator.prepare(files)) {
-            return -1;
-        }
-
-        if (!generator.write()) {
-            return -1;
-        }
-        
-        return 0;
     }
     catch (const std::exception& e) {
         std::cerr << "Unhandled exception: " << e.what() << std::endl;
@@ -0,0 +1,154 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchProgramOptions.h"
+
+#include "commsdsl/gen/util.h"
+
+namespace commsdsl_bench
+{
+
+namespace
+{
+
+const std::string QuietStr("quiet");
+const std::string FullQuietStr("q," + QuietStr);
+const std::string OutputDirStr("output-dir");
+const std::string FullOutputDirStr("o," + OutputDirStr);
+const std::string JsonStr("json");
+const std::string SchemasStr("schemas");
+const std::string NamespacesStr("namespaces");
+const std::string MessagesStr("messages");
+const std::string FieldsStr("fields");
+const std::string EnumSizeStr("enum-size");
+const std::string ReusePercentStr("reuse-percent");
+const std::string CopyFieldsPercentStr("copy-fields-percent");
+const std::string IterationsStr("iterations");
+const std::string BackendsStr("backends");
+const std::string FullBackendsStr("b," + BackendsStr);
+const std::string ThresholdsStr("thresholds");
+
+unsigned getUnsigned(const BenchProgramOptions& options, const std::string& optStr, unsigned minValue)
+{
+    auto result = commsdsl::gen::util::strToUnsigned(options.value(optStr));
+    if (result < minValue) {
+        return minValue;
+    }
+
+    return result;
+}
+
+BenchProgramOptions::StringsList getList(const BenchProgramOptions& options, const std::string& optStr)
+{
+    if (!options.isOptUsed(optStr)) {
+        return BenchProgramOptions::StringsList();
+    }
+
+    return commsdsl::gen::util::strSplitByAnyChar(options.value(optStr), ",");
+}
+
+} // namespace
+
+BenchProgramOptions::BenchProgramOptions()
+{
+    addHelpOption()
+    (FullQuietStr, "Quiet, do not print the results summary.")
+    (FullOutputDirStr, "Working directory for the synthesized schemas and generated code.", std::string("bench_output"))
+    (JsonStr, "Write results into the provided file in JSON format.", true)
+    (SchemasStr, "Number of schemas, the last one is the protocol schema.", std::string("1"))
+    (NamespacesStr, "Number of namespaces in every schema.", std::string("1"))
+    (MessagesStr, "Number of messages in every namespace.", std::string("100"))
+    (FieldsStr, "Number of fields in every message.", std::string("10"))
+    (EnumSizeStr, "Number of valid values of every enum field.", std::string("16"))
+    (ReusePercentStr, "Percentage of the message fields reusing the definition of a global field.", std::string("20"))
+    (CopyFieldsPercentStr, "Percentage of the messages copying fields from the previous message.", std::string("10"))
+    (IterationsStr, "Number of the in-process parse and validate iterations.", std::string("3"))
+    (FullBackendsStr,
+        "Comma separated list of paths to the code generators (commsdsl2comms, commsdsl2tools_qt, etc...) "
+        "to run on the synthesized schemas.", true)
+    (ThresholdsStr,
+        "Comma separated list of <metric>=<max> thresholds, exceeding any of them fails the run. "
+        "The metrics are \"parse\", \"validate\", \"rss_kb\" for the in-process parsing and "
+        "\"<backend>.<phase>\", \"<backend>.total\", \"<backend>.rss_kb\" for the code generators, "
+        "the durations are in milliseconds.", true)
+    ;
+}
+
+bool BenchProgramOptions::quietRequested() const
+{
+    return isOptUsed(QuietStr);
+}
+
+const std::string& BenchProgramOptions::getOutputDirectory() const
+{
+    return value(OutputDirStr);
+}
+
+const std::string& BenchProgramOptions::getJsonFile() const
+{
+    return value(JsonStr);
+}
+
+unsigned BenchProgramOptions::getSchemasCount() const
+{
+    return getUnsigned(*this, SchemasStr, 1U);
+}
+
+unsigned BenchProgramOptions::getNamespacesCount() const
+{
+    return getUnsigned(*this, NamespacesStr, 1U);
+}
+
+unsigned BenchProgramOptions::getMessagesCount() const
+{
+    return getUnsigned(*this, MessagesStr, 1U);
+}
+
+unsigned BenchProgramOptions::getFieldsCount() const
+{
+    return getUnsigned(*this, FieldsStr, 1U);
+}
+
+unsigned BenchProgramOptions::getEnumSize() const
+{
+    return getUnsigned(*this, EnumSizeStr, 1U);
+}
+
+unsigned BenchProgramOptions::getReusePercent() const
+{
+    return getUnsigned(*this, ReusePercentStr, 0U);
+}
+
+unsigned BenchProgramOptions::getCopyFieldsPercent() const
+{
+    return getUnsigned(*this, CopyFieldsPercentStr, 0U);
+}
+
+unsigned BenchProgramOptions::getIterations() const
+{
+    return getUnsigned(*this, IterationsStr, 1U);
+}
+
+BenchProgramOptions::StringsList BenchProgramOptions::getBackends() const
+{
+    return getList(*this, BackendsStr);
+}
+
+BenchProgramOptions::StringsList BenchProgramOptions::getThresholds() const
+{
+    return getList(*this, ThresholdsStr);
+}
+
+} // namespace commsdsl_bench
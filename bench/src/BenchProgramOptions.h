@@ -0,0 +1,48 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "commsdsl/gen/ProgramOptions.h"
+
+namespace commsdsl_bench
+{
+
+class BenchProgramOptions : public commsdsl::gen::ProgramOptions
+{
+public:
+    using StringsList = std::vector<std::string>;
+
+    BenchProgramOptions();
+
+    bool quietRequested() const;
+    const std::string& getOutputDirectory() const;
+    const std::string& getJsonFile() const;
+    unsigned getSchemasCount() const;
+    unsigned getNamespacesCount() const;
+    unsigned getMessagesCount() const;
+    unsigned getFieldsCount() const;
+    unsigned getEnumSize() const;
+    unsigned getReusePercent() const;
+    unsigned getCopyFieldsPercent() const;
+    unsigned getIterations() const;
+    StringsList getBackends() const;
+    StringsList getThresholds() const;
+};
+
+} // namespace commsdsl_bench
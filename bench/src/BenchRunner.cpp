@@ -0,0 +1,372 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchRunner.h"
+
+#include "commsdsl/parse/Protocol.h"
+#include "commsdsl/gen/util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // #ifndef _WIN32
+
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl_bench
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+const std::string ParseStr("parse");
+const std::string ValidateStr("validate");
+const std::string TotalStr("total");
+const std::string RssStr("rss_kb");
+
+double durationMs(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+#ifndef _WIN32
+double maxRssKb(const struct rusage& usage)
+{
+    auto value = static_cast<double>(usage.ru_maxrss);
+#ifdef __APPLE__
+    value /= 1024.0; // Reported in bytes
+#endif
+    return value;
+}
+#endif // #ifndef _WIN32
+
+struct ProcessResult
+{
+    int m_exitCode = -1;
+    double m_durationMs = 0.0;
+    double m_rssKb = 0.0;
+};
+
+ProcessResult runProcess(const std::vector<std::string>& args, const std::string& logFile)
+{
+    assert(!args.empty());
+    ProcessResult result;
+    auto start = Clock::now();
+
+#ifdef _WIN32
+    std::string cmd;
+    for (auto& a : args) {
+        cmd += '\"' + a + "\" ";
+    }
+
+    cmd += "> \"" + logFile + "\" 2>&1";
+    result.m_exitCode = std::system(cmd.c_str());
+#else
+    std::vector<char*> argv;
+    argv.reserve(args.size() + 1U);
+    for (auto& a : args) {
+        argv.push_back(const_cast<char*>(a.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    auto pid = ::fork();
+    if (pid < 0) {
+        return result;
+    }
+
+    if (pid == 0) {
+        auto fd = ::open(logFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (0 <= fd) {
+            ::dup2(fd, STDOUT_FILENO);
+            ::dup2(fd, STDERR_FILENO);
+            ::close(fd);
+        }
+
+        ::execv(argv[0], argv.data());
+        ::_exit(127);
+    }
+
+    int status = 0;
+    struct rusage usage = {};
+    if (::wait4(pid, &status, 0, &usage) < 0) {
+        return result;
+    }
+
+    if (WIFEXITED(status)) {
+        result.m_exitCode = WEXITSTATUS(status);
+    }
+
+    result.m_rssKb = maxRssKb(usage);
+#endif
+
+    result.m_durationMs = durationMs(start, Clock::now());
+    return result;
+}
+
+// Extracts the phase durations from the statistics summary printed by
+// the code generators when "--stats" option is used. Multiple entries
+// of the same phase (like parsing of multiple files) are accumulated.
+void parsePhases(const std::string& output, const std::string& prefix, BenchRunner::MetricsMap& metrics)
+{
+    static const std::string PhasesStr("Phases:");
+    static const std::string MsStr("ms");
+
+    std::istringstream stream(output);
+    std::string line;
+    bool inPhases = false;
+    while (std::getline(stream, line)) {
+        auto tokens = util::strSplitByAnyChar(line, " \t\r");
+        if (tokens.empty()) {
+            continue;
+        }
+
+        if (tokens.front() == PhasesStr) {
+            inPhases = true;
+            continue;
+        }
+
+        if (!inPhases) {
+            continue;
+        }
+
+        if ((tokens.size() < 3U) || (tokens.back() != MsStr)) {
+            inPhases = false;
+            continue;
+        }
+
+        try {
+            metrics[prefix + tokens.front()] += std::stod(tokens[tokens.size() - 2U]);
+        }
+        catch (...) {
+            inPhases = false;
+        }
+    }
+}
+
+} // namespace
+
+BenchRunner::BenchRunner(const BenchSchemaSynth::Config& config, const std::string& outputDir) :
+    m_config(config),
+    m_outputDir(outputDir)
+{
+}
+
+bool BenchRunner::run(unsigned iterations, const StringsList& backends)
+{
+    BenchSchemaSynth synth(m_config);
+    m_schemaFiles = synth.write(util::pathAddElem(m_outputDir, "schema"));
+    if (m_schemaFiles.empty()) {
+        std::cerr << "ERROR: Failed to write synthesized schema files into " << m_outputDir << std::endl;
+        return false;
+    }
+
+    if (!runParse(iterations)) {
+        return false;
+    }
+
+    return
+        std::all_of(
+            backends.begin(), backends.end(),
+            [this](const std::string& b)
+            {
+                return runBackend(b);
+            });
+}
+
+std::string BenchRunner::summary() const
+{
+    std::ostringstream stream;
+    stream << "Benchmark results:\n";
+    for (auto& m : m_metrics) {
+        stream << "    " << std::left << std::setw(50) << m.first << ' ' <<
+            std::right << std::fixed << std::setprecision(3) << std::setw(14) << m.second << '\n';
+    }
+
+    return stream.str();
+}
+
+bool BenchRunner::writeJson(const std::string& filePath) const
+{
+    std::ofstream stream(filePath);
+    if (!stream) {
+        return false;
+    }
+
+    stream << "{\n" <<
+        "  \"config\": {\n" <<
+        "    \"schemas\": " << m_config.m_schemas << ",\n" <<
+        "    \"namespaces\": " << m_config.m_namespaces << ",\n" <<
+        "    \"messages\": " << m_config.m_messages << ",\n" <<
+        "    \"fields\": " << m_config.m_fields << ",\n" <<
+        "    \"enum_size\": " << m_config.m_enumSize << ",\n" <<
+        "    \"reuse_percent\": " << m_config.m_reusePercent << ",\n" <<
+        "    \"copy_fields_percent\": " << m_config.m_copyFieldsPercent << "\n" <<
+        "  },\n" <<
+        "  \"metrics\": {";
+
+    bool first = true;
+    stream << std::fixed << std::setprecision(3);
+    for (auto& m : m_metrics) {
+        if (!first) {
+            stream << ',';
+        }
+
+        first = false;
+        stream << "\n    \"" << m.first << "\": " << m.second;
+    }
+
+    stream << "\n  }\n}\n";
+    stream.flush();
+    return stream.good();
+}
+
+BenchRunner::StringsList BenchRunner::checkThresholds(const StringsList& thresholds) const
+{
+    StringsList result;
+    for (auto& t : thresholds) {
+        auto sepPos = t.find('=');
+        if ((sepPos == std::string::npos) || (sepPos == 0U)) {
+            result.push_back("Invalid threshold \"" + t + "\"");
+            continue;
+        }
+
+        auto metric = t.substr(0, sepPos);
+        double maxValue = 0.0;
+        try {
+            maxValue = std::stod(t.substr(sepPos + 1U));
+        }
+        catch (...) {
+            result.push_back("Invalid threshold value in \"" + t + "\"");
+            continue;
+        }
+
+        auto iter = m_metrics.find(metric);
+        if (iter == m_metrics.end()) {
+            result.push_back("Unknown metric \"" + metric + "\"");
+            continue;
+        }
+
+        if (maxValue < iter->second) {
+            std::ostringstream stream;
+            stream << "Metric \"" << metric << "\" value " << std::fixed << std::setprecision(3) <<
+                iter->second << " exceeds threshold " << maxValue;
+            result.push_back(stream.str());
+        }
+    }
+
+    return result;
+}
+
+bool BenchRunner::runParse(unsigned iterations)
+{
+    auto minParse = std::numeric_limits<double>::max();
+    auto minValidate = std::numeric_limits<double>::max();
+    for (auto idx = 0U; idx < iterations; ++idx) {
+        commsdsl::parse::Protocol protocol;
+        protocol.setMultipleSchemasEnabled(1U < m_schemaFiles.size());
+
+        std::string errors;
+        protocol.setErrorReportCallback(
+            [&errors](commsdsl::parse::ErrorLevel level, const std::string& msg)
+            {
+                if (commsdsl::parse::ErrorLevel_Warning <= level) {
+                    errors += msg + '\n';
+                }
+            });
+
+        auto start = Clock::now();
+        for (auto& f : m_schemaFiles) {
+            if (!protocol.parse(f)) {
+                std::cerr << "ERROR: Failed to parse " << f << ":\n" << errors << std::flush;
+                return false;
+            }
+        }
+
+        auto parsed = Clock::now();
+        if (!protocol.validate()) {
+            std::cerr << "ERROR: Failed to validate synthesized schema:\n" << errors << std::flush;
+            return false;
+        }
+
+        auto validated = Clock::now();
+        minParse = std::min(minParse, durationMs(start, parsed));
+        minValidate = std::min(minValidate, durationMs(parsed, validated));
+    }
+
+    m_metrics[ParseStr] = minParse;
+    m_metrics[ValidateStr] = minValidate;
+
+#ifndef _WIN32
+    struct rusage usage = {};
+    if (::getrusage(RUSAGE_SELF, &usage) == 0) {
+        m_metrics[RssStr] = maxRssKb(usage);
+    }
+#endif
+
+    return true;
+}
+
+bool BenchRunner::runBackend(const std::string& backendPath)
+{
+    auto name = std::filesystem::path(backendPath).stem().string();
+    auto outDir = util::pathAddElem(m_outputDir, name);
+    auto logFile = util::pathAddElem(m_outputDir, name + ".log");
+
+    std::vector<std::string> args = {
+        backendPath,
+        "-q",
+        "--stats",
+        "-o",
+        outDir,
+    };
+
+    if (1U < m_schemaFiles.size()) {
+        args.push_back("-s");
+    }
+
+    args.insert(args.end(), m_schemaFiles.begin(), m_schemaFiles.end());
+
+    auto result = runProcess(args, logFile);
+    auto output = util::readFileContents(logFile);
+    if (result.m_exitCode != 0) {
+        std::cerr << "ERROR: " << backendPath << " failed with exit code " << result.m_exitCode << ":\n" << output << std::flush;
+        return false;
+    }
+
+    auto prefix = name + '.';
+    m_metrics[prefix + TotalStr] = result.m_durationMs;
+#ifndef _WIN32
+    m_metrics[prefix + RssStr] = result.m_rssKb;
+#endif
+    parsePhases(output, prefix, m_metrics);
+    return true;
+}
+
+} // namespace commsdsl_bench
@@ -0,0 +1,58 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "BenchSchemaSynth.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace commsdsl_bench
+{
+
+class BenchRunner
+{
+public:
+    using StringsList = std::vector<std::string>;
+    using MetricsMap = std::map<std::string, double>;
+
+    BenchRunner(const BenchSchemaSynth::Config& config, const std::string& outputDir);
+
+    bool run(unsigned iterations, const StringsList& backends);
+
+    const MetricsMap& metrics() const
+    {
+        return m_metrics;
+    }
+
+    std::string summary() const;
+    bool writeJson(const std::string& filePath) const;
+
+    // Returns list of the violation descriptions, empty if all the thresholds are met.
+    StringsList checkThresholds(const StringsList& thresholds) const;
+
+private:
+    bool runParse(unsigned iterations);
+    bool runBackend(const std::string& backendPath);
+
+    BenchSchemaSynth::Config m_config;
+    std::string m_outputDir;
+    StringsList m_schemaFiles;
+    MetricsMap m_metrics;
+};
+
+} // namespace commsdsl_bench
@@ -0,0 +1,264 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchSchemaSynth.h"
+
+#include "commsdsl/gen/util.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace util = commsdsl::gen::util;
+
+namespace commsdsl_bench
+{
+
+namespace
+{
+
+const std::string ProtocolSchemaNameStr("bench");
+const std::string MsgIdFieldStr("MsgId");
+const std::string KindFieldStr("Kind");
+const std::string ValueFieldStr("Value");
+const std::string LenFieldStr("Len");
+
+// Simple linear congruential generator, keeps the generated
+// schemas identical between runs and platforms.
+unsigned nextRandom(unsigned& seed)
+{
+    seed = (seed * 1103515245U) + 12345U;
+    return (seed / 65536U) % 32768U;
+}
+
+const std::string& enumType(unsigned valuesCount)
+{
+    static const std::string Types[] = {
+        "uint8",
+        "uint16",
+        "uint32",
+    };
+
+    if (valuesCount <= 0x100U) {
+        return Types[0];
+    }
+
+    if (valuesCount <= 0x10000U) {
+        return Types[1];
+    }
+
+    return Types[2];
+}
+
+std::string schemaName(unsigned schemaIdx, unsigned schemasCount)
+{
+    if (schemaIdx == (schemasCount - 1U)) {
+        return ProtocolSchemaNameStr;
+    }
+
+    return ProtocolSchemaNameStr + "_ext" + std::to_string(schemaIdx);
+}
+
+std::string msgIdName(unsigned nsIdx, unsigned msgIdx)
+{
+    return "M" + std::to_string(nsIdx) + '_' + std::to_string(msgIdx);
+}
+
+} // namespace
+
+BenchSchemaSynth::FilesList BenchSchemaSynth::write(const std::string& dir) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (ec) {
+        return FilesList();
+    }
+
+    FilesList result;
+    for (auto idx = 0U; idx < m_config.m_schemas; ++idx) {
+        auto filePath = util::pathAddElem(dir, "Schema" + std::to_string(idx) + ".xml");
+        std::ofstream stream(filePath);
+        if (!stream) {
+            return FilesList();
+        }
+
+        stream << schemaContents(idx);
+        stream.flush();
+        if (!stream.good()) {
+            return FilesList();
+        }
+
+        result.push_back(std::move(filePath));
+    }
+
+    return result;
+}
+
+std::string BenchSchemaSynth::schemaContents(unsigned schemaIdx) const
+{
+    static const std::string Templ =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<schema name=\"#^#NAME#$#\" endian=\"big\">\n"
+        "    <fields>\n"
+        "        <enum name=\"#^#MSG_ID#$#\" type=\"#^#MSG_ID_TYPE#$#\" semanticType=\"messageId\">\n"
+        "            #^#MSG_IDS#$#\n"
+        "        </enum>\n"
+        "        <enum name=\"#^#KIND#$#\" type=\"#^#KIND_TYPE#$#\">\n"
+        "            #^#KIND_VALUES#$#\n"
+        "        </enum>\n"
+        "        <int name=\"#^#VALUE#$#\" type=\"uint32\" />\n"
+        "        <int name=\"#^#LEN#$#\" type=\"uint8\" />\n"
+        "    </fields>\n"
+        "    <frame name=\"Frame\">\n"
+        "        <size name=\"Size\">\n"
+        "            <int name=\"SizeField\" type=\"uint16\" serOffset=\"2\" />\n"
+        "        </size>\n"
+        "        <id name=\"Id\" field=\"#^#MSG_ID#$#\" />\n"
+        "        <payload name=\"Data\" />\n"
+        "    </frame>\n"
+        "    #^#NAMESPACES#$#\n"
+        "</schema>\n";
+
+    util::StringsList msgIds;
+    msgIds.reserve(m_config.m_namespaces * m_config.m_messages);
+    for (auto nsIdx = 0U; nsIdx < m_config.m_namespaces; ++nsIdx) {
+        for (auto msgIdx = 0U; msgIdx < m_config.m_messages; ++msgIdx) {
+            auto value = (nsIdx * m_config.m_messages) + msgIdx + 1U;
+            msgIds.push_back(
+                "<validValue name=\"" + msgIdName(nsIdx, msgIdx) + "\" val=\"" + std::to_string(value) + "\" />");
+        }
+    }
+
+    util::StringsList namespaces;
+    namespaces.reserve(m_config.m_namespaces);
+    for (auto nsIdx = 0U; nsIdx < m_config.m_namespaces; ++nsIdx) {
+        namespaces.push_back(namespaceContents(nsIdx));
+    }
+
+    util::ReplacementMap repl = {
+        {"NAME", schemaName(schemaIdx, m_config.m_schemas)},
+        {"MSG_ID", MsgIdFieldStr},
+        {"MSG_ID_TYPE", enumType((m_config.m_namespaces * m_config.m_messages) + 1U)},
+        {"MSG_IDS", util::strListToString(msgIds, "\n", "")},
+        {"KIND", KindFieldStr},
+        {"KIND_TYPE", enumType(m_config.m_enumSize)},
+        {"KIND_VALUES", enumValues(m_config.m_enumSize, "K")},
+        {"VALUE", ValueFieldStr},
+        {"LEN", LenFieldStr},
+        {"NAMESPACES", util::strListToString(namespaces, "\n", "")},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string BenchSchemaSynth::enumValues(unsigned count, const std::string& prefix, unsigned startValue) const
+{
+    util::StringsList values;
+    values.reserve(count);
+    for (auto idx = 0U; idx < count; ++idx) {
+        values.push_back(
+            "<validValue name=\"" + prefix + std::to_string(idx) + "\" val=\"" + std::to_string(startValue + idx) + "\" />");
+    }
+
+    return util::strListToString(values, "\n", "");
+}
+
+std::string BenchSchemaSynth::namespaceContents(unsigned nsIdx) const
+{
+    static const std::string Templ =
+        "<ns name=\"ns#^#IDX#$#\">\n"
+        "    #^#MESSAGES#$#\n"
+        "</ns>\n";
+
+    unsigned seed = nsIdx + 1U;
+    util::StringsList messages;
+    messages.reserve(m_config.m_messages);
+    for (auto msgIdx = 0U; msgIdx < m_config.m_messages; ++msgIdx) {
+        messages.push_back(messageContents(nsIdx, msgIdx, seed));
+    }
+
+    util::ReplacementMap repl = {
+        {"IDX", std::to_string(nsIdx)},
+        {"MESSAGES", util::strListToString(messages, "\n", "")},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+std::string BenchSchemaSynth::messageContents(unsigned nsIdx, unsigned msgIdx, unsigned& seed) const
+{
+    auto name = "Msg" + std::to_string(msgIdx);
+    auto id = MsgIdFieldStr + '.' + msgIdName(nsIdx, msgIdx);
+
+    // The copied fields may come from the message which copied its fields as well,
+    // to avoid name clashes the copying messages don't define extra fields.
+    if ((0U < msgIdx) && ((nextRandom(seed) % 100U) < m_config.m_copyFieldsPercent)) {
+        return
+            "<message name=\"" + name + "\" id=\"" + id + "\" copyFieldsFrom=\"ns" +
+            std::to_string(nsIdx) + ".Msg" + std::to_string(msgIdx - 1U) + "\" />";
+    }
+
+    util::StringsList fields;
+    fields.reserve(m_config.m_fields);
+    for (auto fieldIdx = 0U; fieldIdx < m_config.m_fields; ++fieldIdx) {
+        auto fieldName = "F" + std::to_string(fieldIdx);
+        if ((nextRandom(seed) % 100U) < m_config.m_reusePercent) {
+            if ((fieldIdx % 2U) == 0U) {
+                fields.push_back("<int name=\"" + fieldName + "\" reuse=\"" + ValueFieldStr + "\" />");
+                continue;
+            }
+
+            fields.push_back("<ref name=\"" + fieldName + "\" field=\"" + KindFieldStr + "\" />");
+            continue;
+        }
+
+        auto kind = nextRandom(seed) % 4U;
+        if (kind == 0U) {
+            fields.push_back(
+                "<int name=\"" + fieldName + "\" type=\"uint16\" defaultValue=\"" + std::to_string(fieldIdx) + "\" />");
+            continue;
+        }
+
+        if (kind == 1U) {
+            fields.push_back(
+                "<enum name=\"" + fieldName + "\" type=\"" + enumType(m_config.m_enumSize) + "\">\n" +
+                "    " + util::strReplace(enumValues(m_config.m_enumSize, "V"), "\n", "\n    ") + '\n' +
+                "</enum>");
+            continue;
+        }
+
+        if (kind == 2U) {
+            fields.push_back("<string name=\"" + fieldName + "\" lengthPrefix=\"" + LenFieldStr + "\" />");
+            continue;
+        }
+
+        fields.push_back(
+            "<list name=\"" + fieldName + "\" element=\"" + ValueFieldStr + "\" countPrefix=\"" + LenFieldStr + "\" />");
+    }
+
+    static const std::string Templ =
+        "<message name=\"#^#NAME#$#\" id=\"#^#ID#$#\">\n"
+        "    #^#FIELDS#$#\n"
+        "</message>";
+
+    util::ReplacementMap repl = {
+        {"NAME", std::move(name)},
+        {"ID", std::move(id)},
+        {"FIELDS", util::strListToString(fields, "\n", "")},
+    };
+
+    return util::processTemplate(Templ, repl);
+}
+
+} // namespace commsdsl_bench
@@ -0,0 +1,57 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace commsdsl_bench
+{
+
+// Generates deterministic synthetic schemas of configurable size.
+class BenchSchemaSynth
+{
+public:
+    using FilesList = std::vector<std::string>;
+
+    struct Config
+    {
+        unsigned m_schemas = 1U;
+        unsigned m_namespaces = 1U;
+        unsigned m_messages = 100U;
+        unsigned m_fields = 10U;
+        unsigned m_enumSize = 16U;
+        unsigned m_reusePercent = 20U;
+        unsigned m_copyFieldsPercent = 10U;
+    };
+
+    explicit BenchSchemaSynth(const Config& config) : m_config(config) {}
+
+    // Writes the schema files into the provided directory, returns the list
+    // of written files or empty list on failure.
+    FilesList write(const std::string& dir) const;
+
+    std::string schemaContents(unsigned schemaIdx) const;
+
+private:
+    std::string enumValues(unsigned count, const std::string& prefix, unsigned startValue = 0U) const;
+    std::string namespaceContents(unsigned nsIdx) const;
+    std::string messageContents(unsigned nsIdx, unsigned msgIdx, unsigned& seed) const;
+
+    Config m_config;
+};
+
+} // namespace commsdsl_bench
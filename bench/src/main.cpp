@@ -0,0 +1,75 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BenchProgramOptions.h"
+#include "BenchRunner.h"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+int main(int argc, const char* argv[])
+{
+    try {
+        commsdsl_bench::BenchProgramOptions options;
+        options.parse(argc, argv);
+        if (options.helpRequested()) {
+            std::cout << "Usage:\n\t" << argv[0] << " [OPTIONS]\n\n";
+            std::cout << options.helpStr();
+            return 0;
+        }
+
+        commsdsl_bench::BenchSchemaSynth::Config config;
+        config.m_schemas = options.getSchemasCount();
+        config.m_namespaces = options.getNamespacesCount();
+        config.m_messages = options.getMessagesCount();
+        config.m_fields = options.getFieldsCount();
+        config.m_enumSize = options.getEnumSize();
+        config.m_reusePercent = options.getReusePercent();
+        config.m_copyFieldsPercent = options.getCopyFieldsPercent();
+
+        commsdsl_bench::BenchRunner runner(config, options.getOutputDirectory());
+        if (!runner.run(options.getIterations(), options.getBackends())) {
+            return -1;
+        }
+
+        if (!options.quietRequested()) {
+            std::cout << runner.summary();
+        }
+
+        auto& jsonFile = options.getJsonFile();
+        if ((!jsonFile.empty()) && (!runner.writeJson(jsonFile))) {
+            std::cerr << "ERROR: Failed to write \"" << jsonFile << "\"" << std::endl;
+            return -1;
+        }
+
+        auto violations = runner.checkThresholds(options.getThresholds());
+        if (!violations.empty()) {
+            for (auto& v : violations) {
+                std::cerr << "ERROR: " << v << std::endl;
+            }
+
+            return -1;
+        }
+
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Unhandled exception: " << e.what() << std::endl;
+        assert(false);
+    }
+
+    return -1;
+}
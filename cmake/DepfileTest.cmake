@@ -0,0 +1,99 @@
+# Verifies the dependency file produced by the "--depfile" option
+# is consumable by make.
+#
+# GENERATOR - Path to the code generator executable
+# SCHEMA - Schema file
+# CODE_INPUT_DIR - (optional) Directory with the code input files
+# WORK_DIR - Working directory
+# MAKE_PROGRAM - Path to make executable
+
+foreach (p GENERATOR SCHEMA WORK_DIR MAKE_PROGRAM)
+    if ("${${p}}" STREQUAL "")
+        message (FATAL_ERROR "${p} is not provided")
+    endif ()
+endforeach ()
+
+file (REMOVE_RECURSE "${WORK_DIR}")
+file (MAKE_DIRECTORY "${WORK_DIR}")
+
+set (code_input_param)
+if (NOT "${CODE_INPUT_DIR}" STREQUAL "")
+    # Copy the code input directory to be able to add files to it
+    file (COPY "${CODE_INPUT_DIR}/" DESTINATION "${WORK_DIR}/src")
+    set (code_input_param -c "${WORK_DIR}/src")
+endif ()
+
+set (depfile "${WORK_DIR}/output.d")
+execute_process (
+    COMMAND "${GENERATOR}" -q -o "${WORK_DIR}/output" ${code_input_param} --depfile "${depfile}" "${SCHEMA}"
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message (FATAL_ERROR "Code generation failed")
+endif ()
+
+file (READ "${depfile}" contents)
+string (REPLACE "\\\n" "" contents "${contents}")
+string (FIND "${contents}" ":" sep_pos)
+math (EXPR prereq_pos "${sep_pos} + 1")
+string (SUBSTRING "${contents}" ${prereq_pos} -1 prereqs)
+string (STRIP "${prereqs}" prereqs)
+string (REGEX REPLACE "[ \t\n]+" ";" prereqs "${prereqs}")
+string (SUBSTRING "${contents}" 0 ${sep_pos} targets)
+string (REGEX REPLACE "[ \t\n]+" ";" targets "${targets}")
+list (GET targets 0 first_target)
+
+set (dirs)
+foreach (p ${prereqs})
+    if (NOT EXISTS "${p}")
+        message (FATAL_ERROR "Non existing prerequisite: ${p}")
+    endif ()
+
+    if (IS_DIRECTORY "${p}")
+        list (APPEND dirs "${p}")
+    endif ()
+endforeach ()
+
+if ((NOT "${CODE_INPUT_DIR}" STREQUAL "") AND ("${dirs}" STREQUAL ""))
+    message (FATAL_ERROR "No code input directories are listed")
+endif ()
+
+if (("${CODE_INPUT_DIR}" STREQUAL "") AND (NOT "${dirs}" STREQUAL ""))
+    message (FATAL_ERROR "Unexpected directories are listed: ${dirs}")
+endif ()
+
+file (WRITE "${WORK_DIR}/Makefile"
+    "include ${depfile}\n"
+    "${first_target}:\n"
+    "\t@echo Regenerating\n"
+)
+
+execute_process (
+    COMMAND "${MAKE_PROGRAM}" -q -f "${WORK_DIR}/Makefile"
+    WORKING_DIRECTORY "${WORK_DIR}"
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 0)
+    message (FATAL_ERROR "The generated files are expected to be up to date")
+endif ()
+
+if ("${dirs}" STREQUAL "")
+    return ()
+endif ()
+
+# Adding a new code input file is expected to trigger re-generation
+list (GET dirs 0 dir)
+execute_process (COMMAND ${CMAKE_COMMAND} -E sleep 1)
+file (WRITE "${dir}/New.h" "")
+
+execute_process (
+    COMMAND "${MAKE_PROGRAM}" -q -f "${WORK_DIR}/Makefile"
+    WORKING_DIRECTORY "${WORK_DIR}"
+    RESULT_VARIABLE result
+)
+
+if (NOT result EQUAL 1)
+    message (FATAL_ERROR "The generated files are expected to be out of date")
+endif ()
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace commsdsl
 {
@@ -50,13 +52,21 @@ public:
 
     const std::string& name() const;
 
+    // Memoized scopes and paths computed by the commsdsl::gen::comms functions,
+    // the key identifies the kind of the stored scope.
+    const std::string* findCachedScope(unsigned key) const;
+    const std::string& cacheScope(unsigned key, std::string&& value) const;
+
 protected:
     explicit Elem(Elem* parent = nullptr);
 
     virtual Type elemTypeImpl() const = 0;
 
 private:
+    using CachedScopesList = std::vector<std::pair<unsigned, std::string> >;
+
     Elem* m_parent = nullptr;
+    mutable CachedScopesList m_cachedScopes;
 };
 
 } // namespace gen
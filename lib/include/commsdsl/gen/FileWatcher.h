@@ -0,0 +1,55 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/CommsdslApi.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+class FileWatcherImpl;
+class COMMSDSL_API FileWatcher
+{
+public:
+    using FilesList = std::vector<std::string>;
+
+    FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    ~FileWatcher();
+
+    // Replaces the set of watched files. The files do not need to exist,
+    // creation of a missing file is reported as a change as well.
+    // A missing directory is watched through its nearest existing ancestor.
+    void watch(const FilesList& files);
+
+    // Blocks until at least one of the watched files is modified, created,
+    // or removed. Returns list of the changed files.
+    FilesList waitForChanges();
+
+private:
+    std::unique_ptr<FileWatcherImpl> m_impl;
+};
+
+} // namespace gen
+
+} // namespace commsdsl
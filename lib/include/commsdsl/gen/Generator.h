@@ -23,7 +23,9 @@
 #include "commsdsl/gen/Logger.h"
 #include "commsdsl/gen/Message.h"
 #include "commsdsl/gen/Namespace.h"
+#include "commsdsl/gen/OutputSink.h"
 #include "commsdsl/gen/Schema.h"
+#include "commsdsl/gen/Stats.h"
 #include "commsdsl/parse/Endian.h"
 
 #include <memory>
@@ -42,6 +44,7 @@ public:
     using LoggerPtr = std::unique_ptr<Logger>;
     using NamespacesList = Namespace::NamespacesList;
     using PlatformNamesList = std::vector<std::string>;
+    using ElemRefsList = std::vector<std::string>;
     using SchemasList = std::vector<SchemaPtr>;
 
     using NamespacesAccessList = Namespace::NamespacesAccessList;
@@ -70,9 +73,22 @@ public:
     void setMultipleSchemasEnabled(bool enabled);
     bool getMultipleSchemasEnabled() const;
 
+    void addExpectedExtraPrefix(const std::string& value);
+
     void setVersionIndependentCodeForced(bool value = true); 
     bool getVersionIndependentCodeForced() const;
 
+    void setDryRun(bool value = true);
+    bool getDryRun() const;
+
+    void setSkipUnchangedFiles(bool value = true);
+    bool getSkipUnchangedFiles() const;
+
+    // All the generated files are passed to the output sink, the files are
+    // written to the filesystem by default. Passing nullptr restores the default.
+    void setOutputSink(OutputSinkPtr sink);
+    OutputSink& outputSink() const;
+
     const Field* findField(const std::string& externalRef) const;
     Field* findField(const std::string& externalRef);
     const Message* findMessage(const std::string& externalRef) const;
@@ -113,6 +129,9 @@ public:
     Logger& logger();
     const Logger& logger() const;
 
+    Stats& stats();
+    const Stats& stats() const;
+
     const SchemasList& schemas() const;
 
     Schema& currentSchema();
@@ -155,6 +174,14 @@ public:
     void chooseProtocolSchema() const;
 
     bool createDirectory(const std::string& path) const;
+    bool writeFile(const std::string& filePath, const std::string& contents) const;
+    bool copyFile(const std::string& srcPath, const std::string& destPath) const;
+    std::string readCodeFile(const std::string& filePath) const;
+    bool isCodeFileReadable(const std::string& filePath) const;
+
+    FilesList inputFiles() const;
+    FilesList outputFiles() const;
+    bool writeDepfile(const std::string& filePath) const;
 
     void referenceAllMessages();
     bool getAllMessagesReferencedByDefault() const;
@@ -164,6 +191,13 @@ public:
     bool getAllInterfacesReferencedByDefault() const;
     void setAllInterfacesReferencedByDefault(bool value = true);    
 
+    // Limit generated code to the listed messages / frames and
+    // everything they reference, empty list means all.
+    void setSelectedMessages(const ElemRefsList& refs);
+    const ElemRefsList& getSelectedMessages() const;
+    void setSelectedFrames(const ElemRefsList& refs);
+    const ElemRefsList& getSelectedFrames() const;
+
 protected:
     virtual bool createCompleteImpl();
     virtual bool prepareImpl();
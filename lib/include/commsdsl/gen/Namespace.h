@@ -84,6 +84,7 @@ public:
 
     void setAllInterfacesReferenced();
     void setAllMessagesReferenced();
+    void setAllFramesReferenced();
 
     bool hasReferencedMessageIdField() const;
     bool hasAnyReferencedMessage() const;
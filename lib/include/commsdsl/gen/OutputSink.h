@@ -0,0 +1,113 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/CommsdslApi.h"
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+// Destination of all the files produced by the generator.
+// The failing operations report the reason via the "error" parameter.
+class COMMSDSL_API OutputSink
+{
+public:
+    OutputSink() = default;
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+    virtual ~OutputSink();
+
+    bool createDirectory(const std::string& path, std::string& error);
+    bool writeFile(const std::string& filePath, const std::string& contents, std::string& error);
+    bool copyFile(const std::string& srcPath, const std::string& destPath, std::string& error);
+    bool isFileUnchanged(const std::string& filePath, const std::string& contents) const;
+
+    // Invoked by the generator when all the files have been written.
+    bool finish(std::string& error);
+
+protected:
+    virtual bool createDirectoryImpl(const std::string& path, std::string& error) = 0;
+    virtual bool writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error) = 0;
+    virtual bool copyFileImpl(const std::string& srcPath, const std::string& destPath, std::string& error);
+    virtual bool isFileUnchangedImpl(const std::string& filePath, const std::string& contents) const;
+    virtual bool finishImpl(std::string& error);
+};
+
+using OutputSinkPtr = std::unique_ptr<OutputSink>;
+
+// Default sink, writes the files into the filesystem.
+class COMMSDSL_API FilesystemOutputSink : public OutputSink
+{
+protected:
+    virtual bool createDirectoryImpl(const std::string& path, std::string& error) override;
+    virtual bool writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error) override;
+    virtual bool copyFileImpl(const std::string& srcPath, const std::string& destPath, std::string& error) override;
+    virtual bool isFileUnchangedImpl(const std::string& filePath, const std::string& contents) const override;
+};
+
+// Keeps the generated files in memory, mapped by their path relative to
+// the provided root directory (usually the generator's output directory).
+class MemoryOutputSinkImpl;
+class COMMSDSL_API MemoryOutputSink : public OutputSink
+{
+public:
+    using FilesMap = std::map<std::string, std::string>;
+
+    explicit MemoryOutputSink(const std::string& rootDir = std::string());
+    virtual ~MemoryOutputSink();
+
+    const FilesMap& files() const;
+    FilesMap releaseFiles();
+
+protected:
+    virtual bool createDirectoryImpl(const std::string& path, std::string& error) override;
+    virtual bool writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error) override;
+    virtual bool isFileUnchangedImpl(const std::string& filePath, const std::string& contents) const override;
+
+private:
+    std::unique_ptr<MemoryOutputSinkImpl> m_impl;
+};
+
+// Streams the generated files as a single POSIX (ustar) tar archive, the
+// paths inside the archive are relative to the provided root directory.
+class TarOutputSinkImpl;
+class COMMSDSL_API TarOutputSink : public OutputSink
+{
+public:
+    TarOutputSink(std::ostream& stream, const std::string& rootDir = std::string());
+    TarOutputSink(const std::string& archivePath, const std::string& rootDir);
+    virtual ~TarOutputSink();
+
+protected:
+    virtual bool createDirectoryImpl(const std::string& path, std::string& error) override;
+    virtual bool writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error) override;
+    virtual bool finishImpl(std::string& error) override;
+
+private:
+    std::unique_ptr<TarOutputSinkImpl> m_impl;
+};
+
+} // namespace gen
+
+} // namespace commsdsl
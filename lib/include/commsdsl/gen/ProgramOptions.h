@@ -33,17 +33,31 @@ class COMMSDSL_API ProgramOptions
 {
 public:
     using ArgsList = std::vector<std::string>;
+    using ElemRefsList = std::vector<std::string>;
     
     ProgramOptions();
     ~ProgramOptions();
 
     ProgramOptions& addHelpOption();
+    ProgramOptions& addStatsOptions();
+    ProgramOptions& addDepfileOptions();
+    ProgramOptions& addOutputArchiveOption();
+    ProgramOptions& addWatchOption();
+    ProgramOptions& addSelectionOptions();
     ProgramOptions& operator()(const std::string& optStr, const std::string& desc, bool hasParam = false);
     ProgramOptions& operator()(const std::string& optStr, const std::string& desc, const std::string& defaultValue);
 
     void parse(int argc, const char** argv);
     bool isOptUsed(const std::string& optStr) const;
     bool helpRequested() const;
+    bool statsRequested() const;
+    const std::string& getTraceJsonFile() const;
+    const std::string& getDepfile() const;
+    const std::string& getOutputTar() const;
+    bool listOutputsRequested() const;
+    bool watchRequested() const;
+    ElemRefsList getSelectedMessages() const;
+    ElemRefsList getSelectedFrames() const;
     const std::string& value(const std::string& optStr) const;
     const ArgsList& args() const;
     std::string helpStr() const;
@@ -107,6 +107,7 @@ public:
 
     void setAllInterfacesReferenced();
     void setAllMessagesReferenced();
+    void setAllFramesReferenced();
 
     bool hasReferencedMessageIdField() const;
     bool hasAnyReferencedMessage() const;    
@@ -0,0 +1,83 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "commsdsl/CommsdslApi.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+class StatsImpl;
+class COMMSDSL_API Stats
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum Category
+    {
+        Category_Phase,
+        Category_Element,
+        Category_NumOfValues
+    };
+
+    class COMMSDSL_API Scope
+    {
+    public:
+        Scope(Stats& stats, Category category, const std::string& name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Stats& m_stats;
+        Category m_category = Category_Phase;
+        std::string m_name;
+        Clock::time_point m_start;
+    };
+
+    Stats();
+    Stats(const Stats&) = delete;
+    ~Stats();
+
+    void setEnabled(bool value = true);
+    bool isEnabled() const;
+
+    void recordScope(Category category, const std::string& name, Clock::time_point start, Clock::time_point end);
+    void recordFileWritten(std::size_t bytes);
+
+    // The templates are processed by the free functions,
+    // the relevant counters are global.
+    static void recordTemplateProcessed(std::size_t bytes);
+
+    std::string summary(unsigned slowestElemsCount = 10U) const;
+    bool writeTraceJson(const std::string& filePath) const;
+
+private:
+    std::unique_ptr<StatsImpl> m_impl;
+};
+
+} // namespace gen
+
+} // namespace commsdsl
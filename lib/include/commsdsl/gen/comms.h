@@ -148,6 +148,8 @@ std::size_t maxPossibleLength();
 
 std::size_t addLength(std::size_t len1, std::size_t len2);
 
+bool isExtraAttributeEnabled(const commsdsl::parse::Field::AttributesMap& attrs, const std::string& name);
+
 } // namespace comms
 
 } // namespace gen
@@ -37,6 +37,7 @@ public:
 
     Endian endian() const;
     Members members() const;
+    const Members& membersView() const;
 };
 
 } // namespace parse
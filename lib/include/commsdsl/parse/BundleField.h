@@ -37,7 +37,9 @@ public:
     explicit BundleField(Field field);
 
     Members members() const;
+    const Members& membersView() const;
     Aliases aliases() const;
+    const Aliases& aliasesView() const;
 };
 
 } // namespace parse
@@ -44,6 +44,7 @@ public:
     const std::string& name() const;
     const std::string& description() const;
     LayersList layers() const;
+    const LayersList& layersView() const;
     std::string externalRef(bool schemaRef = true) const;
 
     const AttributesMap& extraAttributes() const;
@@ -46,7 +46,9 @@ public:
     const std::string& name() const;
     const std::string& description() const;
     FieldsList fields() const;
+    const FieldsList& fieldsView() const;
     AliasesList aliases() const;
+    const AliasesList& aliasesView() const;
     std::string externalRef(bool schemaRef = true) const;
 
     const AttributesMap& extraAttributes() const;
@@ -66,7 +66,9 @@ public:
     unsigned deprecatedSince() const;
     bool isDeprecatedRemoved() const;
     FieldsList fields() const;
+    const FieldsList& fieldsView() const;
     AliasesList aliases() const;
+    const AliasesList& aliasesView() const;
     std::string externalRef(bool schemaRef = true) const;
     bool isCustomizable() const;
     bool isFailOnInvalid() const;
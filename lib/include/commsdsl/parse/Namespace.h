@@ -50,10 +50,15 @@ public:
     const std::string& name() const;
     const std::string& description() const;
     NamespacesList namespaces() const;
+    const NamespacesList& namespacesView() const;
     FieldsList fields() const;
+    const FieldsList& fieldsView() const;
     MessagesList messages() const;
+    const MessagesList& messagesView() const;
     InterfacesList interfaces() const;
+    const InterfacesList& interfacesView() const;
     FramesList frames() const;
+    const FramesList& framesView() const;
     std::string externalRef(bool schemaRef = true) const;
 
     const AttributesMap& extraAttributes() const;
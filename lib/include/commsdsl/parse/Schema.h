@@ -62,6 +62,7 @@ public:
     const ElementsList& extraElements() const;
 
     NamespacesList namespaces() const;
+    const NamespacesList& namespacesView() const;
 
     const PlatformsList& platforms() const;
 
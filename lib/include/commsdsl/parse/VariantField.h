@@ -35,6 +35,7 @@ public:
     explicit VariantField(Field field);
 
     Members members() const;
+    const Members& membersView() const;
     std::size_t defaultMemberIdx() const;
     bool displayIdxReadOnlyHidden() const;
 
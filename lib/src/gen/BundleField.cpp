@@ -43,7 +43,7 @@ public:
             return true;
         }
 
-        auto fields = m_dslObj.members();
+        auto& fields = m_dslObj.membersView();
         m_members.reserve(fields.size());
         for (auto& dslObj : fields) {
             auto ptr = Field::create(m_generator, dslObj, m_parent);
@@ -26,6 +26,7 @@
 
 #include "commsdsl/gen/strings.h"
 
+#include <algorithm>
 #include <cassert>
 #include <type_traits>
 
@@ -90,6 +91,7 @@ Elem::~Elem() = default;
 void Elem::setParent(Elem* parent)
 {
     m_parent = parent;
+    m_cachedScopes.clear();
 }
 
 Elem* Elem::getParent()
@@ -132,6 +134,30 @@ const std::string& Elem::name() const
     return Map[idx](*this);
 }
 
+const std::string* Elem::findCachedScope(unsigned key) const
+{
+    auto iter =
+        std::find_if(
+            m_cachedScopes.begin(), m_cachedScopes.end(),
+            [key](auto& elem)
+            {
+                return elem.first == key;
+            });
+
+    if (iter == m_cachedScopes.end()) {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+const std::string& Elem::cacheScope(unsigned key, std::string&& value) const
+{
+    assert(findCachedScope(key) == nullptr);
+    m_cachedScopes.emplace_back(key, std::move(value));
+    return m_cachedScopes.back().second;
+}
+
 Elem::Elem(Elem* parent) :
     m_parent(parent)
 {
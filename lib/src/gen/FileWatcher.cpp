@@ -0,0 +1,360 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/gen/FileWatcher.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <system_error>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif // #ifdef __linux__
+
+namespace fs = std::filesystem;
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+namespace
+{
+
+const auto PollPeriod = std::chrono::milliseconds(500);
+
+// Editors tend to save a file in several steps (truncate, write, rename),
+// wait for the events to settle before reporting the change.
+const int SettleTimeoutMs = 100;
+
+std::string normalizedPath(const std::string& path)
+{
+    std::error_code ec;
+    auto absPath = fs::absolute(path, ec);
+    if (ec) {
+        return fs::path(path).lexically_normal().string();
+    }
+
+    return absPath.lexically_normal().string();
+}
+
+} // namespace
+
+class FileWatcherImpl
+{
+public:
+    using FilesList = FileWatcher::FilesList;
+
+    FileWatcherImpl()
+    {
+#ifdef __linux__
+        m_fd = ::inotify_init1(IN_CLOEXEC);
+#endif // #ifdef __linux__
+    }
+
+    ~FileWatcherImpl()
+    {
+#ifdef __linux__
+        if (0 <= m_fd) {
+            ::close(m_fd);
+        }
+#endif // #ifdef __linux__
+    }
+
+    void watch(const FilesList& files)
+    {
+        m_files.clear();
+        for (auto& f : files) {
+            m_files.insert(normalizedPath(f));
+        }
+
+        takeSnapshot();
+
+#ifdef __linux__
+        for (auto& w : m_dirs) {
+            ::inotify_rm_watch(m_fd, w.first);
+        }
+        m_dirs.clear();
+        m_watchFailed = false;
+        updateWatches();
+#endif // #ifdef __linux__
+    }
+
+    FilesList waitForChanges()
+    {
+#ifdef __linux__
+        if ((0 <= m_fd) && (!m_watchFailed) && (!m_dirs.empty())) {
+            return waitForNotifications();
+        }
+#endif // #ifdef __linux__
+
+        return waitByPolling();
+    }
+
+private:
+    struct FileState
+    {
+        bool m_exists = false;
+        fs::file_time_type m_time;
+        std::uintmax_t m_size = 0U;
+
+        bool operator==(const FileState& other) const
+        {
+            return
+                (m_exists == other.m_exists) &&
+                (m_time == other.m_time) &&
+                (m_size == other.m_size);
+        }
+
+        bool operator!=(const FileState& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    using FileStatesMap = std::map<std::string, FileState>;
+
+    static FileState stateOf(const std::string& path)
+    {
+        FileState state;
+        std::error_code ec;
+        state.m_exists = fs::is_regular_file(path, ec);
+        if (!state.m_exists) {
+            return state;
+        }
+
+        state.m_time = fs::last_write_time(path, ec);
+        state.m_size = fs::file_size(path, ec);
+        return state;
+    }
+
+    void takeSnapshot()
+    {
+        m_states.clear();
+        for (auto& f : m_files) {
+            m_states[f] = stateOf(f);
+        }
+    }
+
+    FilesList changedSinceSnapshot()
+    {
+        FilesList result;
+        for (auto& s : m_states) {
+            auto state = stateOf(s.first);
+            if (state != s.second) {
+                result.push_back(s.first);
+                s.second = state;
+            }
+        }
+        return result;
+    }
+
+    FilesList waitByPolling()
+    {
+        while (true) {
+            auto result = changedSinceSnapshot();
+            if (!result.empty()) {
+                return result;
+            }
+
+            std::this_thread::sleep_for(PollPeriod);
+        }
+    }
+
+#ifdef __linux__
+    static std::string nearestExistingDir(const std::string& filePath)
+    {
+        auto dir = fs::path(filePath).parent_path();
+        while (true) {
+            std::error_code ec;
+            if (fs::is_directory(dir, ec)) {
+                return dir.string();
+            }
+
+            auto parent = dir.parent_path();
+            if (parent == dir) {
+                return std::string();
+            }
+
+            dir = std::move(parent);
+        }
+    }
+
+    // Watches the directory of every file, or its nearest existing ancestor
+    // when the directory doesn't exist (yet). Any failure to add a watch 
+    // switches to polling to avoid missing changes.
+    void updateWatches()
+    {
+        if (m_fd < 0) {
+            m_watchFailed = true;
+            return;
+        }
+
+        std::set<std::string> dirs;
+        for (auto& f : m_files) {
+            auto dir = nearestExistingDir(f);
+            if (dir.empty()) {
+                m_watchFailed = true;
+                return;
+            }
+
+            dirs.insert(std::move(dir));
+        }
+
+        static const std::uint32_t Mask =
+            IN_CLOSE_WRITE | IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | 
+            IN_DELETE_SELF | IN_MOVE_SELF;
+
+        for (auto& d : dirs) {
+            auto wd = ::inotify_add_watch(m_fd, d.c_str(), Mask);
+            if (wd < 0) {
+                m_watchFailed = true;
+                return;
+            }
+
+            // Re-adding the same directory returns the same descriptor
+            m_dirs[wd] = d;
+        }
+    }
+
+    bool isRelevantPath(const std::string& path) const
+    {
+        auto iter = m_files.lower_bound(path);
+        if (iter == m_files.end()) {
+            return false;
+        }
+
+        if (*iter == path) {
+            return true;
+        }
+
+        // Creation / removal of one of the parent directories
+        return 
+            (path.size() < iter->size()) && 
+            (iter->compare(0, path.size(), path) == 0) && 
+            ((*iter)[path.size()] == fs::path::preferred_separator);
+    }
+
+    bool readNotifications(int timeoutMs)
+    {
+        pollfd pfd;
+        pfd.fd = m_fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (::poll(&pfd, 1, timeoutMs) <= 0) {
+            return false;
+        }
+
+        alignas(inotify_event) char buf[16 * 1024];
+        auto len = ::read(m_fd, buf, sizeof(buf));
+        if (len <= 0) {
+            return false;
+        }
+
+        bool relevant = false;
+        for (decltype(len) pos = 0; pos < len;) {
+            auto* event = reinterpret_cast<const inotify_event*>(&buf[pos]);
+            pos += static_cast<decltype(len)>(sizeof(inotify_event) + event->len);
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0U) {
+                relevant = true;
+                continue;
+            }
+
+            auto iter = m_dirs.find(event->wd);
+            if (iter == m_dirs.end()) {
+                continue;
+            }
+
+            if ((event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) != 0U) {
+                m_dirs.erase(iter);
+                relevant = true;
+                continue;
+            }
+
+            if (event->len == 0U) {
+                continue;
+            }
+
+            auto filePath = (fs::path(iter->second) / event->name).string();
+            if (isRelevantPath(filePath)) {
+                relevant = true;
+            }
+        }
+
+        return relevant;
+    }
+
+    FilesList waitForNotifications()
+    {
+        while (true) {
+            if (!readNotifications(-1)) {
+                continue;
+            }
+
+            while (readNotifications(SettleTimeoutMs)) {}
+
+            auto result = changedSinceSnapshot();
+            if (!result.empty()) {
+                return result;
+            }
+
+            // One of the missing directories could have been created
+            // or one of the watched directories removed.
+            updateWatches();
+            if (m_watchFailed || m_dirs.empty()) {
+                return waitByPolling();
+            }
+        }
+    }
+
+    int m_fd = -1;
+    std::map<int, std::string> m_dirs;
+    bool m_watchFailed = false;
+#endif // #ifdef __linux__
+
+    std::set<std::string> m_files;
+    FileStatesMap m_states;
+};
+
+FileWatcher::FileWatcher() :
+    m_impl(std::make_unique<FileWatcherImpl>())
+{
+}
+
+FileWatcher::~FileWatcher() = default;
+
+void FileWatcher::watch(const FilesList& files)
+{
+    m_impl->watch(files);
+}
+
+FileWatcher::FilesList FileWatcher::waitForChanges()
+{
+    return m_impl->waitForChanges();
+}
+
+} // namespace gen
+
+} // namespace commsdsl
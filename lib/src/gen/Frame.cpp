@@ -45,7 +45,7 @@ public:
             return true;
         }
 
-        auto layers = m_dslObj.layers();
+        auto& layers = m_dslObj.layersView();
         m_layers.reserve(layers.size());
         for (auto& dslObj : layers) {
             auto ptr = Layer::create(m_generator, dslObj, m_parent);
@@ -98,11 +98,22 @@ public:
         return m_generator;
     }    
 
+    bool isReferenced() const
+    {
+        return m_referenced;
+    }
+
+    void setReferenced(bool value)
+    {
+        m_referenced = value;
+    }
+
 private:
     Generator& m_generator;
     commsdsl::parse::Frame m_dslObj;
     Elem* m_parent = nullptr;
     LayersList m_layers;
+    bool m_referenced = false;
 }; 
 
 Frame::Frame(Generator& generator, commsdsl::parse::Frame dslObj, Elem* parent) :
@@ -115,6 +126,10 @@ Frame::~Frame() = default;
 
 bool Frame::prepare()
 {
+    if (!isReferenced()) {
+        return true;
+    }
+
     if (!m_impl->prepare()) {
         return false;
     }
@@ -124,6 +139,10 @@ bool Frame::prepare()
 
 bool Frame::write() const
 {
+    if (!isReferenced()) {
+        return true;
+    }
+
     if (!m_impl->write()) {
         return false;
     }
@@ -183,6 +202,16 @@ Frame::LayersAccessList Frame::getCommsOrderOfLayers(bool& success) const
     return result;    
 }
 
+bool Frame::isReferenced() const
+{
+    return m_impl->isReferenced();
+}
+
+void Frame::setReferenced(bool value)
+{
+    m_impl->setReferenced(value);
+}
+
 Elem::Type Frame::elemTypeImpl() const
 {
     return Type_Frame;
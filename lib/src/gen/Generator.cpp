@@ -44,7 +44,9 @@
 #include <cassert>
 #include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <map>
+#include <set>
 #include <system_error>
 
 namespace commsdsl
@@ -53,6 +55,125 @@ namespace commsdsl
 namespace gen
 {
 
+namespace
+{
+
+bool isPathSep(char ch)
+{
+    return (ch == '/') || (ch == static_cast<char>(std::filesystem::path::preferred_separator));
+}
+
+// Snapshot of the code input directory, taken once on the first lookup.
+// The elements probe many optional files (".extend", ".append", ".read", etc...),
+// the index allows answering the lookups without touching the filesystem.
+class CodeDirIndex
+{
+public:
+    void reset(const std::string& dir)
+    {
+        m_dir = dir;
+        m_files.clear();
+        m_scanned = false;
+    }
+
+    bool covers(const std::string& filePath) const
+    {
+        return m_dir.empty() || (!relPathFor(filePath).empty());
+    }
+
+    bool exists(const std::string& filePath) const
+    {
+        return findFile(filePath) != nullptr;
+    }
+
+    const std::string& contents(const std::string& filePath) const
+    {
+        static const std::string EmptyStr;
+        auto* info = findFile(filePath);
+        if (info == nullptr) {
+            return EmptyStr;
+        }
+
+        if (!info->m_loaded) {
+            info->m_contents = util::readFileContents(info->m_path);
+            info->m_loaded = true;
+        }
+
+        return info->m_contents;
+    }
+
+private:
+    struct FileInfo
+    {
+        std::string m_path;
+        mutable std::string m_contents;
+        mutable bool m_loaded = false;
+    };
+
+    std::string relPathFor(const std::string& filePath) const
+    {
+        if ((filePath.size() <= m_dir.size()) ||
+            (filePath.compare(0, m_dir.size(), m_dir) != 0)) {
+            return std::string();
+        }
+
+        auto pos = m_dir.size();
+        if ((!isPathSep(m_dir.back())) && (!isPathSep(filePath[pos]))) {
+            return std::string();
+        }
+
+        while ((pos < filePath.size()) && isPathSep(filePath[pos])) {
+            ++pos;
+        }
+
+        return std::filesystem::path(filePath.substr(pos)).lexically_normal().generic_string();
+    }
+
+    void scan() const
+    {
+        m_scanned = true;
+        if (m_dir.empty()) {
+            return;
+        }
+
+        std::error_code ec;
+        std::filesystem::path root(m_dir);
+        std::filesystem::recursive_directory_iterator iter(root, std::filesystem::directory_options::follow_directory_symlink, ec);
+        for (; (!ec) && (iter != std::filesystem::recursive_directory_iterator()); iter.increment(ec)) {
+            std::error_code statusEc;
+            if (!iter->is_regular_file(statusEc)) {
+                continue;
+            }
+
+            auto relPath = iter->path().lexically_relative(root).lexically_normal().generic_string();
+            m_files[relPath].m_path = iter->path().string();
+        }
+    }
+
+    const FileInfo* findFile(const std::string& filePath) const
+    {
+        if (m_dir.empty()) {
+            return nullptr;
+        }
+
+        if (!m_scanned) {
+            scan();
+        }
+
+        auto iter = m_files.find(relPathFor(filePath));
+        if (iter == m_files.end()) {
+            return nullptr;
+        }
+
+        return &iter->second;
+    }
+
+    std::string m_dir;
+    mutable std::map<std::string, FileInfo> m_files;
+    mutable bool m_scanned = false;
+};
+
+} // namespace
 
 class GeneratorImpl
 {
@@ -61,11 +182,13 @@ public:
     using FilesList = Generator::FilesList;
     using NamespacesList = Generator::NamespacesList;
     using PlatformNamesList = Generator::PlatformNamesList;
+    using ElemRefsList = Generator::ElemRefsList;
     using SchemasList = Generator::SchemasList;
 
     explicit GeneratorImpl(Generator& generator) :
         m_generator(generator),
-        m_outputDir(std::filesystem::current_path().string())
+        m_outputDir(std::filesystem::current_path().string()),
+        m_outputSink(std::make_unique<FilesystemOutputSink>())
     {
     }
 
@@ -84,6 +207,31 @@ public:
         m_logger = std::move(logger);
     }
 
+    Stats& stats()
+    {
+        return m_stats;
+    }
+
+    void setOutputSink(OutputSinkPtr sink)
+    {
+        if (!sink) {
+            sink = std::make_unique<FilesystemOutputSink>();
+        }
+
+        m_outputSink = std::move(sink);
+    }
+
+    OutputSink& outputSink() const
+    {
+        assert(m_outputSink);
+        return *m_outputSink;
+    }
+
+    const Stats& stats() const
+    {
+        return m_stats;
+    }
+
     const SchemasList& schemas() const
     {
         return m_schemas;
@@ -202,6 +350,7 @@ public:
     void setCodeDir(const std::string& dir)
     {
         m_codeDir = dir;
+        m_codeDirIndex.reset(dir);
     }
 
     const std::string& getCodeDir() const
@@ -219,11 +368,36 @@ public:
         return m_protocol.getMultipleSchemasEnabled();
     }
 
+    void addExpectedExtraPrefix(const std::string& value)
+    {
+        m_protocol.addExpectedExtraPrefix(value);
+    }
+
     void setVersionIndependentCodeForced(bool value)
     {
         m_versionIndependentCodeForced = value;
     }
 
+    void setDryRun(bool value)
+    {
+        m_dryRun = value;
+    }
+
+    bool getDryRun() const
+    {
+        return m_dryRun;
+    }
+
+    void setSkipUnchangedFiles(bool value)
+    {
+        m_skipUnchangedFiles = value;
+    }
+
+    bool getSkipUnchangedFiles() const
+    {
+        return m_skipUnchangedFiles;
+    }
+
     bool getVersionIndependentCodeForced() const
     {
         return m_versionIndependentCodeForced;
@@ -310,8 +484,15 @@ public:
             });
 
         assert(m_logger);
+
+        // All the schema files are inputs, even if parsing stops early
+        for (auto& f : files) {
+            recordInputFile(f);
+        }
+
         for (auto& f : files) {
             m_logger->info("Parsing " + f);
+            Stats::Scope scope(m_stats, Stats::Category_Phase, "parse " + f);
             if (!m_protocol.parse(f)) {
                 return false;
             }
@@ -322,8 +503,11 @@ public:
             }
         }
 
-        if (!m_protocol.validate()) {
-            return false;
+        {
+            Stats::Scope scope(m_stats, Stats::Category_Phase, "validate");
+            if (!m_protocol.validate()) {
+                return false;
+            }
         }
 
         if (m_logger->hadWarning()) {
@@ -361,34 +545,50 @@ public:
             protocolSchemaPtr->setMainNamespaceOverride(renameIter->second);
         }
 
-        for (auto& s : m_schemas) {
-            m_currentSchema = s.get();
-            if (!s->createAll()) {
-                m_logger->error("Failed to create elements inside schema \"" + s->dslObj().name() + "\"");
-                return false;
-            }       
+        {
+            Stats::Scope scope(m_stats, Stats::Category_Phase, "create");
+            for (auto& s : m_schemas) {
+                m_currentSchema = s.get();
+                if (!s->createAll()) {
+                    m_logger->error("Failed to create elements inside schema \"" + s->dslObj().name() + "\"");
+                    return false;
+                }       
+
+                if (m_allInterfacesReferencedByDefault) {
+                    s->setAllInterfacesReferenced();
+                }                 
+
+                if (m_allMessagesReferencedByDefault && m_selectedMessages.empty()) {
+                    s->setAllMessagesReferenced();
+                }
 
-            if (m_allInterfacesReferencedByDefault) {
-                s->setAllInterfacesReferenced();
-            }                 
+                if (m_selectedFrames.empty()) {
+                    s->setAllFramesReferenced();
+                }
+            }   
 
-            if (m_allMessagesReferencedByDefault) {
-                s->setAllMessagesReferenced();
+            if (!referenceSelectedElements()) {
+                return false;
             }
-        }   
-        
-        if (createCompleteCb && (!createCompleteCb())) {
-            return false;
         }
-
-        for (auto& s : m_schemas) {
-            m_currentSchema = s.get();
-            if (!s->prepare()) {
-                m_logger->error("Failed to prepare elements inside schema \"" + s->dslObj().name() + "\"");
+        
+        {
+            Stats::Scope scope(m_stats, Stats::Category_Phase, "createComplete");
+            if (createCompleteCb && (!createCompleteCb())) {
                 return false;
-            }            
-        }               
+            }
+        }
 
+        {
+            Stats::Scope scope(m_stats, Stats::Category_Phase, "prepare");
+            for (auto& s : m_schemas) {
+                m_currentSchema = s.get();
+                if (!s->prepare()) {
+                    m_logger->error("Failed to prepare elements inside schema \"" + s->dslObj().name() + "\"");
+                    return false;
+                }            
+            }               
+        }
 
         if (m_logger->hadWarning()) {
             m_logger->error("Warning treated as error");
@@ -422,6 +622,31 @@ public:
         m_createdDirectories.push_back(path);
     }
 
+    const CodeDirIndex& codeDirIndex() const
+    {
+        return m_codeDirIndex;
+    }
+
+    void recordInputFile(const std::string& path) const
+    {
+        m_inputFiles.insert(path);
+    }
+
+    void recordOutputFile(const std::string& path) const
+    {
+        m_outputFiles.insert(path);
+    }
+
+    FilesList inputFiles() const
+    {
+        return FilesList(m_inputFiles.begin(), m_inputFiles.end());
+    }
+
+    FilesList outputFiles() const
+    {
+        return FilesList(m_outputFiles.begin(), m_outputFiles.end());
+    }
+
     const commsdsl::parse::Protocol& protocol() const
     {
         return m_protocol;
@@ -461,7 +686,70 @@ public:
         m_allInterfacesReferencedByDefault = value;
     }
 
+    void setSelectedMessages(const ElemRefsList& refs)
+    {
+        m_selectedMessages = refs;
+    }
+
+    const ElemRefsList& getSelectedMessages() const
+    {
+        return m_selectedMessages;
+    }
+
+    void setSelectedFrames(const ElemRefsList& refs)
+    {
+        m_selectedFrames = refs;
+    }
+
+    const ElemRefsList& getSelectedFrames() const
+    {
+        return m_selectedFrames;
+    }
+
 private:
+    bool referenceSelectedElements()
+    {
+        return 
+            referenceSelectedElements(m_selectedMessages, "message", &Schema::getAllMessages) &&
+            referenceSelectedElements(m_selectedFrames, "frame", &Schema::getAllFrames);
+    }
+
+    template <typename TElem>
+    bool referenceSelectedElements(
+        const ElemRefsList& refs,
+        const std::string& kind,
+        std::vector<const TElem*> (Schema::*getAllFunc)() const)
+    {
+        if (refs.empty()) {
+            return true;
+        }
+
+        // The names of the protocol schema elements may omit the schema reference prefix
+        std::map<std::string, TElem*> elems;
+        for (auto& s : m_schemas) {
+            auto list = (s.get()->*getAllFunc)();
+            for (auto* e : list) {
+                auto* elem = const_cast<TElem*>(e);
+                elems[e->dslObj().externalRef()] = elem;
+                if (s.get() == m_currentSchema) {
+                    elems[e->dslObj().externalRef(false)] = elem;
+                }
+            }
+        }
+
+        for (auto& r : refs) {
+            auto iter = elems.find(r);
+            if (iter == elems.end()) {
+                m_logger->error("Selected " + kind + " \"" + r + "\" cannot be found");
+                return false;
+            }
+
+            iter->second->setReferenced(true);
+        }
+
+        return true;
+    }
+
     std::pair<const Schema*, std::string> parseExternalRef(const std::string& externalRef) const
     {
         assert(!externalRef.empty());
@@ -499,6 +787,7 @@ private:
     Generator& m_generator;
     commsdsl::parse::Protocol m_protocol;
     LoggerPtr m_logger;
+    Stats m_stats;
     SchemasList m_schemas;
     Schema* m_currentSchema = nullptr;
     std::map<std::string, std::string> m_namespaceOverrides;
@@ -507,8 +796,16 @@ private:
     unsigned m_minRemoteVersion = 0U;
     std::string m_outputDir;
     std::string m_codeDir;
+    CodeDirIndex m_codeDirIndex;
+    OutputSinkPtr m_outputSink;
     mutable std::vector<std::string> m_createdDirectories;
+    mutable std::set<std::string> m_inputFiles;
+    mutable std::set<std::string> m_outputFiles;
+    ElemRefsList m_selectedMessages;
+    ElemRefsList m_selectedFrames;
     bool m_versionIndependentCodeForced = false;
+    bool m_dryRun = false;
+    bool m_skipUnchangedFiles = false;
     bool m_allMessagesReferencedByDefault = true;
     bool m_allInterfacesReferencedByDefault = true;
 }; 
@@ -580,6 +877,11 @@ bool Generator::getMultipleSchemasEnabled() const
     return m_impl->getMultipleSchemasEnabled();
 }
 
+void Generator::addExpectedExtraPrefix(const std::string& value)
+{
+    m_impl->addExpectedExtraPrefix(value);
+}
+
 void Generator::setVersionIndependentCodeForced(bool value)
 {
     m_impl->setVersionIndependentCodeForced(value);
@@ -590,6 +892,36 @@ bool Generator::getVersionIndependentCodeForced() const
     return m_impl->getVersionIndependentCodeForced();
 }
 
+void Generator::setSkipUnchangedFiles(bool value)
+{
+    m_impl->setSkipUnchangedFiles(value);
+}
+
+bool Generator::getSkipUnchangedFiles() const
+{
+    return m_impl->getSkipUnchangedFiles();
+}
+
+void Generator::setDryRun(bool value)
+{
+    m_impl->setDryRun(value);
+}
+
+bool Generator::getDryRun() const
+{
+    return m_impl->getDryRun();
+}
+
+void Generator::setOutputSink(OutputSinkPtr sink)
+{
+    m_impl->setOutputSink(std::move(sink));
+}
+
+OutputSink& Generator::outputSink() const
+{
+    return m_impl->outputSink();
+}
+
 const Field* Generator::findField(const std::string& externalRef) const
 {
     auto* field = m_impl->findField(externalRef);
@@ -793,6 +1125,7 @@ bool Generator::prepare(const FilesList& files)
         return false;
     }
 
+    Stats::Scope scope(stats(), Stats::Category_Phase, "prepareImpl");
     return prepareImpl();
 }
 
@@ -803,11 +1136,31 @@ bool Generator::write()
         return false;
     }
 
-    if (!m_impl->write()) {
-        return false;
+    {
+        Stats::Scope scope(stats(), Stats::Category_Phase, "write");
+        if (!m_impl->write()) {
+            return false;
+        }
     }
     
-    return writeImpl();
+    {
+        Stats::Scope scope(stats(), Stats::Category_Phase, "writeImpl");
+        if (!writeImpl()) {
+            return false;
+        }
+    }
+
+    if (getDryRun()) {
+        return true;
+    }
+
+    std::string error;
+    if (!m_impl->outputSink().finish(error)) {
+        logger().error(error);
+        return false;
+    }
+
+    return true;
 }
 
 bool Generator::doesElementExist(
@@ -856,6 +1209,16 @@ const Logger& Generator::logger() const
     return *loggerPtr;
 }
 
+Stats& Generator::stats()
+{
+    return m_impl->stats();
+}
+
+const Stats& Generator::stats() const
+{
+    return m_impl->stats();
+}
+
 const Generator::SchemasList& Generator::schemas() const
 {
     return m_impl->schemas();
@@ -1057,15 +1420,14 @@ bool Generator::createDirectory(const std::string& path) const
         return true;
     }
 
-    std::error_code ec;
-    if (std::filesystem::is_directory(path, ec)) {
+    if (getDryRun()) {
         m_impl->recordCreatedDirectory(path);
         return true;
     }
 
-    std::filesystem::create_directories(path, ec);
-    if (ec) {
-        logger().error("Failed to create directory \"" + path + "\" with error: " + ec.message());
+    std::string error;
+    if (!m_impl->outputSink().createDirectory(path, error)) {
+        logger().error(error);
         return false;
     }
 
@@ -1073,6 +1435,174 @@ bool Generator::createDirectory(const std::string& path) const
     return true;
 }
 
+bool Generator::writeFile(const std::string& filePath, const std::string& contents) const
+{
+    m_impl->recordOutputFile(filePath);
+    if (getDryRun()) {
+        return true;
+    }
+
+    auto& sink = m_impl->outputSink();
+    if (getSkipUnchangedFiles() && sink.isFileUnchanged(filePath, contents)) {
+        logger().debug("Skipping unchanged " + filePath);
+        return true;
+    }
+
+    std::string error;
+    if (!sink.writeFile(filePath, contents, error)) {
+        logger().error(error);
+        return false;
+    }
+
+    m_impl->stats().recordFileWritten(contents.size());
+    return true;
+}
+
+bool Generator::copyFile(const std::string& srcPath, const std::string& destPath) const
+{
+    m_impl->recordInputFile(srcPath);
+    m_impl->recordOutputFile(destPath);
+    if (getDryRun()) {
+        return true;
+    }
+
+    auto& sink = m_impl->outputSink();
+    if (getSkipUnchangedFiles() && sink.isFileUnchanged(destPath, util::readFileContents(srcPath))) {
+        logger().debug("Skipping unchanged " + destPath);
+        return true;
+    }
+
+    std::string error;
+    if (!sink.copyFile(srcPath, destPath, error)) {
+        logger().error(error);
+        return false;
+    }
+
+    std::error_code ec;
+    auto size = std::filesystem::file_size(srcPath, ec);
+    m_impl->stats().recordFileWritten(ec ? 0U : static_cast<std::size_t>(size));
+    return true;
+}
+
+std::string Generator::readCodeFile(const std::string& filePath) const
+{
+    m_impl->recordInputFile(filePath);
+    auto& index = m_impl->codeDirIndex();
+    if (!index.covers(filePath)) {
+        return util::readFileContents(filePath);
+    }
+
+    return index.contents(filePath);
+}
+
+bool Generator::isCodeFileReadable(const std::string& filePath) const
+{
+    m_impl->recordInputFile(filePath);
+    auto& index = m_impl->codeDirIndex();
+    if (!index.covers(filePath)) {
+        return util::isFileReadable(filePath);
+    }
+
+    return index.exists(filePath);
+}
+
+Generator::FilesList Generator::inputFiles() const
+{
+    return m_impl->inputFiles();
+}
+
+Generator::FilesList Generator::outputFiles() const
+{
+    return m_impl->outputFiles();
+}
+
+bool Generator::writeDepfile(const std::string& filePath) const
+{
+    auto escapeFunc = 
+        [](const std::string& path)
+        {
+            std::string result;
+            result.reserve(path.size());
+            for (auto ch : path) {
+                if (ch == '$') {
+                    result += "$$";
+                    continue;
+                }
+
+                if ((ch == ' ') || (ch == '#')) {
+                    result += '\\';
+                }
+
+                result += ch;
+            }
+            return result;
+        };
+
+    std::string contents;
+    auto outputs = outputFiles();
+    for (auto& f : outputs) {
+        if (!contents.empty()) {
+            contents += " \\\n";
+        }
+
+        contents += escapeFunc(f);
+    }
+
+    // Only existing files are listed as prerequisites, make would otherwise
+    // fail on missing ones. The probed, but missing, code input files are
+    // replaced with their nearest existing directory inside the code input
+    // directory, so adding such a file triggers re-generation.
+    std::set<std::string> prerequisites;
+    std::set<std::string> dirs;
+    auto& codeDir = getCodeDir();
+    auto inputs = inputFiles();
+    for (auto& f : inputs) {
+        std::error_code ec;
+        if (std::filesystem::is_regular_file(f, ec)) {
+            prerequisites.insert(f);
+            continue;
+        }
+
+        if (codeDir.empty() || (f.size() <= codeDir.size()) || (f.compare(0, codeDir.size(), codeDir) != 0)) {
+            continue;
+        }
+
+        auto dir = std::filesystem::path(f).parent_path();
+        while (true) {
+            auto dirStr = dir.string();
+            if (dirStr.size() < codeDir.size()) {
+                break;
+            }
+
+            if (std::filesystem::is_directory(dir, ec)) {
+                dirs.insert(dirStr);
+                break;
+            }
+
+            dir = dir.parent_path();
+        }
+    }
+
+    prerequisites.insert(dirs.begin(), dirs.end());
+
+    contents += ":";
+    for (auto& f : prerequisites) {
+        contents += " \\\n  ";
+        contents += escapeFunc(f);
+    }
+    contents += '\n';
+
+    std::ofstream stream(filePath);
+    if (!stream) {
+        logger().error("Failed to open \"" + filePath + "\" for writing.");
+        return false;
+    }
+
+    stream << contents;
+    stream.flush();
+    return stream.good();
+}
+
 void Generator::referenceAllMessages()
 {
     m_impl->referenceAllMessages();
@@ -1103,6 +1633,26 @@ void Generator::setAllInterfacesReferencedByDefault(bool value)
     m_impl->setAllInterfacesReferencedByDefault(value);
 }    
 
+void Generator::setSelectedMessages(const ElemRefsList& refs)
+{
+    m_impl->setSelectedMessages(refs);
+}
+
+const Generator::ElemRefsList& Generator::getSelectedMessages() const
+{
+    return m_impl->getSelectedMessages();
+}
+
+void Generator::setSelectedFrames(const ElemRefsList& refs)
+{
+    m_impl->setSelectedFrames(refs);
+}
+
+const Generator::ElemRefsList& Generator::getSelectedFrames() const
+{
+    return m_impl->getSelectedFrames();
+}
+
 bool Generator::createCompleteImpl()
 {
     return true;
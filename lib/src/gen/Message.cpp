@@ -55,7 +55,7 @@ public:
             return true;
         }
 
-        auto fields = m_dslObj.fields();
+        auto& fields = m_dslObj.fieldsView();
         m_fields.reserve(fields.size());
         for (auto& dslObj : fields) {
             auto ptr = Field::create(m_generator, dslObj, m_parent);
@@ -188,7 +188,7 @@ bool Message::write() const
     }
 
     if (!m_impl->isReferenced()) {
-        return false;
+        return true;
     }
 
     return writeImpl();
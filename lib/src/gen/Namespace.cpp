@@ -19,6 +19,7 @@
 #include "commsdsl/gen/Field.h"
 #include "commsdsl/gen/Generator.h"
 #include "commsdsl/gen/Interface.h"
+#include "commsdsl/gen/strings.h"
 
 #include <algorithm>
 #include <cassert>
@@ -32,6 +33,22 @@ namespace gen
 namespace 
 {
 
+template <typename TElem>
+std::string elemStatsName(const Stats& stats, const std::string& prefix, const TElem& elem)
+{
+    if (!stats.isEnabled()) {
+        return strings::emptyString();
+    }
+
+    auto obj = elem.dslObj();
+    if (!obj.valid()) {
+        // Auto-generated element (e.g. default interface)
+        return prefix + "<" + (elem.name().empty() ? std::string("default") : elem.name()) + ">";
+    }
+
+    return prefix + obj.externalRef();
+}
+
 template <typename TList>
 bool writeElements(TList& list)
 {
@@ -43,6 +60,33 @@ bool writeElements(TList& list)
         });    
 }
 
+template <typename TList>
+bool writeElements(Generator& generator, TList& list)
+{
+    auto& stats = generator.stats();
+    return std::all_of(
+        list.begin(), list.end(),
+        [&stats](auto& elem)
+        {
+            Stats::Scope scope(stats, Stats::Category_Element, elemStatsName(stats, "write ", *elem));
+            return elem->write();
+        });    
+}
+
+template <typename TList>
+bool prepareElements(Generator& generator, TList& list)
+{
+    auto& stats = generator.stats();
+    return std::all_of(
+        list.begin(), list.end(),
+        [&stats](auto& elem)
+        {
+            assert(elem);
+            Stats::Scope scope(stats, Stats::Category_Element, elemStatsName(stats, "prepare ", *elem));
+            return elem->prepare();
+        });    
+}
+
 } // namespace 
     
 
@@ -94,10 +138,10 @@ public:
     {
         return
             writeElements(m_namespaces) &&
-            writeElements(m_fields) &&
-            writeElements(m_interfaces) &&
-            writeElements(m_messages) &&
-            writeElements(m_frames);
+            writeElements(m_generator, m_fields) &&
+            writeElements(m_generator, m_interfaces) &&
+            writeElements(m_generator, m_messages) &&
+            writeElements(m_generator, m_frames);
     }
 
     commsdsl::parse::Namespace dslObj() const
@@ -147,6 +191,10 @@ public:
 
     void setAllInterfacesReferenced()
     {
+        for (auto& nPtr : m_namespaces) {
+            nPtr->setAllInterfacesReferenced();
+        }
+
         for (auto& iPtr : m_interfaces) {
             iPtr->setReferenced(true);
         }
@@ -154,11 +202,26 @@ public:
 
     void setAllMessagesReferenced()
     {
+        for (auto& nPtr : m_namespaces) {
+            nPtr->setAllMessagesReferenced();
+        }
+
         for (auto& mPtr : m_messages) {
             mPtr->setReferenced(true);
         }
     }
 
+    void setAllFramesReferenced()
+    {
+        for (auto& nPtr : m_namespaces) {
+            nPtr->setAllFramesReferenced();
+        }
+
+        for (auto& fPtr : m_frames) {
+            fPtr->setReferenced(true);
+        }
+    }
+
     bool hasReferencedMessageIdField() const
     {
         bool hasInFields = 
@@ -209,7 +272,15 @@ public:
 
     bool hasAnyReferencedComponent() const
     {
-        if (!m_frames.empty()) {
+        bool hasFrame = 
+            std::any_of(
+                m_frames.begin(), m_frames.end(),
+                [](auto& f)
+                {
+                    return f->isReferenced();
+                });   
+
+        if (hasFrame) {
             return true;
         }
 
@@ -261,7 +332,7 @@ public:
 private:
     bool createNamespaces()
     {
-        auto namespaces = m_dslObj.namespaces();
+        auto& namespaces = m_dslObj.namespacesView();
         m_namespaces.reserve(namespaces.size());
         for (auto& n : namespaces) {
             auto ptr = m_generator.createNamespace(n, m_parent);
@@ -293,7 +364,7 @@ private:
             return true;
         }
 
-        auto fields = m_dslObj.fields();
+        auto& fields = m_dslObj.fieldsView();
         m_fields.reserve(fields.size());
         for (auto& dslObj : fields) {
             auto ptr = Field::create(m_generator, dslObj, m_parent);
@@ -306,20 +377,12 @@ private:
 
     bool prepareFields()
     {
-        return 
-            std::all_of(
-                m_fields.begin(), m_fields.end(),
-                [](auto& f)
-                {
-                    assert(f);
-                    return f->prepare();
-                });
-
+        return prepareElements(m_generator, m_fields);
     }
 
     bool createInterfaces()
     {
-        auto interfaces = m_dslObj.interfaces();
+        auto& interfaces = m_dslObj.interfacesView();
         m_interfaces.reserve(interfaces.size());
         for (auto& i : interfaces) {
             auto ptr = m_generator.createInterface(i, m_parent);
@@ -336,19 +399,12 @@ private:
 
     bool prepareInterfaces()
     {
-        return 
-            std::all_of(
-                m_interfaces.begin(), m_interfaces.end(),
-                [](auto& i)
-                {
-                    assert(i);
-                    return i->prepare();
-                });
+        return prepareElements(m_generator, m_interfaces);
     }
 
     bool createMessages()
     {
-        auto messages = m_dslObj.messages();
+        auto& messages = m_dslObj.messagesView();
         m_messages.reserve(messages.size());
         for (auto& m : messages) {
             auto ptr = m_generator.createMessage(m, m_parent);
@@ -364,19 +420,12 @@ private:
 
     bool prepareMessages()
     {
-        return 
-            std::all_of(
-                m_messages.begin(), m_messages.end(),
-                [](auto& m)
-                {
-                    assert(m);
-                    return m->prepare();
-                });
+        return prepareElements(m_generator, m_messages);
     }
 
     bool createFrames()
     {
-        auto frames = m_dslObj.frames();
+        auto& frames = m_dslObj.framesView();
         m_frames.reserve(frames.size());
         for (auto& f : frames) {
             auto ptr = m_generator.createFrame(f, m_parent);
@@ -389,14 +438,7 @@ private:
 
     bool prepareFrames()
     {
-        return 
-            std::all_of(
-                m_frames.begin(), m_frames.end(),
-                [](auto& f)
-                {
-                    assert(f);
-                    return f->prepare();
-                });
+        return prepareElements(m_generator, m_frames);
     }
 
     Generator& m_generator;
@@ -802,6 +844,11 @@ void Namespace::setAllMessagesReferenced()
     m_impl->setAllMessagesReferenced();
 }
 
+void Namespace::setAllFramesReferenced()
+{
+    m_impl->setAllFramesReferenced();
+}
+
 bool Namespace::hasReferencedMessageIdField() const
 {
     return m_impl->hasReferencedMessageIdField();
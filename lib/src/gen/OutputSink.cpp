@@ -0,0 +1,476 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/gen/OutputSink.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+namespace
+{
+
+bool readContents(const std::string& filePath, std::string& contents)
+{
+    std::ifstream stream(filePath, std::ios_base::binary);
+    if (!stream) {
+        return false;
+    }
+
+    contents.assign(std::istreambuf_iterator<char>(stream), (std::istreambuf_iterator<char>()));
+    return true;
+}
+
+bool isPathSep(char ch)
+{
+    return (ch == '/') || (ch == static_cast<char>(std::filesystem::path::preferred_separator));
+}
+
+// Path relative to the root directory with '/' separators and
+// without leading "./" or '/'.
+std::string relativePath(const std::string& rootDir, const std::string& path)
+{
+    std::string result = path;
+    if ((!rootDir.empty()) && (path.compare(0, rootDir.size(), rootDir) == 0)) {
+        if (path.size() == rootDir.size()) {
+            return std::string();
+        }
+
+        if (isPathSep(path[rootDir.size()]) || isPathSep(rootDir.back())) {
+            result = path.substr(rootDir.size());
+        }
+    }
+
+    std::replace_if(result.begin(), result.end(), &isPathSep, '/');
+    while (true) {
+        if ((!result.empty()) && (result[0] == '/')) {
+            result.erase(result.begin());
+            continue;
+        }
+
+        if (result.compare(0, 2, "./") == 0) {
+            result.erase(0, 2);
+            continue;
+        }
+
+        break;
+    }
+
+    if (result == ".") {
+        result.clear();
+    }
+
+    return result;
+}
+
+} // namespace
+
+OutputSink::~OutputSink() = default;
+
+bool OutputSink::createDirectory(const std::string& path, std::string& error)
+{
+    return createDirectoryImpl(path, error);
+}
+
+bool OutputSink::writeFile(const std::string& filePath, const std::string& contents, std::string& error)
+{
+    return writeFileImpl(filePath, contents, error);
+}
+
+bool OutputSink::copyFile(const std::string& srcPath, const std::string& destPath, std::string& error)
+{
+    return copyFileImpl(srcPath, destPath, error);
+}
+
+bool OutputSink::isFileUnchanged(const std::string& filePath, const std::string& contents) const
+{
+    return isFileUnchangedImpl(filePath, contents);
+}
+
+bool OutputSink::finish(std::string& error)
+{
+    return finishImpl(error);
+}
+
+bool OutputSink::copyFileImpl(const std::string& srcPath, const std::string& destPath, std::string& error)
+{
+    std::string contents;
+    if (!readContents(srcPath, contents)) {
+        error = "Failed to read \"" + srcPath + "\".";
+        return false;
+    }
+
+    return writeFileImpl(destPath, contents, error);
+}
+
+bool OutputSink::isFileUnchangedImpl([[maybe_unused]] const std::string& filePath, [[maybe_unused]] const std::string& contents) const
+{
+    return false;
+}
+
+bool OutputSink::finishImpl([[maybe_unused]] std::string& error)
+{
+    return true;
+}
+
+bool FilesystemOutputSink::createDirectoryImpl(const std::string& path, std::string& error)
+{
+    std::error_code ec;
+    if (std::filesystem::is_directory(path, ec)) {
+        return true;
+    }
+
+    std::filesystem::create_directories(path, ec);
+    if (ec) {
+        error = "Failed to create directory \"" + path + "\" with error: " + ec.message();
+        return false;
+    }
+
+    return true;
+}
+
+bool FilesystemOutputSink::writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error)
+{
+    std::ofstream stream(filePath);
+    if (!stream) {
+        error = "Failed to open \"" + filePath + "\" for writing.";
+        return false;
+    }
+
+    stream << contents;
+    stream.flush();
+    if (!stream.good()) {
+        error = "Failed to write \"" + filePath + "\".";
+        return false;
+    }
+
+    return true;
+}
+
+bool FilesystemOutputSink::copyFileImpl(const std::string& srcPath, const std::string& destPath, std::string& error)
+{
+    std::error_code ec;
+    std::filesystem::copy_file(srcPath, destPath, std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) {
+        error = "Failed to copy with reason: " + ec.message();
+        return false;
+    }
+
+    return true;
+}
+
+bool FilesystemOutputSink::isFileUnchangedImpl(const std::string& filePath, const std::string& contents) const
+{
+    std::error_code ec;
+    auto size = std::filesystem::file_size(filePath, ec);
+    if (ec || (size != contents.size())) {
+        return false;
+    }
+
+    std::string existing;
+    return readContents(filePath, existing) && (existing == contents);
+}
+
+class MemoryOutputSinkImpl
+{
+public:
+    explicit MemoryOutputSinkImpl(const std::string& rootDir) : m_rootDir(rootDir) {}
+
+    std::string relPath(const std::string& path) const
+    {
+        return relativePath(m_rootDir, path);
+    }
+
+    MemoryOutputSink::FilesMap& files()
+    {
+        return m_files;
+    }
+
+private:
+    std::string m_rootDir;
+    MemoryOutputSink::FilesMap m_files;
+};
+
+MemoryOutputSink::MemoryOutputSink(const std::string& rootDir) :
+    m_impl(std::make_unique<MemoryOutputSinkImpl>(rootDir))
+{
+}
+
+MemoryOutputSink::~MemoryOutputSink() = default;
+
+const MemoryOutputSink::FilesMap& MemoryOutputSink::files() const
+{
+    return m_impl->files();
+}
+
+MemoryOutputSink::FilesMap MemoryOutputSink::releaseFiles()
+{
+    FilesMap result;
+    result.swap(m_impl->files());
+    return result;
+}
+
+bool MemoryOutputSink::createDirectoryImpl([[maybe_unused]] const std::string& path, [[maybe_unused]] std::string& error)
+{
+    return true;
+}
+
+bool MemoryOutputSink::writeFileImpl(const std::string& filePath, const std::string& contents, [[maybe_unused]] std::string& error)
+{
+    m_impl->files()[m_impl->relPath(filePath)] = contents;
+    return true;
+}
+
+bool MemoryOutputSink::isFileUnchangedImpl(const std::string& filePath, const std::string& contents) const
+{
+    auto& filesMap = m_impl->files();
+    auto iter = filesMap.find(m_impl->relPath(filePath));
+    return (iter != filesMap.end()) && (iter->second == contents);
+}
+
+class TarOutputSinkImpl
+{
+public:
+    TarOutputSinkImpl(std::ostream& stream, const std::string& rootDir) :
+        m_stream(&stream),
+        m_rootDir(rootDir)
+    {
+    }
+
+    TarOutputSinkImpl(const std::string& archivePath, const std::string& rootDir) :
+        m_fileStream(archivePath, std::ios_base::binary | std::ios_base::trunc),
+        m_stream(&m_fileStream),
+        m_archivePath(archivePath),
+        m_rootDir(rootDir)
+    {
+    }
+
+    bool addDirectory(const std::string& path, std::string& error)
+    {
+        auto relPath = relativePath(m_rootDir, path);
+        if (relPath.empty()) {
+            return true;
+        }
+
+        if (relPath.back() != '/') {
+            relPath += '/';
+        }
+
+        return writeHeader(relPath, 0U, DirTypeFlag, DirMode, error);
+    }
+
+    bool addFile(const std::string& filePath, const std::string& contents, std::string& error)
+    {
+        auto relPath = relativePath(m_rootDir, filePath);
+        if (relPath.empty()) {
+            error = "Invalid archive entry path \"" + filePath + "\".";
+            return false;
+        }
+
+        if (!writeHeader(relPath, contents.size(), FileTypeFlag, FileMode, error)) {
+            return false;
+        }
+
+        m_stream->write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        return writePadding(contents.size(), error);
+    }
+
+    bool finish(std::string& error)
+    {
+        if (m_finished) {
+            return true;
+        }
+
+        m_finished = true;
+
+        // End of archive is marked by two zero blocks.
+        Block block = {};
+        m_stream->write(block.data(), static_cast<std::streamsize>(block.size()));
+        m_stream->write(block.data(), static_cast<std::streamsize>(block.size()));
+        m_stream->flush();
+        return checkStream(error);
+    }
+
+private:
+    static const std::size_t BlockSize = 512U;
+    static const char FileTypeFlag = '0';
+    static const char DirTypeFlag = '5';
+    static const unsigned FileMode = 0644;
+    static const unsigned DirMode = 0755;
+
+    using Block = std::array<char, BlockSize>;
+
+    static void writeOctal(char* field, std::size_t fieldLen, std::uintmax_t value)
+    {
+        // The last character of the field is the terminating NUL.
+        assert(1U < fieldLen);
+        field[fieldLen - 1U] = '\0';
+        for (auto idx = fieldLen - 1U; 0U < idx; --idx) {
+            field[idx - 1U] = static_cast<char>('0' + (value & 0x7));
+            value >>= 3U;
+        }
+    }
+
+    // The ustar header allows up to 100 characters of the name and up to
+    // 155 characters of the prefix, the path is split on a separator.
+    static bool splitPath(const std::string& path, std::string& prefix, std::string& name)
+    {
+        static const std::size_t MaxNameLen = 100U;
+        static const std::size_t MaxPrefixLen = 155U;
+
+        if (path.size() <= MaxNameLen) {
+            prefix.clear();
+            name = path;
+            return true;
+        }
+
+        auto sepPos = path.find('/', path.size() - MaxNameLen - 1U);
+        while (sepPos != std::string::npos) {
+            if ((sepPos <= MaxPrefixLen) && ((path.size() - sepPos - 1U) <= MaxNameLen) && (0U < sepPos)) {
+                prefix = path.substr(0, sepPos);
+                name = path.substr(sepPos + 1U);
+                return true;
+            }
+
+            sepPos = path.find('/', sepPos + 1U);
+        }
+
+        return false;
+    }
+
+    bool writeHeader(const std::string& path, std::size_t size, char typeFlag, unsigned mode, std::string& error)
+    {
+        if (m_finished) {
+            error = "Attempt to add \"" + path + "\" to already finished archive.";
+            return false;
+        }
+
+        if (!checkStream(error)) {
+            return false;
+        }
+
+        std::string prefix;
+        std::string name;
+        if (!splitPath(path, prefix, name)) {
+            error = "The path \"" + path + "\" is too long to be stored in the tar archive.";
+            return false;
+        }
+
+        Block block = {};
+        std::memcpy(&block[0], name.data(), name.size());
+        writeOctal(&block[100], 8U, mode);
+        writeOctal(&block[108], 8U, 0U); // uid
+        writeOctal(&block[116], 8U, 0U); // gid
+        writeOctal(&block[124], 12U, size);
+        writeOctal(&block[136], 12U, static_cast<std::uintmax_t>(m_mtime));
+        std::memset(&block[148], ' ', 8U); // checksum placeholder
+        block[156] = typeFlag;
+        std::memcpy(&block[257], "ustar", 6U);
+        std::memcpy(&block[263], "00", 2U);
+        std::memcpy(&block[345], prefix.data(), prefix.size());
+
+        unsigned checksum = 0U;
+        for (auto ch : block) {
+            checksum += static_cast<unsigned char>(ch);
+        }
+
+        writeOctal(&block[148], 7U, checksum);
+        block[155] = ' ';
+
+        m_stream->write(block.data(), static_cast<std::streamsize>(block.size()));
+        return checkStream(error);
+    }
+
+    bool writePadding(std::size_t size, std::string& error)
+    {
+        auto rem = size % BlockSize;
+        if (rem != 0U) {
+            Block block = {};
+            m_stream->write(block.data(), static_cast<std::streamsize>(BlockSize - rem));
+        }
+
+        return checkStream(error);
+    }
+
+    bool checkStream(std::string& error) const
+    {
+        if (m_stream->good()) {
+            return true;
+        }
+
+        if (m_archivePath.empty()) {
+            error = "Failed to write the tar archive.";
+        }
+        else {
+            error = "Failed to write \"" + m_archivePath + "\".";
+        }
+
+        return false;
+    }
+
+    std::ofstream m_fileStream;
+    std::ostream* m_stream = nullptr;
+    std::string m_archivePath;
+    std::string m_rootDir;
+    std::time_t m_mtime = std::time(nullptr);
+    bool m_finished = false;
+};
+
+TarOutputSink::TarOutputSink(std::ostream& stream, const std::string& rootDir) :
+    m_impl(std::make_unique<TarOutputSinkImpl>(stream, rootDir))
+{
+}
+
+TarOutputSink::TarOutputSink(const std::string& archivePath, const std::string& rootDir) :
+    m_impl(std::make_unique<TarOutputSinkImpl>(archivePath, rootDir))
+{
+}
+
+TarOutputSink::~TarOutputSink()
+{
+    std::string error;
+    m_impl->finish(error);
+}
+
+bool TarOutputSink::createDirectoryImpl(const std::string& path, std::string& error)
+{
+    return m_impl->addDirectory(path, error);
+}
+
+bool TarOutputSink::writeFileImpl(const std::string& filePath, const std::string& contents, std::string& error)
+{
+    return m_impl->addFile(filePath, contents, error);
+}
+
+bool TarOutputSink::finishImpl(std::string& error)
+{
+    return m_impl->finish(error);
+}
+
+} // namespace gen
+
+} // namespace commsdsl
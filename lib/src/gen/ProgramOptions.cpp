@@ -13,6 +13,33 @@ namespace commsdsl
 namespace gen
 {
 
+namespace
+{
+
+const std::string StatsStr("stats");
+const std::string TraceJsonStr("trace-json");
+const std::string DepfileStr("depfile");
+const std::string ListOutputsStr("list-outputs");
+const std::string OutputTarStr("output-tar");
+const std::string WatchStr("watch");
+const std::string MessagesStr("messages");
+const std::string FramesStr("frames");
+
+std::vector<std::string> elemRefsFrom(const std::string& value)
+{
+    if (value.empty()) {
+        return std::vector<std::string>();
+    }
+
+    if (util::isFileReadable(value)) {
+        return util::strSplitByAnyChar(util::readFileContents(value), " \t\r\n,");
+    }
+
+    return util::strSplitByAnyChar(value, ",");
+}
+
+} // namespace
+
 class ProgramOptionsImpl
 {
 public:
@@ -280,6 +307,58 @@ ProgramOptions& ProgramOptions::addHelpOption()
     return (*this)("h,help", "This help");
 }
 
+ProgramOptions& ProgramOptions::addStatsOptions()
+{
+    return 
+        (*this)
+        (StatsStr, "Print timing and output statistics of the code generation at the end.")
+        (TraceJsonStr, 
+            "Write timing statistics of the code generation into the provided file in "
+            "Chrome trace event (JSON) format.", true);
+}
+
+ProgramOptions& ProgramOptions::addDepfileOptions()
+{
+    return 
+        (*this)
+        (DepfileStr, 
+            "Write Make / Ninja compatible dependency file listing all the generated files as targets "
+            "and all the schema and code input files (including probed non-existing ones) as prerequisites.", true)
+        (ListOutputsStr, "Print list of files to be generated to standard output without writing them.");
+}
+
+ProgramOptions& ProgramOptions::addOutputArchiveOption()
+{
+    return 
+        (*this)
+        (OutputTarStr, 
+            "Write all the generated files into the provided tar archive instead of the output directory. "
+            "The paths inside the archive are relative to the output directory.", true);
+}
+
+ProgramOptions& ProgramOptions::addWatchOption()
+{
+    return 
+        (*this)
+        (WatchStr, 
+            "Keep running after the code generation and regenerate the code every time one of the "
+            "schema or code input files changes. Only the files with modified contents get rewritten, "
+            "the files which are no longer generated are left behind.");
+}
+
+ProgramOptions& ProgramOptions::addSelectionOptions()
+{
+    return 
+        (*this)
+        (MessagesStr, 
+            "Comma separated list of messages (or file listing them) to generate code for. "
+            "Only the listed messages and the fields they reference are generated. "
+            "Default: all messages.", true)
+        (FramesStr, 
+            "Comma separated list of frames (or file listing them) to generate code for. "
+            "Default: all frames.", true);
+}
+
 ProgramOptions& ProgramOptions::operator()(const std::string& optStr, const std::string& desc, bool hasParam)
 {
     m_impl->add(optStr, desc, hasParam);
@@ -307,6 +386,46 @@ bool ProgramOptions::helpRequested() const
     return isOptUsed("h");
 }
 
+bool ProgramOptions::statsRequested() const
+{
+    return isOptUsed(StatsStr);
+}
+
+const std::string& ProgramOptions::getTraceJsonFile() const
+{
+    return value(TraceJsonStr);
+}
+
+const std::string& ProgramOptions::getDepfile() const
+{
+    return value(DepfileStr);
+}
+
+const std::string& ProgramOptions::getOutputTar() const
+{
+    return value(OutputTarStr);
+}
+
+bool ProgramOptions::listOutputsRequested() const
+{
+    return isOptUsed(ListOutputsStr);
+}
+
+bool ProgramOptions::watchRequested() const
+{
+    return isOptUsed(WatchStr);
+}
+
+ProgramOptions::ElemRefsList ProgramOptions::getSelectedMessages() const
+{
+    return elemRefsFrom(value(MessagesStr));
+}
+
+ProgramOptions::ElemRefsList ProgramOptions::getSelectedFrames() const
+{
+    return elemRefsFrom(value(FramesStr));
+}
+
 const std::string& ProgramOptions::value(const std::string& optStr) const
 {
     return m_impl->value(optStr);
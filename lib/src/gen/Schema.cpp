@@ -257,7 +257,7 @@ public:
 
     bool createAll()
     {
-        auto namespaces = m_dslObj.namespaces();
+        auto& namespaces = m_dslObj.namespacesView();
         m_namespaces.reserve(namespaces.size());
         for (auto& n : namespaces) {
             auto ptr = m_generator.createNamespace(n, m_parent);
@@ -461,6 +461,13 @@ public:
         }
     }
 
+    void setAllFramesReferenced()
+    {
+        for (auto& nPtr : m_namespaces) {
+            nPtr->setAllFramesReferenced();
+        }
+    }
+
     bool hasReferencedMessageIdField() const
     {
         return 
@@ -799,6 +806,11 @@ void Schema::setAllMessagesReferenced()
     m_impl->setAllMessagesReferenced();
 }
 
+void Schema::setAllFramesReferenced()
+{
+    m_impl->setAllFramesReferenced();
+}
+
 bool Schema::hasReferencedMessageIdField() const
 {
     return m_impl->hasReferencedMessageIdField();
@@ -0,0 +1,318 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "commsdsl/gen/Stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace commsdsl
+{
+
+namespace gen
+{
+
+namespace
+{
+
+std::atomic<std::size_t> TemplatesCount(0U);
+std::atomic<std::size_t> TemplatesBytes(0U);
+
+const std::string& categoryName(Stats::Category category)
+{
+    static const std::string Map[] = {
+        "phase",
+        "element",
+    };
+
+    static const std::size_t MapSize = std::extent<decltype(Map)>::value;
+    static_assert(MapSize == Stats::Category_NumOfValues, "Invalid map");
+
+    assert(category < Stats::Category_NumOfValues);
+    return Map[category];
+}
+
+std::string jsonEscape(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (auto ch : str) {
+        if ((ch == '\"') || (ch == '\\')) {
+            result += '\\';
+            result += ch;
+            continue;
+        }
+
+        if (static_cast<unsigned char>(ch) < 0x20) {
+            std::ostringstream stream;
+            stream << "\\u" << std::hex << std::setfill('0') << std::setw(4) << static_cast<unsigned>(ch);
+            result += stream.str();
+            continue;
+        }
+
+        result += ch;
+    }
+    return result;
+}
+
+std::string durationStr(std::chrono::microseconds duration)
+{
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(3) << (static_cast<double>(duration.count()) / 1000.0) << " ms";
+    return stream.str();
+}
+
+} // namespace
+
+class StatsImpl
+{
+public:
+    using Clock = Stats::Clock;
+    using Category = Stats::Category;
+
+    StatsImpl() :
+        m_start(Clock::now())
+    {
+    }
+
+    void setEnabled(bool value)
+    {
+        m_enabled = value;
+        if (value) {
+            m_start = Clock::now();
+            m_templatesCountStart = TemplatesCount;
+            m_templatesBytesStart = TemplatesBytes;
+        }
+    }
+
+    bool isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void recordScope(Category category, const std::string& name, Clock::time_point start, Clock::time_point end)
+    {
+        if (!m_enabled) {
+            return;
+        }
+
+        ScopeInfo info;
+        info.m_category = category;
+        info.m_name = name;
+        info.m_start = std::chrono::duration_cast<std::chrono::microseconds>(start - m_start);
+        info.m_duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        m_scopes.push_back(std::move(info));
+    }
+
+    void recordFileWritten(std::size_t bytes)
+    {
+        ++m_filesCount;
+        m_filesBytes += bytes;
+    }
+
+    std::string summary(unsigned slowestElemsCount) const
+    {
+        using Totals = std::pair<std::chrono::microseconds, unsigned>;
+        std::vector<std::string> phasesOrder;
+        std::map<std::string, Totals> phases;
+        std::map<std::string, Totals> elems;
+        for (auto& s : m_scopes) {
+            auto& map = (s.m_category == Stats::Category_Phase) ? phases : elems;
+            auto iter = map.find(s.m_name);
+            if (iter == map.end()) {
+                if (s.m_category == Stats::Category_Phase) {
+                    phasesOrder.push_back(s.m_name);
+                }
+
+                map.insert(std::make_pair(s.m_name, Totals(s.m_duration, 1U)));
+                continue;
+            }
+
+            iter->second.first += s.m_duration;
+            ++iter->second.second;
+        }
+
+        static const int NameWidth = 60;
+        std::ostringstream stream;
+        stream << "Generation statistics:\n";
+        stream << "  Phases:\n";
+        for (auto& p : phasesOrder) {
+            auto& totals = phases[p];
+            stream << "    " << std::left << std::setw(NameWidth) << p << ' ' << durationStr(totals.first);
+            if (1U < totals.second) {
+                stream << " (" << totals.second << " times)";
+            }
+            stream << '\n';
+        }
+
+        stream << "  Templates processed: " << (TemplatesCount - m_templatesCountStart) <<
+            " (" << (TemplatesBytes - m_templatesBytesStart) << " bytes)\n";
+        stream << "  Files written: " << m_filesCount << " (" << m_filesBytes << " bytes)\n";
+
+        if ((slowestElemsCount == 0U) || (elems.empty())) {
+            return stream.str();
+        }
+
+        std::vector<std::pair<std::string, Totals> > sortedElems(elems.begin(), elems.end());
+        std::stable_sort(
+            sortedElems.begin(), sortedElems.end(),
+            [](auto& first, auto& second)
+            {
+                return second.second.first < first.second.first;
+            });
+
+        if (slowestElemsCount < sortedElems.size()) {
+            sortedElems.resize(slowestElemsCount);
+        }
+
+        stream << "  Slowest elements:\n";
+        for (auto& e : sortedElems) {
+            stream << "    " << std::left << std::setw(NameWidth) << e.first << ' ' << durationStr(e.second.first) << '\n';
+        }
+
+        return stream.str();
+    }
+
+    bool writeTraceJson(const std::string& filePath) const
+    {
+        std::ofstream stream(filePath);
+        if (!stream) {
+            return false;
+        }
+
+        stream << "{\n\"traceEvents\": [\n";
+        bool first = true;
+        for (auto& s : m_scopes) {
+            if (!first) {
+                stream << ",\n";
+            }
+
+            first = false;
+            stream <<
+                "{\"name\": \"" << jsonEscape(s.m_name) << "\", " <<
+                "\"cat\": \"" << categoryName(s.m_category) << "\", " <<
+                "\"ph\": \"X\", " <<
+                "\"ts\": " << s.m_start.count() << ", " <<
+                "\"dur\": " << s.m_duration.count() << ", " <<
+                "\"pid\": 1, \"tid\": 1}";
+        }
+
+        auto endTs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_start).count();
+        if (!first) {
+            stream << ",\n";
+        }
+
+        stream <<
+            "{\"name\": \"counters\", \"ph\": \"C\", \"ts\": " << endTs << ", \"pid\": 1, \"tid\": 1, \"args\": {" <<
+            "\"templates\": " << (TemplatesCount - m_templatesCountStart) << ", " <<
+            "\"templates_bytes\": " << (TemplatesBytes - m_templatesBytesStart) << ", " <<
+            "\"files\": " << m_filesCount << ", " <<
+            "\"files_bytes\": " << m_filesBytes << "}}\n";
+
+        stream << "],\n\"displayTimeUnit\": \"ms\"\n}\n";
+        stream.flush();
+        return stream.good();
+    }
+
+private:
+    struct ScopeInfo
+    {
+        Category m_category = Stats::Category_Phase;
+        std::string m_name;
+        std::chrono::microseconds m_start;
+        std::chrono::microseconds m_duration;
+    };
+
+    using ScopesList = std::vector<ScopeInfo>;
+
+    Clock::time_point m_start;
+    ScopesList m_scopes;
+    std::size_t m_templatesCountStart = 0U;
+    std::size_t m_templatesBytesStart = 0U;
+    std::size_t m_filesCount = 0U;
+    std::size_t m_filesBytes = 0U;
+    bool m_enabled = false;
+};
+
+Stats::Scope::Scope(Stats& stats, Category category, const std::string& name) :
+    m_stats(stats),
+    m_category(category)
+{
+    if (m_stats.isEnabled()) {
+        m_name = name;
+        m_start = Clock::now();
+    }
+}
+
+Stats::Scope::~Scope()
+{
+    if (m_stats.isEnabled()) {
+        m_stats.recordScope(m_category, m_name, m_start, Clock::now());
+    }
+}
+
+Stats::Stats() :
+    m_impl(std::make_unique<StatsImpl>())
+{
+}
+
+Stats::~Stats() = default;
+
+void Stats::setEnabled(bool value)
+{
+    m_impl->setEnabled(value);
+}
+
+bool Stats::isEnabled() const
+{
+    return m_impl->isEnabled();
+}
+
+void Stats::recordScope(Category category, const std::string& name, Clock::time_point start, Clock::time_point end)
+{
+    m_impl->recordScope(category, name, start, end);
+}
+
+void Stats::recordFileWritten(std::size_t bytes)
+{
+    m_impl->recordFileWritten(bytes);
+}
+
+void Stats::recordTemplateProcessed(std::size_t bytes)
+{
+    ++TemplatesCount;
+    TemplatesBytes += bytes;
+}
+
+std::string Stats::summary(unsigned slowestElemsCount) const
+{
+    return m_impl->summary(slowestElemsCount);
+}
+
+bool Stats::writeTraceJson(const std::string& filePath) const
+{
+    return m_impl->writeTraceJson(filePath);
+}
+
+} // namespace gen
+
+} // namespace commsdsl
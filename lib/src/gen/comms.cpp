@@ -136,28 +136,94 @@ void addNamespaceScopeInernal(
     str.append(elemName);
 }
 
-std::string scopeForInternal(
+// Key of the memoized scope stored inside the Elem. The cached scopes don't
+// include the main namespace, which is prepended on every request, to
+// keep them valid when the namespace override changes.
+unsigned scopeCacheKeyInternal(
+    bool common,
+    const Elem& elem,
+    bool addElement,
+    const std::string& sep,
+    const Elem& leaf,
+    bool fieldTypeScope)
+{
+    enum : unsigned
+    {
+        Variant_Element,
+        Variant_NoElement,
+        Variant_FieldTypeParent,
+        Variant_Parent,
+        Variant_NumOfValues
+    };
+
+    assert((sep == ScopeSep) || (sep == PathSep));
+
+    unsigned result = Variant_Parent;
+    if (&elem == &leaf) {
+        result = addElement ? Variant_Element : Variant_NoElement;
+    }
+    else if (fieldTypeScope) {
+        result = Variant_FieldTypeParent;
+    }
+
+    if (sep != ScopeSep) {
+        result += Variant_NumOfValues;
+    }
+
+    if (common) {
+        result += Variant_NumOfValues * 2U;
+    }
+
+    return result;
+}
+
+std::string withMainNamespaceInternal(
+    const Elem& elem,
+    const Generator& generator,
+    bool addMainNamespace,
+    const std::string& sep,
+    const std::string& scope,
+    const std::string& suffix = strings::emptyString())
+{
+    std::string result;
+    auto* mainNs = &strings::emptyString();
+    if (addMainNamespace) {
+        mainNs = &generator.schemaOf(elem).mainNamespace();
+    }
+
+    result.reserve(mainNs->size() + sep.size() + scope.size() + suffix.size());
+    result.append(*mainNs);
+    if ((!result.empty()) && (!scope.empty())) {
+        result.append(sep);
+    }
+
+    result.append(scope);
+    result.append(suffix);
+    return result;
+}
+
+const std::string& scopeForInternal(
     const Elem& elem, 
-    const Generator& generator, 
-    bool addMainNamespace, 
     bool addElement,
     const std::string& sep,
     const Elem* leaf = nullptr)
 {
-    std::string result;
     if (leaf == nullptr) {
         leaf = &elem;
     }
 
     auto fieldTypeScope = (leaf->elemType() == Elem::Type_Field) && (sep == ScopeSep);
+    auto cacheKey = scopeCacheKeyInternal(false, elem, addElement, sep, *leaf, fieldTypeScope);
+    auto* cached = elem.findCachedScope(cacheKey);
+    if (cached != nullptr) {
+        return *cached;
+    }
 
+    std::string result;
     auto* parent = elem.getParent();
     assert(parent != nullptr);
     if (parent->elemType() != Elem::Type_Schema) {
-        result = scopeForInternal(*parent, generator, addMainNamespace, true, sep, leaf);
-    }
-    else if (addMainNamespace) {
-        result = generator.schemaOf(elem).mainNamespace();
+        result = scopeForInternal(*parent, true, sep, leaf);
     }
 
     do {
@@ -206,32 +272,31 @@ std::string scopeForInternal(
 
     } while (false);
 
-    return result;
+    return elem.cacheScope(cacheKey, std::move(result));
 }
 
-std::string commonScopeForInternal(
+const std::string& commonScopeForInternal(
     const Elem& elem, 
-    const Generator& generator, 
-    bool addMainNamespace, 
     bool addElement,
     const std::string& sep,
     const Elem* leaf = nullptr)
 {
-    std::string result;
-
     if (leaf == nullptr) {
         leaf = &elem;
     }
 
     auto fieldTypeScope = (leaf->elemType() == Elem::Type_Field) && (sep == ScopeSep);
+    auto cacheKey = scopeCacheKeyInternal(true, elem, addElement, sep, *leaf, fieldTypeScope);
+    auto* cached = elem.findCachedScope(cacheKey);
+    if (cached != nullptr) {
+        return *cached;
+    }
 
+    std::string result;
     auto* parent = elem.getParent();
     assert(parent != nullptr);
     if (parent->elemType() != Elem::Type_Schema) {
-        result = commonScopeForInternal(*parent, generator, addMainNamespace, true, sep, leaf);
-    }
-    else if (addMainNamespace) {
-        result = generator.schemaOf(elem).mainNamespace();
+        result = commonScopeForInternal(*parent, true, sep, leaf);
     }
 
     do {
@@ -268,6 +333,18 @@ std::string commonScopeForInternal(
 
     } while (false);
 
+    return elem.cacheScope(cacheKey, std::move(result));
+}
+
+std::string outputPathInternal(const std::string& dir, const std::string& subDir, const std::string& relPath)
+{
+    std::string result;
+    result.reserve(dir.size() + subDir.size() + relPath.size() + 2U);
+    result.append(dir);
+    result.append(PathSep);
+    result.append(subDir);
+    result.append(PathSep);
+    result.append(relPath);
     return result;
 }
 
@@ -325,7 +402,10 @@ std::string scopeFor(
     bool addMainNamespace, 
     bool addElement)
 {
-    return scopeForInternal(elem, generator, addMainNamespace, addElement, ScopeSep);
+    return 
+        withMainNamespaceInternal(
+            elem, generator, addMainNamespace, ScopeSep,
+            scopeForInternal(elem, addElement, ScopeSep));
 }
 
 std::string commonScopeFor(
@@ -334,7 +414,10 @@ std::string commonScopeFor(
     bool addMainNamespace, 
     bool addElement)
 {
-    return commonScopeForInternal(elem, generator, addMainNamespace, addElement, ScopeSep);
+    return 
+        withMainNamespaceInternal(
+            elem, generator, addMainNamespace, ScopeSep,
+            commonScopeForInternal(elem, addElement, ScopeSep));
 }
 
 std::string scopeForInterface(
@@ -439,17 +522,26 @@ std::string scopeForCustomLayer(
 
 std::string relHeaderPathFor(const Elem& elem, const Generator& generator, bool addMainNamespace)
 {
-    return scopeForInternal(elem, generator, addMainNamespace, true, PathSep) + strings::cppHeaderSuffixStr();    
+    return 
+        withMainNamespaceInternal(
+            elem, generator, addMainNamespace, PathSep,
+            scopeForInternal(elem, true, PathSep), strings::cppHeaderSuffixStr());
 }
 
 std::string relSourcePathFor(const Elem& elem, const Generator& generator, bool addMainNamespace)
 {
-    return scopeForInternal(elem, generator, addMainNamespace, true, PathSep) + strings::cppSourceSuffixStr();    
+    return 
+        withMainNamespaceInternal(
+            elem, generator, addMainNamespace, PathSep,
+            scopeForInternal(elem, true, PathSep), strings::cppSourceSuffixStr());
 }
 
 std::string relCommonHeaderPathFor(const Elem& elem, const Generator& generator)
 {
-    return commonScopeForInternal(elem, generator, true, true, PathSep) + strings::cppHeaderSuffixStr();    
+    return 
+        withMainNamespaceInternal(
+            elem, generator, true, PathSep,
+            commonScopeForInternal(elem, true, PathSep), strings::cppHeaderSuffixStr());
 }
 
 std::string relHeaderPathForField(const std::string& name, const Generator& generator)
@@ -531,12 +623,12 @@ std::string relSourceForRoot(const std::string& name, const Generator& generator
 
 std::string headerPathFor(const Elem& elem, const Generator& generator)
 {
-    return generator.getOutputDir() + '/' + strings::includeDirStr() + '/' + relHeaderPathFor(elem, generator);
+    return outputPathInternal(generator.getOutputDir(), strings::includeDirStr(), relHeaderPathFor(elem, generator));
 }
 
 std::string sourcePathFor(const Elem& elem, const Generator& generator)
 {
-    return generator.getOutputDir() + '/' + strings::srcDirStr() + '/' + relSourcePathFor(elem, generator);
+    return outputPathInternal(generator.getOutputDir(), strings::srcDirStr(), relSourcePathFor(elem, generator));
 }
 
 std::string headerPathForField(const std::string& name, const Generator& generator)
@@ -566,7 +658,7 @@ std::string headerPathForFactory(const std::string& name, const Generator& gener
 
 std::string commonHeaderPathFor(const Elem& elem, const Generator& generator)
 {
-    return generator.getOutputDir() + '/' + strings::includeDirStr() + '/' + relCommonHeaderPathFor(elem, generator);
+    return outputPathInternal(generator.getOutputDir(), strings::includeDirStr(), relCommonHeaderPathFor(elem, generator));
 }
 
 std::string headerPathRoot(const std::string& name, const Generator& generator)
@@ -1098,6 +1190,16 @@ std::size_t addLength(std::size_t len1, std::size_t len2)
     return len1 + len2;
 }
 
+bool isExtraAttributeEnabled(const commsdsl::parse::Field::AttributesMap& attrs, const std::string& name)
+{
+    auto iter = attrs.find(name);
+    if (iter == attrs.end()) {
+        return false;
+    }
+
+    auto value = util::strToLower(iter->second);
+    return (value == "true") || (value == "1");
+}
 
 } // namespace comms
 
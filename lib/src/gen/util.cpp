@@ -1,5 +1,6 @@
 #include "commsdsl/gen/util.h"
 
+#include "commsdsl/gen/Stats.h"
 #include "commsdsl/gen/strings.h"
 
 #include <algorithm>
@@ -487,6 +488,8 @@ std::string processTemplate(const std::string& templ, const ReplacementMap& repl
     if (tidyCode) {
         doTidyCode(result);
     }
+
+    Stats::recordTemplateProcessed(result.size());
     return result;
 }
 
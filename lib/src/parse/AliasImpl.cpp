@@ -46,7 +46,7 @@ const XmlWrap::NamesList& commonProps()
 
 AliasImpl::Ptr AliasImpl::clone() const
 {
-    Ptr ptr(new AliasImpl(m_node, m_protocol));
+    Ptr ptr(new AliasImpl(getNode(), m_protocol));
     ptr->m_state = m_state;
     return ptr;
 }
@@ -58,9 +58,9 @@ AliasImpl::Ptr AliasImpl::create(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool AliasImpl::parse()
 {
-    auto props = XmlWrap::parseNodeProps(m_node);
+    auto props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), props)) {
         return false;
     }
 
@@ -115,7 +115,7 @@ bool AliasImpl::verifyAlias(
             });
 
     if (fieldSameNameIter != fields.end()) {
-        logError(m_protocol.logger()) << XmlWrap::logPrefix(getNode()) <<
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(location()) <<
             "Cannot create alias with name \"" << aliasName << "\", because field "
             "with the same name has been already defined.";
         return false;
@@ -130,7 +130,7 @@ bool AliasImpl::verifyAlias(
             });
 
     if (aliasSameNameIter != aliases.end()) {
-        logError(m_protocol.logger()) << XmlWrap::logPrefix(getNode()) <<
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(location()) <<
             "Cannot create alias with name \"" << aliasName << "\", because other alias "
             "with the same name has been already defined.";
         return false;
@@ -151,7 +151,7 @@ bool AliasImpl::verifyAlias(
     auto reportNotFoundFieldFunc =
         [this, &aliasedFieldName]()
         {
-            logError(m_protocol.logger()) << XmlWrap::logPrefix(getNode()) <<
+            logError(m_protocol.logger()) << XmlWrap::logPrefix(location()) <<
                 "Aliased field(s) with name \"" << aliasedFieldName << "\", hasn't been found.";
         };
 
@@ -244,17 +244,17 @@ bool AliasImpl::validateAndUpdateStringPropValue(
 
 bool AliasImpl::validateSinglePropInstance(const PropsMap& props, const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, props, str, m_protocol.logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), props, str, m_protocol.logger(), mustHave);
 }
 
 void AliasImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, common::aliasStr(), propName, propValue, m_protocol.logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), common::aliasStr(), propName, propValue, m_protocol.logger());
 }
 
 bool AliasImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
 {
-    auto extraAttrs = XmlWrap::getExtraAttributes(m_node, names, m_protocol);
+    auto extraAttrs = XmlWrap::getExtraAttributes(getNode(), names, m_protocol);
     if (extraAttrs.empty()) {
         return true;
     }
@@ -270,7 +270,7 @@ bool AliasImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
 
 bool AliasImpl::updateExtraChildren(const XmlWrap::NamesList& names)
 {
-    auto extraChildren = XmlWrap::getExtraChildren(m_node, names, m_protocol);
+    auto extraChildren = XmlWrap::getExtraChildren(getNode(), names, m_protocol);
     if (extraChildren.empty()) {
         return true;
     }
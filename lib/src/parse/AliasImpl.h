@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <string>
 #include <memory>
 
@@ -33,6 +34,7 @@ class AliasImpl
 {
 public:
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using Ptr = std::unique_ptr<AliasImpl>;
 
@@ -51,12 +53,12 @@ public:
         return m_state.m_fieldName;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_state.m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_state.m_extraAttrs;
     }
@@ -79,13 +81,20 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool verifyAlias(const std::vector<Ptr>& aliases, const std::vector<FieldImplPtr>& fields) const;
 
 protected:
-    AliasImpl(::xmlNodePtr node, ProtocolImpl& protocol) : m_node(node), m_protocol(protocol) {}
+    AliasImpl(::xmlNodePtr node, ProtocolImpl& protocol) : m_node(node), m_location(XmlWrap::location(node)), m_protocol(protocol) {}
 
 private:
 
@@ -104,6 +113,7 @@ private:
     bool updateExtraChildren(const XmlWrap::NamesList& names);
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
 
     struct State
@@ -111,7 +121,7 @@ private:
         std::string m_name;
         std::string m_description;
         std::string m_fieldName;
-        PropsMap m_extraAttrs;
+        AttributesMap m_extraAttrs;
         ContentsList m_extraChildren;
     };
 
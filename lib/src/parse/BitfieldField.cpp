@@ -57,6 +57,11 @@ BitfieldField::Members BitfieldField::members() const
     return cast(m_pImpl)->membersList();
 }
 
+const BitfieldField::Members& BitfieldField::membersView() const
+{
+    return cast(m_pImpl)->cachedMembersList();
+}
+
 } // namespace parse
 
 } // namespace commsdsl
@@ -70,6 +70,11 @@ BitfieldFieldImpl::Members BitfieldFieldImpl::membersList() const
     return result;
 }
 
+const BitfieldFieldImpl::Members& BitfieldFieldImpl::cachedMembersList() const
+{
+    return m_membersListCache.get([this]() { return membersList(); });
+}
+
 const XmlWrap::NamesList& BitfieldFieldImpl::supportedTypes()
 {
     static const XmlWrap::NamesList Names = {
@@ -145,14 +150,14 @@ bool BitfieldFieldImpl::replaceMembersImpl(FieldsList& members)
                 });
 
         if (iter == m_members.end()) {
-            logError() << XmlWrap::logPrefix(mem->getNode()) <<
+            logError() << XmlWrap::logPrefix(mem->location()) <<
                 "Cannot find reused member with name \"" << mem->name() << "\" to replace.";
             return false;
         }
 
         if ((mem->getSinceVersion() != getSinceVersion()) ||
             (mem->getDeprecated() != getDeprecated())) {
-            logError() << XmlWrap::logPrefix(mem->getNode()) <<
+            logError() << XmlWrap::logPrefix(mem->location()) <<
                 "Bitfield replacing members are not allowed to update \"" << common::sinceVersionStr() << "\" and "
                 "\"" << common::deprecatedStr() << "\" properties.";
             return false;
@@ -268,7 +273,7 @@ bool BitfieldFieldImpl::updateMembers()
     do {
         auto membersNodes = XmlWrap::getChildren(getNode(), common::membersStr());
         if (1U < membersNodes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Only single \"" << common::membersStr() << "\" child element is "
                           "supported for \"" << common::bitfieldStr() << "\".";
             return false;
@@ -276,7 +281,7 @@ bool BitfieldFieldImpl::updateMembers()
 
         auto memberFieldsTypes = XmlWrap::getChildren(getNode(), supportedTypes());
         if ((0U < membersNodes.size()) && (0U < memberFieldsTypes.size())) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::bitfieldStr() << "\" element does not support "
                           "list of stand alone member fields as child elements together with \"" <<
                           common::membersStr() << "\" child element.";
@@ -285,7 +290,7 @@ bool BitfieldFieldImpl::updateMembers()
 
         if ((0U == membersNodes.size()) && (0U == memberFieldsTypes.size())) {
             if (m_members.empty()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The \"" << common::bitfieldStr() << "\" must contain member fields.";
                 return false;
             }
@@ -294,7 +299,7 @@ bool BitfieldFieldImpl::updateMembers()
         }
 
         if (!m_members.empty()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::bitfieldStr() << "\" cannot add member fields after reuse.";
             return false;
         }
@@ -303,7 +308,7 @@ bool BitfieldFieldImpl::updateMembers()
             assert(0U == membersNodes.size());
             auto allChildren = XmlWrap::getChildren(getNode());
             if (allChildren.size() != memberFieldsTypes.size()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The member types of \"" << common::bitfieldStr() <<
                               "\" must be defined inside \"<" << common::membersStr() << ">\" child element "
                               "when there are other property describing children.";
@@ -333,7 +338,7 @@ bool BitfieldFieldImpl::updateMembers()
                 static constexpr bool Should_not_happen = false;
                 static_cast<void>(Should_not_happen);
                 assert(Should_not_happen);
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "Internal error, failed to create objects for member fields.";
                 return false;
             }
@@ -345,7 +350,7 @@ bool BitfieldFieldImpl::updateMembers()
 
             if ((mem->getSinceVersion() != getSinceVersion()) ||
                 (mem->getDeprecated() != getDeprecated())) {
-                logError() << XmlWrap::logPrefix(mem->getNode()) <<
+                logError() << XmlWrap::logPrefix(mem->location()) <<
                     "Bitfield members are not allowed to update \"" << common::sinceVersionStr() << "\" and "
                     "\"" << common::deprecatedStr() << "\" properties.";
                 return false;
@@ -367,7 +372,7 @@ bool BitfieldFieldImpl::updateMembers()
                 });
 
         if ((totalBitLength % 8U) != 0) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The summary of member's bit lengths (" << totalBitLength <<
                           ") is expected to be devisable by 8.";
             return false;
@@ -375,7 +380,7 @@ bool BitfieldFieldImpl::updateMembers()
 
         static const std::size_t MaxBits = std::numeric_limits<std::uint64_t>::digits;
         if (MaxBits < totalBitLength) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The summary of member's bit lengths (" << totalBitLength <<
                           ") cannot be greater than " << MaxBits << '.';
             return false;
@@ -18,6 +18,7 @@
 #include "commsdsl/parse/Endian.h"
 #include "commsdsl/parse/BitfieldField.h"
 #include "FieldImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -39,6 +40,7 @@ public:
     }
 
     Members membersList() const;
+    const Members& cachedMembersList() const;
 
     static const XmlWrap::NamesList& supportedTypes();
 
@@ -66,6 +68,7 @@ private:
 
     Endian m_endian = Endian_NumOfValues;
     FieldsList m_members;
+    CachedList<Members> m_membersListCache;
 };
 
 } // namespace parse
@@ -52,11 +52,21 @@ BundleField::Members BundleField::members() const
     return cast(m_pImpl)->membersList();
 }
 
+const BundleField::Members& BundleField::membersView() const
+{
+    return cast(m_pImpl)->cachedMembersList();
+}
+
 BundleField::Aliases BundleField::aliases() const
 {
     return cast(m_pImpl)->aliasesList();
 }
 
+const BundleField::Aliases& BundleField::aliasesView() const
+{
+    return cast(m_pImpl)->cachedAliasesList();
+}
+
 } // namespace parse
 
 } // namespace commsdsl
@@ -77,6 +77,11 @@ BundleFieldImpl::Members BundleFieldImpl::membersList() const
     return result;
 }
 
+const BundleFieldImpl::Members& BundleFieldImpl::cachedMembersList() const
+{
+    return m_membersListCache.get([this]() { return membersList(); });
+}
+
 BundleFieldImpl::AliasesList BundleFieldImpl::aliasesList() const
 {
     AliasesList result;
@@ -90,6 +95,11 @@ BundleFieldImpl::AliasesList BundleFieldImpl::aliasesList() const
     return result;
 }
 
+const BundleFieldImpl::AliasesList& BundleFieldImpl::cachedAliasesList() const
+{
+    return m_aliasesListCache.get([this]() { return aliasesList(); });
+}
+
 FieldImpl::Kind BundleFieldImpl::kindImpl() const
 {
     return Kind::Bundle;
@@ -177,7 +187,7 @@ bool BundleFieldImpl::replaceMembersImpl(FieldsList& members)
                 });
 
         if (iter == m_members.end()) {
-            logError() << XmlWrap::logPrefix(mem->getNode()) <<
+            logError() << XmlWrap::logPrefix(mem->location()) <<
                 "Cannot find reused member with name \"" << mem->name() << "\" to replace.";
             return false;
         }
@@ -306,7 +316,7 @@ bool BundleFieldImpl::updateMembers()
     do {
         auto membersNodes = XmlWrap::getChildren(getNode(), common::membersStr());
         if (1U < membersNodes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Only single \"" << common::membersStr() << "\" child element is "
                           "supported for \"" << common::bundleStr() << "\".";
             return false;
@@ -314,7 +324,7 @@ bool BundleFieldImpl::updateMembers()
 
         auto memberFieldsTypes = XmlWrap::getChildren(getNode(), bundleSupportedTypes());
         if ((0U < membersNodes.size()) && (0U < memberFieldsTypes.size())) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::bundleStr() << "\" element does not support "
                           "list of stand alone member fields as child elements together with \"" <<
                           common::membersStr() << "\" child element.";
@@ -323,7 +333,7 @@ bool BundleFieldImpl::updateMembers()
 
         if ((0U == membersNodes.size()) && (0U == memberFieldsTypes.size())) {
             if (m_members.empty()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The \"" << common::bundleStr() << "\" must contain member fields.";
                 return false;
             }
@@ -335,7 +345,7 @@ bool BundleFieldImpl::updateMembers()
             assert(0U == membersNodes.size());
             auto allChildren = XmlWrap::getChildren(getNode());
             if (allChildren.size() != memberFieldsTypes.size()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The member types of \"" << common::bundleStr() <<
                               "\" must be defined inside \"<" << common::membersStr() << ">\" child element "
                               "when there are other property describing children.";
@@ -365,7 +375,7 @@ bool BundleFieldImpl::updateMembers()
                 static constexpr bool Should_not_happen = false;
                 static_cast<void>(Should_not_happen);
                 assert(Should_not_happen);
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "Internal error, failed to create objects for member fields.";
                 return false;
             }
@@ -397,7 +407,7 @@ bool BundleFieldImpl::updateMembers()
             });
 
     if (!hasSameVer) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "There must be at least one member with the same version as the parent bundle.";
         return false;
     }
@@ -411,7 +421,7 @@ bool BundleFieldImpl::updateMembers()
             });
 
     if (1 < lengthFieldsCount) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "No more that single field with semantiType=\"" << common::lengthStr() << "\" "
             "is allowed within \"" << common::bundleStr() << "\".";
         return false;
@@ -463,7 +473,7 @@ bool BundleFieldImpl::updateAliases()
             static constexpr bool Should_not_happen = false;
             static_cast<void>(Should_not_happen);
             assert(Should_not_happen);
-            logError() << XmlWrap::logPrefix(alias->getNode()) <<
+            logError() << XmlWrap::logPrefix(alias->location()) <<
                   "Internal error, failed to create objects for member aliases.";
             return false;
         }
@@ -18,6 +18,7 @@
 #include "commsdsl/parse/BundleField.h"
 #include "FieldImpl.h"
 #include "AliasImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -35,7 +36,9 @@ public:
     using AliasesList = BundleField::Aliases;
 
     Members membersList() const;
+    const Members& cachedMembersList() const;
     AliasesList aliasesList() const;
+    const AliasesList& cachedAliasesList() const;
 
     const std::vector<AliasImplPtr>& aliases() const
     {
@@ -69,6 +72,8 @@ private:
 
     FieldsList m_members;
     std::vector<AliasImplPtr> m_aliases;
+    CachedList<Members> m_membersListCache;
+    CachedList<AliasesList> m_aliasesListCache;
 };
 
 } // namespace parse
@@ -0,0 +1,67 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace commsdsl
+{
+
+namespace parse
+{
+
+// Lazily built list of the public handles to the elements owned by the
+// Impl object. The list is built on the first access, which is expected
+// to happen after the validation when the owned elements don't change any more.
+// The build is performed only once even when the first accesses are concurrent.
+// The copies of the owning object own different elements, hence
+// the cached list is never copied.
+template <typename TList>
+class CachedList
+{
+public:
+    CachedList() = default;
+    CachedList(const CachedList&) {}
+    CachedList& operator=(const CachedList&)
+    {
+        m_list = TList();
+        m_builtFlag = std::make_unique<std::once_flag>();
+        return *this;
+    }
+
+    template <typename TFunc>
+    const TList& get(TFunc&& buildFunc) const
+    {
+        std::call_once(
+            *m_builtFlag,
+            [this, &buildFunc]()
+            {
+                m_list = std::forward<TFunc>(buildFunc)();
+            });
+
+        return m_list;
+    }
+
+private:
+    mutable TList m_list;
+    std::unique_ptr<std::once_flag> m_builtFlag = std::make_unique<std::once_flag>();
+};
+
+} // namespace parse
+
+} // namespace commsdsl
@@ -69,7 +69,7 @@ bool ChecksumLayerImpl::verifyImpl(const LayerImpl::LayersList& layers)
     assert(thisIdx < layers.size());
 
     if (from().empty() && until().empty()) {
-        logError() << XmlWrap::logPrefix(getNode()) << 
+        logError() << XmlWrap::logPrefix(location()) << 
             "Checksum layer must set \"" << common::fromStr() << "\" or \"" << 
             common::untilStr() << "\" property to indicate on what values checksum is calculated.";
         return false;
@@ -83,7 +83,7 @@ bool ChecksumLayerImpl::verifyImpl(const LayerImpl::LayersList& layers)
         }
 
         if (thisIdx <= fromIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Layer \"" << from() << "\" must appear before the \"" << name() << "\".";
             return false;
         }
@@ -97,7 +97,7 @@ bool ChecksumLayerImpl::verifyImpl(const LayerImpl::LayersList& layers)
         }
 
         if (untilIdx <= thisIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Layer \"" << until() << "\" must appear after the \"" << name() << "\".";
             return false;
         }
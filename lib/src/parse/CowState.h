@@ -0,0 +1,84 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <memory>
+#include <utility>
+
+namespace commsdsl
+{
+
+namespace parse
+{
+
+// Copy-on-write holder of the parsed state. Copies share the same state
+// object, which gets privately copied on the first non-const access.
+template <typename T>
+class CowState
+{
+public:
+    CowState() : m_ptr(std::make_shared<T>()) {}
+    CowState(const CowState&) = default;
+    CowState(CowState&&) = default;
+    CowState& operator=(const CowState&) = default;
+    CowState& operator=(CowState&&) = default;
+
+    CowState& operator=(T&& value)
+    {
+        m_ptr = std::make_shared<T>(std::move(value));
+        return *this;
+    }
+
+    const T& operator*() const
+    {
+        return *m_ptr;
+    }
+
+    const T* operator->() const
+    {
+        return m_ptr.get();
+    }
+
+    T& operator*()
+    {
+        return mutate();
+    }
+
+    T* operator->()
+    {
+        return &mutate();
+    }
+
+    bool isShared() const
+    {
+        return 1 < m_ptr.use_count();
+    }
+
+private:
+    T& mutate()
+    {
+        if (isShared()) {
+            m_ptr = std::make_shared<T>(*m_ptr);
+        }
+
+        return *m_ptr;
+    }
+
+    std::shared_ptr<T> m_ptr;
+};
+
+} // namespace parse
+
+} // namespace commsdsl
@@ -103,7 +103,7 @@ bool CustomLayerImpl::updateSemanticLayerType()
     }
 
     if (!protocol().isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << prop << "\" is not supported for selected dslVersion, ignoring...";
         return true;
     }
@@ -113,7 +113,7 @@ bool CustomLayerImpl::updateSemanticLayerType()
     }
 
     if (m_sematicLayerType != Kind::Custom) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot use \"" + prop + "\" property when semantic type was specified by other (deprecated) properties";        
 
         return false;
@@ -152,13 +152,13 @@ bool CustomLayerImpl::updateChecksumFrom()
     }
 
     if (!protocol().isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << prop << "\" is not supported for selected dslVersion, ignoring...";
         return true;
     }
 
     if (m_sematicLayerType != Kind::Checksum) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << prop << "\" is not applicable to selected \"" << common::semanticLayerTypeStr() << "\", ignoring...";
         return true;        
     }    
@@ -180,13 +180,13 @@ bool CustomLayerImpl::updateChecksumUntil()
     }
 
     if (!protocol().isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << prop << "\" is not supported for selected dslVersion, ignoring...";
         return true;
     }
 
     if (m_sematicLayerType != Kind::Checksum) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << prop << "\" is not applicable to selected \"" << common::semanticLayerTypeStr() << "\", ignoring...";
         return true;        
     }
@@ -205,7 +205,7 @@ bool CustomLayerImpl::verifyChecksumInternal(const LayersList& layers)
     assert(thisIdx < layers.size());
 
     if (m_checksumFromLayer.empty() && m_checksumUntilLayer.empty()) {
-        logError() << XmlWrap::logPrefix(getNode()) << 
+        logError() << XmlWrap::logPrefix(location()) << 
             "Custom layer with " + common::semanticLayerTypeStr() << "=\"" << common::checksumStr() << "\" must set \"" << 
             common::checksumFromStr() << "\" or \"" << 
             common::checksumUntilStr() << "\" property to indicate on what values checksum is calculated.";
@@ -220,7 +220,7 @@ bool CustomLayerImpl::verifyChecksumInternal(const LayersList& layers)
         }
 
         if (thisIdx <= fromIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Layer \"" << m_checksumFromLayer << "\" must appear before the \"" << name() << "\".";
             return false;
         }
@@ -234,7 +234,7 @@ bool CustomLayerImpl::verifyChecksumInternal(const LayersList& layers)
         }
 
         if (untilIdx <= thisIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Layer \"" << m_checksumUntilLayer << "\" must appear after the \"" << name() << "\".";
             return false;
         }
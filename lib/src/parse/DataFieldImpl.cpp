@@ -55,7 +55,7 @@ DataFieldImpl::DataFieldImpl(const DataFieldImpl& other)
     m_state(other.m_state)
 {
     if (other.m_prefixField) {
-        assert(other.m_state.m_extPrefixField == nullptr);
+        assert(other.m_state->m_extPrefixField == nullptr);
         m_prefixField = other.m_prefixField->clone();
     }
 }
@@ -99,7 +99,7 @@ bool DataFieldImpl::reuseImpl(const FieldImpl& other)
     auto& castedOther = static_cast<const DataFieldImpl&>(other);
     m_state = castedOther.m_state;
     if (castedOther.m_prefixField) {
-        assert(m_state.m_extPrefixField == nullptr);
+        assert(m_state->m_extPrefixField == nullptr);
         m_prefixField = castedOther.m_prefixField->clone();
     }
     else {
@@ -118,18 +118,18 @@ bool DataFieldImpl::parseImpl()
 
 bool DataFieldImpl::verifySiblingsImpl(const FieldImpl::FieldsList& fields) const
 {
-    if (m_state.m_detachedPrefixField.empty()) {
+    if (m_state->m_detachedPrefixField.empty()) {
         return true;
     }
 
-    auto* sibling = findSibling(fields, m_state.m_detachedPrefixField);
+    auto* sibling = findSibling(fields, m_state->m_detachedPrefixField);
     if (sibling == nullptr) {
         return false;
     }
 
     auto fieldKind = getNonRefFieldKind(*sibling);
     if ((fieldKind != Kind::Int) && (sibling->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Detached length prefix is expected to be of \"" << common::intStr() << "\" type "
             "or have semanticType=\"length\" property set.";
         return false;
@@ -141,8 +141,8 @@ bool DataFieldImpl::verifySiblingsImpl(const FieldImpl::FieldsList& fields) cons
 
 std::size_t DataFieldImpl::minLengthImpl() const
 {
-    if (m_state.m_length != 0U) {
-        return m_state.m_length;
+    if (m_state->m_length != 0U) {
+        return m_state->m_length;
     }
 
     if (hasPrefixField()) {
@@ -154,8 +154,8 @@ std::size_t DataFieldImpl::minLengthImpl() const
 
 std::size_t DataFieldImpl::maxLengthImpl() const
 {
-    if (m_state.m_length != 0U) {
-        return m_state.m_length;
+    if (m_state->m_length != 0U) {
+        return m_state->m_length;
     }
 
     if (hasPrefixField()) {
@@ -180,7 +180,7 @@ bool DataFieldImpl::strToDataImpl(const std::string& ref, std::vector<std::uint8
         return false;
     }
 
-    val = m_state.m_defaultValue;
+    val = m_state->m_defaultValue;
     return true;
 }
 
@@ -196,8 +196,8 @@ bool DataFieldImpl::updateDefaultValue()
             break;
         }
 
-        if (!strToValue(iter->second, m_state.m_defaultValue)) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if (!strToValue(iter->second, m_state->m_defaultValue)) {
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Property \"" << common::defaultValueStr() << "\" of element \"" << name() <<
                 "\" has unexpected value (" << iter->second << "), expected to "
                 "be hex values string with even number of non-white characters.";
@@ -205,9 +205,9 @@ bool DataFieldImpl::updateDefaultValue()
         }
 
     } while (false);
-    if ((m_state.m_length != 0U) &&
-        (m_state.m_length < m_state.m_defaultValue.size())) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+    if ((m_state->m_length != 0U) &&
+        (m_state->m_length < m_state->m_defaultValue.size())) {
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "The default value is too long "
             "for proper serialisation.";
     }
@@ -233,17 +233,17 @@ bool DataFieldImpl::updateLength()
         return false;
     }
 
-    if (m_state.m_length == newVal) {
+    if (m_state->m_length == newVal) {
         return true;
     }
 
     if (hasPrefixField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot force fixed length after reusing data sequence with length prefix.";
         return false;
     }
 
-    m_state.m_length = newVal;
+    m_state->m_length = newVal;
     return true;
 }
 
@@ -258,8 +258,8 @@ bool DataFieldImpl::updatePrefix()
         return true;
     }
 
-    if (m_state.m_length != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_length != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Length prefix field is not applicable to fixed length data sequences.";
         return false;
     }
@@ -289,29 +289,29 @@ bool DataFieldImpl::checkPrefixFromRef()
             return false;
         }
 
-        m_state.m_detachedPrefixField = std::string(str, 1);
-        common::normaliseString(m_state.m_detachedPrefixField);
+        m_state->m_detachedPrefixField = std::string(str, 1);
+        common::normaliseString(m_state->m_detachedPrefixField);
 
-        if (m_state.m_detachedPrefixField.empty()) {
+        if (m_state->m_detachedPrefixField.empty()) {
             reportUnexpectedPropertyValue(common::lengthPrefixStr(), str);
             return false;
         }
 
-        m_state.m_extPrefixField = nullptr;
+        m_state->m_extPrefixField = nullptr;
         m_prefixField.reset();
         return true;
     }
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << common::lengthPrefixStr() <<
             "\" property (" << iter->second << ").";
         return false;
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The field referenced by \"" << common::lengthPrefixStr() <<
             "\" property (" << iter->second << ") must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
@@ -319,9 +319,9 @@ bool DataFieldImpl::checkPrefixFromRef()
     }
 
     m_prefixField.reset();
-    m_state.m_extPrefixField = field;
+    m_state->m_extPrefixField = field;
     assert(hasPrefixField());
-    m_state.m_detachedPrefixField.clear();
+    m_state->m_detachedPrefixField.clear();
     return true;
 }
 
@@ -361,7 +361,7 @@ bool DataFieldImpl::checkPrefixAsChild()
     }
 
     if (hasInProps) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << common::lengthPrefixStr() << "\" element is expected to define only "
             "single field";
         return false;
@@ -385,23 +385,23 @@ bool DataFieldImpl::checkPrefixAsChild()
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << common::lengthPrefixStr() << "\" element must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
         return false;
     }      
 
-    m_state.m_extPrefixField = nullptr;
+    m_state->m_extPrefixField = nullptr;
     m_prefixField = std::move(field);
-    m_state.m_detachedPrefixField.clear();
+    m_state->m_detachedPrefixField.clear();
     return true;
 }
 
 const FieldImpl* DataFieldImpl::getPrefixField() const
 {
-    if (m_state.m_extPrefixField != nullptr) {
+    if (m_state->m_extPrefixField != nullptr) {
         assert(!m_prefixField);
-        return m_state.m_extPrefixField;
+        return m_state->m_extPrefixField;
     }
 
     assert(m_prefixField);
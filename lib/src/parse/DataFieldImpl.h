@@ -41,23 +41,23 @@ public:
 
     const ValueType& defaultValue() const
     {
-        return m_state.m_defaultValue;
+        return m_state->m_defaultValue;
     }
 
     std::size_t length() const
     {
-        return m_state.m_length;
+        return m_state->m_length;
     }
 
     bool hasPrefixField() const
     {
-        return (m_state.m_extPrefixField != nullptr) || static_cast<bool>(m_prefixField);
+        return (m_state->m_extPrefixField != nullptr) || static_cast<bool>(m_prefixField);
     }
 
     Field prefixField() const
     {
-        if (m_state.m_extPrefixField != nullptr) {
-            return Field(m_state.m_extPrefixField);
+        if (m_state->m_extPrefixField != nullptr) {
+            return Field(m_state->m_extPrefixField);
         }
 
         return Field(m_prefixField.get());
@@ -65,7 +65,7 @@ public:
 
     const std::string& detachedPrefixFieldName() const
     {
-        return m_state.m_detachedPrefixField;
+        return m_state->m_detachedPrefixField;
     }
 
 
@@ -100,7 +100,7 @@ private:
         std::string m_detachedPrefixField;
     };
 
-    State m_state;
+    CowState<State> m_state;
     FieldImplPtr m_prefixField;
 };
 
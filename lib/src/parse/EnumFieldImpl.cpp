@@ -50,7 +50,7 @@ bool EnumFieldImpl::isUnique() const
 {
     std::intmax_t prevKey = 0;
     bool firstElem = true;
-    for (auto& v : m_state.m_revValues) {
+    for (auto& v : m_state->m_revValues) {
         if (firstElem) {
             prevKey = v.first;
             firstElem = false;
@@ -132,22 +132,22 @@ bool EnumFieldImpl::parseImpl()
 
 std::size_t EnumFieldImpl::minLengthImpl() const
 {
-    if ((m_state.m_type == Type::Intvar) || (m_state.m_type == Type::Uintvar)) {
+    if ((m_state->m_type == Type::Intvar) || (m_state->m_type == Type::Uintvar)) {
         return 1U;
     }
 
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 std::size_t EnumFieldImpl::maxLengthImpl() const
 {
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 std::size_t EnumFieldImpl::bitLengthImpl() const
 {
     if (isBitfieldMember()) {
-        return m_state.m_bitLength;
+        return m_state->m_bitLength;
     }
     return Base::bitLengthImpl();
 }
@@ -177,18 +177,18 @@ bool EnumFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
                  static_cast<std::uintmax_t>(std::numeric_limits<std::intmax_t>::max());
 
             isBigUnsigned =
-                IntFieldImpl::isBigUnsigned(m_state.m_type) &&
+                IntFieldImpl::isBigUnsigned(m_state->m_type) &&
                 (BigUnsignedThreshold < static_cast<std::uintmax_t>(val));
         };
 
     if (ref.empty()) {
-        val = m_state.m_defaultValue;
+        val = m_state->m_defaultValue;
         updateIsBigUnsignedFunc();
         return true;
     }
 
-    auto iter = m_state.m_values.find(ref);
-    if (iter == m_state.m_values.end()) {
+    auto iter = m_state->m_values.find(ref);
+    if (iter == m_state->m_values.end()) {
         return false;
     }
 
@@ -199,14 +199,14 @@ bool EnumFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
 
 bool EnumFieldImpl::validateBitLengthValueImpl(::xmlNodePtr node, std::size_t bitLength) const
 {
-    if ((m_state.m_type == Type::Intvar) || (m_state.m_type == Type::Uintvar)) {
+    if ((m_state->m_type == Type::Intvar) || (m_state->m_type == Type::Uintvar)) {
         logError() << XmlWrap::logPrefix(node) <<
                       "Bitfield member cannot have variable length type.";
         return false;
     }
 
-    assert(0U < m_state.m_length);
-    auto maxBitLength = m_state.m_length * BitsInByte;
+    assert(0U < m_state->m_length);
+    auto maxBitLength = m_state->m_length * BitsInByte;
     if (maxBitLength < bitLength) {
         logError() << XmlWrap::logPrefix(node) <<
                       "Value of property \"" << common::bitLengthStr() << "\" exceeds "
@@ -228,8 +228,8 @@ EnumFieldImpl::FieldRefInfo EnumFieldImpl::processInnerRefImpl(const std::string
     assert(!refStr.empty());
 
     FieldRefInfo info;
-    auto iter = m_state.m_values.find(refStr);
-    if (iter != m_state.m_values.end()) {
+    auto iter = m_state->m_values.find(refStr);
+    if (iter != m_state->m_values.end()) {
         info.m_field = this;
         info.m_valueName = refStr;
         info.m_refType = FieldRefType_InnerValue;
@@ -240,14 +240,14 @@ EnumFieldImpl::FieldRefInfo EnumFieldImpl::processInnerRefImpl(const std::string
 
 bool EnumFieldImpl::updateType()
 {
-    bool mustHave = (m_state.m_type == Type::NumOfValues);
+    bool mustHave = (m_state->m_type == Type::NumOfValues);
     if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
         return false;
     }
 
     auto propsIter = props().find(common::typeStr());
     if (propsIter == props().end()) {
-        assert(m_state.m_type != Type::NumOfValues);
+        assert(m_state->m_type != Type::NumOfValues);
         return true;
     }
 
@@ -258,15 +258,15 @@ bool EnumFieldImpl::updateType()
     }
 
     if (mustHave) {
-        m_state.m_type = newType;
+        m_state->m_type = newType;
         return true;
     }
 
-    if (m_state.m_type == newType) {
+    if (m_state->m_type == newType) {
         return true;
     }
 
-    logError() << XmlWrap::logPrefix(getNode()) <<
+    logError() << XmlWrap::logPrefix(location()) <<
                   "Type cannot be changed after reuse";
     return false;
 }
@@ -278,12 +278,12 @@ bool EnumFieldImpl::updateEndian()
     }
 
     auto& endianStr = common::getStringProp(props(), common::endianStr());
-    if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
+    if ((endianStr.empty()) && (m_state->m_endian != Endian_NumOfValues)) {
         return true;
     }
 
-    m_state.m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
-    if (m_state.m_endian == Endian_NumOfValues) {
+    m_state->m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
+    if (m_state->m_endian == Endian_NumOfValues) {
         reportUnexpectedPropertyValue(common::endianStr(), endianStr);
         return false;
     }
@@ -296,46 +296,46 @@ bool EnumFieldImpl::updateLength()
         return false;
     }
 
-    auto maxLength = IntFieldImpl::maxTypeLength(m_state.m_type);
+    auto maxLength = IntFieldImpl::maxTypeLength(m_state->m_type);
     auto& lengthStr = common::getStringProp(props(), common::lengthStr());
     if (lengthStr.empty()) {
-        if (m_state.m_length == 0) {
-            m_state.m_length = maxLength;
+        if (m_state->m_length == 0) {
+            m_state->m_length = maxLength;
             return true;
         }
 
-        assert(m_state.m_length <= IntFieldImpl::maxTypeLength(m_state.m_type));
+        assert(m_state->m_length <= IntFieldImpl::maxTypeLength(m_state->m_type));
         return true;
     }
 
     bool ok = false;
-    auto newLength = static_cast<decltype(m_state.m_length)>(common::strToUintMax(lengthStr, &ok));
+    auto newLength = static_cast<decltype(m_state->m_length)>(common::strToUintMax(lengthStr, &ok));
 
     if ((!ok) || (newLength == 0)) {
         reportUnexpectedPropertyValue(common::lengthStr(), lengthStr);
         return false;
     }
 
-    if (m_state.m_length == newLength) {
+    if (m_state->m_length == newLength) {
         return true;
     }
 
-    if (m_state.m_length != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_length != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Length cannot be changed after reuse";
         return false;
     }
 
-    m_state.m_length = newLength;
+    m_state->m_length = newLength;
 
     assert(0U < maxLength);
-    if (maxLength < m_state.m_length) {
-        logError() << XmlWrap::logPrefix(getNode()) << "Length of the \"" << name() << "\" element (" << lengthStr << ") cannot exceed "
+    if (maxLength < m_state->m_length) {
+        logError() << XmlWrap::logPrefix(location()) << "Length of the \"" << name() << "\" element (" << lengthStr << ") cannot exceed "
                       "max length allowed by the type (" << maxLength << ").";
         return false;
     }
 
-    assert (m_state.m_length != 0U);
+    assert (m_state->m_length != 0U);
     return true;
 }
 
@@ -345,36 +345,36 @@ bool EnumFieldImpl::updateBitLength()
         return false;
     }
 
-    auto maxBitLength = m_state.m_length * BitsInByte;
-    assert((m_state.m_bitLength == 0) || (m_state.m_bitLength == maxBitLength));
+    auto maxBitLength = m_state->m_length * BitsInByte;
+    assert((m_state->m_bitLength == 0) || (m_state->m_bitLength == maxBitLength));
     auto& valStr = common::getStringProp(props(), common::bitLengthStr());
     if (valStr.empty()) {
-        assert(0 < m_state.m_length);
-        if (m_state.m_bitLength == 0) {
-            m_state.m_bitLength = maxBitLength;
+        assert(0 < m_state->m_length);
+        if (m_state->m_bitLength == 0) {
+            m_state->m_bitLength = maxBitLength;
             return true;
         }
 
-        assert(m_state.m_bitLength <= maxBitLength);
+        assert(m_state->m_bitLength <= maxBitLength);
         return true;
     }
 
     if (!isBitfieldMember()) {
-        logWarning() << XmlWrap::logPrefix((getNode())) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
                         "The property \"" << common::bitLengthStr() << "\" is "
                         "applicable only to the members of \"" << common::bitfieldStr() << "\"";
-        m_state.m_bitLength = maxBitLength;
+        m_state->m_bitLength = maxBitLength;
         return true;
     }
 
     bool ok = false;
-    m_state.m_bitLength = common::strToUnsigned(valStr, &ok);
+    m_state->m_bitLength = common::strToUnsigned(valStr, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::bitLengthStr(), valStr);
         return false;
     }    
 
-    if (!validateBitLengthValue(m_state.m_bitLength)) {
+    if (!validateBitLengthValue(m_state->m_bitLength)) {
         return false;
     }
 
@@ -383,21 +383,21 @@ bool EnumFieldImpl::updateBitLength()
 
 bool EnumFieldImpl::updateNonUniqueAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueAllowedStr(), m_state.m_nonUniqueAllowed);
+    return validateAndUpdateBoolPropValue(common::nonUniqueAllowedStr(), m_state->m_nonUniqueAllowed);
 }
 
 bool EnumFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state->m_validCheckVersion);
 }
 
 bool EnumFieldImpl::updateMinMaxValues()
 {
-    m_state.m_typeAllowedMinValue = IntFieldImpl::minTypeValue(m_state.m_type);
-    m_state.m_typeAllowedMaxValue = IntFieldImpl::maxTypeValue(m_state.m_type);
+    m_state->m_typeAllowedMinValue = IntFieldImpl::minTypeValue(m_state->m_type);
+    m_state->m_typeAllowedMaxValue = IntFieldImpl::maxTypeValue(m_state->m_type);
 
-    m_state.m_minValue = IntFieldImpl::calcMinValue(m_state.m_type, m_state.m_bitLength);
-    m_state.m_maxValue = IntFieldImpl::calcMaxValue(m_state.m_type, m_state.m_bitLength);
+    m_state->m_minValue = IntFieldImpl::calcMinValue(m_state->m_type, m_state->m_bitLength);
+    m_state->m_maxValue = IntFieldImpl::calcMaxValue(m_state->m_type, m_state->m_bitLength);
 
     return true;
 }
@@ -406,12 +406,12 @@ bool EnumFieldImpl::updateValues()
 {
     auto validValues = XmlWrap::getChildren(getNode(), common::validValueStr());
     if (validValues.empty()) {
-        if (!m_state.m_values.empty()) {
-            assert(!m_state.m_revValues.empty());
+        if (!m_state->m_values.empty()) {
+            assert(!m_state->m_revValues.empty());
             return true; // already has values
         }
 
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "The enum \"" << name() << "\" doesn't list any valid value.";
         return false;
     }
@@ -470,8 +470,8 @@ bool EnumFieldImpl::updateValues()
             return false;
         }
 
-        auto valuesIter = m_state.m_values.find(nameIter->second);
-        if (valuesIter != m_state.m_values.end()) {
+        auto valuesIter = m_state->m_values.find(nameIter->second);
+        if (valuesIter != m_state->m_values.end()) {
             logError() << XmlWrap::logPrefix(vNode) << "Value with name \"" << nameIter->second <<
                           "\" has already been defined for enum \"" << name() << "\".";
             return false;
@@ -490,15 +490,15 @@ bool EnumFieldImpl::updateValues()
         auto checkValueInRangeFunc =
             [this, vNode, &nameIter](auto v) -> bool
             {
-                if ((v < static_cast<decltype(v)>(m_state.m_typeAllowedMinValue)) ||
-                    (static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue) < v)) {
+                if ((v < static_cast<decltype(v)>(m_state->m_typeAllowedMinValue)) ||
+                    (static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue) < v)) {
                     this->logError() << XmlWrap::logPrefix(vNode) <<
                                     "Valid value \"" << nameIter->second << "\" is outside the range of available values within a type.";
                     return false;
                 }
 
-                if ((v < static_cast<decltype(v)>(m_state.m_minValue)) ||
-                    (static_cast<decltype(v)>(m_state.m_maxValue) < v)) {
+                if ((v < static_cast<decltype(v)>(m_state->m_minValue)) ||
+                    (static_cast<decltype(v)>(m_state->m_maxValue) < v)) {
                     this->logWarning() << XmlWrap::logPrefix(vNode) <<
                                     "Valid value \"" << nameIter->second << "\" is outside the range of correctly serializable values.";
                 }
@@ -507,7 +507,7 @@ bool EnumFieldImpl::updateValues()
             };
 
         bool checkResult = false;
-        if (IntFieldImpl::isBigUnsigned(m_state.m_type)) {
+        if (IntFieldImpl::isBigUnsigned(m_state->m_type)) {
             checkResult = checkValueInRangeFunc(static_cast<std::uintmax_t>(val));
         }
         else {
@@ -518,9 +518,9 @@ bool EnumFieldImpl::updateValues()
             return false;
         }
 
-        if (!m_state.m_nonUniqueAllowed) {
-            auto revIter = m_state.m_revValues.find(val);
-            if (revIter != m_state.m_revValues.end()) {
+        if (!m_state->m_nonUniqueAllowed) {
+            auto revIter = m_state->m_revValues.find(val);
+            if (revIter != m_state->m_revValues.end()) {
                 logError() << XmlWrap::logPrefix(vNode) <<
                               "Value \"" << valIter->second << "\" has been already defined "
                               "as \"" << revIter->second << "\".";
@@ -549,8 +549,8 @@ bool EnumFieldImpl::updateValues()
             return false;
         }
 
-        m_state.m_values.emplace(nameIter->second, info);
-        m_state.m_revValues.emplace(val, nameIter->second);
+        m_state->m_values.emplace(nameIter->second, info);
+        m_state->m_revValues.emplace(val, nameIter->second);
     }
     return true;
 }
@@ -569,22 +569,22 @@ bool EnumFieldImpl::updateDefaultValue()
     auto reportErrorFunc =
         [this, &valueStr]()
         {
-            logError() << XmlWrap::logPrefix(getNode()) << "The default value of the \"" << name() <<
+            logError() << XmlWrap::logPrefix(location()) << "The default value of the \"" << name() <<
                           "\" is not within type boundaries (" << valueStr << ").";
         };
 
     auto reportWarningFunc =
         [this, &valueStr]()
         {
-            logWarning() << XmlWrap::logPrefix(getNode()) << "The default value of the \"" << name() <<
+            logWarning() << XmlWrap::logPrefix(location()) << "The default value of the \"" << name() <<
                           "\" is too small or big and will not be serialised correctly (" << valueStr << ").";
         };
 
     auto checkValueFunc =
         [this, &reportErrorFunc, &reportWarningFunc](auto v) -> bool
         {
-            auto castedTypeAllowedMinValue = static_cast<decltype(v)>(m_state.m_typeAllowedMinValue);
-            auto castedTypeAllowedMaxValue = static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue);
+            auto castedTypeAllowedMinValue = static_cast<decltype(v)>(m_state->m_typeAllowedMinValue);
+            auto castedTypeAllowedMaxValue = static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue);
 
             if (v < castedTypeAllowedMinValue) {
                 reportErrorFunc();
@@ -596,25 +596,25 @@ bool EnumFieldImpl::updateDefaultValue()
                 return false;
             }
 
-            auto castedMinValue = static_cast<decltype(v)>(m_state.m_minValue);
-            auto castedMaxValue = static_cast<decltype(v)>(m_state.m_maxValue);
+            auto castedMinValue = static_cast<decltype(v)>(m_state->m_minValue);
+            auto castedMaxValue = static_cast<decltype(v)>(m_state->m_maxValue);
             if ((v < castedMinValue) ||
                 (castedMaxValue < v)) {
                 reportWarningFunc();
             }
 
-            m_state.m_defaultValue = static_cast<decltype(m_state.m_defaultValue)>(v);
+            m_state->m_defaultValue = static_cast<decltype(m_state->m_defaultValue)>(v);
             return true;
         };
 
     std::intmax_t val = 0;
     if (!strToValue(valueStr, val)) {
-        logError() << XmlWrap::logPrefix(getNode()) << "Default value (" << valueStr <<
+        logError() << XmlWrap::logPrefix(location()) << "Default value (" << valueStr <<
                       ") cannot be recognized.";
         return false;
     }
 
-    if (IntFieldImpl::isBigUnsigned(m_state.m_type)) {
+    if (IntFieldImpl::isBigUnsigned(m_state->m_type)) {
         return checkValueFunc(static_cast<std::uintmax_t>(val));
     }
 
@@ -623,7 +623,7 @@ bool EnumFieldImpl::updateDefaultValue()
 
 bool EnumFieldImpl::updateHexAssign()
 {
-    if (!validateAndUpdateBoolPropValue(common::hexAssignStr(), m_state.m_hexAssign)) {
+    if (!validateAndUpdateBoolPropValue(common::hexAssignStr(), m_state->m_hexAssign)) {
         return false;
     }
 
@@ -632,8 +632,8 @@ bool EnumFieldImpl::updateHexAssign()
         return true;
     }    
 
-    if (!IntFieldImpl::isTypeUnsigned(m_state.m_type)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (!IntFieldImpl::isTypeUnsigned(m_state->m_type)) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot set \"" << common::hexAssignStr() << "\" property with signed types.";
         return false;
     }
@@ -643,7 +643,7 @@ bool EnumFieldImpl::updateHexAssign()
 
 bool EnumFieldImpl::updateAvailableLengthLimit()
 {
-    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state.m_availableLengthLimit);
+    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state->m_availableLengthLimit);
 }
 
 bool EnumFieldImpl::strToValue(
@@ -652,8 +652,8 @@ bool EnumFieldImpl::strToValue(
 {
     if (common::isValidName(str)) {
         // Check among specials
-        auto iter = m_state.m_values.find(str);
-        if (iter != m_state.m_values.end()) {
+        auto iter = m_state->m_values.find(str);
+        if (iter != m_state->m_values.end()) {
             val = iter->second.m_value;
             return true;
         }
@@ -665,16 +665,16 @@ bool EnumFieldImpl::strToValue(
             return false;
         }
 
-        if ((!bigUnsigned) && (val < 0) && (IntFieldImpl::isUnsigned(m_state.m_type))) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if ((!bigUnsigned) && (val < 0) && (IntFieldImpl::isUnsigned(m_state->m_type))) {
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Cannot assign negative value (" << val << " references as " <<
                 str << ") to field with positive type.";
 
             return false;
         }
 
-        if (bigUnsigned && (!IntFieldImpl::isBigUnsigned(m_state.m_type))) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if (bigUnsigned && (!IntFieldImpl::isBigUnsigned(m_state->m_type))) {
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Cannot assign such big positive number (" <<
                 static_cast<std::uintmax_t>(val) << " referenced as " <<
                 str << ").";
@@ -686,7 +686,7 @@ bool EnumFieldImpl::strToValue(
 
 
     bool ok = false;
-    if (IntFieldImpl::isBigUnsigned(m_state.m_type)) {
+    if (IntFieldImpl::isBigUnsigned(m_state->m_type)) {
         val = static_cast<std::intmax_t>(common::strToUintMax(str, &ok));
     }
     else {
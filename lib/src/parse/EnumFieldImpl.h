@@ -44,49 +44,49 @@ public:
 
     Type type() const
     {
-        return m_state.m_type;
+        return m_state->m_type;
     }
 
     Endian endian() const
     {
-        return m_state.m_endian;
+        return m_state->m_endian;
     }
 
     std::intmax_t defaultValue() const
     {
-        return m_state.m_defaultValue;
+        return m_state->m_defaultValue;
     }
 
     const Values& values() const
     {
-        return m_state.m_values;
+        return m_state->m_values;
     }
 
     const RevValues& revValues() const
     {
-        return m_state.m_revValues;
+        return m_state->m_revValues;
     }
 
     bool isNonUniqueAllowed() const
     {
-        return m_state.m_nonUniqueAllowed;
+        return m_state->m_nonUniqueAllowed;
     }
 
     bool isUnique() const;
 
     bool validCheckVersion() const
     {
-        return m_state.m_validCheckVersion;
+        return m_state->m_validCheckVersion;
     }
 
     bool hexAssign() const
     {
-        return m_state.m_hexAssign;
+        return m_state->m_hexAssign;
     }
 
     bool availableLengthLimit() const
     {
-        return m_state.m_availableLengthLimit;
+        return m_state->m_availableLengthLimit;
     }    
 
 protected:
@@ -139,7 +139,7 @@ private:
         bool m_availableLengthLimit = false;
     };
 
-    State m_state;
+    CowState<State> m_state;
 };
 
 } // namespace parse
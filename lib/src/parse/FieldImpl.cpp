@@ -67,9 +67,9 @@ FieldImpl::Ptr FieldImpl::create(
 
 bool FieldImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    m_props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), *m_props)) {
         return false;
     }
 
@@ -79,7 +79,7 @@ bool FieldImpl::parse()
             break;
         }
 
-        if (!XmlWrap::parseChildrenAsProps(m_node, extraPropsNames, m_protocol.logger(), m_props)) {
+        if (!XmlWrap::parseChildrenAsProps(getNode(), extraPropsNames, m_protocol.logger(), *m_props)) {
             return false;
         }
 
@@ -91,7 +91,7 @@ bool FieldImpl::parse()
             break;
         }
 
-        if (!XmlWrap::parseChildrenAsProps(m_node, extraPossiblePropsNames, m_protocol.logger(), m_props, false)) {
+        if (!XmlWrap::parseChildrenAsProps(getNode(), extraPossiblePropsNames, m_protocol.logger(), *m_props, false)) {
             return false;
         }
 
@@ -155,17 +155,17 @@ bool FieldImpl::parse()
 
 const std::string& FieldImpl::name() const
 {
-    return m_state.m_name;
+    return m_state->m_name;
 }
 
 const std::string& FieldImpl::displayName() const
 {
-    return m_state.m_displayName;
+    return m_state->m_displayName;
 }
 
 const std::string& FieldImpl::description() const
 {
-    return m_state.m_description;
+    return m_state->m_description;
 }
 
 const std::string& FieldImpl::kindStr() const
@@ -214,7 +214,7 @@ bool FieldImpl::validateMembersNames(
     std::set<std::string> usedNames;
     for (auto& f : fields) {
         if (usedNames.find(f->name()) != usedNames.end()) {
-            commsdsl::parse::logError(logger) << XmlWrap::logPrefix(f->getNode()) <<
+            commsdsl::parse::logError(logger) << XmlWrap::logPrefix(f->location()) <<
                 "Member field with name \"" << f->name() << "\" has already been defined.";
             return false;
         }
@@ -364,7 +364,7 @@ bool FieldImpl::verifyAliasedMember(const std::string& fieldName)
 
 std::string FieldImpl::schemaPos() const
 {
-    return XmlWrap::logPrefix(m_node);
+    return XmlWrap::logPrefix(m_location);
 }
 
 FieldImpl::FieldRefInfo FieldImpl::processSiblingRef(const FieldsList& siblings, const std::string& refStr)
@@ -421,6 +421,7 @@ bool FieldImpl::isValidInnerRef(const std::string& refStr) const
 
 FieldImpl::FieldImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol)
 {
 }
@@ -480,7 +481,7 @@ bool FieldImpl::parseImpl()
 bool FieldImpl::replaceMembersImpl(FieldsList& members)
 {
     static_cast<void>(members);
-    logError() << XmlWrap::logPrefix(m_node) <<
+    logError() << XmlWrap::logPrefix(m_location) <<
         "The field of kind \"" << kindStr() << "\" does not support replacing its members.";
     return false;
 }
@@ -631,12 +632,12 @@ FieldImpl::FieldRefInfo FieldImpl::processInnerRefImpl(const std::string& refStr
 
 bool FieldImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, protocol().logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), *m_props, str, protocol().logger(), mustHave);
 }
 
 bool FieldImpl::validateNoPropInstance(const std::string& str)
 {
-    return XmlWrap::validateNoPropInstance(m_node, m_props, str, protocol().logger());
+    return XmlWrap::validateNoPropInstance(getNode(), *m_props, str, protocol().logger());
 }
 
 bool FieldImpl::validateAndUpdateStringPropValue(
@@ -649,8 +650,8 @@ bool FieldImpl::validateAndUpdateStringPropValue(
         return false;
     }
 
-    auto iter = m_props.find(str);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(str);
+    if (iter == m_props->end()) {
         assert(!mustHave);
         return true;
     }
@@ -670,7 +671,7 @@ bool FieldImpl::validateAndUpdateStringPropValue(
 
 void FieldImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, name(), propName, propValue, protocol().logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), name(), propName, propValue, protocol().logger());
 }
 
 bool FieldImpl::validateAndUpdateBoolPropValue(const std::string& propName, bool& value, bool mustHave)
@@ -679,13 +680,13 @@ bool FieldImpl::validateAndUpdateBoolPropValue(const std::string& propName, bool
         return false;
     }
 
-    auto iter = m_props.find(propName);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(propName);
+    if (iter == m_props->end()) {
         return true;
     }
 
     if (!m_protocol.isPropertySupported(propName)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "Property \"" << common::availableLengthLimitStr() << "\" is not available for DSL version " << protocol().currSchema().dslVersion();                
         return true;
     }
@@ -706,14 +707,14 @@ bool FieldImpl::validateAndUpdateOverrideTypePropValue(const std::string& propNa
         return false;
     }
 
-    auto iter = m_props.find(propName);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(propName);
+    if (iter == m_props->end()) {
         value = OverrideType_Any;
         return true;
     }    
 
     if (!m_protocol.isOverrideTypeSupported()) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "The property \"" << propName << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
@@ -792,7 +793,7 @@ const FieldImpl* FieldImpl::findSibling(const FieldsList& fields, const std::str
             });
 
     if (iter == fields.end()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The holding bundle/message does not contain field named \"" <<
             sibName << "\".";
 
@@ -844,7 +845,7 @@ bool FieldImpl::checkDetachedPrefixAllowed() const
     } while (false);
 
     if (!result) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Detached prefixes are allowed only for members of \"" << common::bundleStr() << "\" field "
             "or \"" << common::messageStr() << "\" object.";
     }
@@ -982,21 +983,21 @@ bool FieldImpl::checkReuse()
         return false;
     }
 
-    auto iter = m_props.find(common::reuseStr());
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(common::reuseStr());
+    if (iter == m_props->end()) {
         return true;
     }
 
     auto& valueStr = iter->second;
     auto* field = m_protocol.findField(valueStr);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "The field \"" << valueStr << "\" hasn't been recorded yet.";
         return false;
     }
 
     if (field->kind() != kind()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Cannot reuse field of different kind (\"" << valueStr << "\").";
         return false;
     }
@@ -1015,8 +1016,8 @@ bool FieldImpl::checkReuse()
             return false;
         }
 
-        auto codeIter = m_props.find(codeProp);
-        if (codeIter == m_props.end()) {
+        auto codeIter = m_props->find(codeProp);
+        if (codeIter == m_props->end()) {
             break;
         }  
 
@@ -1029,7 +1030,7 @@ bool FieldImpl::checkReuse()
             break;
         }
 
-        m_state.m_copyCodeFrom = valueStr; 
+        m_state->m_copyCodeFrom = valueStr; 
     } while (false);
     return reuseImpl(*field);
 }
@@ -1038,7 +1039,7 @@ bool FieldImpl::checkReplace()
 {
     auto replaceNodes = XmlWrap::getChildren(getNode(), common::replaceStr());
     if (1U < replaceNodes.size()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Only single \"" << common::replaceStr() << "\" child element is "
             "supported for a field.";
         return false;
@@ -1049,7 +1050,7 @@ bool FieldImpl::checkReplace()
     }
 
     if (!m_protocol.isMemberReplaceSupported()) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Replacing members with \"" << common::replaceStr() << "\" child element is unavaliable "
             "for selected DSL version, ignoring...";        
         return true;
@@ -1091,17 +1092,17 @@ bool FieldImpl::checkReplace()
 
 bool FieldImpl::updateName()
 {
-    return validateAndUpdateStringPropValue(common::nameStr(), m_state.m_name);
+    return validateAndUpdateStringPropValue(common::nameStr(), m_state->m_name);
 }
 
 bool FieldImpl::updateDescription()
 {
-    return validateAndUpdateStringPropValue(common::descriptionStr(), m_state.m_description, false, true);
+    return validateAndUpdateStringPropValue(common::descriptionStr(), m_state->m_description, false, true);
 }
 
 bool FieldImpl::updateDisplayName()
 {
-    return validateAndUpdateStringPropValue(common::displayNameStr(), m_state.m_displayName, false, true);
+    return validateAndUpdateStringPropValue(common::displayNameStr(), m_state->m_displayName, false, true);
 }
 
 bool FieldImpl::updateVersions()
@@ -1128,7 +1129,7 @@ bool FieldImpl::updateVersions()
         deprecated = getParent()->getDeprecated();
     }
 
-    if (!XmlWrap::getAndCheckVersions(m_node, name(), m_props, sinceVersion, deprecated, protocol())) {
+    if (!XmlWrap::getAndCheckVersions(getNode(), name(), *m_props, sinceVersion, deprecated, protocol())) {
         return false;
     }
 
@@ -1139,14 +1140,14 @@ bool FieldImpl::updateVersions()
         }
 
         if (sinceVersion != 0U) {
-            logWarning() << XmlWrap::logPrefix(getNode()) <<
+            logWarning() << XmlWrap::logPrefix(location()) <<
                 "Property \"" << common::sinceVersionStr() << "\" is not applicable to "
                 "this field, ignoring provided value";
             sinceVersion = 0U;
         }
 
         if (deprecated != Protocol::notYetDeprecated()) {
-            logWarning() << XmlWrap::logPrefix(getNode()) <<
+            logWarning() << XmlWrap::logPrefix(location()) <<
                 "Property \"" << common::deprecatedStr() << "\" is not applicable to "
                 "this field, ignoring provided value";
             deprecated = Protocol::notYetDeprecated();
@@ -1156,8 +1157,8 @@ bool FieldImpl::updateVersions()
 
     bool deprecatedRemoved = false;
     do {
-        auto deprecatedRemovedIter = m_props.find(common::removedStr());
-        if (deprecatedRemovedIter == m_props.end()) {
+        auto deprecatedRemovedIter = m_props->find(common::removedStr());
+        if (deprecatedRemovedIter == m_props->end()) {
             break;
         }
 
@@ -1173,7 +1174,7 @@ bool FieldImpl::updateVersions()
         }
 
         if (deprecated == Protocol::notYetDeprecated()) {
-            logWarning() << XmlWrap::logPrefix(getNode()) <<
+            logWarning() << XmlWrap::logPrefix(location()) <<
                 "Property \"" << common::removedStr() << "\" is not applicable to "
                 "non deprecated fields";
         }
@@ -1191,8 +1192,8 @@ bool FieldImpl::updateSemanticType()
         return false;
     }
 
-    auto iter = m_props.find(common::semanticTypeStr());
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(common::semanticTypeStr());
+    if (iter == m_props->end()) {
         return true;
     }
 
@@ -1208,7 +1209,7 @@ bool FieldImpl::updateSemanticType()
         "Invalid map");
 
     if (iter->second.empty()) {
-        m_state.m_semanticType = SemanticType::None;
+        m_state->m_semanticType = SemanticType::None;
         return true;
     }
 
@@ -1219,7 +1220,7 @@ bool FieldImpl::updateSemanticType()
         return false;
     }
 
-    m_state.m_semanticType =
+    m_state->m_semanticType =
         static_cast<SemanticType>(std::distance(std::begin(Map), valIter));
 
     return true;
@@ -1227,67 +1228,67 @@ bool FieldImpl::updateSemanticType()
 
 bool FieldImpl::updatePseudo()
 {
-    return validateAndUpdateBoolPropValue(common::pseudoStr(), m_state.m_pseudo);
+    return validateAndUpdateBoolPropValue(common::pseudoStr(), m_state->m_pseudo);
 }
 
 bool FieldImpl::updateDisplayReadOnly()
 {
-    return validateAndUpdateBoolPropValue(common::displayReadOnlyStr(), m_state.m_displayReadOnly);
+    return validateAndUpdateBoolPropValue(common::displayReadOnlyStr(), m_state->m_displayReadOnly);
 }
 
 bool FieldImpl::updateDisplayHidden()
 {
-    return validateAndUpdateBoolPropValue(common::displayHiddenStr(), m_state.m_displayHidden);
+    return validateAndUpdateBoolPropValue(common::displayHiddenStr(), m_state->m_displayHidden);
 }
 
 bool FieldImpl::updateCustomizable()
 {
-    return validateAndUpdateBoolPropValue(common::customizableStr(), m_state.m_customizable);
+    return validateAndUpdateBoolPropValue(common::customizableStr(), m_state->m_customizable);
 }
 
 bool FieldImpl::updateFailOnInvalid()
 {
-    return validateAndUpdateBoolPropValue(common::failOnInvalidStr(), m_state.m_failOnInvalid);
+    return validateAndUpdateBoolPropValue(common::failOnInvalidStr(), m_state->m_failOnInvalid);
 }
 
 bool FieldImpl::updateForceGen()
 {
-    return validateAndUpdateBoolPropValue(common::forceGenStr(), m_state.m_forceGen);
+    return validateAndUpdateBoolPropValue(common::forceGenStr(), m_state->m_forceGen);
 }
 
 bool FieldImpl::updateValueOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::valueOverrideStr(), m_state.m_valueOverride);
+    return validateAndUpdateOverrideTypePropValue(common::valueOverrideStr(), m_state->m_valueOverride);
 }
 
 bool FieldImpl::updateReadOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::readOverrideStr(), m_state.m_readOverride);
+    return validateAndUpdateOverrideTypePropValue(common::readOverrideStr(), m_state->m_readOverride);
 }
 
 bool FieldImpl::updateWriteOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::writeOverrideStr(), m_state.m_writeOverride);
+    return validateAndUpdateOverrideTypePropValue(common::writeOverrideStr(), m_state->m_writeOverride);
 }
 
 bool FieldImpl::updateRefreshOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::refreshOverrideStr(), m_state.m_refreshOverride);
+    return validateAndUpdateOverrideTypePropValue(common::refreshOverrideStr(), m_state->m_refreshOverride);
 }
 
 bool FieldImpl::updateLengthOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::lengthOverrideStr(), m_state.m_lengthOverride);
+    return validateAndUpdateOverrideTypePropValue(common::lengthOverrideStr(), m_state->m_lengthOverride);
 }
 
 bool FieldImpl::updateValidOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::validOverrideStr(), m_state.m_validOverride);
+    return validateAndUpdateOverrideTypePropValue(common::validOverrideStr(), m_state->m_validOverride);
 }
 
 bool FieldImpl::updateNameOverride()
 {
-    return validateAndUpdateOverrideTypePropValue(common::nameOverrideStr(), m_state.m_nameOverride);
+    return validateAndUpdateOverrideTypePropValue(common::nameOverrideStr(), m_state->m_nameOverride);
 }
 
 bool FieldImpl::updateCopyOverrideCodeFrom()
@@ -1297,13 +1298,13 @@ bool FieldImpl::updateCopyOverrideCodeFrom()
         return false;
     }
 
-    auto iter = m_props.find(prop);
-    if (iter == m_props.end()) {
+    auto iter = m_props->find(prop);
+    if (iter == m_props->end()) {
         return true;
     }  
 
     if (!m_protocol.isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "The property \"" << prop << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
@@ -1311,45 +1312,45 @@ bool FieldImpl::updateCopyOverrideCodeFrom()
 
     auto* field = m_protocol.findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Field referenced by \"" << prop << "\" property (" + iter->second + ") is not found.";
         return false;        
     }
 
-    m_state.m_copyCodeFrom = iter->second;
+    m_state->m_copyCodeFrom = iter->second;
     return true;
 }
 
 bool FieldImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
 {
-    auto extraAttrs = XmlWrap::getExtraAttributes(m_node, names, m_protocol);
+    auto extraAttrs = XmlWrap::getExtraAttributes(getNode(), names, m_protocol);
     if (extraAttrs.empty()) {
         return true;
     }
 
-    if (m_state.m_extraAttrs.empty()) {
-        m_state.m_extraAttrs = std::move(extraAttrs);
+    if (m_state->m_extraAttrs.empty()) {
+        m_state->m_extraAttrs = std::move(extraAttrs);
         return true;
     }
 
-    std::move(extraAttrs.begin(), extraAttrs.end(), std::inserter(m_state.m_extraAttrs, m_state.m_extraAttrs.end()));
+    std::move(extraAttrs.begin(), extraAttrs.end(), std::inserter(m_state->m_extraAttrs, m_state->m_extraAttrs.end()));
     return true;
 }
 
 bool FieldImpl::updateExtraChildren(const XmlWrap::NamesList& names)
 {
-    auto extraChildren = XmlWrap::getExtraChildren(m_node, names, m_protocol);
+    auto extraChildren = XmlWrap::getExtraChildren(getNode(), names, m_protocol);
     if (extraChildren.empty()) {
         return true;
     }
 
-    if (m_state.m_extraChildren.empty()) {
-        m_state.m_extraChildren = std::move(extraChildren);
+    if (m_state->m_extraChildren.empty()) {
+        m_state->m_extraChildren = std::move(extraChildren);
         return true;
     }
 
-    m_state.m_extraChildren.reserve(m_state.m_extraChildren.size() + extraChildren.size());
-    std::move(extraChildren.begin(), extraChildren.end(), std::back_inserter(m_state.m_extraChildren));
+    m_state->m_extraChildren.reserve(m_state->m_extraChildren.size() + extraChildren.size());
+    std::move(extraChildren.begin(), extraChildren.end(), std::back_inserter(m_state->m_extraChildren));
     return true;
 }
 
@@ -1436,15 +1437,15 @@ const FieldImpl::CreateMap& FieldImpl::createMap()
 
 bool FieldImpl::verifyName() const
 {
-    if (m_state.m_name.empty()) {
-        logError() << XmlWrap::logPrefix(m_node) <<
-            "Missing value for mandatory property \"" << common::nameStr() << "\" for \"" << m_node->name << "\" element.";
+    if (m_state->m_name.empty()) {
+        logError() << XmlWrap::logPrefix(m_location) <<
+            "Missing value for mandatory property \"" << common::nameStr() << "\" for \"" << getNode()->name << "\" element.";
         return false;
     }
 
-    if (!common::isValidName(m_state.m_name)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
-                "Invalid value for name property \"" << m_state.m_name << "\".";
+    if (!common::isValidName(m_state->m_name)) {
+        logError() << XmlWrap::logPrefix(location()) <<
+                "Invalid value for name property \"" << m_state->m_name << "\".";
         return false;
     }
 
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <map>
 #include <functional>
@@ -22,6 +23,7 @@
 
 #include "commsdsl/parse/Field.h"
 #include "XmlWrap.h"
+#include "CowState.h"
 #include "Logger.h"
 #include "Object.h"
 
@@ -38,6 +40,7 @@ class FieldImpl : public Object
 public:
     using Ptr = std::unique_ptr<FieldImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using FieldsList = std::vector<Ptr>;
     using Kind = Field::Kind;
@@ -70,9 +73,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parse();
     bool verifySiblings(const FieldsList& fields) const
     {
@@ -81,7 +91,7 @@ public:
 
     const PropsMap& props() const
     {
-        return m_props;
+        return *m_props;
     }
 
     const std::string& name() const;
@@ -97,77 +107,77 @@ public:
 
     SemanticType semanticType() const
     {
-        return m_state.m_semanticType;
+        return m_state->m_semanticType;
     }
 
     bool isPseudo() const
     {
-        return m_state.m_pseudo;
+        return m_state->m_pseudo;
     }
 
     bool isDisplayReadOnly() const
     {
-        return m_state.m_displayReadOnly;
+        return m_state->m_displayReadOnly;
     }    
 
     bool isDisplayHidden() const
     {
-        return m_state.m_displayHidden;
+        return m_state->m_displayHidden;
     }    
 
     bool isCustomizable() const
     {
-        return m_state.m_customizable;
+        return m_state->m_customizable;
     }    
 
     bool isFailOnInvalid() const
     {
-        return m_state.m_failOnInvalid;
+        return m_state->m_failOnInvalid;
     }    
 
     bool isForceGen() const
     {
-        return m_state.m_forceGen;
+        return m_state->m_forceGen;
     }
 
     OverrideType valueOverride() const
     {
-        return m_state.m_valueOverride;
+        return m_state->m_valueOverride;
     }    
 
     OverrideType readOverride() const
     {
-        return m_state.m_readOverride;
+        return m_state->m_readOverride;
     }
 
     OverrideType writeOverride() const
     {
-        return m_state.m_writeOverride;
+        return m_state->m_writeOverride;
     }    
 
     OverrideType refreshOverride() const
     {
-        return m_state.m_refreshOverride;
+        return m_state->m_refreshOverride;
     }
 
     OverrideType lengthOverride() const
     {
-        return m_state.m_lengthOverride;
+        return m_state->m_lengthOverride;
     }
 
     OverrideType validOverride() const
     {
-        return m_state.m_validOverride;
+        return m_state->m_validOverride;
     }
 
     OverrideType nameOverride() const
     {
-        return m_state.m_nameOverride;
+        return m_state->m_nameOverride;
     }    
 
     const std::string& copyCodeFrom() const
     {
-        return m_state.m_copyCodeFrom;
+        return m_state->m_copyCodeFrom;
     }
 
     std::size_t minLength() const
@@ -217,24 +227,24 @@ public:
     bool isComparableToValue(const std::string& val) const;
     bool isComparableToField(const FieldImpl& field) const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
-        return m_state.m_extraAttrs;
+        return m_state->m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
-        return m_state.m_extraAttrs;
+        return m_state->m_extraAttrs;
     }
 
     const ContentsList& extraChildren() const
     {
-        return m_state.m_extraChildren;
+        return m_state->m_extraChildren;
     }
 
     ContentsList& extraChildren()
     {
-        return m_state.m_extraChildren;
+        return m_state->m_extraChildren;
     }
 
     bool strToNumeric(const std::string& ref, std::intmax_t& val, bool& isBigUnsigned) const
@@ -269,7 +279,7 @@ public:
 
     bool validateBitLengthValue(std::size_t bitLength) const
     {
-        return validateBitLengthValue(m_node, bitLength);
+        return validateBitLengthValue(getNode(), bitLength);
     }
 
     bool verifySemanticType() const;
@@ -305,17 +315,17 @@ protected:
 
     void setName(const std::string& val)
     {
-        m_state.m_name = val;
+        m_state->m_name = val;
     }
 
     void setDisplayName(const std::string& val)
     {
-        m_state.m_displayName = val;
+        m_state->m_displayName = val;
     }
 
     void setSemanticType(SemanticType val)
     {
-        m_state.m_semanticType = val;
+        m_state->m_semanticType = val;
     }
 
     LogWrapper logError() const;
@@ -407,7 +417,7 @@ private:
         std::string m_name;
         std::string m_displayName;
         std::string m_description;
-        PropsMap m_extraAttrs;
+        AttributesMap m_extraAttrs;
         ContentsList m_extraChildren;
         SemanticType m_semanticType = SemanticType::None;
         OverrideType m_valueOverride = OverrideType_Any;
@@ -455,9 +465,10 @@ private:
     static const CreateMap& createMap();
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
-    PropsMap m_props;
-    ReusableState m_state;
+    CowState<PropsMap> m_props;
+    CowState<ReusableState> m_state;
 };
 
 using FieldImplPtr = FieldImpl::Ptr;
@@ -0,0 +1,211 @@
+//
+// Copyright 2018 - 2023 (C). Alex Robenko. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace commsdsl
+{
+
+namespace parse
+{
+
+// Sorted vector based replacement of std::multimap<std::string, std::string>
+// used to hold element properties. All the elements reside in single
+// contiguous storage and the lookups accept any key type comparable
+// with std::string (including string literals) without creating temporaries.
+// Elements with equal keys preserve their insertion order, just like
+// with std::multimap.
+class FlatPropsMap
+{
+public:
+    using key_type = std::string;
+    using mapped_type = std::string;
+    using value_type = std::pair<std::string, std::string>;
+    using Storage = std::vector<value_type>;
+    using size_type = Storage::size_type;
+    using iterator = Storage::iterator;
+    using const_iterator = Storage::const_iterator;
+
+    FlatPropsMap() = default;
+    FlatPropsMap(const FlatPropsMap&) = default;
+    FlatPropsMap(FlatPropsMap&&) = default;
+    FlatPropsMap& operator=(const FlatPropsMap&) = default;
+    FlatPropsMap& operator=(FlatPropsMap&&) = default;
+
+    iterator begin() { return m_storage.begin(); }
+    iterator end() { return m_storage.end(); }
+    const_iterator begin() const { return m_storage.begin(); }
+    const_iterator end() const { return m_storage.end(); }
+    const_iterator cbegin() const { return m_storage.cbegin(); }
+    const_iterator cend() const { return m_storage.cend(); }
+
+    bool empty() const
+    {
+        return m_storage.empty();
+    }
+
+    size_type size() const
+    {
+        return m_storage.size();
+    }
+
+    void reserve(size_type count)
+    {
+        m_storage.reserve(count);
+    }
+
+    void clear()
+    {
+        m_storage.clear();
+    }
+
+    template <typename TKey>
+    iterator lower_bound(const TKey& key)
+    {
+        return std::lower_bound(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    const_iterator lower_bound(const TKey& key) const
+    {
+        return std::lower_bound(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    iterator upper_bound(const TKey& key)
+    {
+        return std::upper_bound(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    const_iterator upper_bound(const TKey& key) const
+    {
+        return std::upper_bound(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    std::pair<iterator, iterator> equal_range(const TKey& key)
+    {
+        return std::equal_range(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    std::pair<const_iterator, const_iterator> equal_range(const TKey& key) const
+    {
+        return std::equal_range(m_storage.begin(), m_storage.end(), key, LessKey());
+    }
+
+    template <typename TKey>
+    iterator find(const TKey& key)
+    {
+        auto iter = lower_bound(key);
+        if ((iter == m_storage.end()) || (iter->first != key)) {
+            return m_storage.end();
+        }
+
+        return iter;
+    }
+
+    template <typename TKey>
+    const_iterator find(const TKey& key) const
+    {
+        auto iter = lower_bound(key);
+        if ((iter == m_storage.end()) || (iter->first != key)) {
+            return m_storage.end();
+        }
+
+        return iter;
+    }
+
+    template <typename TKey>
+    size_type count(const TKey& key) const
+    {
+        auto iters = equal_range(key);
+        return static_cast<size_type>(std::distance(iters.first, iters.second));
+    }
+
+    iterator insert(const value_type& value)
+    {
+        return m_storage.insert(upper_bound(value.first), value);
+    }
+
+    iterator insert(value_type&& value)
+    {
+        auto iter = upper_bound(value.first);
+        return m_storage.insert(iter, std::move(value));
+    }
+
+    template <typename TKey, typename TValue>
+    iterator emplace(TKey&& key, TValue&& value)
+    {
+        return insert(value_type(std::forward<TKey>(key), std::forward<TValue>(value)));
+    }
+
+    iterator erase(iterator pos)
+    {
+        return m_storage.erase(pos);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return m_storage.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return m_storage.erase(first, last);
+    }
+
+    template <typename TKey>
+    size_type erase(const TKey& key)
+    {
+        auto iters = equal_range(key);
+        auto result = static_cast<size_type>(std::distance(iters.first, iters.second));
+        m_storage.erase(iters.first, iters.second);
+        return result;
+    }
+
+private:
+    struct LessKey
+    {
+        template <typename TKey>
+        bool operator()(const value_type& elem, const TKey& key) const
+        {
+            return elem.first < key;
+        }
+
+        template <typename TKey>
+        bool operator()(const TKey& key, const value_type& elem) const
+        {
+            return key < elem.first;
+        }
+
+        bool operator()(const value_type& first, const value_type& second) const
+        {
+            return first.first < second.first;
+        }
+    };
+
+    Storage m_storage;
+};
+
+} // namespace parse
+
+} // namespace commsdsl
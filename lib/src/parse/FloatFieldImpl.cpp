@@ -113,20 +113,20 @@ double maxValueForType(FloatFieldImpl::Type value)
 FloatFieldImpl::FloatFieldImpl(xmlNodePtr node, ProtocolImpl& protocol)
   : Base(node, protocol)
 {
-    m_state.m_nonUniqueSpecialsAllowed = !protocol.isNonUniqueSpecialsAllowedSupported();
+    m_state->m_nonUniqueSpecialsAllowed = !protocol.isNonUniqueSpecialsAllowedSupported();
 }
 
 bool FloatFieldImpl::hasNonUniqueSpecials() const
 {
-    if (!m_state.m_nonUniqueSpecialsAllowed) {
+    if (!m_state->m_nonUniqueSpecialsAllowed) {
         return false;
     }
 
 
     std::vector<double> specValues;
-    specValues.reserve(m_state.m_specials.size());
+    specValues.reserve(m_state->m_specials.size());
 
-    for (auto& s : m_state.m_specials) {
+    for (auto& s : m_state->m_specials) {
         if (std::isnan(s.second.m_value)) {
             continue;
         }
@@ -134,7 +134,7 @@ bool FloatFieldImpl::hasNonUniqueSpecials() const
         specValues.push_back(s.second.m_value);
     }
 
-    if ((specValues.size() + 1U) < m_state.m_specials.size()) {
+    if ((specValues.size() + 1U) < m_state->m_specials.size()) {
         // More than one NaN inside
         return true;
     }
@@ -222,7 +222,7 @@ bool FloatFieldImpl::parseImpl()
 
 std::size_t FloatFieldImpl::minLengthImpl() const
 {
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 bool FloatFieldImpl::isComparableToValueImpl(const std::string& val) const
@@ -238,12 +238,12 @@ bool FloatFieldImpl::strToFpImpl(const std::string& ref, double& val) const
     }
 
     if (ref.empty()) {
-        val = m_state.m_defaultValue;
+        val = m_state->m_defaultValue;
         return true;
     }
 
-    auto iter = m_state.m_specials.find(ref);
-    if (iter == m_state.m_specials.end()) {
+    auto iter = m_state->m_specials.find(ref);
+    if (iter == m_state->m_specials.end()) {
         return false;
     }
 
@@ -255,8 +255,8 @@ FloatFieldImpl::FieldRefInfo FloatFieldImpl::processInnerRefImpl(const std::stri
 {
     assert(!refStr.empty());
     FieldRefInfo info;
-    auto iter = m_state.m_specials.find(refStr);
-    if (iter != m_state.m_specials.end()) {
+    auto iter = m_state->m_specials.find(refStr);
+    if (iter != m_state->m_specials.end()) {
         info.m_field = this;
         info.m_valueName = refStr;
         info.m_refType = FieldRefType_InnerValue;
@@ -267,7 +267,7 @@ FloatFieldImpl::FieldRefInfo FloatFieldImpl::processInnerRefImpl(const std::stri
 
 bool FloatFieldImpl::updateType()
 {
-    bool mustHave = (m_state.m_type == Type::NumOfValues);
+    bool mustHave = (m_state->m_type == Type::NumOfValues);
     if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
         return false;
     }
@@ -294,17 +294,17 @@ bool FloatFieldImpl::updateType()
         return false;
     }
 
-    auto newType = static_cast<decltype(m_state.m_type)>(std::distance(std::begin(Map), iter));
-    if (m_state.m_type == Type::NumOfValues) {
-        m_state.m_type = newType;
+    auto newType = static_cast<decltype(m_state->m_type)>(std::distance(std::begin(Map), iter));
+    if (m_state->m_type == Type::NumOfValues) {
+        m_state->m_type = newType;
         return true;
     }
 
-    if (newType == m_state.m_type) {
+    if (newType == m_state->m_type) {
         return true;
     }
 
-    logError() << XmlWrap::logPrefix(getNode()) <<
+    logError() << XmlWrap::logPrefix(location()) <<
                   "Type cannot be changed after reuse";
     return false;
 }
@@ -316,8 +316,8 @@ bool FloatFieldImpl::updateEndian()
     }
 
     auto& endianStr = common::getStringProp(props(), common::endianStr());
-    m_state.m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
-    if (m_state.m_endian == Endian_NumOfValues) {
+    m_state->m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
+    if (m_state->m_endian == Endian_NumOfValues) {
         reportUnexpectedPropertyValue(common::endianStr(), endianStr);
         return false;
     }
@@ -338,21 +338,21 @@ bool FloatFieldImpl::updateLength()
     static_assert(sizeof(float) == 4U, "Invalid size assumption");
     static_assert(sizeof(double) == 8U, "Invalid size assumption");
 
-    if (MapSize <= util::toUnsigned(m_state.m_type)) {
+    if (MapSize <= util::toUnsigned(m_state->m_type)) {
         static constexpr bool Should_not_happen = false;
         static_cast<void>(Should_not_happen);
         assert(Should_not_happen);
         return false;
     }
 
-    m_state.m_length = Map[util::toUnsigned(m_state.m_type)];
+    m_state->m_length = Map[util::toUnsigned(m_state->m_type)];
     return true;
 }
 
 bool FloatFieldImpl::updateMinMaxValues()
 {
-    m_state.m_typeAllowedMinValue = minValueForType(m_state.m_type);
-    m_state.m_typeAllowedMaxValue = maxValueForType(m_state.m_type);
+    m_state->m_typeAllowedMinValue = minValueForType(m_state->m_type);
+    m_state->m_typeAllowedMaxValue = maxValueForType(m_state->m_type);
     return true;
 }
 
@@ -367,23 +367,23 @@ bool FloatFieldImpl::updateDefaultValue()
         return true;
     }
 
-    if (!strToValue(valueStr, m_state.m_defaultValue)) {
+    if (!strToValue(valueStr, m_state->m_defaultValue)) {
         reportUnexpectedPropertyValue(common::defaultValueStr(), valueStr);
         return false;
     }
 
-    bool isSpecial = std::isnan(m_state.m_defaultValue) || std::isinf(m_state.m_defaultValue);
+    bool isSpecial = std::isnan(m_state->m_defaultValue) || std::isinf(m_state->m_defaultValue);
     if (isSpecial) {
         return true;
     }
 
-    if (m_state.m_typeAllowedMaxValue < m_state.m_defaultValue) {
+    if (m_state->m_typeAllowedMaxValue < m_state->m_defaultValue) {
         logError() << "Value of property \"" << common::defaultValueStr() <<
                         "\" is greater than the type's maximal value.";
         return false;
     }
 
-    if (m_state.m_defaultValue < m_state.m_typeAllowedMinValue) {
+    if (m_state->m_defaultValue < m_state->m_typeAllowedMinValue) {
         logError() << "Value of property \"" << common::defaultValueStr() <<
                         "\" is less than the type's minimal value.";
         return false;
@@ -394,7 +394,7 @@ bool FloatFieldImpl::updateDefaultValue()
 
 bool FloatFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state->m_validCheckVersion);
 }
 
 bool FloatFieldImpl::updateValidRanges()
@@ -413,7 +413,7 @@ bool FloatFieldImpl::updateValidRanges()
     // sort by version
     assert(std::isinf(-std::numeric_limits<double>::infinity()));
     std::sort(
-        m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+        m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
         [](auto& elem1, auto& elem2)
         {
             assert(elem1.m_deprecatedSince != 0U);
@@ -438,12 +438,12 @@ bool FloatFieldImpl::updateValidRanges()
         });
 
     // Merge
-    for (auto iter = m_state.m_validRanges.begin(); iter != m_state.m_validRanges.end(); ++iter) {
+    for (auto iter = m_state->m_validRanges.begin(); iter != m_state->m_validRanges.end(); ++iter) {
         if (iter->m_deprecatedSince == 0U) {
             continue;
         }
 
-        for (auto nextIter = iter + 1; nextIter != m_state.m_validRanges.end(); ++nextIter) {
+        for (auto nextIter = iter + 1; nextIter != m_state->m_validRanges.end(); ++nextIter) {
             if (nextIter->m_deprecatedSince == 0U) {
                 continue;
             }
@@ -469,17 +469,17 @@ bool FloatFieldImpl::updateValidRanges()
     }
 
     // Remove invalid
-    m_state.m_validRanges.erase(
-        std::remove_if(m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+    m_state->m_validRanges.erase(
+        std::remove_if(m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
                     [](auto& elem)
                     {
                         return elem.m_deprecatedSince == 0U;
                     }),
-        m_state.m_validRanges.end());
+        m_state->m_validRanges.end());
 
     // Sort by min/max value
     std::sort(
-        m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+        m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
         [](auto& elem1, auto& elem2)
         {
             assert(elem1.m_deprecatedSince != 0U);
@@ -513,7 +513,7 @@ bool FloatFieldImpl::updateValidRanges()
 
 bool FloatFieldImpl::updateNonUniqueSpecialsAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state.m_nonUniqueSpecialsAllowed);
+    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state->m_nonUniqueSpecialsAllowed);
 }
 
 bool FloatFieldImpl::updateSpecials()
@@ -573,8 +573,8 @@ bool FloatFieldImpl::updateSpecials()
             return false;
         }
 
-        auto specialsIter = m_state.m_specials.find(nameIter->second);
-        if (specialsIter != m_state.m_specials.end()) {
+        auto specialsIter = m_state->m_specials.find(nameIter->second);
+        if (specialsIter != m_state->m_specials.end()) {
             logError() << XmlWrap::logPrefix(s) << "Special with name \"" << nameIter->second <<
                           "\" was already assigned to \"" << name() << "\" element.";
             return false;
@@ -590,7 +590,7 @@ bool FloatFieldImpl::updateSpecials()
             return false;
         }
 
-        if (!m_state.m_nonUniqueSpecialsAllowed) {
+        if (!m_state->m_nonUniqueSpecialsAllowed) {
             bool reportError = false;
             const std::string* prevDefName = nullptr;
             do {
@@ -623,7 +623,7 @@ bool FloatFieldImpl::updateSpecials()
 
         bool isSpecial = std::isnan(val) || std::isinf(val);
         if ((!isSpecial) &&
-            ((val < m_state.m_typeAllowedMinValue) || (m_state.m_typeAllowedMaxValue < val))) {
+            ((val < m_state->m_typeAllowedMinValue) || (m_state->m_typeAllowedMaxValue < val))) {
             this->logError() << XmlWrap::logPrefix(s) <<
                 "Special value \"" << nameIter->second << "\" (" <<
                 valIter->second << ") is outside the range of available values within a type.";
@@ -649,7 +649,7 @@ bool FloatFieldImpl::updateSpecials()
             info.m_displayName = displayNameIter->second;
         }
 
-        m_state.m_specials.emplace(nameIter->second, info);
+        m_state->m_specials.emplace(nameIter->second, info);
     }
 
     return true;
@@ -667,7 +667,7 @@ bool FloatFieldImpl::updateUnits()
     }
 
     bool ok = false;
-    m_state.m_units = common::strToUnits(iter->second, &ok);
+    m_state->m_units = common::strToUnits(iter->second, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::unitsStr(), iter->second);
         return false;
@@ -688,7 +688,7 @@ bool FloatFieldImpl::updateDisplayDecimals()
     }
 
     bool ok = false;
-    m_state.m_displayDecimals = common::strToUnsigned(iter->second, &ok);
+    m_state->m_displayDecimals = common::strToUnsigned(iter->second, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::displayDesimalsStr(), iter->second);
         return false;
@@ -699,7 +699,7 @@ bool FloatFieldImpl::updateDisplayDecimals()
 
 bool FloatFieldImpl::updateDisplaySpecials()
 {
-    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state.m_displaySpecials);
+    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state->m_displaySpecials);
 }
 
 bool FloatFieldImpl::checkFullRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
@@ -721,11 +721,11 @@ bool FloatFieldImpl::checkFullRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
     }
 
     ValidRangeInfo info;
-    info.m_min = m_state.m_typeAllowedMinValue;
-    info.m_max = m_state.m_typeAllowedMaxValue;
+    info.m_min = m_state->m_typeAllowedMinValue;
+    info.m_max = m_state->m_typeAllowedMaxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -748,8 +748,8 @@ bool FloatFieldImpl::checkFullRangeAsChild(::xmlNodePtr child)
     }
 
     ValidRangeInfo info;
-    info.m_min = m_state.m_typeAllowedMinValue;
-    info.m_max = m_state.m_typeAllowedMaxValue;
+    info.m_min = m_state->m_typeAllowedMinValue;
+    info.m_max = m_state->m_typeAllowedMaxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
@@ -757,7 +757,7 @@ bool FloatFieldImpl::checkFullRangeAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -796,7 +796,7 @@ bool FloatFieldImpl::checkValidRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -819,7 +819,7 @@ bool FloatFieldImpl::checkValidRangeAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -855,7 +855,7 @@ bool FloatFieldImpl::checkValidValueAsAttr(const FieldImpl::PropsMap& xmlAttrs)
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -880,7 +880,7 @@ bool FloatFieldImpl::checkValidValueAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -912,11 +912,11 @@ bool FloatFieldImpl::checkValidMinAsAttr(const FieldImpl::PropsMap& xmlAttrs)
         return false;
     }
 
-    info.m_max = m_state.m_typeAllowedMaxValue;
+    info.m_max = m_state->m_typeAllowedMaxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -933,7 +933,7 @@ bool FloatFieldImpl::checkValidMinAsChild(::xmlNodePtr child)
         return false;
     }
 
-    info.m_max = m_state.m_typeAllowedMaxValue;
+    info.m_max = m_state->m_typeAllowedMaxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
@@ -941,7 +941,7 @@ bool FloatFieldImpl::checkValidMinAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -973,11 +973,11 @@ bool FloatFieldImpl::checkValidMaxAsAttr(const FieldImpl::PropsMap& xmlAttrs)
         return false;
     }
 
-    info.m_min = m_state.m_typeAllowedMinValue;
+    info.m_min = m_state->m_typeAllowedMinValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -994,7 +994,7 @@ bool FloatFieldImpl::checkValidMaxAsChild(::xmlNodePtr child)
         return false;
     }
 
-    info.m_min = m_state.m_typeAllowedMinValue;
+    info.m_min = m_state->m_typeAllowedMinValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
@@ -1002,7 +1002,7 @@ bool FloatFieldImpl::checkValidMaxAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1032,19 +1032,19 @@ bool FloatFieldImpl::validateValidRangeStr(const std::string& str, double& min,
     }
 
     if (!strToValue(range.first, min, false)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid min value in valid range (" << str << ").";
         return false;
     }
 
     if (!strToValue(range.second, max, false)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid max value in valid range (" << str << ").";
         return false;
     }
 
     if (max < min) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Min value must be less than max in valid range (" << str << ").";
         return false;
     }
@@ -1067,13 +1067,13 @@ bool FloatFieldImpl::validateValidValueStr(
         return true;
     }
 
-    if (m_state.m_typeAllowedMaxValue < val) {
+    if (m_state->m_typeAllowedMaxValue < val) {
         logError() << "Value of property \"" << type <<
                         "\" is greater than the type's maximal value.";
         return false;
     }
 
-    if (val < m_state.m_typeAllowedMinValue) {
+    if (val < m_state->m_typeAllowedMinValue) {
         logError() << "Value of property \"" << type <<
                         "\" is less than the type's minimal value.";
         return false;
@@ -1094,8 +1094,8 @@ bool FloatFieldImpl::strToValue(
         }
 
         if (common::isValidName(str)) {
-            auto iter = m_state.m_specials.find(str);
-            if (iter != m_state.m_specials.end()) {
+            auto iter = m_state->m_specials.find(str);
+            if (iter != m_state->m_specials.end()) {
                 val = iter->second.m_value;
                 return true;
             }
@@ -46,47 +46,47 @@ public:
 
     Type type() const
     {
-        return m_state.m_type;
+        return m_state->m_type;
     }
 
     Endian endian() const
     {
-        return m_state.m_endian;
+        return m_state->m_endian;
     }
 
     double defaultValue() const
     {
-        return m_state.m_defaultValue;
+        return m_state->m_defaultValue;
     }
 
     const ValidRangesList& validRanges() const
     {
-        return m_state.m_validRanges;
+        return m_state->m_validRanges;
     }
 
     const SpecialValues& specialValues() const
     {
-        return m_state.m_specials;
+        return m_state->m_specials;
     }
 
     bool validCheckVersion() const
     {
-        return m_state.m_validCheckVersion;
+        return m_state->m_validCheckVersion;
     }
 
     Units units() const
     {
-        return m_state.m_units;
+        return m_state->m_units;
     }
 
     unsigned displayDecimals() const
     {
-        return m_state.m_displayDecimals;
+        return m_state->m_displayDecimals;
     }
 
     bool displaySpecials() const
     {
-        return m_state.m_displaySpecials;
+        return m_state->m_displaySpecials;
     }
 
     bool hasNonUniqueSpecials() const;
@@ -156,7 +156,7 @@ private:
         bool m_displaySpecials = true;
     };
 
-    State m_state;
+    CowState<State> m_state;
 };
 
 } // namespace parse
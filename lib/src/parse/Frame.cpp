@@ -56,6 +56,12 @@ Frame::LayersList Frame::layers() const
     return m_pImpl->layersList();
 }
 
+const Frame::LayersList& Frame::layersView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedLayersList();
+}
+
 std::string Frame::externalRef(bool schemaRef) const
 {
     assert(m_pImpl != nullptr);
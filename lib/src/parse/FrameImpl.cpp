@@ -46,6 +46,7 @@ const XmlWrap::NamesList& frameSupportedTypes()
 
 FrameImpl::FrameImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol),
     m_name(&common::emptyString()),
     m_description(&common::emptyString())
@@ -54,9 +55,9 @@ FrameImpl::FrameImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool FrameImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    m_props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), m_props)) {
         return false;
     }
 
@@ -93,6 +94,11 @@ FrameImpl::LayersList FrameImpl::layersList() const
     return result;
 }
 
+const FrameImpl::LayersList& FrameImpl::cachedLayersList() const
+{
+    return m_layersListCache.get([this]() { return layersList(); });
+}
+
 std::string FrameImpl::externalRef(bool schemaRef) const
 {
     assert(getParent() != nullptr);
@@ -129,7 +135,7 @@ LogWrapper FrameImpl::logInfo() const
 
 bool FrameImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, m_protocol.logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), m_props, str, m_protocol.logger(), mustHave);
 }
 
 bool FrameImpl::validateAndUpdateStringPropValue(
@@ -152,7 +158,7 @@ bool FrameImpl::validateAndUpdateStringPropValue(
 
 void FrameImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, name(), propName, propValue, m_protocol.logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), name(), propName, propValue, m_protocol.logger());
 }
 
 const XmlWrap::NamesList& FrameImpl::commonProps()
@@ -183,7 +189,7 @@ bool FrameImpl::updateName()
     }
 
     if (!common::isValidName(*m_name)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid value for name property \"" << *m_name << "\".";
         return false;
     }
@@ -200,7 +206,7 @@ bool FrameImpl::updateLayers()
 {
     auto layersNodes = XmlWrap::getChildren(getNode(), common::layersStr());
     if (1U < layersNodes.size()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Only single \"" << common::layersStr() << "\" child element is "
                       "supported for \"" << common::frameStr() << "\".";
         return false;
@@ -208,7 +214,7 @@ bool FrameImpl::updateLayers()
 
     auto layersTypes = XmlWrap::getChildren(getNode(), frameSupportedTypes());
     if ((!layersNodes.empty()) && (!layersTypes.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "The \"" << common::frameStr() << "\" element does not support "
                       "list of stand alone layers as child elements together with \"" <<
                       common::layersStr() << "\" child element.";
@@ -216,7 +222,7 @@ bool FrameImpl::updateLayers()
     }
 
     if ((layersNodes.empty()) && (layersTypes.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << common::framesStr() << "\" element must contain at least one layer";
         return false;
     }
@@ -225,7 +231,7 @@ bool FrameImpl::updateLayers()
         assert(0U == layersNodes.size());
         auto allChildren = XmlWrap::getChildren(getNode());
         if (allChildren.size() != layersTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The layer types of \"" << common::frameStr() <<
                           "\" must be defined inside \"<" << common::layersStr() << ">\" child element "
                           "when there are other property describing children.";
@@ -257,7 +263,7 @@ bool FrameImpl::updateLayers()
             static constexpr bool Should_not_happen = false;
             static_cast<void>(Should_not_happen);
             assert(Should_not_happen);
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                   "Internal error, failed to create objects for layers.";
             return false;
         }
@@ -289,7 +295,7 @@ bool FrameImpl::updateLayers()
     }
 
     if (!hasPayloadLayer) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The frame \"" << name() << "\" must contain a \"" <<
             common::payloadStr() << "\" layer.";
         return false;
@@ -309,14 +315,14 @@ bool FrameImpl::updateLayers()
 
 bool FrameImpl::updateExtraAttrs()
 {
-    m_extraAttrs = XmlWrap::getExtraAttributes(m_node, commonProps(), m_protocol);
+    m_extraAttrs = XmlWrap::getExtraAttributes(getNode(), commonProps(), m_protocol);
     return true;
 }
 
 bool FrameImpl::updateExtraChildren()
 {
     static const XmlWrap::NamesList ChildrenNames = allNames();
-    m_extraChildren = XmlWrap::getExtraChildren(m_node, ChildrenNames, m_protocol);
+    m_extraChildren = XmlWrap::getExtraChildren(getNode(), ChildrenNames, m_protocol);
     return true;
 }
 
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <map>
 #include <string>
@@ -26,6 +27,7 @@
 #include "commsdsl/parse/Frame.h"
 #include "commsdsl/parse/Protocol.h"
 #include "LayerImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -40,6 +42,7 @@ class FrameImpl final : public Object
 public:
     using Ptr = std::unique_ptr<FrameImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using LayersList = Frame::LayersList;
     using ContentsList = XmlWrap::ContentsList;
 
@@ -50,9 +53,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parse();
 
     const PropsMap& props() const
@@ -64,10 +74,11 @@ public:
     const std::string& description() const;
 
     LayersList layersList() const;
+    const LayersList& cachedLayersList() const;
 
     std::string externalRef(bool schemaRef) const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -100,14 +111,16 @@ private:
     bool updateExtraChildren();
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     const std::string* m_name = nullptr;
     const std::string* m_description = nullptr;
     std::vector<LayerImplPtr> m_layers;
+    CachedList<LayersList> m_layersListCache;
 };
 
 using FrameImplPtr = FrameImpl::Ptr;
@@ -140,7 +140,7 @@ std::uintmax_t calcMaxUnsignedValue(IntFieldImpl::Type t, std::size_t bitsLen)
 IntFieldImpl::IntFieldImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : Base(node, protocol)
 {
-    m_state.m_nonUniqueSpecialsAllowed = !protocol.isNonUniqueSpecialsAllowedSupported();
+    m_state->m_nonUniqueSpecialsAllowed = !protocol.isNonUniqueSpecialsAllowedSupported();
 }
 
 IntFieldImpl::Type IntFieldImpl::parseTypeValue(const std::string& value)
@@ -395,22 +395,22 @@ bool IntFieldImpl::parseImpl()
 
 std::size_t IntFieldImpl::minLengthImpl() const
 {
-    if ((m_state.m_type == Type::Intvar) || (m_state.m_type == Type::Uintvar)) {
+    if ((m_state->m_type == Type::Intvar) || (m_state->m_type == Type::Uintvar)) {
         return 1U;
     }
 
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 std::size_t IntFieldImpl::maxLengthImpl() const
 {
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 std::size_t IntFieldImpl::bitLengthImpl() const
 {
     if (isBitfieldMember()) {
-        return m_state.m_bitLength;
+        return m_state->m_bitLength;
     }
     return Base::bitLengthImpl();
 }
@@ -440,18 +440,18 @@ bool IntFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
                  static_cast<std::uintmax_t>(std::numeric_limits<std::intmax_t>::max());
 
             isBigUnsigned =
-                IntFieldImpl::isBigUnsigned(m_state.m_type) &&
+                IntFieldImpl::isBigUnsigned(m_state->m_type) &&
                 (BigUnsignedThreshold < static_cast<std::uintmax_t>(val));
         };
 
     if (ref.empty()) {
-        val = m_state.m_defaultValue;
+        val = m_state->m_defaultValue;
         updateIsBigUnsignedFunc();
         return true;
     }
 
-    auto iter = m_state.m_specials.find(ref);
-    if (iter == m_state.m_specials.end()) {
+    auto iter = m_state->m_specials.find(ref);
+    if (iter == m_state->m_specials.end()) {
         return false;
     }
 
@@ -462,14 +462,14 @@ bool IntFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
 
 bool IntFieldImpl::validateBitLengthValueImpl(::xmlNodePtr node, std::size_t bitLength) const
 {
-    if ((m_state.m_type == Type::Intvar) || (m_state.m_type == Type::Uintvar)) {
+    if ((m_state->m_type == Type::Intvar) || (m_state->m_type == Type::Uintvar)) {
         logError() << XmlWrap::logPrefix(node) <<
                       "Bitfield member cannot have variable length type.";
         return false;
     }
 
-    assert(0U < m_state.m_length);
-    auto maxBitLength = m_state.m_length * BitsInByte;
+    assert(0U < m_state->m_length);
+    auto maxBitLength = m_state->m_length * BitsInByte;
     if (maxBitLength < bitLength) {
         logError() << XmlWrap::logPrefix(node) <<
                       "Value of property \"" << common::bitLengthStr() << "\" exceeds "
@@ -499,8 +499,8 @@ IntFieldImpl::FieldRefInfo IntFieldImpl::processInnerRefImpl(const std::string&
 {
     assert(!refStr.empty());
     FieldRefInfo info;
-    auto iter = m_state.m_specials.find(refStr);
-    if (iter != m_state.m_specials.end()) {
+    auto iter = m_state->m_specials.find(refStr);
+    if (iter != m_state->m_specials.end()) {
         info.m_field = this;
         info.m_valueName = refStr;
         info.m_refType = FieldRefType_InnerValue;
@@ -511,14 +511,14 @@ IntFieldImpl::FieldRefInfo IntFieldImpl::processInnerRefImpl(const std::string&
 
 bool IntFieldImpl::updateType()
 {
-    bool mustHave = (m_state.m_type == Type::NumOfValues);
+    bool mustHave = (m_state->m_type == Type::NumOfValues);
     if (!validateSinglePropInstance(common::typeStr(), mustHave)) {
         return false;
     }
 
     auto propsIter = props().find(common::typeStr());
     if (propsIter == props().end()) {
-        assert(m_state.m_type != Type::NumOfValues);
+        assert(m_state->m_type != Type::NumOfValues);
         return true;
     }
 
@@ -529,15 +529,15 @@ bool IntFieldImpl::updateType()
     }
 
     if (mustHave) {
-        m_state.m_type = type;
+        m_state->m_type = type;
         return true;
     }
 
-    if (type == m_state.m_type) {
+    if (type == m_state->m_type) {
         return true;
     }
 
-    logError() << XmlWrap::logPrefix(getNode()) <<
+    logError() << XmlWrap::logPrefix(location()) <<
                   "Type cannot be changed after reuse";
     return false;
 }
@@ -549,12 +549,12 @@ bool IntFieldImpl::updateEndian()
     }
 
     auto& endianStr = common::getStringProp(props(), common::endianStr());
-    if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
+    if ((endianStr.empty()) && (m_state->m_endian != Endian_NumOfValues)) {
         return true;
     }
 
-    m_state.m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
-    if (m_state.m_endian == Endian_NumOfValues) {
+    m_state->m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
+    if (m_state->m_endian == Endian_NumOfValues) {
         reportUnexpectedPropertyValue(common::endianStr(), endianStr);
         return false;
     }
@@ -567,48 +567,48 @@ bool IntFieldImpl::updateLength()
         return false;
     }
 
-    auto maxLength = maxTypeLength(m_state.m_type);
+    auto maxLength = maxTypeLength(m_state->m_type);
     auto& lengthStr = common::getStringProp(props(), common::lengthStr());
     if (lengthStr.empty()) {
-        if (m_state.m_length == 0) {
-            m_state.m_length = maxLength;
+        if (m_state->m_length == 0) {
+            m_state->m_length = maxLength;
             return true;
         }
 
-        assert(m_state.m_length <= maxTypeLength(m_state.m_type));
+        assert(m_state->m_length <= maxTypeLength(m_state->m_type));
         return true;
     }
 
     bool ok = false;
-    auto newLength = static_cast<decltype(m_state.m_length)>(common::strToUintMax(lengthStr, &ok));
+    auto newLength = static_cast<decltype(m_state->m_length)>(common::strToUintMax(lengthStr, &ok));
 
     if ((!ok) || (newLength == 0)) {
         reportUnexpectedPropertyValue(common::lengthStr(), lengthStr);
         return false;
     }
 
-    if (m_state.m_length == newLength) {
+    if (m_state->m_length == newLength) {
         return true;
     }
 
-    if (m_state.m_length != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_length != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Length cannot be changed after reuse";
         return false;
     }
 
-    m_state.m_length = newLength;
+    m_state->m_length = newLength;
 
 
     assert(0U < maxLength);
 
-    if (maxLength < m_state.m_length) {
-        logError() << XmlWrap::logPrefix(getNode()) << "Length of the \"" << name() << "\" element (" << lengthStr << ") cannot exceed "
+    if (maxLength < m_state->m_length) {
+        logError() << XmlWrap::logPrefix(location()) << "Length of the \"" << name() << "\" element (" << lengthStr << ") cannot exceed "
                       "max length allowed by the type (" << maxLength << ").";
         return false;
     }
 
-    assert (m_state.m_length != 0U);
+    assert (m_state->m_length != 0U);
     return true;
 }
 
@@ -618,36 +618,36 @@ bool IntFieldImpl::updateBitLength()
         return false;
     }
 
-    auto maxBitLength = m_state.m_length * BitsInByte;
-    assert((m_state.m_bitLength == 0) || (m_state.m_bitLength == maxBitLength));
+    auto maxBitLength = m_state->m_length * BitsInByte;
+    assert((m_state->m_bitLength == 0) || (m_state->m_bitLength == maxBitLength));
     auto& valStr = common::getStringProp(props(), common::bitLengthStr());
     if (valStr.empty()) {
-        assert(0 < m_state.m_length);
-        if (m_state.m_bitLength == 0) {
-            m_state.m_bitLength = maxBitLength;
+        assert(0 < m_state->m_length);
+        if (m_state->m_bitLength == 0) {
+            m_state->m_bitLength = maxBitLength;
             return true;
         }
 
-        assert(m_state.m_bitLength <= maxBitLength);
+        assert(m_state->m_bitLength <= maxBitLength);
         return true;
     }
 
     if (!isBitfieldMember()) {
-        logWarning() << XmlWrap::logPrefix((getNode())) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
                         "The property \"" << common::bitLengthStr() << "\" is "
                         "applicable only to the members of \"" << common::bitfieldStr() << "\"";
-        m_state.m_bitLength = maxBitLength;
+        m_state->m_bitLength = maxBitLength;
         return true;
     }
 
     bool ok = false;
-    m_state.m_bitLength = common::strToUnsigned(valStr, &ok);
+    m_state->m_bitLength = common::strToUnsigned(valStr, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::bitLengthStr(), valStr);
         return false;
     }
 
-    if (!validateBitLengthValue(m_state.m_bitLength)) {
+    if (!validateBitLengthValue(m_state->m_bitLength)) {
         return false;
     }
 
@@ -667,7 +667,7 @@ bool IntFieldImpl::updateSerOffset()
     }
 
     bool ok = false;
-    m_state.m_serOffset = common::strToIntMax(valueStr, &ok);
+    m_state->m_serOffset = common::strToIntMax(valueStr, &ok);
 
     if (!ok) {
         reportUnexpectedPropertyValue(common::serOffsetStr(), valueStr);
@@ -679,29 +679,29 @@ bool IntFieldImpl::updateSerOffset()
 
 bool IntFieldImpl::updateMinMaxValues()
 {
-    m_state.m_typeAllowedMinValue = minTypeValue(m_state.m_type);
-    m_state.m_typeAllowedMaxValue = maxTypeValue(m_state.m_type);
+    m_state->m_typeAllowedMinValue = minTypeValue(m_state->m_type);
+    m_state->m_typeAllowedMaxValue = maxTypeValue(m_state->m_type);
 
-    m_state.m_minValue = calcMinValue(m_state.m_type, m_state.m_bitLength);
-    m_state.m_maxValue = calcMaxValue(m_state.m_type, m_state.m_bitLength);
+    m_state->m_minValue = calcMinValue(m_state->m_type, m_state->m_bitLength);
+    m_state->m_maxValue = calcMaxValue(m_state->m_type, m_state->m_bitLength);
 
-    if (m_state.m_serOffset == 0) {
+    if (m_state->m_serOffset == 0) {
         return true;
     }
 
     do {
-        if ((isBigUnsigned(m_state.m_type)) ||
-            (m_state.m_typeAllowedMaxValue == std::numeric_limits<std::intmax_t>::max())) {
+        if ((isBigUnsigned(m_state->m_type)) ||
+            (m_state->m_typeAllowedMaxValue == std::numeric_limits<std::intmax_t>::max())) {
             break;
         }
 
-        auto diff = (m_state.m_typeAllowedMaxValue - m_state.m_typeAllowedMinValue);
+        auto diff = (m_state->m_typeAllowedMaxValue - m_state->m_typeAllowedMinValue);
         assert(diff <= static_cast<decltype(diff)>(std::numeric_limits<std::uint32_t>::max()));
-        if (std::abs(m_state.m_serOffset) < diff) {
+        if (std::abs(m_state->m_serOffset) < diff) {
             break;
         }
 
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "The serialisation offset value is too big or too small for selected type.";
         return false;
     } while (false);
@@ -710,15 +710,15 @@ bool IntFieldImpl::updateMinMaxValues()
         [this](auto& val)
         {
             using ValType = std::decay_t<decltype(val)>;
-            if (m_state.m_serOffset < 0) {
-                val -= m_state.m_serOffset;
+            if (m_state->m_serOffset < 0) {
+                val -= m_state->m_serOffset;
                 return;
             }
 
-            assert(0 < m_state.m_serOffset);
-            auto limit = std::numeric_limits<ValType>::min() + m_state.m_serOffset;
+            assert(0 < m_state->m_serOffset);
+            auto limit = std::numeric_limits<ValType>::min() + m_state->m_serOffset;
             if (static_cast<ValType>(limit) < val) {
-                val -= m_state.m_serOffset;
+                val -= m_state->m_serOffset;
             }
         };
 
@@ -726,32 +726,32 @@ bool IntFieldImpl::updateMinMaxValues()
         [this](auto& val)
         {
             using ValType = std::decay_t<decltype(val)>;
-            if (m_state.m_serOffset < 0) {
-                auto limit = std::numeric_limits<ValType>::max() + m_state.m_serOffset;
+            if (m_state->m_serOffset < 0) {
+                auto limit = std::numeric_limits<ValType>::max() + m_state->m_serOffset;
                 if (val < static_cast<ValType>(limit)) {
-                    val -= m_state.m_serOffset;
+                    val -= m_state->m_serOffset;
                 }
                 return;
             }
 
-            assert(0 < m_state.m_serOffset);
-            val -= m_state.m_serOffset;
+            assert(0 < m_state->m_serOffset);
+            val -= m_state->m_serOffset;
         };
 
-    if (!isTypeUnsigned(m_state.m_type)) {
-        updateMinValueFunc(m_state.m_minValue);
-        updateMaxValueFunc(m_state.m_maxValue);
+    if (!isTypeUnsigned(m_state->m_type)) {
+        updateMinValueFunc(m_state->m_minValue);
+        updateMaxValueFunc(m_state->m_maxValue);
         return true;
     }
 
-    auto minValueTmp = static_cast<std::uint64_t>(m_state.m_minValue);
-    auto maxValueTmp = static_cast<std::uint64_t>(m_state.m_maxValue);
+    auto minValueTmp = static_cast<std::uint64_t>(m_state->m_minValue);
+    auto maxValueTmp = static_cast<std::uint64_t>(m_state->m_maxValue);
 
     updateMinValueFunc(minValueTmp);
     updateMaxValueFunc(maxValueTmp);
 
-    m_state.m_minValue = static_cast<std::uint64_t>(minValueTmp);
-    m_state.m_maxValue = static_cast<std::uint64_t>(maxValueTmp);
+    m_state->m_minValue = static_cast<std::uint64_t>(minValueTmp);
+    m_state->m_maxValue = static_cast<std::uint64_t>(maxValueTmp);
 
     return true;
 }
@@ -784,7 +784,7 @@ bool IntFieldImpl::updateDefaultValidValue()
     }
 
     if (!protocol().isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) << 
+        logWarning() << XmlWrap::logPrefix(location()) << 
             "Property \"" << prop << "\" is not supported for DSL version " << protocol().currSchema().dslVersion() << ", ignoring...";        
         return true;
     }
@@ -795,11 +795,11 @@ bool IntFieldImpl::updateDefaultValidValue()
     }
 
     ValidRangeInfo info;
-    info.m_min = m_state.m_defaultValue;
-    info.m_max = m_state.m_defaultValue;
+    info.m_min = m_state->m_defaultValue;
+    info.m_max = m_state->m_defaultValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();    
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -809,11 +809,11 @@ bool IntFieldImpl::updateScaling()
         return false;
     }
 
-    std::intmax_t num = m_state.m_scaling.first;
+    std::intmax_t num = m_state->m_scaling.first;
     if (num == 0) {
         num = 1;
     }
-    std::intmax_t denom = m_state.m_scaling.second;
+    std::intmax_t denom = m_state->m_scaling.second;
     if (denom == 0) {
         denom = 1;
     }
@@ -827,7 +827,7 @@ bool IntFieldImpl::updateScaling()
         auto reportErrorFunc =
             [this, &valueStr]()
             {
-                logError() << XmlWrap::logPrefix(getNode()) << "The scaling ratio value of the \"" << name() <<
+                logError() << XmlWrap::logPrefix(location()) << "The scaling ratio value of the \"" << name() <<
                               "\" is not of expected format (" << valueStr << ").";
             };
 
@@ -875,19 +875,19 @@ bool IntFieldImpl::updateScaling()
     } while (false);
 
     if ((num == 0) || (denom == 0)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Neither part of scaling fraction is allowed to be 0.";
         return false;
     }
 
-    m_state.m_scaling = std::make_pair(num, denom);
+    m_state->m_scaling = std::make_pair(num, denom);
 
     return true;
 }
 
 bool IntFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state->m_validCheckVersion);
 }
 
 bool IntFieldImpl::updateValidRanges()
@@ -903,9 +903,9 @@ bool IntFieldImpl::updateValidRanges()
     }
 
     // Sort by version first
-    bool bigUnsigned = isBigUnsigned(m_state.m_type);
+    bool bigUnsigned = isBigUnsigned(m_state->m_type);
     std::sort(
-        m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+        m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
         [bigUnsigned](auto& elem1, auto& elem2)
         {
             assert(elem1.m_deprecatedSince != 0U);
@@ -934,12 +934,12 @@ bool IntFieldImpl::updateValidRanges()
         });
 
     // Merge
-    for (auto iter = m_state.m_validRanges.begin(); iter != m_state.m_validRanges.end(); ++iter) {
+    for (auto iter = m_state->m_validRanges.begin(); iter != m_state->m_validRanges.end(); ++iter) {
         if (iter->m_deprecatedSince == 0U) {
             continue;
         }
 
-        for (auto nextIter = iter + 1; nextIter != m_state.m_validRanges.end(); ++nextIter) {
+        for (auto nextIter = iter + 1; nextIter != m_state->m_validRanges.end(); ++nextIter) {
             if (nextIter->m_deprecatedSince == 0U) {
                 continue;
             }
@@ -957,17 +957,17 @@ bool IntFieldImpl::updateValidRanges()
     }
 
     // Remove invalid
-    m_state.m_validRanges.erase(
-        std::remove_if(m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+    m_state->m_validRanges.erase(
+        std::remove_if(m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
                     [](auto& elem)
                     {
                         return elem.m_deprecatedSince == 0U;
                     }),
-        m_state.m_validRanges.end());
+        m_state->m_validRanges.end());
 
     // Sort by min/max value
     std::sort(
-        m_state.m_validRanges.begin(), m_state.m_validRanges.end(),
+        m_state->m_validRanges.begin(), m_state->m_validRanges.end(),
         [bigUnsigned](auto& elem1, auto& elem2)
         {
             assert(elem1.m_deprecatedSince != 0U);
@@ -1003,12 +1003,12 @@ bool IntFieldImpl::updateValidRanges()
 
 bool IntFieldImpl::updateNonUniqueSpecialsAllowed()
 {
-    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state.m_nonUniqueSpecialsAllowed);
+    return validateAndUpdateBoolPropValue(common::nonUniqueSpecialsAllowedStr(), m_state->m_nonUniqueSpecialsAllowed);
 }
 
 bool IntFieldImpl::updateSpecials()
 {
-    bool bigUnsignedType = isBigUnsigned(m_state.m_type);
+    bool bigUnsignedType = isBigUnsigned(m_state->m_type);
     auto specials = XmlWrap::getChildren(getNode(), common::specialStr());
 
     using RecSpecials = std::multimap<std::intmax_t, std::string>;
@@ -1063,8 +1063,8 @@ bool IntFieldImpl::updateSpecials()
             return false;
         }
 
-        auto specialsIter = m_state.m_specials.find(nameIter->second);
-        if (specialsIter != m_state.m_specials.end()) {
+        auto specialsIter = m_state->m_specials.find(nameIter->second);
+        if (specialsIter != m_state->m_specials.end()) {
             logError() << XmlWrap::logPrefix(s) << "Special with name \"" << nameIter->second <<
                           "\" was already assigned to \"" << name() << "\" element.";
             return false;
@@ -1081,7 +1081,7 @@ bool IntFieldImpl::updateSpecials()
             return false;
         }
 
-        if (!m_state.m_nonUniqueSpecialsAllowed) {
+        if (!m_state->m_nonUniqueSpecialsAllowed) {
             auto recIter = recSpecials.find(val);
             if (recIter != recSpecials.end()) {
                 logError() << XmlWrap::logPrefix(s) <<
@@ -1097,15 +1097,15 @@ bool IntFieldImpl::updateSpecials()
         auto checkSpecialInRangeFunc =
             [this, s, &nameIter](auto v) -> bool
             {
-                if ((v < static_cast<decltype(v)>(m_state.m_typeAllowedMinValue)) ||
-                    (static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue) < v)) {
+                if ((v < static_cast<decltype(v)>(m_state->m_typeAllowedMinValue)) ||
+                    (static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue) < v)) {
                     this->logError() << XmlWrap::logPrefix(s) <<
                                     "Special value \"" << nameIter->second << "\" is outside the range of available values within a type.";
                     return false;
                 }
 
-                if ((v < static_cast<decltype(v)>(m_state.m_minValue)) ||
-                    (static_cast<decltype(v)>(m_state.m_maxValue) < v)) {
+                if ((v < static_cast<decltype(v)>(m_state->m_minValue)) ||
+                    (static_cast<decltype(v)>(m_state->m_maxValue) < v)) {
                     this->logWarning() << XmlWrap::logPrefix(s) <<
                                     "Special value \"" << nameIter->second << "\" is outside the range of correctly serializable values.";
                 }
@@ -1143,7 +1143,7 @@ bool IntFieldImpl::updateSpecials()
             info.m_displayName = displayNameIter->second;
         }
 
-        m_state.m_specials.emplace(nameIter->second, info);
+        m_state->m_specials.emplace(nameIter->second, info);
     }
 
     return true;
@@ -1161,7 +1161,7 @@ bool IntFieldImpl::updateUnits()
     }
 
     bool ok = false;
-    m_state.m_units = common::strToUnits(iter->second, &ok);
+    m_state->m_units = common::strToUnits(iter->second, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::unitsStr(), iter->second);
         return false;
@@ -1182,7 +1182,7 @@ bool IntFieldImpl::updateDisplayDecimals()
     }
 
     bool ok = false;
-    m_state.m_displayDecimals = common::strToUnsigned(iter->second, &ok);
+    m_state->m_displayDecimals = common::strToUnsigned(iter->second, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::displayDesimalsStr(), iter->second);
         return false;
@@ -1203,7 +1203,7 @@ bool IntFieldImpl::updateDisplayOffset()
     }
 
     bool ok = false;
-    m_state.m_displayOffset = common::strToIntMax(iter->second, &ok);
+    m_state->m_displayOffset = common::strToIntMax(iter->second, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::displayOffsetStr(), iter->second);
         return false;
@@ -1214,7 +1214,7 @@ bool IntFieldImpl::updateDisplayOffset()
 
 bool IntFieldImpl::updateSignExt()
 {
-    if (!validateAndUpdateBoolPropValue(common::signExtStr(), m_state.m_signExt)) {
+    if (!validateAndUpdateBoolPropValue(common::signExtStr(), m_state->m_signExt)) {
         return false;
     }
 
@@ -1224,7 +1224,7 @@ bool IntFieldImpl::updateSignExt()
     }
 
     do {
-        if (isUnsigned(m_state.m_type)) {
+        if (isUnsigned(m_state->m_type)) {
             break;
         }
 
@@ -1233,14 +1233,14 @@ bool IntFieldImpl::updateSignExt()
             bitLen = minLength() * 8U;
         }
 
-        if ((maxTypeLength(m_state.m_type) * 8U) <= bitLen) {
+        if ((maxTypeLength(m_state->m_type) * 8U) <= bitLen) {
             break;
         }
 
         return true;
     } while (false);
 
-    logWarning() << XmlWrap::logPrefix(getNode()) <<
+    logWarning() << XmlWrap::logPrefix(location()) <<
         "Property \"" << common::signExtStr() << "\" is relevant only to signed types with "
         "length limitation.";
 
@@ -1249,12 +1249,12 @@ bool IntFieldImpl::updateSignExt()
 
 bool IntFieldImpl::updateDisplaySpecials()
 {
-    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state.m_displaySpecials);
+    return validateAndUpdateBoolPropValue(common::displaySpecialsStr(), m_state->m_displaySpecials);
 }
 
 bool IntFieldImpl::updateAvailableLengthLimit()
 {
-    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state.m_availableLengthLimit);
+    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state->m_availableLengthLimit);
 }
 
 bool IntFieldImpl::checkValidRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
@@ -1272,7 +1272,7 @@ bool IntFieldImpl::checkValidRangeAsAttr(const FieldImpl::PropsMap& xmlAttrs)
 
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1295,7 +1295,7 @@ bool IntFieldImpl::checkValidRangeAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1331,7 +1331,7 @@ bool IntFieldImpl::checkValidValueAsAttr(const FieldImpl::PropsMap& xmlAttrs)
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1356,7 +1356,7 @@ bool IntFieldImpl::checkValidValueAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1388,11 +1388,11 @@ bool IntFieldImpl::checkValidMinAsAttr(const FieldImpl::PropsMap& xmlAttrs)
         return false;
     }
 
-    info.m_max = m_state.m_maxValue;
+    info.m_max = m_state->m_maxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1409,7 +1409,7 @@ bool IntFieldImpl::checkValidMinAsChild(::xmlNodePtr child)
         return false;
     }
 
-    info.m_max = m_state.m_maxValue;
+    info.m_max = m_state->m_maxValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
@@ -1417,7 +1417,7 @@ bool IntFieldImpl::checkValidMinAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1449,11 +1449,11 @@ bool IntFieldImpl::checkValidMaxAsAttr(const FieldImpl::PropsMap& xmlAttrs)
         return false;
     }
 
-    info.m_min = m_state.m_minValue;
+    info.m_min = m_state->m_minValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1470,7 +1470,7 @@ bool IntFieldImpl::checkValidMaxAsChild(::xmlNodePtr child)
         return false;
     }
 
-    info.m_min = m_state.m_minValue;
+    info.m_min = m_state->m_minValue;
     info.m_sinceVersion = getSinceVersion();
     info.m_deprecatedSince = getDeprecated();
 
@@ -1478,7 +1478,7 @@ bool IntFieldImpl::checkValidMaxAsChild(::xmlNodePtr child)
         return false;
     }
 
-    m_state.m_validRanges.push_back(info);
+    m_state->m_validRanges.push_back(info);
     return true;
 }
 
@@ -1509,25 +1509,25 @@ bool IntFieldImpl::validateValidRangeStr(const std::string& str, std::intmax_t&
 
     minVal = 0;
     if (!strToValue(range.first, minVal)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid min value in valid range (" << str << ").";
         return false;
     }
 
     maxVal = 0;
     if (!strToValue(range.second, maxVal)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid max value in valid range (" << str << ").";
         return false;
     }
 
     bool validComparison = (minVal <= maxVal);
-    if (isBigUnsigned(m_state.m_type)) {
+    if (isBigUnsigned(m_state->m_type)) {
         validComparison = (static_cast<std::uintmax_t>(minVal) <= static_cast<std::uintmax_t>(maxVal));
     }
 
     if (!validComparison) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Min value must be less than max in valid range (" << str << ").";
         return false;
     }
@@ -1535,14 +1535,14 @@ bool IntFieldImpl::validateValidRangeStr(const std::string& str, std::intmax_t&
     auto validateFunc =
         [this](auto v, const std::string& vType)
         {
-             if (v < static_cast<decltype(v)>(m_state.m_typeAllowedMinValue)) {
-                 logWarning() << XmlWrap::logPrefix(getNode()) <<
+             if (v < static_cast<decltype(v)>(m_state->m_typeAllowedMinValue)) {
+                 logWarning() << XmlWrap::logPrefix(location()) <<
                         "Range's " << vType << " value (" << v << ") "
                         "is below the type's minimal value.";
              }
 
-             if (static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue) < v) {
-                 logWarning() << XmlWrap::logPrefix(getNode()) <<
+             if (static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue) < v) {
+                 logWarning() << XmlWrap::logPrefix(location()) <<
                         "Range's " << vType << " value (" << v << ") "
                         "is above the type's maximal value.";
              }
@@ -1550,7 +1550,7 @@ bool IntFieldImpl::validateValidRangeStr(const std::string& str, std::intmax_t&
 
     static const std::string MinStr("min");
     static const std::string MaxStr("max");
-    if (isBigUnsigned(m_state.m_type)) {
+    if (isBigUnsigned(m_state->m_type)) {
         validateFunc(static_cast<std::uintmax_t>(minVal), MinStr);
         validateFunc(static_cast<std::uintmax_t>(maxVal), MaxStr);
     }
@@ -1570,7 +1570,7 @@ bool IntFieldImpl::validateValidValueStr(
 {
     val = 0;
     if (!strToValue(str, val)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Property value \"" << type << "\" of int element \"" <<
                       name() << "\" cannot be properly parsed.";
         return false;
@@ -1579,20 +1579,20 @@ bool IntFieldImpl::validateValidValueStr(
     auto validateFunc =
         [this, &type](auto v)
         {
-             if (v < static_cast<decltype(v)>(m_state.m_typeAllowedMinValue)) {
-                 logWarning() << XmlWrap::logPrefix(getNode()) <<
+             if (v < static_cast<decltype(v)>(m_state->m_typeAllowedMinValue)) {
+                 logWarning() << XmlWrap::logPrefix(location()) <<
                                  "Property value \"" << type <<
                                  "\" is below the type's minimal value.";
              }
 
-             if (static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue) < v) {
-                 logWarning() << XmlWrap::logPrefix(getNode()) <<
+             if (static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue) < v) {
+                 logWarning() << XmlWrap::logPrefix(location()) <<
                                  "Property value \"" << type <<
                                  "\" is above the type's maximal value.";
              }
         };
 
-    if (isBigUnsigned(m_state.m_type)) {
+    if (isBigUnsigned(m_state->m_type)) {
         validateFunc(static_cast<std::uintmax_t>(val));
     }
     else {
@@ -1608,8 +1608,8 @@ bool IntFieldImpl::strToValue(
 {
     if (common::isValidName(str)) {
         // Check among specials
-        auto iter = m_state.m_specials.find(str);
-        if (iter != m_state.m_specials.end()) {
+        auto iter = m_state->m_specials.find(str);
+        if (iter != m_state->m_specials.end()) {
             val = iter->second.m_value;
             return true;
         }
@@ -1621,15 +1621,15 @@ bool IntFieldImpl::strToValue(
             return false;
         }
 
-        if ((!bigUnsigned) && (val < 0) && (isUnsigned(m_state.m_type))) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if ((!bigUnsigned) && (val < 0) && (isUnsigned(m_state->m_type))) {
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Cannot assign negative value (" << val << " references as " <<
             str << ") to field with positive type.";
             return false;
         }
 
-        if (bigUnsigned && (!isBigUnsigned(m_state.m_type))) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if (bigUnsigned && (!isBigUnsigned(m_state->m_type))) {
+            logError() << XmlWrap::logPrefix(location()) <<
             "Cannot assign such big positive number (" <<
             static_cast<std::uintmax_t>(val) << " referenced as " <<
             str << ").";
@@ -1640,7 +1640,7 @@ bool IntFieldImpl::strToValue(
     }
 
     bool ok = false;
-    if (isBigUnsigned(m_state.m_type)) {
+    if (isBigUnsigned(m_state->m_type)) {
         val = static_cast<std::intmax_t>(common::strToUintMax(str, &ok));
     }
     else {
@@ -1654,22 +1654,22 @@ bool IntFieldImpl::updateDefaultValueInternal(const std::string& valueStr)
     auto reportErrorFunc =
         [this, &valueStr]()
         {
-            logError() << XmlWrap::logPrefix(getNode()) << "The default value of the \"" << name() <<
+            logError() << XmlWrap::logPrefix(location()) << "The default value of the \"" << name() <<
                           "\" is not within type boundaries (" << valueStr << ").";
         };
 
     auto reportWarningFunc =
         [this, &valueStr]()
         {
-            logWarning() << XmlWrap::logPrefix(getNode()) << "The default value of the \"" << name() <<
+            logWarning() << XmlWrap::logPrefix(location()) << "The default value of the \"" << name() <<
                           "\" is too small or big and will not be serialised correctly (" << valueStr << ").";
         };
 
     auto checkValueFunc =
         [this, &reportErrorFunc, &reportWarningFunc](auto v) -> bool
         {
-            auto castedTypeAllowedMinValue = static_cast<decltype(v)>(m_state.m_typeAllowedMinValue);
-            auto castedTypeAllowedMaxValue = static_cast<decltype(v)>(m_state.m_typeAllowedMaxValue);
+            auto castedTypeAllowedMinValue = static_cast<decltype(v)>(m_state->m_typeAllowedMinValue);
+            auto castedTypeAllowedMaxValue = static_cast<decltype(v)>(m_state->m_typeAllowedMaxValue);
 
             if (v < castedTypeAllowedMinValue) {
                 reportErrorFunc();
@@ -1681,25 +1681,25 @@ bool IntFieldImpl::updateDefaultValueInternal(const std::string& valueStr)
                 return false;
             }
 
-            auto castedMinValue = static_cast<decltype(v)>(m_state.m_minValue);
-            auto castedMaxValue = static_cast<decltype(v)>(m_state.m_maxValue);
+            auto castedMinValue = static_cast<decltype(v)>(m_state->m_minValue);
+            auto castedMaxValue = static_cast<decltype(v)>(m_state->m_maxValue);
             if ((v < castedMinValue) ||
                 (castedMaxValue < v)) {
                 reportWarningFunc();
             }
 
-            m_state.m_defaultValue = static_cast<decltype(m_state.m_defaultValue)>(v);
+            m_state->m_defaultValue = static_cast<decltype(m_state->m_defaultValue)>(v);
             return true;
         };
 
     std::intmax_t val = 0;
     if (!strToValue(valueStr, val)) {
-        logError() << XmlWrap::logPrefix(getNode()) << "The default value of the \"" << name() <<
+        logError() << XmlWrap::logPrefix(location()) << "The default value of the \"" << name() <<
                       "\" cannot be recongized (" << valueStr << ").";
         return false;
     }
 
-    if (isBigUnsigned(m_state.m_type)) {
+    if (isBigUnsigned(m_state->m_type)) {
         return checkValueFunc(static_cast<std::uint64_t>(val));
     }
 
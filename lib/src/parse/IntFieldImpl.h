@@ -47,82 +47,82 @@ public:
 
     Type type() const
     {
-        return m_state.m_type;
+        return m_state->m_type;
     }
 
     Endian endian() const
     {
-        return m_state.m_endian;
+        return m_state->m_endian;
     }
 
     std::intmax_t serOffset() const
     {
-        return m_state.m_serOffset;
+        return m_state->m_serOffset;
     }
 
     std::intmax_t minValue() const
     {
-        return m_state.m_minValue;
+        return m_state->m_minValue;
     }
 
     std::intmax_t maxValue() const
     {
-        return m_state.m_maxValue;
+        return m_state->m_maxValue;
     }
 
     std::intmax_t defaultValue() const
     {
-        return m_state.m_defaultValue;
+        return m_state->m_defaultValue;
     }
 
     ScalingRatio scaling() const
     {
-        return m_state.m_scaling;
+        return m_state->m_scaling;
     }
 
     const ValidRangesList& validRanges() const
     {
-        return m_state.m_validRanges;
+        return m_state->m_validRanges;
     }
 
     const SpecialValues& specialValues() const
     {
-        return m_state.m_specials;
+        return m_state->m_specials;
     }
 
     bool validCheckVersion() const
     {
-        return m_state.m_validCheckVersion;
+        return m_state->m_validCheckVersion;
     }
 
     Units units() const
     {
-        return m_state.m_units;
+        return m_state->m_units;
     }
 
     unsigned displayDecimals() const
     {
-        return m_state.m_displayDecimals;
+        return m_state->m_displayDecimals;
     }
 
     std::intmax_t displayOffset() const
     {
-        return m_state.m_displayOffset;
+        return m_state->m_displayOffset;
     }
 
     bool signExt() const
     {
-        return m_state.m_signExt;
+        return m_state->m_signExt;
     }
 
     bool displaySpecials() const
     {
-        return m_state.m_displaySpecials;
+        return m_state->m_displaySpecials;
     }
 
     bool availableLengthLimit() const
     {
-        return m_state.m_availableLengthLimit;
+        return m_state->m_availableLengthLimit;
     }
 
     static Type parseTypeValue(const std::string& value);
@@ -220,7 +220,7 @@ private:
         bool m_availableLengthLimit = false;
     };
 
-    State m_state;
+    CowState<State> m_state;
 };
 
 } // namespace parse
@@ -56,12 +56,24 @@ Interface::FieldsList Interface::fields() const
     return m_pImpl->fieldsList();
 }
 
+const Interface::FieldsList& Interface::fieldsView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedFieldsList();
+}
+
 Interface::AliasesList Interface::aliases() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->aliasesList();
 }
 
+const Interface::AliasesList& Interface::aliasesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedAliasesList();
+}
+
 std::string Interface::externalRef(bool schemaRef) const
 {
     assert(m_pImpl != nullptr);
@@ -47,6 +47,7 @@ const XmlWrap::NamesList& interfaceSupportedTypes()
 
 InterfaceImpl::InterfaceImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol),
     m_name(&common::emptyString()),
     m_description(&common::emptyString())
@@ -55,9 +56,9 @@ InterfaceImpl::InterfaceImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 
 bool InterfaceImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    m_props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), m_props)) {
         return false;
     }
 
@@ -97,6 +98,11 @@ InterfaceImpl::FieldsList InterfaceImpl::fieldsList() const
     return result;
 }
 
+const InterfaceImpl::FieldsList& InterfaceImpl::cachedFieldsList() const
+{
+    return m_fieldsListCache.get([this]() { return fieldsList(); });
+}
+
 InterfaceImpl::AliasesList InterfaceImpl::aliasesList() const
 {
     AliasesList result;
@@ -110,6 +116,11 @@ InterfaceImpl::AliasesList InterfaceImpl::aliasesList() const
     return result;
 }
 
+const InterfaceImpl::AliasesList& InterfaceImpl::cachedAliasesList() const
+{
+    return m_aliasesListCache.get([this]() { return aliasesList(); });
+}
+
 std::string InterfaceImpl::externalRef(bool schemaRef) const
 {
     assert(getParent() != nullptr);
@@ -199,7 +210,7 @@ LogWrapper InterfaceImpl::logInfo() const
 
 bool InterfaceImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, m_protocol.logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), m_props, str, m_protocol.logger(), mustHave);
 }
 
 bool InterfaceImpl::validateAndUpdateStringPropValue(
@@ -222,7 +233,7 @@ bool InterfaceImpl::validateAndUpdateStringPropValue(
 
 void InterfaceImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, name(), propName, propValue, m_protocol.logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), name(), propName, propValue, m_protocol.logger());
 }
 
 const XmlWrap::NamesList& InterfaceImpl::commonProps()
@@ -256,7 +267,7 @@ bool InterfaceImpl::updateName()
     }
 
     if (!common::isValidName(*m_name)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid value for name property \"" << *m_name << "\".";
         return false;
     }
@@ -288,14 +299,14 @@ bool InterfaceImpl::copyFields()
         }
 
         if (!m_protocol.isCopyFieldsFromBundleSupported()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Invalid reference to other interface \"" << iter->second << "\".";
             return false;            
         }
 
         auto* copyFromField = m_protocol.findField(iter->second);
         if ((copyFromField == nullptr) || (copyFromField->kind() != Field::Kind::Bundle)) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Invalid reference to other interface or bundle \"" << iter->second << "\".";
             return false;
         }        
@@ -312,7 +323,7 @@ bool InterfaceImpl::updateFields()
     do {
         auto fieldsNodes = XmlWrap::getChildren(getNode(), common::fieldsStr());
         if (1U < fieldsNodes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Only single \"" << common::fieldsStr() << "\" child element is "
                           "supported for \"" << common::interfaceStr() << "\".";
             return false;
@@ -320,7 +331,7 @@ bool InterfaceImpl::updateFields()
 
         auto fieldsTypes = XmlWrap::getChildren(getNode(), interfaceSupportedTypes());
         if ((!fieldsNodes.empty()) && (!fieldsTypes.empty())) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::interfaceStr() << "\" element does not support "
                           "list of stand alone fields as child elements together with \"" <<
                           common::fieldsStr() << "\" child element.";
@@ -335,7 +346,7 @@ bool InterfaceImpl::updateFields()
             assert(0U == fieldsNodes.size());
             auto allChildren = XmlWrap::getChildren(getNode());
             if (allChildren.size() != fieldsTypes.size()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The field types of \"" << common::interfaceStr() <<
                               "\" must be defined inside \"<" << common::fieldsStr() << ">\" child element "
                               "when there are other property describing children.";
@@ -365,7 +376,7 @@ bool InterfaceImpl::updateFields()
                 static constexpr bool Should_not_happen = false;
                 static_cast<void>(Should_not_happen);
                 assert(Should_not_happen);
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                       "Internal error, failed to create objects for member fields.";
                 return false;
             }
@@ -400,7 +411,7 @@ bool InterfaceImpl::copyAliases()
 
     auto iter = props().find(propStr);
     if (iter != props().end() && (!m_protocol.isFieldAliasSupported())) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Unexpected property \"" << propStr << "\".";
         return false;
     }
@@ -424,7 +435,7 @@ bool InterfaceImpl::copyAliases()
     }
 
     if ((iter != props().end()) && (m_copyFieldsFromInterface == nullptr) && (m_copyFieldsFromBundle == nullptr)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "Property \"" << propStr << "\" is inapplicable without \"" << common::copyFieldsFromStr() << "\".";
         return true;
     }
@@ -516,7 +527,7 @@ bool InterfaceImpl::updateAliases()
             static constexpr bool Should_not_happen = false;
             static_cast<void>(Should_not_happen);
             assert(Should_not_happen);
-            logError() << XmlWrap::logPrefix(alias->getNode()) <<
+            logError() << XmlWrap::logPrefix(alias->location()) <<
                   "Internal error, failed to create objects for member aliases.";
             return false;
         }
@@ -537,14 +548,14 @@ bool InterfaceImpl::updateAliases()
 
 bool InterfaceImpl::updateExtraAttrs()
 {
-    m_extraAttrs = XmlWrap::getExtraAttributes(m_node, commonProps(), m_protocol);
+    m_extraAttrs = XmlWrap::getExtraAttributes(getNode(), commonProps(), m_protocol);
     return true;
 }
 
 bool InterfaceImpl::updateExtraChildren()
 {
     static const XmlWrap::NamesList ChildrenNames = allNames();
-    m_extraChildren = XmlWrap::getExtraChildren(m_node, ChildrenNames, m_protocol);
+    m_extraChildren = XmlWrap::getExtraChildren(getNode(), ChildrenNames, m_protocol);
     return true;
 }
 
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <map>
 #include <string>
@@ -28,6 +29,7 @@
 #include "FieldImpl.h"
 #include "AliasImpl.h"
 #include "BundleFieldImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -42,6 +44,7 @@ class InterfaceImpl final : public Object
 public:
     using Ptr = std::unique_ptr<InterfaceImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using FieldsList = Interface::FieldsList;
     using AliasesList = Interface::AliasesList;
     using ContentsList = XmlWrap::ContentsList;
@@ -55,9 +58,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parse();
 
     const PropsMap& props() const
@@ -70,11 +80,13 @@ public:
     const std::string& description() const;
 
     FieldsList fieldsList() const;
+    const FieldsList& cachedFieldsList() const;
     AliasesList aliasesList() const;
+    const AliasesList& cachedAliasesList() const;
 
     std::string externalRef(bool schemaRef) const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -119,9 +131,10 @@ private:
     bool updateExtraChildren();
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     const std::string* m_name = nullptr;
@@ -130,6 +143,8 @@ private:
     const BundleFieldImpl* m_copyFieldsFromBundle = nullptr;
     std::vector<FieldImplPtr> m_fields;
     std::vector<AliasImplPtr> m_aliases;
+    CachedList<FieldsList> m_fieldsListCache;
+    CachedList<AliasesList> m_aliasesListCache;
 };
 
 using InterfaceImplPtr = InterfaceImpl::Ptr;
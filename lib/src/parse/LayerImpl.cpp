@@ -55,9 +55,9 @@ LayerImpl::Ptr LayerImpl::create(
 
 bool LayerImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    m_props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), m_props)) {
         return false;
     }
 
@@ -67,13 +67,13 @@ bool LayerImpl::parse()
             break;
         }
 
-        if (!XmlWrap::parseChildrenAsProps(m_node, extraPropsNames, m_protocol.logger(), m_props)) {
+        if (!XmlWrap::parseChildrenAsProps(getNode(), extraPropsNames, m_protocol.logger(), m_props)) {
             return false;
         }
 
     } while (false);
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonPossibleProps(), m_protocol.logger(), m_props, false)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonPossibleProps(), m_protocol.logger(), m_props, false)) {
         return false;
     }
 
@@ -137,6 +137,7 @@ XmlWrap::NamesList LayerImpl::supportedTypes()
 
 LayerImpl::LayerImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol),
     m_name(&common::emptyString()),
     m_description(&common::emptyString())
@@ -186,7 +187,7 @@ bool LayerImpl::mustHaveFieldImpl() const
 
 bool LayerImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, protocol().logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), m_props, str, protocol().logger(), mustHave);
 }
 
 bool LayerImpl::validateAndUpdateStringPropValue(
@@ -209,7 +210,7 @@ bool LayerImpl::validateAndUpdateStringPropValue(
 
 void LayerImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, name(), propName, propValue, protocol().logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), name(), propName, propValue, protocol().logger());
 }
 
 bool LayerImpl::verifySingleLayer(const LayerImpl::LayersList& layers, const std::string& kindStr)
@@ -221,7 +222,7 @@ bool LayerImpl::verifySingleLayer(const LayerImpl::LayersList& layers, const std
         }
 
         if (l->kind() == k) {
-            logError() << XmlWrap::logPrefix(l->getNode()) <<
+            logError() << XmlWrap::logPrefix(l->location()) <<
                 "Only single \"" << kindStr << "\" layer can exist in the frame.";
             return false;
         }
@@ -237,7 +238,7 @@ bool LayerImpl::verifyBeforePayload(const LayerImpl::LayersList& layers)
     assert(payloadIdx < layers.size());
 
     if (payloadIdx <= thisIdx) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "This layer is expected to be before the \"" << common::payloadStr() <<
             "\" one.";
         return false;
@@ -328,7 +329,7 @@ bool LayerImpl::updateName()
     }
 
     if (!common::isValidName(*m_name)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid value for name property \"" << m_name << "\".";
         return false;
     }
@@ -353,12 +354,12 @@ bool LayerImpl::updateField()
     }
 
     if (hasField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "This layer mustn't specify field.";
         return false;
     }
 
-    logError() << XmlWrap::logPrefix(getNode()) <<
+    logError() << XmlWrap::logPrefix(location()) <<
         "This layer must specify field.";
 
     return false;
@@ -366,7 +367,7 @@ bool LayerImpl::updateField()
 
 bool LayerImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
 {
-    auto extraAttrs = XmlWrap::getExtraAttributes(m_node, names, m_protocol);
+    auto extraAttrs = XmlWrap::getExtraAttributes(getNode(), names, m_protocol);
     if (extraAttrs.empty()) {
         return true;
     }
@@ -382,7 +383,7 @@ bool LayerImpl::updateExtraAttrs(const XmlWrap::NamesList& names)
 
 bool LayerImpl::updateExtraChildren(const XmlWrap::NamesList& names)
 {
-    auto extraChildren = XmlWrap::getExtraChildren(m_node, names, m_protocol);
+    auto extraChildren = XmlWrap::getExtraChildren(getNode(), names, m_protocol);
     if (extraChildren.empty()) {
         return true;
     }
@@ -410,7 +411,7 @@ bool LayerImpl::checkFieldFromRef()
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << common::fieldStr() <<
             "\" property (" << iter->second << ").";
         return false;
@@ -431,7 +432,7 @@ bool LayerImpl::checkFieldAsChild()
 
     auto fieldTypes = XmlWrap::getChildren(getNode(), FieldImpl::supportedTypes());
     if ((0U < children.size()) && (0U < fieldTypes.size())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                   "The frame layer element does not support "
                   "stand alone field as child element together with \"" <<
                   common::fieldStr() << "\" child element.";
@@ -449,7 +450,7 @@ bool LayerImpl::checkFieldAsChild()
         }
 
         if (1U < fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "The frame layer element is expected to define only "
                 "single field";
             return false;
@@ -457,7 +458,7 @@ bool LayerImpl::checkFieldAsChild()
 
         auto allChildren = XmlWrap::getChildren(getNode());
         if (allChildren.size() != fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                   "The field type of frame layer "
                   " must be defined inside \"<" << common::fieldsStr() << ">\" child element "
                   "when there are other property describing children.";
@@ -510,7 +511,7 @@ bool LayerImpl::checkFieldAsChild()
     std::string fieldKind(reinterpret_cast<const char*>(fieldNode->name));
     auto field = FieldImpl::create(fieldKind, fieldNode, protocol());
     if (!field) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Unknown field type \"" << fieldKind << "\"";
         return false;
     }
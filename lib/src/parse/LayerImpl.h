@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <map>
 #include <functional>
@@ -39,6 +40,7 @@ class LayerImpl : public Object
 public:
     using Ptr = std::unique_ptr<LayerImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using LayersList = std::vector<Ptr>;
     using Kind = Layer::Kind;
@@ -49,9 +51,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parse();
     bool verify(const LayersList& layers)
     {
@@ -93,12 +102,12 @@ public:
         return extraPropsNamesImpl();
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -167,13 +176,14 @@ private:
     static const CreateMap& createMap();
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
     const std::string* m_name = nullptr;
     const std::string* m_description = nullptr;
     const FieldImpl* m_extField = nullptr;
     FieldImplPtr m_field;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 };
 
@@ -116,9 +116,9 @@ bool ListFieldImpl::reuseImpl(const FieldImpl& other)
 bool ListFieldImpl::verifySiblingsImpl(const FieldsList& fields) const
 {
     return 
-        verifySiblingsForPrefix(fields, m_state.m_detachedCountPrefixField) &&
-        verifySiblingsForPrefix(fields, m_state.m_detachedLengthPrefixField) &&
-        verifySiblingsForPrefix(fields, m_state.m_detachedElemLengthPrefixField);
+        verifySiblingsForPrefix(fields, m_state->m_detachedCountPrefixField) &&
+        verifySiblingsForPrefix(fields, m_state->m_detachedLengthPrefixField) &&
+        verifySiblingsForPrefix(fields, m_state->m_detachedElemLengthPrefixField);
 }
 
 bool ListFieldImpl::parseImpl()
@@ -141,15 +141,15 @@ std::size_t ListFieldImpl::minLengthImpl() const
         extraLen += elemLengthPrefixField().minLength();
     }
 
-    if (m_state.m_count != 0U) {
+    if (m_state->m_count != 0U) {
         assert(elementField().valid());
         auto elemMinLength = elementField().minLength();
 
-        if (!m_state.m_elemFixedLength) {
-            extraLen *= m_state.m_count;
+        if (!m_state->m_elemFixedLength) {
+            extraLen *= m_state->m_count;
         }
 
-        return (m_state.m_count * elemMinLength) + extraLen;
+        return (m_state->m_count * elemMinLength) + extraLen;
     }
 
     if (hasCountPrefixField()) {
@@ -176,13 +176,13 @@ std::size_t ListFieldImpl::maxLengthImpl() const
 
     assert(elementField().valid());
     auto elemMaxLength = elementField().maxLength();
-    if (m_state.m_count != 0U) {
+    if (m_state->m_count != 0U) {
 
-        if (!m_state.m_elemFixedLength) {
-            extraLen = common::mulLength(extraLen, m_state.m_count);
+        if (!m_state->m_elemFixedLength) {
+            extraLen = common::mulLength(extraLen, m_state->m_count);
         }
 
-        common::addToLength(common::mulLength(elemMaxLength, m_state.m_count), extraLen);
+        common::addToLength(common::mulLength(elemMaxLength, m_state->m_count), extraLen);
         return extraLen;
     }
 
@@ -195,7 +195,7 @@ std::size_t ListFieldImpl::maxLengthImpl() const
 
         common::addToLength(castedPrefix.maxLength(), result);
 
-        if (!m_state.m_elemFixedLength) {
+        if (!m_state->m_elemFixedLength) {
             extraLen = common::mulLength(extraLen, count);
         }
 
@@ -218,27 +218,27 @@ std::size_t ListFieldImpl::maxLengthImpl() const
 void ListFieldImpl::cloneFields(const ListFieldImpl& other)
 {
     if (other.m_elementField) {
-        assert(other.m_state.m_extElementField == nullptr);
+        assert(other.m_state->m_extElementField == nullptr);
         m_elementField = other.m_elementField->clone();
     }
 
     if (other.m_countPrefixField) {
-        assert(other.m_state.m_extCountPrefixField == nullptr);
+        assert(other.m_state->m_extCountPrefixField == nullptr);
         m_countPrefixField = other.m_countPrefixField->clone();
     }
 
     if (other.m_lengthPrefixField) {
-        assert(other.m_state.m_extLengthPrefixField == nullptr);
+        assert(other.m_state->m_extLengthPrefixField == nullptr);
         m_lengthPrefixField = other.m_lengthPrefixField->clone();
     }
 
     if (other.m_elemLengthPrefixField) {
-        assert(other.m_state.m_extElemLengthPrefixField == nullptr);
+        assert(other.m_state->m_extElemLengthPrefixField == nullptr);
         m_elemLengthPrefixField = other.m_elemLengthPrefixField->clone();
     }
 
     if (other.m_termSuffixField) {
-        assert(other.m_state.m_extTermSuffixField == nullptr);
+        assert(other.m_state->m_extTermSuffixField == nullptr);
         m_termSuffixField = other.m_termSuffixField->clone();
     }    
 }
@@ -251,7 +251,7 @@ bool ListFieldImpl::updateElement()
     }
 
     if (!hasElementField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "List element hasn't been provided.";
         return false;
     }
@@ -279,45 +279,45 @@ bool ListFieldImpl::updateCount()
     }
 
     if ((hasCountPrefixField()) || (hasLengthPrefixField()) || (hasTermSuffixField()) ||
-        (!m_state.m_detachedCountPrefixField.empty()) ||
-        (!m_state.m_detachedLengthPrefixField.empty()) ||
-        (!m_state.m_detachedElemLengthPrefixField.empty()) ||
-        (!m_state.m_detachedTermSuffixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        (!m_state->m_detachedCountPrefixField.empty()) ||
+        (!m_state->m_detachedLengthPrefixField.empty()) ||
+        (!m_state->m_detachedElemLengthPrefixField.empty()) ||
+        (!m_state->m_detachedTermSuffixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot use " << common::countStr() << " property after reusing list with " << 
             common::countPrefixStr() << ", " << common::lengthPrefixStr() << ", or" << common::termSuffixStr() << ".";
         return false;
     }
 
-    m_state.m_count = newVal;
+    m_state->m_count = newVal;
     return true;
 }
 
 bool ListFieldImpl::updateCountPrefix()
 {
-    if ((!checkPrefixFromRef(common::countPrefixStr(), m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField)) ||
-        (!checkPrefixAsChild(common::countPrefixStr(), m_state.m_extCountPrefixField, m_countPrefixField, m_state.m_detachedCountPrefixField))) {
+    if ((!checkPrefixFromRef(common::countPrefixStr(), m_state->m_extCountPrefixField, m_countPrefixField, m_state->m_detachedCountPrefixField)) ||
+        (!checkPrefixAsChild(common::countPrefixStr(), m_state->m_extCountPrefixField, m_countPrefixField, m_state->m_detachedCountPrefixField))) {
         return false;
     }
 
-    if ((!hasCountPrefixField()) && (m_state.m_detachedCountPrefixField.empty())) {
+    if ((!hasCountPrefixField()) && (m_state->m_detachedCountPrefixField.empty())) {
         return true;
     }
 
-    if (m_state.m_count != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_count != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::countStr() << " and " << common::countPrefixStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasLengthPrefixField() || (!m_state.m_detachedLengthPrefixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasLengthPrefixField() || (!m_state->m_detachedLengthPrefixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::lengthPrefixStr() << " and " << common::countPrefixStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasTermSuffixField() || (!m_state.m_detachedTermSuffixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasTermSuffixField() || (!m_state->m_detachedTermSuffixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::termSuffixStr() << " and " << common::countPrefixStr() << " cannot be used together.";
         return false;
     }    
@@ -327,29 +327,29 @@ bool ListFieldImpl::updateCountPrefix()
 
 bool ListFieldImpl::updateLengthPrefix()
 {
-    if ((!checkPrefixFromRef(common::lengthPrefixStr(), m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField)) ||
-        (!checkPrefixAsChild(common::lengthPrefixStr(), m_state.m_extLengthPrefixField, m_lengthPrefixField, m_state.m_detachedLengthPrefixField))) {
+    if ((!checkPrefixFromRef(common::lengthPrefixStr(), m_state->m_extLengthPrefixField, m_lengthPrefixField, m_state->m_detachedLengthPrefixField)) ||
+        (!checkPrefixAsChild(common::lengthPrefixStr(), m_state->m_extLengthPrefixField, m_lengthPrefixField, m_state->m_detachedLengthPrefixField))) {
         return false;
     }
 
-    if ((!hasLengthPrefixField()) && (m_state.m_detachedLengthPrefixField.empty())) {
+    if ((!hasLengthPrefixField()) && (m_state->m_detachedLengthPrefixField.empty())) {
         return true;
     }
 
-    if (m_state.m_count != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_count != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::countStr() << " and " << common::lengthPrefixStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasCountPrefixField() || (!m_state.m_detachedCountPrefixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasCountPrefixField() || (!m_state->m_detachedCountPrefixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::countPrefixStr() << " and " << common::lengthPrefixStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasTermSuffixField() || (!m_state.m_detachedTermSuffixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasTermSuffixField() || (!m_state->m_detachedTermSuffixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::termSuffixStr() << " and " << common::lengthPrefixStr() << " cannot be used together.";
         return false;
     }     
@@ -359,14 +359,14 @@ bool ListFieldImpl::updateLengthPrefix()
 
 bool ListFieldImpl::updateElemLengthPrefix()
 {
-    if ((!checkPrefixFromRef(common::elemLengthPrefixStr(), m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField)) ||
-        (!checkPrefixAsChild(common::elemLengthPrefixStr(), m_state.m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state.m_detachedElemLengthPrefixField))) {
+    if ((!checkPrefixFromRef(common::elemLengthPrefixStr(), m_state->m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state->m_detachedElemLengthPrefixField)) ||
+        (!checkPrefixAsChild(common::elemLengthPrefixStr(), m_state->m_extElemLengthPrefixField, m_elemLengthPrefixField, m_state->m_detachedElemLengthPrefixField))) {
         return false;
     }
 
-    if ((!m_state.m_detachedElemLengthPrefixField.empty()) &&
-        (!m_state.m_elemFixedLength)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if ((!m_state->m_detachedElemLengthPrefixField.empty()) &&
+        (!m_state->m_elemFixedLength)) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Detached element length prefix is supported only for lists with fixed length elements. "
             "Set the \"" << common::elemFixedLengthStr() << "\" property.";
         return false;
@@ -388,21 +388,21 @@ bool ListFieldImpl::updateElemFixedLength()
         }
 
         bool ok = false;
-        m_state.m_elemFixedLength = common::strToBool(iter->second, &ok);
+        m_state->m_elemFixedLength = common::strToBool(iter->second, &ok);
         if (!ok) {
             reportUnexpectedPropertyValue(common::elemFixedLengthStr(), iter->second);
             return false;
         }
     } while (false);
 
-    if (!m_state.m_elemFixedLength) {
+    if (!m_state->m_elemFixedLength) {
         return true;
     }
 
     assert(hasElementField());
     auto elem = elementField();
     if (elem.minLength() != elem.maxLength()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot have \"" << common::elemFixedLengthStr() << "\" property being set to "
             "true when list element has variable length.";
         return false;
@@ -413,38 +413,38 @@ bool ListFieldImpl::updateElemFixedLength()
 bool ListFieldImpl::updateTermSuffix()
 {
     auto& prop = common::termSuffixStr();
-    if ((!checkPrefixFromRef(prop, m_state.m_extTermSuffixField, m_termSuffixField, m_state.m_detachedTermSuffixField)) ||
-        (!checkPrefixAsChild(prop, m_state.m_extTermSuffixField, m_termSuffixField, m_state.m_detachedTermSuffixField))) {
+    if ((!checkPrefixFromRef(prop, m_state->m_extTermSuffixField, m_termSuffixField, m_state->m_detachedTermSuffixField)) ||
+        (!checkPrefixAsChild(prop, m_state->m_extTermSuffixField, m_termSuffixField, m_state->m_detachedTermSuffixField))) {
         return false;
     }
 
-    if ((!hasTermSuffixField()) && (m_state.m_detachedTermSuffixField.empty())) {
+    if ((!hasTermSuffixField()) && (m_state->m_detachedTermSuffixField.empty())) {
         return true;
     }
 
     if (!protocol().isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Usage of the " << prop << " property is not supported for the used dslVersion, ignoring...";
-        m_state.m_extTermSuffixField = nullptr;
-        m_state.m_detachedTermSuffixField.clear();
+        m_state->m_extTermSuffixField = nullptr;
+        m_state->m_detachedTermSuffixField.clear();
         m_termSuffixField.reset();
         return true;
     }
 
-    if (m_state.m_count != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_count != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::termSuffixStr() << " and " << common::countStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasCountPrefixField() || (!m_state.m_detachedCountPrefixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasCountPrefixField() || (!m_state->m_detachedCountPrefixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::termSuffixStr() << " and " << common::countPrefixStr() << " cannot be used together.";
         return false;
     }
 
-    if (hasLengthPrefixField() || (!m_state.m_detachedLengthPrefixField.empty())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (hasLengthPrefixField() || (!m_state->m_detachedLengthPrefixField.empty())) {
+        logError() << XmlWrap::logPrefix(location()) <<
             common::termSuffixStr() << " and " << common::lengthPrefixStr() << " cannot be used together.";
         return false;
     }    
@@ -465,14 +465,14 @@ bool ListFieldImpl::checkElementFromRef()
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << common::elementStr() <<
             "\" property (" << iter->second << ").";
         return false;
     }
 
     m_elementField.reset();
-    m_state.m_extElementField = field;
+    m_state->m_extElementField = field;
     return true;
 }
 
@@ -490,7 +490,7 @@ bool ListFieldImpl::checkElementAsChild()
 
     auto fieldTypes = XmlWrap::getChildren(getNode(), listSupportedTypes());
     if ((0U < children.size()) && (0U < fieldTypes.size())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                   "The \"" << common::listStr() << "\" does not support "
                   "stand alone field as child element together with \"" <<
                   common::elementStr() << "\" child element.";
@@ -508,7 +508,7 @@ bool ListFieldImpl::checkElementAsChild()
         }
 
         if (1U < fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "The \"" << common::listStr() << "\" element is expected to define only "
                 "single child field";
             return false;
@@ -516,7 +516,7 @@ bool ListFieldImpl::checkElementAsChild()
 
         auto allChildren = XmlWrap::getChildren(getNode());
         if (allChildren.size() != fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                   "The element type of \"" << common::listStr() <<
                   "\" must be defined inside \"<" << common::elementStr() << ">\" child element "
                   "when there are other property describing children.";
@@ -585,7 +585,7 @@ bool ListFieldImpl::checkElementAsChild()
         return false;
     }
 
-    m_state.m_extElementField = nullptr;
+    m_state->m_extElementField = nullptr;
     m_elementField = std::move(field);
     assert(m_elementField->externalRef(false).empty());
     return true;
@@ -632,14 +632,14 @@ bool ListFieldImpl::checkPrefixFromRef(
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << type <<
             "\" property (" << iter->second << ").";
         return false;
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The field referenced by \"" << type <<
             "\" property (" << iter->second << ") must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
@@ -691,7 +691,7 @@ bool ListFieldImpl::checkPrefixAsChild(
     }
 
     if (hasInProps) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << type << "\" element is expected to define only "
             "single field";
         return false;
@@ -715,7 +715,7 @@ bool ListFieldImpl::checkPrefixAsChild(
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << type << "\" element  must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
         return false;
@@ -729,9 +729,9 @@ bool ListFieldImpl::checkPrefixAsChild(
 
 const FieldImpl* ListFieldImpl::getCountPrefixField() const
 {
-    if (m_state.m_extCountPrefixField != nullptr) {
+    if (m_state->m_extCountPrefixField != nullptr) {
         assert(!m_countPrefixField);
-        return m_state.m_extCountPrefixField;
+        return m_state->m_extCountPrefixField;
     }
 
     assert(m_countPrefixField);
@@ -740,9 +740,9 @@ const FieldImpl* ListFieldImpl::getCountPrefixField() const
 
 const FieldImpl* ListFieldImpl::getLengthPrefixField() const
 {
-    if (m_state.m_extLengthPrefixField != nullptr) {
+    if (m_state->m_extLengthPrefixField != nullptr) {
         assert(!m_lengthPrefixField);
-        return m_state.m_extLengthPrefixField;
+        return m_state->m_extLengthPrefixField;
     }
 
     assert(m_lengthPrefixField);
@@ -764,7 +764,7 @@ bool ListFieldImpl::verifySiblingsForPrefix(
 
     auto fieldKind = getNonRefFieldKind(*sibling);
     if ((fieldKind != Kind::Int) && (sibling->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Detached prefix \"" << detachedName << "\" is expected to be of \"" << common::intStr() << "\" type "
             "or have semanticType=\"length\" property set.";
         return false;
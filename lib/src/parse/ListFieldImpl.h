@@ -38,19 +38,19 @@ public:
 
     std::size_t count() const
     {
-        return m_state.m_count;
+        return m_state->m_count;
     }
 
     bool hasElementField() const
     {
-        return (m_state.m_extElementField != nullptr) ||
+        return (m_state->m_extElementField != nullptr) ||
                static_cast<bool>(m_elementField);
     }
 
     Field elementField() const
     {
-        if (m_state.m_extElementField != nullptr) {
-            return Field(m_state.m_extElementField);
+        if (m_state->m_extElementField != nullptr) {
+            return Field(m_state->m_extElementField);
         }
 
         return Field(m_elementField.get());
@@ -59,14 +59,14 @@ public:
 
     bool hasCountPrefixField() const
     {
-        return (m_state.m_extCountPrefixField != nullptr) ||
+        return (m_state->m_extCountPrefixField != nullptr) ||
                static_cast<bool>(m_countPrefixField);
     }
 
     Field countPrefixField() const
     {
-        if (m_state.m_extCountPrefixField != nullptr) {
-            return Field(m_state.m_extCountPrefixField);
+        if (m_state->m_extCountPrefixField != nullptr) {
+            return Field(m_state->m_extCountPrefixField);
         }
 
         return Field(m_countPrefixField.get());
@@ -74,19 +74,19 @@ public:
 
     const std::string& detachedCountPrefixFieldName() const
     {
-        return m_state.m_detachedCountPrefixField;
+        return m_state->m_detachedCountPrefixField;
     }
 
     bool hasLengthPrefixField() const
     {
-        return (m_state.m_extLengthPrefixField != nullptr) ||
+        return (m_state->m_extLengthPrefixField != nullptr) ||
                static_cast<bool>(m_lengthPrefixField);
     }
 
     Field lengthPrefixField() const
     {
-        if (m_state.m_extLengthPrefixField != nullptr) {
-            return Field(m_state.m_extLengthPrefixField);
+        if (m_state->m_extLengthPrefixField != nullptr) {
+            return Field(m_state->m_extLengthPrefixField);
         }
 
         return Field(m_lengthPrefixField.get());
@@ -94,19 +94,19 @@ public:
 
     const std::string& detachedLengthPrefixFieldName() const
     {
-        return m_state.m_detachedLengthPrefixField;
+        return m_state->m_detachedLengthPrefixField;
     }
 
     bool hasElemLengthPrefixField() const
     {
-        return (m_state.m_extElemLengthPrefixField != nullptr) ||
+        return (m_state->m_extElemLengthPrefixField != nullptr) ||
                static_cast<bool>(m_elemLengthPrefixField);
     }
 
     Field elemLengthPrefixField() const
     {
-        if (m_state.m_extElemLengthPrefixField != nullptr) {
-            return Field(m_state.m_extElemLengthPrefixField);
+        if (m_state->m_extElemLengthPrefixField != nullptr) {
+            return Field(m_state->m_extElemLengthPrefixField);
         }
 
         return Field(m_elemLengthPrefixField.get());
@@ -114,19 +114,19 @@ public:
 
     const std::string& detachedElemLengthPrefixFieldName() const
     {
-        return m_state.m_detachedElemLengthPrefixField;
+        return m_state->m_detachedElemLengthPrefixField;
     }
 
     bool hasTermSuffixField() const
     {
-        return (m_state.m_extTermSuffixField != nullptr) ||
+        return (m_state->m_extTermSuffixField != nullptr) ||
                static_cast<bool>(m_termSuffixField);
     }
 
     Field termSuffixField() const
     {
-        if (m_state.m_extTermSuffixField != nullptr) {
-            return Field(m_state.m_extTermSuffixField);
+        if (m_state->m_extTermSuffixField != nullptr) {
+            return Field(m_state->m_extTermSuffixField);
         }
 
         return Field(m_termSuffixField.get());
@@ -134,12 +134,12 @@ public:
 
     const std::string& detachedTermSuffixFieldName() const
     {
-        return m_state.m_detachedTermSuffixField;
+        return m_state->m_detachedTermSuffixField;
     }    
 
     bool elemFixedLength() const
     {
-        return m_state.m_elemFixedLength;
+        return m_state->m_elemFixedLength;
     }
 
 
@@ -195,7 +195,7 @@ private:
         bool m_elemFixedLength = false;
     };
 
-    State m_state;
+    CowState<State> m_state;
     FieldImplPtr m_elementField;
     FieldImplPtr m_countPrefixField;
     FieldImplPtr m_lengthPrefixField;
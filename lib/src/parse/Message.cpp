@@ -104,12 +104,24 @@ Message::FieldsList Message::fields() const
     return m_pImpl->fieldsList();
 }
 
+const Message::FieldsList& Message::fieldsView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedFieldsList();
+}
+
 Message::AliasesList Message::aliases() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->aliasesList();
 }
 
+const Message::AliasesList& Message::aliasesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedAliasesList();
+}
+
 std::string Message::externalRef(bool schemaRef) const
 {
     assert(m_pImpl != nullptr);
@@ -79,19 +79,20 @@ bool verifyConstructInternal(const OptCond& cond)
 
 MessageImpl::MessageImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol)
 {
 }
 
 bool MessageImpl::parse()
 {
-    m_props = XmlWrap::parseNodeProps(m_node);
+    m_props = XmlWrap::parseNodeProps(getNode());
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, commonProps(), m_protocol.logger(), m_props)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), commonProps(), m_protocol.logger(), m_props)) {
         return false;
     }
 
-    if (!XmlWrap::parseChildrenAsProps(m_node, extraProps(), m_protocol.logger(), m_props, false)) {
+    if (!XmlWrap::parseChildrenAsProps(getNode(), extraProps(), m_protocol.logger(), m_props, false)) {
         return false;
     }    
 
@@ -183,6 +184,11 @@ MessageImpl::FieldsList MessageImpl::fieldsList() const
     return result;
 }
 
+const MessageImpl::FieldsList& MessageImpl::cachedFieldsList() const
+{
+    return m_fieldsListCache.get([this]() { return fieldsList(); });
+}
+
 MessageImpl::AliasesList MessageImpl::aliasesList() const
 {
     AliasesList result;
@@ -196,6 +202,11 @@ MessageImpl::AliasesList MessageImpl::aliasesList() const
     return result;
 }
 
+const MessageImpl::AliasesList& MessageImpl::cachedAliasesList() const
+{
+    return m_aliasesListCache.get([this]() { return aliasesList(); });
+}
+
 std::string MessageImpl::externalRef(bool schemaRef) const
 {
     assert(getParent() != nullptr);
@@ -232,7 +243,7 @@ LogWrapper MessageImpl::logInfo() const
 
 bool MessageImpl::validateSinglePropInstance(const std::string& str, bool mustHave)
 {
-    return XmlWrap::validateSinglePropInstance(m_node, m_props, str, m_protocol.logger(), mustHave);
+    return XmlWrap::validateSinglePropInstance(getNode(), m_props, str, m_protocol.logger(), mustHave);
 }
 
 bool MessageImpl::validateAndUpdateStringPropValue(
@@ -277,7 +288,7 @@ bool MessageImpl::validateAndUpdateOverrideTypePropValue(const std::string& prop
     }    
 
     if (!m_protocol.isOverrideTypeSupported()) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "The property \"" << propName << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
@@ -314,7 +325,7 @@ bool MessageImpl::validateAndUpdateBoolPropValue(const std::string& propName, bo
     }
 
     if (!m_protocol.isPropertySupported(propName)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "Property \"" << common::availableLengthLimitStr() << "\" is not available for dslVersion= " << m_protocol.currSchema().dslVersion();                
         return true;
     }
@@ -331,7 +342,7 @@ bool MessageImpl::validateAndUpdateBoolPropValue(const std::string& propName, bo
 
 void MessageImpl::reportUnexpectedPropertyValue(const std::string& propName, const std::string& propValue)
 {
-    XmlWrap::reportUnexpectedPropertyValue(m_node, common::messageStr(), propName, propValue, m_protocol.logger());
+    XmlWrap::reportUnexpectedPropertyValue(getNode(), common::messageStr(), propName, propValue, m_protocol.logger());
 }
 
 const XmlWrap::NamesList& MessageImpl::commonProps()
@@ -409,7 +420,7 @@ bool MessageImpl::updateName()
     }
 
     if (!common::isValidName(m_name)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Invalid value for name property \"" << m_name << "\".";
         return false;
     }
@@ -491,7 +502,7 @@ bool MessageImpl::updateVersions()
 
     unsigned sinceVersion = 0U;
     unsigned deprecated = Protocol::notYetDeprecated();
-    if (!XmlWrap::getAndCheckVersions(m_node, name(), m_props, sinceVersion, deprecated, m_protocol)) {
+    if (!XmlWrap::getAndCheckVersions(getNode(), name(), m_props, sinceVersion, deprecated, m_protocol)) {
         return false;
     }
 
@@ -514,7 +525,7 @@ bool MessageImpl::updateVersions()
         }
 
         if (deprecated == Protocol::notYetDeprecated()) {
-            logWarning() << XmlWrap::logPrefix(getNode()) <<
+            logWarning() << XmlWrap::logPrefix(location()) <<
                 "Property \"" << common::removedStr() << "\" is not applicable to "
                 "non deprecated fields";
         }
@@ -583,7 +594,7 @@ bool MessageImpl::updatePlatforms()
 
         auto platIter = std::lower_bound(allPlatforms.begin(), allPlatforms.end(), p);
         if ((platIter == allPlatforms.end()) || (*platIter != p)) {
-            logError() << XmlWrap::logPrefix(m_node) <<
+            logError() << XmlWrap::logPrefix(m_location) <<
                 "Platform \"" << p << "\" hasn't been defined.";
             return false;
         }
@@ -607,7 +618,7 @@ bool MessageImpl::updatePlatforms()
         std::back_inserter(m_platforms));
 
     if (m_platforms.empty()) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Message \"" << name() << "\" is not supported in any platform.";
         return false;
     }
@@ -664,7 +675,7 @@ bool MessageImpl::updateValidateMinLength()
     }
 
     if (!m_protocol.isPropertySupported(propStr)) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << propStr << "\" is not supported for DSL version " << m_protocol.currSchema().dslVersion() << ", ignoring...";
         return true;
     }
@@ -686,7 +697,7 @@ bool MessageImpl::updateFailOnInvalid()
     }
 
     if (m_failOnInvalid && (!m_protocol.isFailOnInvalidInMessageSupported())) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Property \"" << propStr << "\" is not supported for DSL version " << m_protocol.currSchema().dslVersion() << ", ignoring...";
         m_failOnInvalid = false;
         return true;
@@ -714,14 +725,14 @@ bool MessageImpl::copyFields()
         }
 
         if (!m_protocol.isCopyFieldsFromBundleSupported()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Invalid reference to other message \"" << iter->second << "\".";
             return false;            
         }
 
         auto* copyFromField = m_protocol.findField(iter->second);
         if ((copyFromField == nullptr) || (copyFromField->kind() != Field::Kind::Bundle)) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Invalid reference to other message or bundle \"" << iter->second << "\".";
             return false;
         }
@@ -753,7 +764,7 @@ bool MessageImpl::replaceFields()
 {
     auto replaceNodes = XmlWrap::getChildren(getNode(), common::replaceStr());
     if (1U < replaceNodes.size()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Only single \"" << common::replaceStr() << "\" child element is "
             "supported for \"" << common::messageStr() << "\".";
         return false;
@@ -764,7 +775,7 @@ bool MessageImpl::replaceFields()
     }
 
     if (!m_protocol.isMemberReplaceSupported()) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Replacing fields with \"" << common::replaceStr() << "\" child element is unavaliable "
             "for selected DSL version, ignoring...";        
         return true;
@@ -816,7 +827,7 @@ bool MessageImpl::replaceFields()
                 });
 
         if (iter == m_fields.end()) {
-            logError() << XmlWrap::logPrefix(field->getNode()) <<
+            logError() << XmlWrap::logPrefix(field->location()) <<
                 "Cannot find reused field with name \"" << field->name() << "\" to replace.";
             return false;
         }
@@ -836,7 +847,7 @@ bool MessageImpl::copyAliases()
 
     auto iter = m_props.find(propStr);
     if (iter != m_props.end() && (!m_protocol.isFieldAliasSupported())) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Unexpected property \"" << propStr << "\".";
         return false;
     }
@@ -860,7 +871,7 @@ bool MessageImpl::copyAliases()
     }
 
     if ((iter != m_props.end()) && (m_copyFieldsFromMsg == nullptr) && (m_copyFieldsFromBundle == nullptr)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "Property \"" << propStr << "\" is inapplicable without \"" << common::copyFieldsFromStr() << "\".";
         return true;
     }
@@ -900,7 +911,7 @@ bool MessageImpl::updateFields()
     do {
         auto fieldsNodes = XmlWrap::getChildren(getNode(), common::fieldsStr());
         if (1U < fieldsNodes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Only single \"" << common::fieldsStr() << "\" child element is "
                           "supported for \"" << common::messageStr() << "\".";
             return false;
@@ -908,7 +919,7 @@ bool MessageImpl::updateFields()
 
         auto fieldsTypes = XmlWrap::getChildren(getNode(), messageSupportedTypes());
         if ((!fieldsNodes.empty()) && (!fieldsTypes.empty())) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::messageStr() << "\" element does not support "
                           "list of stand alone fields as child elements together with \"" <<
                           common::fieldsStr() << "\" child element.";
@@ -923,7 +934,7 @@ bool MessageImpl::updateFields()
             assert(0U == fieldsNodes.size());
             auto allChildren = XmlWrap::getChildren(getNode());
             if (allChildren.size() != fieldsTypes.size()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The field types of \"" << common::messageStr() <<
                               "\" must be defined inside \"<" << common::fieldsStr() << ">\" child element "
                               "when there are other property describing children.";
@@ -953,7 +964,7 @@ bool MessageImpl::updateFields()
                 static constexpr bool Should_not_happen = false;
                 static_cast<void>(Should_not_happen);
                 assert(Should_not_happen);
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                       "Internal error, failed to create objects for member fields.";
                 return false;
             }
@@ -977,7 +988,7 @@ bool MessageImpl::updateFields()
         if (0 <= m_validateMinLength) {
             auto len = minLength();
             if (static_cast<unsigned>(m_validateMinLength) != len) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                     "The calculated minimal length of the message is " << len <<
                     " while expected is " << m_validateMinLength << " (specified with \"" << common::validateMinLengthStr() << "\" property).";                
                 return false;
@@ -1011,7 +1022,7 @@ bool MessageImpl::updateAliases()
             static constexpr bool Should_not_happen = false;
             static_cast<void>(Should_not_happen);
             assert(Should_not_happen);
-            logError() << XmlWrap::logPrefix(alias->getNode()) <<
+            logError() << XmlWrap::logPrefix(alias->location()) <<
                   "Internal error, failed to create objects for member aliases.";
             return false;
         }
@@ -1105,7 +1116,7 @@ bool MessageImpl::updateCopyOverrideCodeFrom()
     }  
 
     if (!m_protocol.isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "The property \"" << prop << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
@@ -1113,7 +1124,7 @@ bool MessageImpl::updateCopyOverrideCodeFrom()
 
     auto* field = m_protocol.findMessage(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Message referenced by \"" << prop << "\" property (" + iter->second + ") is not found.";
         return false;        
     }
@@ -1134,7 +1145,7 @@ bool MessageImpl::updateSingleConstruct()
 
     if (!verifyConstructInternal(OptCond(m_construct.get()))) {
         m_construct.reset();
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Only bit checks and equality comparisons are supported in the \"" << common::constructStr() << "\" property.";
         return false;
     }
@@ -1154,7 +1165,7 @@ bool MessageImpl::updateMultiConstruct()
 
     if (!verifyConstructInternal(OptCond(m_construct.get()))) {
         m_construct.reset();
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Only \"" << common::andStr() <<  
             "\" of the bit checks and equality comparisons are supported in the \"" << common::constructStr() << "\" element.";
         return false;
@@ -1207,14 +1218,14 @@ bool MessageImpl::copyConstructToValidCond()
 
 bool MessageImpl::updateExtraAttrs()
 {
-    m_extraAttrs = XmlWrap::getExtraAttributes(m_node, allProps(), m_protocol);
+    m_extraAttrs = XmlWrap::getExtraAttributes(getNode(), allProps(), m_protocol);
     return true;
 }
 
 bool MessageImpl::updateExtraChildren()
 {
     static const XmlWrap::NamesList ChildrenNames = allNames();
-    m_extraChildren = XmlWrap::getExtraChildren(m_node, ChildrenNames, m_protocol);
+    m_extraChildren = XmlWrap::getExtraChildren(getNode(), ChildrenNames, m_protocol);
     return true;
 }
 
@@ -1230,20 +1241,20 @@ bool MessageImpl::updateSingleCondInternal(const std::string& prop, OptCondImplP
     }
 
     if (!m_protocol.isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "The property \"" << prop << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
     }          
 
     if (cond) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Only single \"" << prop << "\" property is supported";
         return false;
     }
 
     auto newCond = std::make_unique<OptCondExprImpl>();
-    if (!newCond->parse(iter->second, m_node, m_protocol)) {
+    if (!newCond->parse(iter->second, getNode(), m_protocol)) {
         return false;
     }
 
@@ -1253,7 +1264,7 @@ bool MessageImpl::updateSingleCondInternal(const std::string& prop, OptCondImplP
         fieldsPtr = &m_fields;
     }    
 
-    if (!newCond->verify(*fieldsPtr, m_node, m_protocol)) {
+    if (!newCond->verify(*fieldsPtr, getNode(), m_protocol)) {
         return false;
     }   
 
@@ -1263,20 +1274,20 @@ bool MessageImpl::updateSingleCondInternal(const std::string& prop, OptCondImplP
 
 bool MessageImpl::updateMultiCondInternal(const std::string& prop, OptCondImplPtr& cond, bool allowFieldsAccess)
 {
-    auto condNodes = XmlWrap::getChildren(m_node, prop, true);
+    auto condNodes = XmlWrap::getChildren(getNode(), prop, true);
     if (condNodes.empty()) {
         return true;
     }
 
     if (!m_protocol.isPropertySupported(prop)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "The property \"" << prop << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
     }      
 
     if (condNodes.size() > 1U) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Cannot use more that one child to the \"" << prop << "\" element.";        
         return false;
     }
@@ -1288,7 +1299,7 @@ bool MessageImpl::updateMultiCondInternal(const std::string& prop, OptCondImplPt
 
     auto condChildren = XmlWrap::getChildren(condNodes.front(), ElemNames);
     if (condChildren.size() != condNodes.size()) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Only single \"" << common::andStr() << "\" or \"" << common::orStr() << "\" child of the \"" << prop << "\" element is supported.";           
         return false;
     }    
@@ -1336,7 +1347,7 @@ bool MessageImpl::copyCondInternal(
     }    
 
     if (!m_protocol.isPropertySupported(copyProp)) {
-        logWarning() << XmlWrap::logPrefix(m_node) <<
+        logWarning() << XmlWrap::logPrefix(m_location) <<
             "The property \"" << copyProp << "\" is not supported for dslVersion=" << 
                 m_protocol.currSchema().dslVersion() << ".";        
         return true;
@@ -1354,13 +1365,13 @@ bool MessageImpl::copyCondInternal(
     }
 
     if (!fromCond) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "No \"" << fromProp << "\" conditions were defined to copy.";           
         return false;            
     }
 
     if (toCond) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
             "Set of the \"" << copyProp << "\" property overrides existing \"" << toProp << "\" setting.";          
         return false;
     }
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <map>
 #include <string>
@@ -29,6 +30,7 @@
 #include "OptCondImpl.h"
 #include "Object.h"
 #include "XmlWrap.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -43,6 +45,7 @@ class MessageImpl final : public Object
 public:
     using Ptr = std::unique_ptr<MessageImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using FieldsList = Message::FieldsList;
     using AliasesList = Message::AliasesList;
     using ContentsList = XmlWrap::ContentsList;
@@ -56,9 +59,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parse();
 
     const PropsMap& props() const
@@ -85,11 +95,13 @@ public:
     std::size_t maxLength() const;
 
     FieldsList fieldsList() const;
+    const FieldsList& cachedFieldsList() const;
     AliasesList aliasesList() const;
+    const AliasesList& cachedAliasesList() const;
 
     std::string externalRef(bool schemaRef) const;
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
@@ -236,9 +248,10 @@ private:
         OptCondImplPtr& toCond);
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     std::string m_name;
@@ -265,6 +278,8 @@ private:
     OptCondImplPtr m_validCond;
     bool m_customizable = false;
     bool m_failOnInvalid = false;
+    CachedList<FieldsList> m_fieldsListCache;
+    CachedList<AliasesList> m_aliasesListCache;
 };
 
 using MessageImplPtr = MessageImpl::Ptr;
@@ -57,30 +57,60 @@ Namespace::NamespacesList Namespace::namespaces() const
     return m_pImpl->namespacesList();
 }
 
+const Namespace::NamespacesList& Namespace::namespacesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedNamespacesList();
+}
+
 Namespace::FieldsList Namespace::fields() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->fieldsList();
 }
 
+const Namespace::FieldsList& Namespace::fieldsView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedFieldsList();
+}
+
 Namespace::MessagesList Namespace::messages() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->messagesList();
 }
 
+const Namespace::MessagesList& Namespace::messagesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedMessagesList();
+}
+
 Namespace::InterfacesList Namespace::interfaces() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->interfacesList();
 }
 
+const Namespace::InterfacesList& Namespace::interfacesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedInterfacesList();
+}
+
 Namespace::FramesList Namespace::frames() const
 {
     assert(m_pImpl != nullptr);
     return m_pImpl->framesList();
 }
 
+const Namespace::FramesList& Namespace::framesView() const
+{
+    assert(m_pImpl != nullptr);
+    return m_pImpl->cachedFramesList();
+}
+
 std::string Namespace::externalRef(bool schemaRef) const
 {
     assert(m_pImpl != nullptr);
@@ -72,6 +72,7 @@ bool updateStringProperty(const XmlWrap::PropsMap& map, const std::string& name,
 
 NamespaceImpl::NamespaceImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol)
 {
 }
@@ -85,8 +86,8 @@ bool NamespaceImpl::parseProps()
 {
     assert (m_node != nullptr);
 
-    m_props = XmlWrap::parseNodeProps(m_node);
-    if (!XmlWrap::parseChildrenAsProps(m_node, PropNames, m_protocol.logger(), m_props)) {
+    m_props = XmlWrap::parseNodeProps(getNode());
+    if (!XmlWrap::parseChildrenAsProps(getNode(), PropNames, m_protocol.logger(), m_props)) {
         return false;
     }
 
@@ -98,7 +99,7 @@ bool NamespaceImpl::parseProps()
     }
 
     if (!common::isValidName(m_name)) {
-        logError() << XmlWrap::logPrefix(m_node) <<
+        logError() << XmlWrap::logPrefix(m_location) <<
               "Property \"" << common::nameStr() << "\" has unexpected value (" << m_name << ").";
         return false;
     }
@@ -108,7 +109,7 @@ bool NamespaceImpl::parseProps()
 
 bool NamespaceImpl::parseChildren(NamespaceImpl* realNs)
 {
-    auto children = XmlWrap::getChildren(m_node, ChildrenNames);
+    auto children = XmlWrap::getChildren(getNode(), ChildrenNames);
     for (auto* c : children) {
         if (!processChild(c, realNs)) {
             return false;
@@ -181,6 +182,11 @@ NamespaceImpl::NamespacesList NamespaceImpl::namespacesList() const
     return result;
 }
 
+const NamespaceImpl::NamespacesList& NamespaceImpl::cachedNamespacesList() const
+{
+    return m_namespacesListCache.get([this]() { return namespacesList(); });
+}
+
 NamespaceImpl::FieldsList NamespaceImpl::fieldsList() const
 {
     FieldsList result;
@@ -199,6 +205,11 @@ NamespaceImpl::FieldsList NamespaceImpl::fieldsList() const
     return result;
 }
 
+const NamespaceImpl::FieldsList& NamespaceImpl::cachedFieldsList() const
+{
+    return m_fieldsListCache.get([this]() { return fieldsList(); });
+}
+
 NamespaceImpl::MessagesList NamespaceImpl::messagesList() const
 {
     MessagesList result;
@@ -216,6 +227,11 @@ NamespaceImpl::MessagesList NamespaceImpl::messagesList() const
     return result;
 }
 
+const NamespaceImpl::MessagesList& NamespaceImpl::cachedMessagesList() const
+{
+    return m_messagesListCache.get([this]() { return messagesList(); });
+}
+
 NamespaceImpl::InterfacesList NamespaceImpl::interfacesList() const
 {
     InterfacesList result;
@@ -233,6 +249,11 @@ NamespaceImpl::InterfacesList NamespaceImpl::interfacesList() const
     return result;
 }
 
+const NamespaceImpl::InterfacesList& NamespaceImpl::cachedInterfacesList() const
+{
+    return m_interfacesListCache.get([this]() { return interfacesList(); });
+}
+
 NamespaceImpl::FramesList NamespaceImpl::framesList() const
 {
     FramesList result;
@@ -250,6 +271,11 @@ NamespaceImpl::FramesList NamespaceImpl::framesList() const
     return result;
 }
 
+const NamespaceImpl::FramesList& NamespaceImpl::cachedFramesList() const
+{
+    return m_framesListCache.get([this]() { return framesList(); });
+}
+
 const FieldImpl* NamespaceImpl::findField(const std::string& fieldName) const
 {
     auto iter = m_fields.find(fieldName);
@@ -482,7 +508,7 @@ bool NamespaceImpl::processNamespace(::xmlNodePtr node)
                 realNs->updateDescription(nsToProcess->description());
             }
             else {
-                logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                logWarning() << XmlWrap::logPrefix(nsToProcess->location()) <<
                     "Description of namespace \"" << nsToProcess->name() << "\" differs to "
                     "one encountered before.";
             }
@@ -495,7 +521,7 @@ bool NamespaceImpl::processNamespace(::xmlNodePtr node)
                     realNs->extraAttributes().insert(a);
                 }
                 else if (a.second != attIter->second) {
-                    logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                    logWarning() << XmlWrap::logPrefix(nsToProcess->location()) <<
                         "Value of attribute \"" << a.first << "\" differs to one defined before.";
                 }
             }
@@ -534,7 +560,7 @@ bool NamespaceImpl::processMultipleFields(::xmlNodePtr node)
         auto iter = m_fields.find(name);
         if (iter != m_fields.end()) {
             logError() << XmlWrap::logPrefix(c) << "Field with name \"" << name << "\" has been already defined at " <<
-                          iter->second->getNode()->doc->URL << ":" << iter->second->getNode()->line << '.';
+                          XmlWrap::locationStr(iter->second->location()) << '.';
             return false;
         }
 
@@ -556,7 +582,7 @@ bool NamespaceImpl::processMessage(::xmlNodePtr node)
     auto& msgName = msg->name();
     if (msgPtr != nullptr) {
         logError() << XmlWrap::logPrefix(node) << "Message with name \"" << msgName << "\" has been already defined at " <<
-                      msgPtr->getNode()->doc->URL << ":" << msgPtr->getNode()->line << '.';
+                      XmlWrap::locationStr(msgPtr->location()) << '.';
 
         return false;
     }
@@ -597,7 +623,7 @@ bool NamespaceImpl::processInterface(::xmlNodePtr node)
     auto& intName = interface->name();
     if (intPtr != nullptr) {
         logError() << XmlWrap::logPrefix(node) << "Interface with name \"" << intName << "\" has been already defined at " <<
-                      intPtr->getNode()->doc->URL << ":" << intPtr->getNode()->line << '.';
+                      XmlWrap::locationStr(intPtr->location()) << '.';
 
         return false;
     }
@@ -638,7 +664,7 @@ bool NamespaceImpl::processFrame(::xmlNodePtr node)
     auto& frameName = frame->name();
     if (framePtr != nullptr) {
         logError() << XmlWrap::logPrefix(node) << "Frame with name \"" << frameName << "\" has been already defined at " <<
-                      framePtr->getNode()->doc->URL << ":" << framePtr->getNode()->line << '.';
+                      XmlWrap::locationStr(framePtr->location()) << '.';
 
         return false;
     }
@@ -669,14 +695,14 @@ bool NamespaceImpl::processMultipleFrames(::xmlNodePtr node)
 
 bool NamespaceImpl::updateExtraAttrs()
 {
-    m_extraAttrs = XmlWrap::getExtraAttributes(m_node, PropNames, m_protocol);
+    m_extraAttrs = XmlWrap::getExtraAttributes(getNode(), PropNames, m_protocol);
     return true;
 }
 
 bool NamespaceImpl::updateExtraChildren()
 {
     static const XmlWrap::NamesList Names = allNames();
-    m_extraChildren = XmlWrap::getExtraChildren(m_node, Names, m_protocol);
+    m_extraChildren = XmlWrap::getExtraChildren(getNode(), Names, m_protocol);
     return true;
 }
 
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <memory>
 #include <algorithm>
 #include <cctype>
@@ -28,6 +29,7 @@
 #include "InterfaceImpl.h"
 #include "FrameImpl.h"
 #include "Object.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -64,6 +66,7 @@ public:
 
     using Ptr = std::unique_ptr<NamespaceImpl>;
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using NamespacesList = Namespace::NamespacesList;
     using FieldsList = Namespace::FieldsList;
@@ -86,9 +89,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     bool parseProps();
 
     bool parseChildren(NamespaceImpl* realNs = nullptr);
@@ -125,22 +135,27 @@ public:
     }
 
     NamespacesList namespacesList() const;
+    const NamespacesList& cachedNamespacesList() const;
     FieldsList fieldsList() const;
+    const FieldsList& cachedFieldsList() const;
     MessagesList messagesList() const;
+    const MessagesList& cachedMessagesList() const;
     InterfacesList interfacesList() const;
+    const InterfacesList& cachedInterfacesList() const;
     FramesList framesList() const;
+    const FramesList& cachedFramesList() const;
 
     const MessagesMap& messages() const
     {
         return m_messages;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -204,10 +219,11 @@ private:
     LogWrapper logInfo() const;
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
 
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
 
     std::string m_name;
@@ -218,6 +234,11 @@ private:
     MessagesMap m_messages;
     InterfacesMap m_interfaces;
     FramesMap m_frames;
+    CachedList<NamespacesList> m_namespacesListCache;
+    CachedList<FieldsList> m_fieldsListCache;
+    CachedList<MessagesList> m_messagesListCache;
+    CachedList<InterfacesList> m_interfacesListCache;
+    CachedList<FramesList> m_framesListCache;
 };
 
 using NamespaceImplPtr = NamespaceImpl::Ptr;
@@ -67,7 +67,7 @@ OptionalFieldImpl::OptionalFieldImpl(const OptionalFieldImpl& other)
     m_state(other.m_state)
 {
     if (other.m_field) {
-        assert(other.m_state.m_extField == nullptr);
+        assert(other.m_state->m_extField == nullptr);
         m_field = other.m_field->clone();
     }
 
@@ -115,7 +115,7 @@ bool OptionalFieldImpl::reuseImpl(const FieldImpl& other)
     auto& castedOther = static_cast<const OptionalFieldImpl&>(other);
     m_state = castedOther.m_state;
     if (castedOther.m_field) {
-        assert(m_state.m_extField == nullptr);
+        assert(m_state->m_extField == nullptr);
         m_field = castedOther.m_field->clone();
     }
     else {
@@ -262,23 +262,23 @@ bool OptionalFieldImpl::updateMode()
         return false;
     }
 
-    m_state.m_mode = mapIter->second;
+    m_state->m_mode = mapIter->second;
     return true;
 }
 
 bool OptionalFieldImpl::updateExternalModeCtrl()
 {
-    return validateAndUpdateBoolPropValue(common::displayExtModeCtrlStr(), m_state.m_externalModeCtrl);
+    return validateAndUpdateBoolPropValue(common::displayExtModeCtrlStr(), m_state->m_externalModeCtrl);
 }
 
 bool OptionalFieldImpl::updateMissingOnReadFail()
 {
-    return validateAndUpdateBoolPropValue(common::missingOnReadFailStr(), m_state.m_missingOnReadFail);
+    return validateAndUpdateBoolPropValue(common::missingOnReadFailStr(), m_state->m_missingOnReadFail);
 }
 
 bool OptionalFieldImpl::updateMissingOnInvalid()
 {
-    return validateAndUpdateBoolPropValue(common::missingOnInvalidStr(), m_state.m_missingOnInvalid);
+    return validateAndUpdateBoolPropValue(common::missingOnInvalidStr(), m_state->m_missingOnInvalid);
 }
 
 bool OptionalFieldImpl::updateField()
@@ -289,7 +289,7 @@ bool OptionalFieldImpl::updateField()
     }
 
     if (!hasField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Field itself hasn't been provided.";
         return false;
     }
@@ -309,13 +309,13 @@ bool OptionalFieldImpl::updateSingleCondition()
     }
 
     if (m_cond) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Overriding non-empty condition(s) is not allowed";
         return false;
     }
 
     if ((!isBundleMember()) && (!isMessageMember())) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
             "Condition for existing mode are applicable only to members of \"" <<
             common::bundleStr() << "\" and \"" << common::messageStr() << "\".";
     }
@@ -356,7 +356,7 @@ bool OptionalFieldImpl::updateMultiCondition()
     }
 
     if (m_cond) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Overriding non-empty condition(s) is not allowed";
         return false;
     }
@@ -384,14 +384,14 @@ bool OptionalFieldImpl::checkFieldFromRef()
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << common::fieldStr() <<
             "\" property (" << iter->second << ").";
         return false;
     }
 
     m_field.reset();
-    m_state.m_extField = field;
+    m_state->m_extField = field;
     assert(hasField());
     return true;
 }
@@ -406,7 +406,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
 
     auto fieldTypes = XmlWrap::getChildren(getNode(), optionalSupportedTypes());
     if ((0U < children.size()) && (0U < fieldTypes.size())) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
                   "The \"" << common::optionalStr() << "\" element does not support "
                   "stand alone field as child element together with \"" <<
                   common::fieldStr() << "\" child element.";
@@ -424,7 +424,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
         }
 
         if (1U < fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "The \"" << common::optionalStr() << "\" element is expected to define only "
                 "single field";
             return false;
@@ -432,7 +432,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
 
         auto allChildren = XmlWrap::getChildren(getNode());
         if (allChildren.size() != fieldTypes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                   "The field type of \"" << common::optionalStr() <<
                   "\" must be defined inside \"<" << common::fieldsStr() << ">\" child element "
                   "when there are other property describing children.";
@@ -485,7 +485,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
     std::string fieldKind(reinterpret_cast<const char*>(fieldNode->name));
     auto field = FieldImpl::create(fieldKind, fieldNode, protocol());
     if (!field) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Unknown field type \"" << fieldKind;
         return false;
     }
@@ -495,7 +495,7 @@ bool OptionalFieldImpl::checkFieldAsChild()
         return false;
     }
 
-    m_state.m_extField = nullptr;
+    m_state->m_extField = nullptr;
     m_field = std::move(field);
     assert(m_field->externalRef(false).empty());
     return true;
@@ -503,9 +503,9 @@ bool OptionalFieldImpl::checkFieldAsChild()
 
 const FieldImpl* OptionalFieldImpl::getField() const
 {
-    if (m_state.m_extField != nullptr) {
+    if (m_state->m_extField != nullptr) {
         assert(!m_field);
-        return m_state.m_extField;
+        return m_state->m_extField;
     }
 
     assert(m_field);
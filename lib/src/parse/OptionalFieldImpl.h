@@ -41,33 +41,33 @@ public:
 
     Mode defaultMode() const
     {
-        return m_state.m_mode;
+        return m_state->m_mode;
     }
 
     bool externalModeCtrl() const
     {
-        return m_state.m_externalModeCtrl;
+        return m_state->m_externalModeCtrl;
     }
 
     bool missingOnReadFail() const
     {
-        return m_state.m_missingOnReadFail;
+        return m_state->m_missingOnReadFail;
     }  
 
     bool missingOnInvalid() const
     {
-        return m_state.m_missingOnInvalid;
+        return m_state->m_missingOnInvalid;
     }      
 
     bool hasField() const
     {
-        return (m_state.m_extField != nullptr) || static_cast<bool>(m_field);
+        return (m_state->m_extField != nullptr) || static_cast<bool>(m_field);
     }
 
     Field field() const
     {
-        if (m_state.m_extField != nullptr) {
-            return Field(m_state.m_extField);
+        if (m_state->m_extField != nullptr) {
+            return Field(m_state->m_extField);
         }
 
         return Field(m_field.get());
@@ -133,7 +133,7 @@ private:
         bool m_missingOnInvalid = false;
     };
 
-    State m_state;
+    CowState<State> m_state;
     FieldImplPtr m_field;
     OptCondImplPtr m_cond;
 };
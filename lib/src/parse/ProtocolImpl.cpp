@@ -65,12 +65,19 @@ bool ProtocolImpl::parse(const std::string& input)
         return false;
     }
 
-    XmlDocPtr doc(xmlParseFile(input.c_str()));
+    XmlDocPtr doc(xmlReadFile(input.c_str(), nullptr, XML_PARSE_COMPACT | XML_PARSE_BIG_LINES));
     if (!doc) {
         std::cerr << "ERROR: Failed to parse" << input << std::endl;
         return false;
     }
 
+    // The document information outlives the document itself and allows
+    // reporting the location of the elements after the document is released.
+    m_docInfos.emplace_back();
+    auto& info = m_docInfos.back();
+    info.m_url = reinterpret_cast<const char*>(doc->URL);
+    doc->_private = &info;
+
     m_docs.push_back(std::move(doc));
     return true;
 }
@@ -86,10 +93,20 @@ bool ProtocolImpl::validate()
         return false;
     }
 
-    for (auto& d : m_docs) {
+    while (!m_docs.empty()) {
+        auto& d = m_docs.front();
         if (!validateDoc(d.get())) {
             return false;
         }
+
+        // All the required information has been extracted from the XML document,
+        // there is no need to keep it in memory any more. Note that the stored
+        // xml nodes of the document cannot be accessed after this point, only
+        // their recorded locations.
+        auto* info = static_cast<XmlWrap::DocInfo*>(d->_private);
+        assert(info != nullptr);
+        info->m_released = true;
+        m_docs.erase(m_docs.begin());
     }
 
     if ((!validateAllMessages()) ||
@@ -442,7 +459,7 @@ bool ProtocolImpl::validateSchema(::xmlNodePtr node)
     }
 
     if (schemaName.empty()) {
-        logError() << XmlWrap::logPrefix(schema->getNode()) <<
+        logError() << XmlWrap::logPrefix(schema->location()) <<
             "First schema definition must define \"" << common::nameStr() << "\" property.";
         return false;
     }    
@@ -458,13 +475,13 @@ bool ProtocolImpl::validateSchema(::xmlNodePtr node)
     if (schemaIter == m_schemas.end()) {
         assert(!schema->name().empty());
         if ((!m_schemas.empty()) && (!isMultiSchemaSupported())) {
-            logError() << XmlWrap::logPrefix(schema->getNode()) <<
+            logError() << XmlWrap::logPrefix(schema->location()) <<
                 "Multiple schemas is not supported in the selected " << common::dslVersionStr();
             return false;
         }
 
         if ((!m_schemas.empty()) && (!m_multipleSchemasEnabled)) {
-            logError() << XmlWrap::logPrefix(schema->getNode()) <<
+            logError() << XmlWrap::logPrefix(schema->location()) <<
                 "Multiple schemas support must be explicitly enabled by the code generator.";
             return false;
         }
@@ -624,7 +641,7 @@ bool ProtocolImpl::validateNamespaces(::xmlNodePtr root)
                         realNs->updateDescription(nsToProcess->description());
                     }
                     else {
-                        logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                        logWarning() << XmlWrap::logPrefix(nsToProcess->location()) <<
                             "Description of namespace \"" << nsToProcess->name() << "\" differs to "
                             "one encountered before.";
                     }
@@ -637,7 +654,7 @@ bool ProtocolImpl::validateNamespaces(::xmlNodePtr root)
                             realNs->extraAttributes().insert(a);
                         }
                         else if (a.second != attIter->second) {
-                            logWarning() << XmlWrap::logPrefix(nsToProcess->getNode()) <<
+                            logWarning() << XmlWrap::logPrefix(nsToProcess->location()) <<
                                 "Value of attribute \"" << a.first << "\" differs to one defined before.";
                         }
                     }
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <memory>
+#include <list>
 #include <vector>
 #include <utility>
 
@@ -136,6 +137,7 @@ private:
 
     using XmlDocPtr = std::unique_ptr<::xmlDoc, XmlDocFree>;
     using DocsList = std::vector<XmlDocPtr>;
+    using DocInfosList = std::list<XmlWrap::DocInfo>;
     using StrToValueConvertFunc = std::function<bool (const NamespaceImpl& ns, const std::string& ref)>;
 
     static void cbXmlErrorFunc(void* userData, xmlErrorPtr err);
@@ -156,6 +158,7 @@ private:
 
     ErrorReportFunction m_errorReportCb;
     DocsList m_docs;
+    DocInfosList m_docInfos;
     ErrorLevel m_minLevel = ErrorLevel_Info;
     mutable Logger m_logger;
     SchemasList m_schemas;
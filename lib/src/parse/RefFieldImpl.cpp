@@ -127,7 +127,7 @@ std::size_t RefFieldImpl::maxLengthImpl() const
 std::size_t RefFieldImpl::bitLengthImpl() const
 {
     if (isBitfieldMember()) {
-        return m_state.m_bitLength;
+        return m_state->m_bitLength;
     }
 
     return Base::bitLengthImpl();
@@ -228,31 +228,31 @@ bool RefFieldImpl::updateBitLength()
     assert(0 < maxLength());
     auto maxBitLength = maxLength() * BitsInByte;
     if (valStr.empty()) {
-        if (m_state.m_bitLength == 0) {
-            m_state.m_bitLength = maxBitLength;
+        if (m_state->m_bitLength == 0) {
+            m_state->m_bitLength = maxBitLength;
             return true;
         }
 
-        assert(m_state.m_bitLength <= maxBitLength);
+        assert(m_state->m_bitLength <= maxBitLength);
         return true;
     }    
 
     if (!isBitfieldMember()) {
-        logWarning() << XmlWrap::logPrefix((getNode())) <<
+        logWarning() << XmlWrap::logPrefix(location()) <<
                         "The property \"" << common::bitLengthStr() << "\" is "
                         "applicable only to the members of \"" << common::bitfieldStr() << "\"";
         return true;
     }    
 
     bool ok = false;
-    m_state.m_bitLength = common::strToUnsigned(valStr, &ok);
+    m_state->m_bitLength = common::strToUnsigned(valStr, &ok);
     if (!ok) {
         reportUnexpectedPropertyValue(common::bitLengthStr(), valStr);
         return false;
     }
 
     assert(m_field != nullptr);
-    if (!m_field->validateBitLengthValue(getNode(), m_state.m_bitLength)) {
+    if (!m_field->validateBitLengthValue(getNode(), m_state->m_bitLength)) {
         return false;
     }
 
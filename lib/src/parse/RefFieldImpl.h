@@ -79,7 +79,7 @@ private:
         std::size_t m_bitLength = 0U;
     };    
 
-    State m_state;
+    CowState<State> m_state;
     const FieldImpl* m_field = nullptr;
 };
 
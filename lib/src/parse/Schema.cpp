@@ -150,6 +150,17 @@ Schema::NamespacesList Schema::namespaces() const
     return m_pImpl->namespacesList();
 }
 
+const Schema::NamespacesList& Schema::namespacesView() const
+{
+    if (!valid()) {
+        assert(Unexpected_call_on_invalid_schema_object);
+        static const NamespacesList List;
+        return List;
+    }
+
+    return m_pImpl->cachedNamespacesList();
+}
+
 const Schema::PlatformsList& Schema::platforms() const
 {
     return m_pImpl->platforms();
@@ -58,6 +58,7 @@ XmlWrap::NamesList getChildrenList()
 
 SchemaImpl::SchemaImpl(::xmlNodePtr node, ProtocolImpl& protocol)
   : m_node(node),
+    m_location(XmlWrap::location(node)),
     m_protocol(protocol)
 {
 }
@@ -65,8 +66,8 @@ SchemaImpl::SchemaImpl(::xmlNodePtr node, ProtocolImpl& protocol)
 bool SchemaImpl::processNode()
 {
 
-    m_props = XmlWrap::parseNodeProps(m_node);
-    if (!XmlWrap::parseChildrenAsProps(m_node, PropNames, m_protocol.logger(), m_props)) {
+    m_props = XmlWrap::parseNodeProps(getNode());
+    if (!XmlWrap::parseChildrenAsProps(getNode(), PropNames, m_protocol.logger(), m_props)) {
         return false;
     }
 
@@ -83,7 +84,7 @@ bool SchemaImpl::processNode()
     }
 
     if ((!m_name.empty()) && (!common::isValidName(m_name))) {
-        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_node) <<
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_location) <<
               "Property \"" << common::nameStr() << "\" has unexpected value (" << m_name << ").";
         return false;
     }
@@ -101,6 +102,11 @@ SchemaImpl::NamespacesList SchemaImpl::namespacesList() const
     return result;
 }
 
+const SchemaImpl::NamespacesList& SchemaImpl::cachedNamespacesList() const
+{
+    return m_namespacesListCache.get([this]() { return namespacesList(); });
+}
+
 const FieldImpl* SchemaImpl::findField(const std::string& ref, bool checkRef) const
 {
     std::string fieldName;
@@ -324,8 +330,8 @@ bool SchemaImpl::updateUnsignedProperty(const PropsMap& map, const std::string&
     bool ok = false;
     unsigned val = common::strToUnsigned(iter->second, &ok);
     if (!ok) {
-        logError(m_protocol.logger()) << m_node->doc->URL << ':' << m_node->line <<
-            ": Invalid value of \"" << name << "\" property for \"" << m_node->name << "\" element.";
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_location) <<
+            "Invalid value of \"" << name << "\" property for \"" << getNode()->name << "\" element.";
         return false;
     }
 
@@ -338,8 +344,8 @@ bool SchemaImpl::updateEndianProperty(const PropsMap& map, const std::string& na
     auto& endianStr = common::getStringProp(map, name);
     prop = common::parseEndian(endianStr, Endian_Little);
     if (prop == Endian_NumOfValues) {
-        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_node) <<
-            "Invalid value of \"" << name << "\" property for \"" << m_node->name << "\" element.";
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_location) <<
+            "Invalid value of \"" << name << "\" property for \"" << getNode()->name << "\" element.";
         return false;
     }
 
@@ -357,8 +363,8 @@ bool SchemaImpl::updateBooleanProperty(const SchemaImpl::PropsMap& map, const st
     bool ok = false;
     bool val = common::strToBool(iter->second, &ok);
     if (!ok) {
-        logError(m_protocol.logger()) << m_node->doc->URL << ':' << m_node->line <<
-            ": Invalid value of \"" << name << "\" property for \"" << m_node->name << "\" element.";
+        logError(m_protocol.logger()) << XmlWrap::logPrefix(m_location) <<
+            "Invalid value of \"" << name << "\" property for \"" << getNode()->name << "\" element.";
         return false;
     }
 
@@ -368,14 +374,14 @@ bool SchemaImpl::updateBooleanProperty(const SchemaImpl::PropsMap& map, const st
 
 bool SchemaImpl::updateExtraAttrs()
 {
-    m_extraAttrs = XmlWrap::getExtraAttributes(m_node, PropNames, m_protocol);
+    m_extraAttrs = XmlWrap::getExtraAttributes(getNode(), PropNames, m_protocol);
     return true;
 }
 
 bool SchemaImpl::updateExtraChildren()
 {
     static const XmlWrap::NamesList ChildrenNames = getChildrenList();
-    m_extraChildren = XmlWrap::getExtraChildren(m_node, ChildrenNames, m_protocol);
+    m_extraChildren = XmlWrap::getExtraChildren(getNode(), ChildrenNames, m_protocol);
     return true;
 }
 
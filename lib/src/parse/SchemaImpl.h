@@ -15,10 +15,13 @@
 
 #pragma once
 
+#include <cassert>
+
 #include "commsdsl/parse/Endian.h"
 
 #include "XmlWrap.h"
 #include "NamespaceImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -32,6 +35,7 @@ class SchemaImpl final : public Object
     using Base = Object;
 public:
     using PropsMap = XmlWrap::PropsMap;
+    using AttributesMap = XmlWrap::AttributesMap;
     using ContentsList = XmlWrap::ContentsList;
     using NamespacesList = NamespaceImpl::NamespacesList;
     using NamespacesMap = NamespaceImpl::NamespacesMap;
@@ -47,9 +51,16 @@ public:
 
     ::xmlNodePtr getNode() const
     {
+        // The xml document is released after its validation
+        assert((m_node == nullptr) || (!m_location.m_docInfo->m_released));
         return m_node;
     }
 
+    const XmlWrap::Location& location() const
+    {
+        return m_location;
+    }
+
     const PropsMap& props() const
     {
         return m_props;
@@ -90,12 +101,12 @@ public:
         return m_nonUniqueMsgIdAllowed;
     }
 
-    const PropsMap& extraAttributes() const
+    const AttributesMap& extraAttributes() const
     {
         return m_extraAttrs;
     }
 
-    PropsMap& extraAttributes()
+    AttributesMap& extraAttributes()
     {
         return m_extraAttrs;
     }
@@ -115,7 +126,8 @@ public:
         return m_namespaces;
     }
 
-    NamespacesList namespacesList() const;    
+    NamespacesList namespacesList() const;
+    const NamespacesList& cachedNamespacesList() const;
 
     const FieldImpl* findField(const std::string& ref, bool checkRef = true) const;
 
@@ -157,10 +169,11 @@ private:
     const NamespaceImpl* getNsFromPath(const std::string& ref, bool checkRef, std::string& remName) const;
 
     ::xmlNodePtr m_node = nullptr;
+    XmlWrap::Location m_location;
     ProtocolImpl& m_protocol;
 
     PropsMap m_props;
-    PropsMap m_extraAttrs;
+    AttributesMap m_extraAttrs;
     ContentsList m_extraChildren;
     std::string m_name;
     std::string m_description;
@@ -171,6 +184,7 @@ private:
     unsigned m_dslVersion = 0;
     Endian m_endian = Endian_NumOfValues;
     bool m_nonUniqueMsgIdAllowed = false;
+    CachedList<NamespacesList> m_namespacesListCache;
 };
 
 using SchemaImplPtr = std::unique_ptr<SchemaImpl>;
@@ -51,7 +51,7 @@ bool SetFieldImpl::isUnique() const
 {
     unsigned prevIdx = 0;
     bool firstElem = true;
-    for (auto& b : m_state.m_revBits) {
+    for (auto& b : m_state->m_revBits) {
         if (firstElem) {
             prevIdx = b.first;
             firstElem = false;
@@ -129,13 +129,13 @@ bool SetFieldImpl::parseImpl()
 
 std::size_t SetFieldImpl::minLengthImpl() const
 {
-    return m_state.m_length;
+    return m_state->m_length;
 }
 
 std::size_t SetFieldImpl::bitLengthImpl() const
 {
     if (isBitfieldMember()) {
-        return m_state.m_bitLength;
+        return m_state->m_bitLength;
     }
 
     return Base::bitLengthImpl();
@@ -151,7 +151,7 @@ bool SetFieldImpl::isComparableToValueImpl(const std::string& val) const
         }
 
         if ((!bigUnsigned) && (valTmp < 0)) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Cannot compare negative value (" << valTmp << " referenced as " <<
             val << ").";
             return false;
@@ -163,7 +163,7 @@ bool SetFieldImpl::isComparableToValueImpl(const std::string& val) const
     bool ok = false;
     auto valTmp = common::strToIntMax(val, &ok);
     if (ok && (valTmp < 0)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot compare to negative number " << valTmp << ".";        
         return false;
     }
@@ -185,12 +185,12 @@ bool SetFieldImpl::strToNumericImpl(const std::string& ref, std::intmax_t& val,
 
     isBigUnsigned = false;
     if (ref.empty()) {
-        val = static_cast<std::intmax_t>(m_state.m_defaultBitValue);
+        val = static_cast<std::intmax_t>(m_state->m_defaultBitValue);
         return true;
     }
 
-    auto iter = m_state.m_bits.find(ref);
-    if (iter == m_state.m_bits.end()) {
+    auto iter = m_state->m_bits.find(ref);
+    if (iter == m_state->m_bits.end()) {
         return false;
     }
 
@@ -205,12 +205,12 @@ bool SetFieldImpl::strToBoolImpl(const std::string& ref, bool& val) const
     }
 
     if (ref.empty()) {
-        val = m_state.m_defaultBitValue;
+        val = m_state->m_defaultBitValue;
         return true;
     }
 
-    auto iter = m_state.m_bits.find(ref);
-    if (iter == m_state.m_bits.end()) {
+    auto iter = m_state->m_bits.find(ref);
+    if (iter == m_state->m_bits.end()) {
         return false;
     }
 
@@ -220,8 +220,8 @@ bool SetFieldImpl::strToBoolImpl(const std::string& ref, bool& val) const
 
 bool SetFieldImpl::validateBitLengthValueImpl(::xmlNodePtr node, std::size_t bitLength) const
 {
-    assert(0U < m_state.m_length);
-    auto maxBitLength = m_state.m_length * BitsInByte;
+    assert(0U < m_state->m_length);
+    auto maxBitLength = m_state->m_length * BitsInByte;
     if (maxBitLength < bitLength) {
         logError() << XmlWrap::logPrefix(node) <<
                       "Value of property \"" << common::bitLengthStr() << "\" exceeds "
@@ -237,8 +237,8 @@ SetFieldImpl::FieldRefInfo SetFieldImpl::processInnerRefImpl(const std::string&
     assert(!refStr.empty());
 
     FieldRefInfo info;
-    auto iter = m_state.m_bits.find(refStr);
-    if (iter != m_state.m_bits.end()) {
+    auto iter = m_state->m_bits.find(refStr);
+    if (iter != m_state->m_bits.end()) {
         info.m_field = this;
         info.m_valueName = refStr;
         info.m_refType = FieldRefType_InnerValue;
@@ -254,12 +254,12 @@ bool SetFieldImpl::updateEndian()
     }
 
     auto& endianStr = common::getStringProp(props(), common::endianStr());
-    if ((endianStr.empty()) && (m_state.m_endian != Endian_NumOfValues)) {
+    if ((endianStr.empty()) && (m_state->m_endian != Endian_NumOfValues)) {
         return true;
     }
 
-    m_state.m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
-    if (m_state.m_endian == Endian_NumOfValues) {
+    m_state->m_endian = common::parseEndian(endianStr, protocol().currSchema().endian());
+    if (m_state->m_endian == Endian_NumOfValues) {
         reportUnexpectedPropertyValue(common::endianStr(), endianStr);
         return false;
     }
@@ -284,66 +284,66 @@ bool SetFieldImpl::updateType()
         return false;
     }
 
-    if (m_state.m_type == typeVal) {
+    if (m_state->m_type == typeVal) {
         return true;
     }
 
-    if (m_state.m_type != Type::NumOfValues) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_type != Type::NumOfValues) {
+        logError() << XmlWrap::logPrefix(location()) <<
                       "Type cannot be changed after reuse";
         return false;
     }
 
-    m_state.m_type = typeVal;
+    m_state->m_type = typeVal;
     return true;
 }
 
 bool SetFieldImpl::updateLength()
 {
     bool mustHaveLength =
-            (m_state.m_type == Type::NumOfValues) &&
-            (m_state.m_length == 0U) &&
+            (m_state->m_type == Type::NumOfValues) &&
+            (m_state->m_length == 0U) &&
             (!isBitfieldMember());
     if (!validateSinglePropInstance(common::lengthStr(), mustHaveLength)) {
         return false;
     }
 
     std::size_t maxLength = sizeof(std::uint64_t);
-    if (m_state.m_type != Type::NumOfValues) {
-        maxLength = IntFieldImpl::maxTypeLength(m_state.m_type);
+    if (m_state->m_type != Type::NumOfValues) {
+        maxLength = IntFieldImpl::maxTypeLength(m_state->m_type);
     }
 
     auto& lengthStr = common::getStringProp(props(), common::lengthStr());
     do {
         if (lengthStr.empty()) {
-            if ((m_state.m_length == 0U) && (m_state.m_type != Type::NumOfValues)) {
-                m_state.m_length = maxLength;
+            if ((m_state->m_length == 0U) && (m_state->m_type != Type::NumOfValues)) {
+                m_state->m_length = maxLength;
             }
             break;
         }
 
         bool ok = false;
-        auto newLen = static_cast<decltype(m_state.m_length)>(common::strToUintMax(lengthStr, &ok));
+        auto newLen = static_cast<decltype(m_state->m_length)>(common::strToUintMax(lengthStr, &ok));
 
         if ((!ok) || (newLen == 0U) || (maxLength < newLen)) {
             reportUnexpectedPropertyValue(common::lengthStr(), lengthStr);
             return false;
         }
 
-        if (m_state.m_length == newLen) {
+        if (m_state->m_length == newLen) {
             break;
         }
 
-        if (m_state.m_length != 0U) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+        if (m_state->m_length != 0U) {
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Length cannot be changed after reuse";
             return false;
         }
 
-        m_state.m_length = newLen;
+        m_state->m_length = newLen;
     } while (false);
 
-    bool mustHaveBitLength = (isBitfieldMember() && m_state.m_bitLength == 0U && (m_state.m_length == 0U));
+    bool mustHaveBitLength = (isBitfieldMember() && m_state->m_bitLength == 0U && (m_state->m_length == 0U));
     if (!validateSinglePropInstance(common::bitLengthStr(), mustHaveBitLength)) {
         return false;
     }
@@ -351,42 +351,42 @@ bool SetFieldImpl::updateLength()
     auto& bitLengthStr = common::getStringProp(props(), common::bitLengthStr());
     do {
         if (bitLengthStr.empty()) {
-            if (m_state.m_bitLength == 0U) {
-                assert(m_state.m_length != 0U);
-                m_state.m_bitLength = m_state.m_length * 8U;
+            if (m_state->m_bitLength == 0U) {
+                assert(m_state->m_length != 0U);
+                m_state->m_bitLength = m_state->m_length * 8U;
             }
             break;
         }
 
         if (!isBitfieldMember()) {
-            logWarning() << XmlWrap::logPrefix((getNode())) <<
+            logWarning() << XmlWrap::logPrefix(location()) <<
                             "The property \"" << common::bitLengthStr() << "\" is "
                             "applicable only to the members of \"" << common::bitfieldStr() << "\"";
-            assert(m_state.m_length != 0U);
-            m_state.m_bitLength = m_state.m_length * 8U;
+            assert(m_state->m_length != 0U);
+            m_state->m_bitLength = m_state->m_length * 8U;
             break;
         }
 
         bool ok = false;
-        m_state.m_bitLength = static_cast<decltype(m_state.m_bitLength)>(common::strToUintMax(bitLengthStr, &ok));
-        if ((!ok) || (m_state.m_bitLength == 0U)) {
+        m_state->m_bitLength = static_cast<decltype(m_state->m_bitLength)>(common::strToUintMax(bitLengthStr, &ok));
+        if ((!ok) || (m_state->m_bitLength == 0U)) {
             reportUnexpectedPropertyValue(common::bitLengthStr(), bitLengthStr);
             return false;
         }
 
-        if ((m_state.m_length != 0) && ((m_state.m_length * 8U) < m_state.m_bitLength)) {
+        if ((m_state->m_length != 0) && ((m_state->m_length * 8U) < m_state->m_bitLength)) {
             reportUnexpectedPropertyValue(common::bitLengthStr(), bitLengthStr);
             return false;
         }
 
     } while (false);
 
-    if ((m_state.m_length == 0U) && (m_state.m_bitLength != 0U)) {
-        m_state.m_length = ((m_state.m_bitLength - 1U) / 8U) + 1U;
+    if ((m_state->m_length == 0U) && (m_state->m_bitLength != 0U)) {
+        m_state->m_length = ((m_state->m_bitLength - 1U) / 8U) + 1U;
     }
 
-    if (m_state.m_type == Type::NumOfValues) {
-        assert(m_state.m_length != 0U);
+    if (m_state->m_type == Type::NumOfValues) {
+        assert(m_state->m_length != 0U);
 
         static const Type Map[] {
             Type::Uint8,
@@ -402,19 +402,19 @@ bool SetFieldImpl::updateLength()
         static const std::size_t MapSize = std::extent<decltype(Map)>::value;
         static_assert(MapSize == sizeof(std::uint64_t), "Invalid map");
 
-        assert(m_state.m_length <= MapSize);
-        m_state.m_type = Map[m_state.m_length - 1];
+        assert(m_state->m_length <= MapSize);
+        m_state->m_type = Map[m_state->m_length - 1];
     }
 
-    assert(m_state.m_type != Type::NumOfValues);
-    assert(m_state.m_length != 0U);
-    assert(m_state.m_bitLength != 0U);
+    assert(m_state->m_type != Type::NumOfValues);
+    assert(m_state->m_length != 0U);
+    assert(m_state->m_bitLength != 0U);
     return true;
 }
 
 bool SetFieldImpl::updateNonUniqueAllowed()
 {
-    bool wasAllowed = m_state.m_nonUniqueAllowed;
+    bool wasAllowed = m_state->m_nonUniqueAllowed;
     bool newAllowed = false;
     if (!validateAndUpdateBoolPropValue(common::nonUniqueAllowedStr(), newAllowed)) {
         return false;
@@ -431,13 +431,13 @@ bool SetFieldImpl::updateNonUniqueAllowed()
         return false;
     }
 
-    m_state.m_nonUniqueAllowed = newAllowed;
+    m_state->m_nonUniqueAllowed = newAllowed;
     return true;
 }
 
 bool SetFieldImpl::updateValidCheckVersion()
 {
-    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state.m_validCheckVersion);
+    return validateAndUpdateBoolPropValue(common::validCheckVersionStr(), m_state->m_validCheckVersion);
 }
 
 bool SetFieldImpl::updateDefaultValue()
@@ -448,7 +448,7 @@ bool SetFieldImpl::updateDefaultValue()
         return true;
     }
 
-    if (!strToValue(iter->second, m_state.m_defaultBitValue)) {
+    if (!strToValue(iter->second, m_state->m_defaultBitValue)) {
         reportUnexpectedPropertyValue(propName, iter->second);
         return false;
     }
@@ -464,7 +464,7 @@ bool SetFieldImpl::updateReservedValue()
         return true;
     }
 
-    if (!strToValue(iter->second, m_state.m_reservedBitValue)) {
+    if (!strToValue(iter->second, m_state->m_reservedBitValue)) {
         reportUnexpectedPropertyValue(propName, iter->second);
         return false;
     }
@@ -474,7 +474,7 @@ bool SetFieldImpl::updateReservedValue()
 
 bool SetFieldImpl::updateAvailableLengthLimit()
 {
-    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state.m_availableLengthLimit);
+    return validateAndUpdateBoolPropValue(common::availableLengthLimitStr(), m_state->m_availableLengthLimit);
 }
 
 bool SetFieldImpl::updateBits()
@@ -550,8 +550,8 @@ bool SetFieldImpl::updateBits()
             return false;
         }
 
-        auto bitsIter = m_state.m_bits.find(nameIter->second);
-        if (bitsIter != m_state.m_bits.end()) {
+        auto bitsIter = m_state->m_bits.find(nameIter->second);
+        if (bitsIter != m_state->m_bits.end()) {
             logError() << XmlWrap::logPrefix(b) << "Bit with name \"" << nameIter->second <<
                           "\" has already been defined for set \"" << name() << "\".";
             return false;
@@ -567,15 +567,15 @@ bool SetFieldImpl::updateBits()
             return false;
         }
 
-        if (m_state.m_bitLength <= idx) {
+        if (m_state->m_bitLength <= idx) {
             logError() << XmlWrap::logPrefix(b) <<
                           "Index of the bit (" << idx << ") must be less than number of available bits (" <<
-                          m_state.m_bitLength << ").";
+                          m_state->m_bitLength << ").";
             return false;
         }
-        if (!m_state.m_nonUniqueAllowed) {
-            auto revBitsIter = m_state.m_revBits.find(idx);
-            if (revBitsIter != m_state.m_revBits.end()) {
+        if (!m_state->m_nonUniqueAllowed) {
+            auto revBitsIter = m_state->m_revBits.find(idx);
+            if (revBitsIter != m_state->m_revBits.end()) {
                 logError() << XmlWrap::logPrefix(b) <<
                       "Bit \"" << revBitsIter->first << "\" has been already defined "
                       "as \"" << revBitsIter->second << "\".";
@@ -585,8 +585,8 @@ bool SetFieldImpl::updateBits()
 
         BitInfo info;
         info.m_idx = idx;
-        info.m_defaultValue = m_state.m_defaultBitValue;
-        info.m_reservedValue = m_state.m_reservedBitValue;
+        info.m_defaultValue = m_state->m_defaultBitValue;
+        info.m_reservedValue = m_state->m_reservedBitValue;
         info.m_sinceVersion = getSinceVersion();
         info.m_deprecatedSince = getDeprecated();
         do {
@@ -648,21 +648,21 @@ bool SetFieldImpl::updateBits()
 
         // Check consistency with previous definitions
         do {
-            if (!m_state.m_nonUniqueAllowed) {
+            if (!m_state->m_nonUniqueAllowed) {
                 // The bit hasn't been processed earlier
-                assert(m_state.m_revBits.find(idx) == m_state.m_revBits.end());
+                assert(m_state->m_revBits.find(idx) == m_state->m_revBits.end());
                 break;
             }
 
-            auto revIters = m_state.m_revBits.equal_range(idx);
+            auto revIters = m_state->m_revBits.equal_range(idx);
             if (revIters.first == revIters.second) {
                 // The bit hasn't been processed earlier
                 break;
             }
 
             for (auto rIter = revIters.first; rIter != revIters.second; ++rIter) {
-                auto iter = m_state.m_bits.find(rIter->second);
-                assert(iter != m_state.m_bits.end());
+                auto iter = m_state->m_bits.find(rIter->second);
+                assert(iter != m_state->m_bits.end());
 
                 if (iter->second.m_deprecatedSince <= info.m_sinceVersion) {
                     assert(iter->second.m_sinceVersion < info.m_sinceVersion);
@@ -709,8 +709,8 @@ bool SetFieldImpl::updateBits()
             return false;
         }
 
-        m_state.m_bits.emplace(nameIter->second, info);
-        m_state.m_revBits.emplace(idx, nameIter->second);
+        m_state->m_bits.emplace(nameIter->second, info);
+        m_state->m_revBits.emplace(idx, nameIter->second);
     }
 
     return true;
@@ -43,49 +43,49 @@ public:
 
     Type type() const
     {
-        return m_state.m_type;
+        return m_state->m_type;
     }
 
     Endian endian() const
     {
-        return m_state.m_endian;
+        return m_state->m_endian;
     }
 
     bool defaultBitValue() const
     {
-        return m_state.m_defaultBitValue;
+        return m_state->m_defaultBitValue;
     }
 
     bool reservedBitValue() const
     {
-        return m_state.m_reservedBitValue;
+        return m_state->m_reservedBitValue;
     }
 
     const Bits& bits() const
     {
-        return m_state.m_bits;
+        return m_state->m_bits;
     }
 
     const RevBits& revBits() const
     {
-        return m_state.m_revBits;
+        return m_state->m_revBits;
     }
 
     bool isNonUniqueAllowed() const
     {
-        return m_state.m_nonUniqueAllowed;
+        return m_state->m_nonUniqueAllowed;
     }
 
     bool isUnique() const;
 
     bool validCheckVersion() const
     {
-        return m_state.m_validCheckVersion;
+        return m_state->m_validCheckVersion;
     }
 
     bool availableLengthLimit() const
     {
-        return m_state.m_availableLengthLimit;
+        return m_state->m_availableLengthLimit;
     }
 
 protected:
@@ -130,7 +130,7 @@ private:
         bool m_validCheckVersion = false;
         bool m_availableLengthLimit = false;
     };
-    State m_state;
+    CowState<State> m_state;
 };
 
 } // namespace parse
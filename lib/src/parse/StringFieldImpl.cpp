@@ -54,7 +54,7 @@ StringFieldImpl::StringFieldImpl(const StringFieldImpl& other)
     m_state(other.m_state)
 {
     if (other.m_prefixField) {
-        assert(other.m_state.m_extPrefixField == nullptr);
+        assert(other.m_state->m_extPrefixField == nullptr);
         m_prefixField = other.m_prefixField->clone();
     }
 }
@@ -100,7 +100,7 @@ bool StringFieldImpl::reuseImpl(const FieldImpl& other)
     auto& castedOther = static_cast<const StringFieldImpl&>(other);
     m_state = castedOther.m_state;
     if (castedOther.m_prefixField) {
-        assert(m_state.m_extPrefixField == nullptr);
+        assert(m_state->m_extPrefixField == nullptr);
         m_prefixField = castedOther.m_prefixField->clone();
     }
     else {
@@ -121,18 +121,18 @@ bool StringFieldImpl::parseImpl()
 
 bool StringFieldImpl::verifySiblingsImpl(const FieldImpl::FieldsList& fields) const
 {
-    if (m_state.m_detachedPrefixField.empty()) {
+    if (m_state->m_detachedPrefixField.empty()) {
         return true;
     }
 
-    auto* sibling = findSibling(fields, m_state.m_detachedPrefixField);
+    auto* sibling = findSibling(fields, m_state->m_detachedPrefixField);
     if (sibling == nullptr) {
         return false;
     }
 
     auto fieldKind = getNonRefFieldKind(*sibling);
     if ((fieldKind != Kind::Int) && (sibling->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Detached length prefix is expected to be of \"" << common::intStr() << "\" type "
             "or have semanticType=\"length\" property set.";
         return false;
@@ -143,11 +143,11 @@ bool StringFieldImpl::verifySiblingsImpl(const FieldImpl::FieldsList& fields) co
 
 std::size_t StringFieldImpl::minLengthImpl() const
 {
-    if (m_state.m_length != 0U) {
-        return m_state.m_length;
+    if (m_state->m_length != 0U) {
+        return m_state->m_length;
     }
 
-    if (m_state.m_haxZeroSuffix) {
+    if (m_state->m_haxZeroSuffix) {
         return 1U;
     }
 
@@ -160,8 +160,8 @@ std::size_t StringFieldImpl::minLengthImpl() const
 
 std::size_t StringFieldImpl::maxLengthImpl() const
 {
-    if (m_state.m_length != 0U) {
-        return m_state.m_length;
+    if (m_state->m_length != 0U) {
+        return m_state->m_length;
     }
 
     if (hasPrefixField()) {
@@ -189,13 +189,13 @@ bool StringFieldImpl::isComparableToValueImpl(const std::string& val) const
 
     auto* refField = protocol().findField(std::string(val, 1));
     if (refField == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Referenced field (" + val + ") is not defined.";
         return false;
     }
 
     if (refField->kind() != Kind::String) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Referenced field (" + val + ") is not <string>.";        
         return false;
     }
@@ -210,7 +210,7 @@ bool StringFieldImpl::strToStringImpl(const std::string& ref, std::string& val)
     }
 
     if (ref.empty()) {
-        val = m_state.m_defaultValue;
+        val = m_state->m_defaultValue;
         return true;
     }
 
@@ -230,15 +230,15 @@ bool StringFieldImpl::updateDefaultValue()
             break;
         }
 
-        if (!strToValue(iter->second, m_state.m_defaultValue)) {
+        if (!strToValue(iter->second, m_state->m_defaultValue)) {
             reportUnexpectedPropertyValue(propName, iter->second);
             return false;
         }
     } while (false);
 
-    if ((m_state.m_length != 0U) && (m_state.m_length < m_state.m_defaultValue.size())) {
-        logWarning() << XmlWrap::logPrefix(getNode()) <<
-            "The default value (" << m_state.m_defaultValue << ") is too long "
+    if ((m_state->m_length != 0U) && (m_state->m_length < m_state->m_defaultValue.size())) {
+        logWarning() << XmlWrap::logPrefix(location()) <<
+            "The default value (" << m_state->m_defaultValue << ") is too long "
             "for proper serialisation.";
     }
 
@@ -253,7 +253,7 @@ bool StringFieldImpl::updateEncoding()
 
     auto iter = props().find(common::encodingStr());
     if (iter != props().end()) {
-        m_state.m_encoding = iter->second;
+        m_state->m_encoding = iter->second;
     }
 
     return true;
@@ -277,23 +277,23 @@ bool StringFieldImpl::updateLength()
         return false;
     }
 
-    if (m_state.m_length == newVal) {
+    if (m_state->m_length == newVal) {
         return true;
     }
 
     if (hasPrefixField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot force fixed length after reusing string with length prefix.";
         return false;
     }
 
-    if (m_state.m_haxZeroSuffix) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_haxZeroSuffix) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot force fixed length after reusing string with zero suffix.";
         return false;
     }
 
-    m_state.m_length = newVal;
+    m_state->m_length = newVal;
     return true;
 }
 
@@ -308,14 +308,14 @@ bool StringFieldImpl::updatePrefix()
         return true;
     }
 
-    if (m_state.m_length != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_length != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Length prefix field is not applicable to fixed length strings.";
         return false;
     }
 
-    if (m_state.m_haxZeroSuffix) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_haxZeroSuffix) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Length prefix field is not applicable to zero terminated strings.";
         return false;
     }
@@ -341,28 +341,28 @@ bool StringFieldImpl::updateZeroTerm()
         return false;
     }
 
-    if (newVal == m_state.m_haxZeroSuffix) {
+    if (newVal == m_state->m_haxZeroSuffix) {
         return true;
     }
 
     if (!newVal) {
-        m_state.m_haxZeroSuffix = newVal;
+        m_state->m_haxZeroSuffix = newVal;
         return true;
     }
 
-    if (m_state.m_length != 0U) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+    if (m_state->m_length != 0U) {
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot apply zero suffix to fixed length strings.";
         return false;
     }
 
     if (hasPrefixField()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot apply zero suffix to strings having length prefix.";
         return false;
     }
 
-    m_state.m_haxZeroSuffix = newVal;
+    m_state->m_haxZeroSuffix = newVal;
     return true;
 }
 
@@ -388,29 +388,29 @@ bool StringFieldImpl::checkPrefixFromRef()
             return false;
         }
         
-        m_state.m_detachedPrefixField = std::string(str, 1);
-        common::normaliseString(m_state.m_detachedPrefixField);
+        m_state->m_detachedPrefixField = std::string(str, 1);
+        common::normaliseString(m_state->m_detachedPrefixField);
 
-        if (m_state.m_detachedPrefixField.empty()) {
+        if (m_state->m_detachedPrefixField.empty()) {
             reportUnexpectedPropertyValue(common::lengthPrefixStr(), str);
             return false;
         }
 
-        m_state.m_extPrefixField = nullptr;
+        m_state->m_extPrefixField = nullptr;
         m_prefixField.reset();
         return true;
     }
 
     auto* field = protocol().findField(iter->second);
     if (field == nullptr) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "Cannot find field referenced by \"" << common::lengthPrefixStr() <<
             "\" property (" << iter->second << ").";
         return false;
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The field referenced by \"" << common::lengthPrefixStr() <<
             "\" property (" << iter->second << ") must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
@@ -418,8 +418,8 @@ bool StringFieldImpl::checkPrefixFromRef()
     }
 
     m_prefixField.reset();
-    m_state.m_extPrefixField = field;
-    m_state.m_detachedPrefixField.clear();
+    m_state->m_extPrefixField = field;
+    m_state->m_detachedPrefixField.clear();
     assert(hasPrefixField());
     return true;
 }
@@ -459,7 +459,7 @@ bool StringFieldImpl::checkPrefixAsChild()
     }
 
     if (hasInProps) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << common::lengthPrefixStr() << "\" element is expected to define only "
             "single field";
         return false;
@@ -483,23 +483,23 @@ bool StringFieldImpl::checkPrefixAsChild()
     }
 
     if ((field->kind() != Kind::Int) && (field->semanticType() != SemanticType::Length)) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "The \"" << common::lengthPrefixStr() << "\" element must be of type \"" << common::intStr() << 
             "\" or have semanticType=\"length\" property set.";
         return false;
     }    
 
-    m_state.m_extPrefixField = nullptr;
-    m_state.m_detachedPrefixField.clear();
+    m_state->m_extPrefixField = nullptr;
+    m_state->m_detachedPrefixField.clear();
     m_prefixField = std::move(field);
     return true;
 }
 
 const FieldImpl* StringFieldImpl::getPrefixField() const
 {
-    if (m_state.m_extPrefixField != nullptr) {
+    if (m_state->m_extPrefixField != nullptr) {
         assert(!m_prefixField);
-        return m_state.m_extPrefixField;
+        return m_state->m_extPrefixField;
     }
 
     assert(m_prefixField);
@@ -38,28 +38,28 @@ public:
 
     const std::string& defaultValue() const
     {
-        return m_state.m_defaultValue;
+        return m_state->m_defaultValue;
     }
 
     const std::string& encodingStr() const
     {
-        return m_state.m_encoding;
+        return m_state->m_encoding;
     }
 
     std::size_t length() const
     {
-        return m_state.m_length;
+        return m_state->m_length;
     }
 
     bool hasPrefixField() const
     {
-        return (m_state.m_extPrefixField != nullptr) || static_cast<bool>(m_prefixField);
+        return (m_state->m_extPrefixField != nullptr) || static_cast<bool>(m_prefixField);
     }
 
     Field prefixField() const
     {
-        if (m_state.m_extPrefixField != nullptr) {
-            return Field(m_state.m_extPrefixField);
+        if (m_state->m_extPrefixField != nullptr) {
+            return Field(m_state->m_extPrefixField);
         }
 
         return Field(m_prefixField.get());
@@ -67,12 +67,12 @@ public:
 
     const std::string& detachedPrefixFieldName() const
     {
-        return m_state.m_detachedPrefixField;
+        return m_state->m_detachedPrefixField;
     }
 
     bool hasZeroTermSuffix() const
     {
-        return m_state.m_haxZeroSuffix;
+        return m_state->m_haxZeroSuffix;
     }
 
 protected:
@@ -110,7 +110,7 @@ private:
         bool m_haxZeroSuffix = false;
     };
 
-    State m_state;
+    CowState<State> m_state;
     FieldImplPtr m_prefixField;
 };
 
@@ -119,7 +119,7 @@ bool ValueLayerImpl::updateInterfaces()
 
             auto interface = protocol().findInterface(ref);
             if (interface == nullptr) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                     "Unknown interface \"" << ref << "\".";
                 return false;
             }
@@ -133,7 +133,7 @@ bool ValueLayerImpl::updateInterfaces()
     } while (false);
 
     if (m_interfaces.empty()) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "No valid interfaces have been defined.";
         return false;
     }
@@ -163,7 +163,7 @@ bool ValueLayerImpl::updateFieldName()
         assert(interface != nullptr);
         auto fieldIdx = interface->findFieldIdx(fieldName());
         if (fieldIdx == InvalidIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Interface \"" << interface->name() << "\" doesn't contain "
                 "field named \"" << fieldName() << "\"";
             return false;
@@ -175,7 +175,7 @@ bool ValueLayerImpl::updateFieldName()
         }
 
         if (idx != fieldIdx) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                 "Index of field \"" << fieldName() << "\" (" << fieldIdx << ") in \"" <<
                 interface->name() << "\" interface differs from expected (" << idx << ").";
             return false;
@@ -52,6 +52,11 @@ VariantField::Members VariantField::members() const
     return cast(m_pImpl)->membersList();
 }
 
+const VariantField::Members& VariantField::membersView() const
+{
+    return cast(m_pImpl)->cachedMembersList();
+}
+
 std::size_t VariantField::defaultMemberIdx() const
 {
     return cast(m_pImpl)->defaultMemberIdx();
@@ -77,6 +77,11 @@ VariantFieldImpl::Members VariantFieldImpl::membersList() const
     return result;
 }
 
+const VariantFieldImpl::Members& VariantFieldImpl::cachedMembersList() const
+{
+    return m_membersListCache.get([this]() { return membersList(); });
+}
+
 FieldImpl::Kind VariantFieldImpl::kindImpl() const
 {
     return Kind::Variant;
@@ -134,7 +139,7 @@ bool VariantFieldImpl::replaceMembersImpl(FieldsList& members)
                 });
 
         if (iter == m_members.end()) {
-            logError() << XmlWrap::logPrefix(mem->getNode()) <<
+            logError() << XmlWrap::logPrefix(mem->location()) <<
                 "Cannot find reused member with name \"" << mem->name() << "\" to replace.";
             return false;
         }
@@ -226,7 +231,7 @@ bool VariantFieldImpl::updateMembers()
     do {
         auto membersNodes = XmlWrap::getChildren(getNode(), common::membersStr());
         if (1U < membersNodes.size()) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "Only single \"" << common::membersStr() << "\" child element is "
                           "supported for \"" << common::variantStr() << "\".";
             return false;
@@ -234,7 +239,7 @@ bool VariantFieldImpl::updateMembers()
 
         auto memberFieldsTypes = XmlWrap::getChildren(getNode(), variantSupportedTypes());
         if ((0U < membersNodes.size()) && (0U < memberFieldsTypes.size())) {
-            logError() << XmlWrap::logPrefix(getNode()) <<
+            logError() << XmlWrap::logPrefix(location()) <<
                           "The \"" << common::variantStr() << "\" element does not support "
                           "list of stand alone member fields as child elements together with \"" <<
                           common::membersStr() << "\" child element.";
@@ -243,7 +248,7 @@ bool VariantFieldImpl::updateMembers()
 
         if ((0U == membersNodes.size()) && (0U == memberFieldsTypes.size())) {
             if (m_members.empty()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The \"" << common::variantStr() << "\" must contain member fields.";
                 return false;
             }
@@ -255,7 +260,7 @@ bool VariantFieldImpl::updateMembers()
             assert(0U == membersNodes.size());
             auto allChildren = XmlWrap::getChildren(getNode());
             if (allChildren.size() != memberFieldsTypes.size()) {
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "The member types of \"" << common::variantStr() <<
                               "\" must be defined inside \"<" << common::membersStr() << ">\" child element "
                               "when there are other property describing children.";
@@ -285,7 +290,7 @@ bool VariantFieldImpl::updateMembers()
                 static constexpr bool Should_not_happen = false;
                 static_cast<void>(Should_not_happen);
                 assert(Should_not_happen);
-                logError() << XmlWrap::logPrefix(getNode()) <<
+                logError() << XmlWrap::logPrefix(location()) <<
                               "Internal error, failed to create objects for member fields.";
                 return false;
             }
@@ -317,7 +322,7 @@ bool VariantFieldImpl::updateMembers()
             });
 
     if (!hasSameVer) {
-        logError() << XmlWrap::logPrefix(getNode()) <<
+        logError() << XmlWrap::logPrefix(location()) <<
             "There must be at least one member with the same version as the parent variant.";
         return false;
     }
@@ -351,8 +356,8 @@ bool VariantFieldImpl::updateDefaultMember()
             return false;
         }
 
-        m_state.m_defaultIdx = 
-            static_cast<decltype(m_state.m_defaultIdx)>(
+        m_state->m_defaultIdx = 
+            static_cast<decltype(m_state->m_defaultIdx)>(
                 std::distance(m_members.begin(), iter));
 
         return true;
@@ -378,7 +383,7 @@ bool VariantFieldImpl::updateDefaultMember()
     } while (false);
 
     if (val < 0) {
-        m_state.m_defaultIdx = std::numeric_limits<std::size_t>::max();
+        m_state->m_defaultIdx = std::numeric_limits<std::size_t>::max();
         return true;
     }
 
@@ -387,13 +392,13 @@ bool VariantFieldImpl::updateDefaultMember()
         return false;
     }
 
-    m_state.m_defaultIdx = static_cast<std::size_t>(val);
+    m_state->m_defaultIdx = static_cast<std::size_t>(val);
     return true;
 }
     
 bool VariantFieldImpl::updateIdxHidden()
 {
-    return validateAndUpdateBoolPropValue(common::displayIdxReadOnlyHiddenStr(), m_state.m_idxHidden);
+    return validateAndUpdateBoolPropValue(common::displayIdxReadOnlyHiddenStr(), m_state->m_idxHidden);
 }
 
 } // namespace parse
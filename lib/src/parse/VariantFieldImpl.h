@@ -19,6 +19,7 @@
 
 #include "commsdsl/parse/VariantField.h"
 #include "FieldImpl.h"
+#include "CachedList.h"
 
 namespace commsdsl
 {
@@ -35,15 +36,16 @@ public:
     using Members = VariantField::Members;
 
     Members membersList() const;
+    const Members& cachedMembersList() const;
 
     std::size_t defaultMemberIdx() const
     {
-        return m_state.m_defaultIdx;
+        return m_state->m_defaultIdx;
     }
 
     bool displayIdxReadOnlyHidden() const
     {
-        return m_state.m_idxHidden;
+        return m_state->m_idxHidden;
     }
 
 protected:
@@ -76,8 +78,9 @@ private:
         bool m_idxHidden = false;
     };
 
-    ReusableState m_state;
+    CowState<ReusableState> m_state;
     FieldsList m_members;
+    CachedList<Members> m_membersListCache;
 };
 
 } // namespace parse
@@ -16,6 +16,7 @@
 #include "XmlWrap.h"
 
 #include <cassert>
+#include <cstring>
 #include <algorithm>
 
 #include "ProtocolImpl.h"
@@ -32,18 +33,73 @@ const XmlWrap::NamesList& XmlWrap::emptyNamesList()
     return List;
 }
 
+namespace
+{
+
+const char* const WhiteSpaces = " \r\n\t";
+
+bool isWhiteSpace(char ch)
+{
+    return std::strchr(WhiteSpaces, ch) != nullptr;
+}
+
+std::string trimmedString(const char* str)
+{
+    if (str == nullptr) {
+        return std::string();
+    }
+
+    auto* begin = str;
+    while ((*begin != '\0') && isWhiteSpace(*begin)) {
+        ++begin;
+    }
+
+    auto* end = begin + std::strlen(begin);
+    while ((begin < end) && isWhiteSpace(*(end - 1))) {
+        --end;
+    }
+
+    return std::string(begin, end);
+}
+
+const char* nodeName(::xmlNodePtr node)
+{
+    return reinterpret_cast<const char*>(node->name);
+}
+
+bool nameInList(const char* name, const XmlWrap::NamesList& names)
+{
+    return std::any_of(
+        names.begin(), names.end(),
+        [name](const std::string& n)
+        {
+            return n == name;
+        });
+}
+
+} // namespace
+
 XmlWrap::PropsMap XmlWrap::parseNodeProps(::xmlNodePtr node)
 {
     assert(node != nullptr);
     PropsMap map;
+    std::size_t count = 0U;
+    for (auto* prop = node->properties; prop != nullptr; prop = prop->next) {
+        ++count;
+    }
+
+    map.reserve(count);
     auto* prop = node->properties;
     while (prop != nullptr) {
-        StringPtr valuePtr(::xmlNodeListGetString(node->doc, prop->children, 1));
-        auto iter = map.insert(
-            std::make_pair(
-                reinterpret_cast<const char*>(prop->name),
-                reinterpret_cast<const char*>(valuePtr.get())));
-        common::removeHeadingTrailingWhitespaces(iter->second);
+        auto* child = prop->children;
+        if ((child != nullptr) && (child->type == XML_TEXT_NODE) && (child->next == nullptr)) {
+            // Plain text value, no entities to resolve, avoid extra allocation
+            map.emplace(nodeName(reinterpret_cast<::xmlNodePtr>(prop)), trimmedString(reinterpret_cast<const char*>(child->content)));
+        }
+        else {
+            StringPtr valuePtr(::xmlNodeListGetString(node->doc, child, 1));
+            map.emplace(nodeName(reinterpret_cast<::xmlNodePtr>(prop)), trimmedString(reinterpret_cast<const char*>(valuePtr.get())));
+        }
         prop = prop->next;
     }
 
@@ -74,18 +130,12 @@ XmlWrap::NodesList XmlWrap::getChildren(::xmlNodePtr node, const NamesList& name
                 break;
             }
 
-            if (skipValueAttr) {
-                auto props = parseNodeProps(cur);
-                static const std::string ValueAttr("value");
-                if (props.find(ValueAttr) != props.end()) {
-                    // Skip one with the value attribute
-                    break;
-                }            
+            if (skipValueAttr && (::xmlHasProp(cur, reinterpret_cast<const ::xmlChar*>("value")) != nullptr)) {
+                // Skip one with the value attribute
+                break;
             }
 
-            std::string elemName(reinterpret_cast<const char*>(cur->name));
-            auto iter = std::find(names.begin(), names.end(), elemName);
-            if (iter == names.end()) {
+            if (!nameInList(nodeName(cur), names)) {
                 break;
             }
 
@@ -126,13 +176,10 @@ bool XmlWrap::parseNodeValue(
     std::string& value,
     bool mustHaveValue)
 {
-    auto props = parseNodeProps(node);
-    static const std::string ValueAttr("value");
-    auto valIter = props.find(ValueAttr);
     std::string valueTmp;
-    if (valIter != props.end()) {
-        valueTmp = valIter->second;
-        common::removeHeadingTrailingWhitespaces(valueTmp);
+    StringPtr valuePtr(::xmlGetProp(node, reinterpret_cast<const ::xmlChar*>("value")));
+    if (valuePtr) {
+        valueTmp = trimmedString(reinterpret_cast<const char*>(valuePtr.get()));
     }
 
     auto text = getText(node);
@@ -174,9 +221,8 @@ bool XmlWrap::parseChildrenAsProps(
 {
     auto children = getChildren(node);
     for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter == names.end()) {
+        auto* cName = nodeName(c);
+        if (!nameInList(cName, names)) {
             continue;
         }
 
@@ -214,9 +260,7 @@ XmlWrap::NodesList XmlWrap::getUnknownChildren(::xmlNodePtr node, const XmlWrap:
     NodesList result;
     auto children = getChildren(node);
     for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter == names.end()) {
+        if (!nameInList(nodeName(c), names)) {
             result.push_back(c);
         }
     }
@@ -255,7 +299,32 @@ std::string XmlWrap::logPrefix(::xmlNodePtr node)
     assert(node != nullptr);
     assert(node->doc != nullptr);
     assert(node->doc->URL != nullptr);
-    return std::string(reinterpret_cast<const char*>(node->doc->URL)) + ":" + std::to_string(node->line) + ": ";
+    return std::string(reinterpret_cast<const char*>(node->doc->URL)) + ":" + std::to_string(::xmlGetLineNo(node)) + ": ";
+}
+
+XmlWrap::Location XmlWrap::location(::xmlNodePtr node)
+{
+    Location loc;
+    if (node == nullptr) {
+        return loc;
+    }
+
+    assert(node->doc != nullptr);
+    assert(node->doc->_private != nullptr);
+    loc.m_docInfo = static_cast<const DocInfo*>(node->doc->_private);
+    loc.m_line = ::xmlGetLineNo(node);
+    return loc;
+}
+
+std::string XmlWrap::locationStr(const Location& loc)
+{
+    assert(loc.m_docInfo != nullptr);
+    return loc.m_docInfo->m_url + ":" + std::to_string(loc.m_line);
+}
+
+std::string XmlWrap::logPrefix(const Location& loc)
+{
+    return locationStr(loc) + ": ";
 }
 
 bool XmlWrap::validateSinglePropInstance(
@@ -295,12 +364,8 @@ bool XmlWrap::validateNoPropInstance(::xmlNodePtr node, const XmlWrap::PropsMap&
 
 bool XmlWrap::hasAnyChild(::xmlNodePtr node, const XmlWrap::NamesList& names)
 {
-    ContentsList result;
-    auto children = getChildren(node);
-    for (auto* c : children) {
-        std::string cName(reinterpret_cast<const char*>(c->name));
-        auto iter = std::find(names.begin(), names.end(), cName);
-        if (iter != names.end()) {
+    for (auto* cur = node->children; cur != nullptr; cur = cur->next) {
+        if ((cur->type == XML_ELEMENT_NODE) && (nameInList(nodeName(cur), names))) {
             return true;
         }
     }
@@ -445,9 +510,14 @@ bool XmlWrap::getAndCheckVersions(
     return getAndCheckVersions(node, name, props, sinceVersion, deprecatedSince, protocol);
 }
 
-XmlWrap::PropsMap XmlWrap::getExtraAttributes(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
+XmlWrap::AttributesMap XmlWrap::getExtraAttributes(::xmlNodePtr node, const XmlWrap::NamesList& names, ProtocolImpl& protocol)
 {
-    PropsMap attrs = XmlWrap::getUnknownProps(node, names);
+    auto unknownProps = XmlWrap::getUnknownProps(node, names);
+    AttributesMap attrs;
+    for (auto& p : unknownProps) {
+        attrs.insert(attrs.end(), std::move(p));
+    }
+
     auto& expectedPrefixes = protocol.extraElementPrefixes();
     for (auto& a : attrs) {
         bool expected =
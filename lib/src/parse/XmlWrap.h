@@ -35,7 +35,8 @@ namespace parse
 class ProtocolImpl;
 struct XmlWrap
 {
-    using PropsMap = std::multimap<std::string, std::string>;
+    using PropsMap = common::PropsMap;
+    using AttributesMap = common::AttributesMap;
     struct CharFree
     {
         void operator()(::xmlChar* p) const
@@ -52,6 +53,21 @@ struct XmlWrap
         }
     };
 
+    // Information about the schema file, outlives its xml document.
+    struct DocInfo
+    {
+        std::string m_url;
+        bool m_released = false;
+    };
+
+    // Location of the element in the schema file, remains valid
+    // after the xml document is released.
+    struct Location
+    {
+        const DocInfo* m_docInfo = nullptr;
+        long m_line = 0;
+    };
+
     using StringPtr = std::unique_ptr<::xmlChar, CharFree>;
     using BufferPtr = std::unique_ptr<::xmlBuffer, BufferFree>;
     using NamesList = std::vector<std::string>;
@@ -81,6 +97,9 @@ struct XmlWrap
     static std::string getElementContent(::xmlNodePtr node);
     static ContentsList getUnknownChildrenContents(::xmlNodePtr node, const NamesList& names);
     static std::string logPrefix(::xmlNodePtr node);
+    static Location location(::xmlNodePtr node);
+    static std::string locationStr(const Location& loc);
+    static std::string logPrefix(const Location& loc);
     static bool validateSinglePropInstance(
         ::xmlNodePtr node,
         const PropsMap& props,
@@ -126,7 +145,7 @@ struct XmlWrap
         unsigned& deprecatedSince,
         ProtocolImpl& protocol);
 
-    static PropsMap getExtraAttributes(
+    static AttributesMap getExtraAttributes(
         ::xmlNodePtr node,
         const XmlWrap::NamesList& names,
         ProtocolImpl& protocol);
@@ -23,6 +23,8 @@
 #include "commsdsl/parse/Endian.h"
 #include "commsdsl/parse/Units.h"
 
+#include "FlatPropsMap.h"
+
 namespace commsdsl
 {
 
@@ -32,7 +34,8 @@ namespace parse
 namespace common
 {
 
-using PropsMap = std::multimap<std::string, std::string>;
+using PropsMap = FlatPropsMap;
+using AttributesMap = std::multimap<std::string, std::string>;
 
 const std::string& emptyString();
 const std::string& nameStr();
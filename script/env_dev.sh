@@ -13,4 +13,4 @@ cd ${BUILD_DIR}
 
 cmake .. -DCMAKE_INSTALL_PREFIX=install -DCMAKE_BUILD_TYPE=Debug -DCOMMSDSL_BUILD_UNIT_TESTS=ON -DCOMMSDSL_TEST_BUILD_DOC=ON \
     -DCOMMSDSL_BUILD_COMMSDSL2TEST=ON -DCOMMSDSL_BUILD_COMMSDSL2TOOLS_QT=ON -DCOMMSDSL_BUILD_COMMSDSL2SWIG=ON \
-    -DCOMMSDSL_BUILD_COMMSDSL2EMSCRIPTEN=ON "$@"
+    -DCOMMSDSL_BUILD_COMMSDSL2EMSCRIPTEN=ON -DCOMMSDSL_BUILD_COMMSDSL2FLAT=ON "$@"